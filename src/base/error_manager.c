@@ -92,6 +92,7 @@
 #endif /* !WINDOWS */
 
 #include <mutex>
+#include <new>
 
 /*
  * Definition of error message structure. One structure is defined for each
@@ -311,6 +312,9 @@ static SIGNAL_HANDLER_FUNCTION saved_Sig_handler;
 
 /* Other supporting global variables */
 static bool er_Logfile_opened = false;
+
+/* errors detached from their threads are not logged by error context */
+static const bool er_Detached_error_logging = false;
 static bool er_Hasalready_initiated = false;
 static bool er_Has_sticky_init = false;
 static bool er_Isa_null_device = false;
@@ -2331,6 +2335,73 @@ er_stack_clearall (void)
     }
 }
 
+/*
+ * er_detach_error - Move the last error of this thread out of its error context
+ *   return: detached error or NULL if no error was set
+ *
+ * Note: Error id, severity, location, message and arguments are moved; the error of this thread is cleared.
+ *       The detached error is attached to another thread by er_attach_error, e.g. by the thread waiting for the
+ *       results of a worker, or freed by er_free_detached_error.
+ */
+void *
+er_detach_error (void)
+{
+  // *INDENT-OFF*
+  er_message &crt_error = context::get_thread_local_error ();
+  // *INDENT-ON*
+  er_message *detached_error;
+
+  if (crt_error.err_id == NO_ERROR)
+    {
+      return NULL;
+    }
+
+  detached_error = new (std::nothrow) er_message (er_Detached_error_logging);
+  if (detached_error == NULL)
+    {
+      return NULL;
+    }
+
+  /* message area and arguments are allocated from global heap */
+  detached_error->swap (crt_error);
+  return detached_error;
+}
+
+/*
+ * er_attach_error - Set a detached error as the last error of this thread
+ *   return: error id of detached error
+ *   detached_error(in): error returned by er_detach_error; it is freed
+ */
+int
+er_attach_error (void *detached_error)
+{
+  // *INDENT-OFF*
+  er_message &crt_error = context::get_thread_local_error ();
+  // *INDENT-ON*
+  er_message *error_p = (er_message *) detached_error;
+
+  if (error_p == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  error_p->swap (crt_error);
+  delete error_p;
+
+  return crt_error.err_id;
+}
+
+/*
+ * er_free_detached_error - Free a detached error that is not attached to any thread
+ *   return: none
+ *   detached_error(in): error returned by er_detach_error
+ */
+void
+er_free_detached_error (void *detached_error)
+{
+  delete (er_message *) detached_error;
+}
+
 
 /*
  * er_study_spec -
@@ -215,6 +215,9 @@ extern "C"
   extern void er_stack_pop_and_keep_error (void);
   extern void er_restore_last_error (void);
   extern void er_stack_clearall (void);
+  extern void *er_detach_error (void);
+  extern int er_attach_error (void *detached_error);
+  extern void er_free_detached_error (void *detached_error);
   extern void *db_default_malloc_handler (void *arg, const char *filename, int line_no, size_t size);
   extern int er_event_restart (void);
   extern void er_clearid (void);
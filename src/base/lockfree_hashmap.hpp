@@ -163,7 +163,7 @@ namespace lockfree
       template <typename D>
       void dump_stat (std::ostream &os, const char *name, const ct_stat_type &ct_stat) const;
 
-      static constexpr std::ptrdiff_t free_node_offset_of_data (free_node_type fn)
+      static std::ptrdiff_t free_node_offset_of_data (free_node_type &fn)
       {
 	return ((char *) (&fn.get_data ().m_entry)) - ((char *) (&fn));
       }
@@ -544,7 +544,8 @@ namespace lockfree
   hashmap<Key, T>::to_free_node (T *p)
   {
     // not nice, but necessary until we fully refactor lockfree hashmap
-    const std::ptrdiff_t off = free_node_offset_of_data (free_node_type ());
+    free_node_type fn;    // T may be not copyable
+    const std::ptrdiff_t off = free_node_offset_of_data (fn);
     char *cp = (char *) p;
     cp -= off;
     return (free_node_type *) cp;
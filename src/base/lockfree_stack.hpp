@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+//
+// lockfree_stack.hpp - lock-free stack of values kept in nodes claimed from a freelist
+//
+//    The freelist may be shared by many stacks (e.g. one stack for each cache entry). Pushed values are copied into a
+//    node claimed from the freelist; popped nodes are retired back to freelist.
+//
+//    The ABA problem of pop is avoided by lock-free transactions: pop runs in a transaction, and a node retired by a
+//    concurrent pop cannot be reclaimed (and pushed again) until the transaction is ended.
+//
+
+#ifndef _LOCKFREE_STACK_HPP_
+#define _LOCKFREE_STACK_HPP_
+
+#include "lockfree_freelist.hpp"
+#include "lockfree_transaction_descriptor.hpp"
+#include "lockfree_transaction_table.hpp"
+
+#include <atomic>
+#include <cassert>
+
+namespace lockfree
+{
+  template <class T>
+  class stack
+  {
+    public:
+      struct node_data;
+      using freelist_type = freelist<node_data>;
+      using node_type = typename freelist_type::free_node;
+
+      struct node_data
+      {
+	T m_value;
+	node_type *m_stack_next;
+
+	node_data ()
+	  : m_value {}
+	  , m_stack_next (NULL)
+	{
+	}
+
+	void on_reclaim ()
+	{
+	  m_value = T {};
+	  m_stack_next = NULL;
+	}
+      };
+
+      stack ();
+      ~stack ();
+
+      void push (freelist_type &fl, tran::index tran_index, const T &value);
+      bool pop (freelist_type &fl, tran::index tran_index, T &value);     // false if stack is empty
+
+      bool is_empty () const;     // use it for early outs, don't rely on the answer
+
+    private:
+      std::atomic<node_type *> m_top;
+  };
+} // namespace lockfree
+
+//
+// implementation
+//
+
+namespace lockfree
+{
+  template <class T>
+  stack<T>::stack ()
+    : m_top { NULL }
+  {
+  }
+
+  template <class T>
+  stack<T>::~stack ()
+  {
+    // values must be popped before destroying the stack
+    assert (m_top == NULL);
+  }
+
+  template <class T>
+  void
+  stack<T>::push (freelist_type &fl, tran::index tran_index, const T &value)
+  {
+    // note: claim starts a transaction
+    node_type *node = fl.claim (tran_index);
+    node_data &data = node->get_data ();
+    node_type *top;
+
+    data.m_value = value;
+    do
+      {
+	top = m_top;
+	data.m_stack_next = top;
+      }
+    while (!m_top.compare_exchange_weak (top, node));
+
+    fl.get_transaction_table ().end_tran (tran_index);
+  }
+
+  template <class T>
+  bool
+  stack<T>::pop (freelist_type &fl, tran::index tran_index, T &value)
+  {
+    tran::descriptor &tdes = fl.get_transaction_table ().get_descriptor (tran_index);
+    node_type *top;
+    node_type *next;
+
+    if (m_top == NULL)
+      {
+	return false;
+      }
+
+    tdes.start_tran ();
+    do
+      {
+	top = m_top;
+	if (top == NULL)
+	  {
+	    tdes.end_tran ();
+	    return false;
+	  }
+	// top cannot be reclaimed while transaction is started, so it is safe to read next
+	next = top->get_data ().m_stack_next;
+      }
+    while (!m_top.compare_exchange_weak (top, next));
+
+    value = top->get_data ().m_value;
+    top->get_data ().m_stack_next = NULL;
+    fl.retire (tdes, *top);
+    tdes.end_tran ();
+
+    return true;
+  }
+
+  template <class T>
+  bool
+  stack<T>::is_empty () const
+  {
+    return m_top == NULL;
+  }
+} // namespace lockfree
+
+#endif // !_LOCKFREE_STACK_HPP_
@@ -80,6 +80,7 @@
 #include "heap_file.h"
 #include "vacuum.h"
 #include "xasl_cache.h"
+#include "list_file.h"
 #include "load_worker_manager.hpp"
 
 #if defined (SERVER_MODE)
@@ -113,6 +114,11 @@ static int rv;
 
 #define PERFMON_VALUES_MEMSIZE (pstat_Global.n_stat_values * sizeof (UINT64))
 
+/* upper bounds, in microseconds, of commit wait time histogram buckets; last bucket is not bounded */
+static const UINT64 perfmon_Log_commit_wait_bounds[PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT - 1] = {
+  50, 100, 250, 500, 1000, 2500, 5000, 10000, 50000
+};
+
 static int f_load_Num_data_page_fix_ext (void);
 static int f_load_Num_data_page_promote_ext (void);
 static int f_load_Num_data_page_promote_time_ext (void);
@@ -123,6 +129,7 @@ static int f_load_Time_data_page_fix_acquire_time (void);
 static int f_load_Num_mvcc_snapshot_ext (void);
 static int f_load_Time_obj_lock_acquire_time (void);
 static int f_load_Num_dwb_flushed_block_volumes (void);
+static int f_load_Time_log_commit_wait_histogram (void);
 static int f_load_Time_get_snapshot_acquire_time (void);
 static int f_load_Count_get_snapshot_retry (void);
 static int f_load_Time_tran_complete_time (void);
@@ -143,6 +150,7 @@ static void f_dump_in_file_Time_obj_lock_acquire_time (FILE *, const UINT64 * st
 static void f_dump_in_file_thread_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_thread_daemon_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_dwb_flushed_block_volumes (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_Time_log_commit_wait_histogram (FILE *, const UINT64 * stat_vals);
 
 static void f_dump_in_buffer_Num_data_page_fix_ext (char **, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_data_page_promote_ext (char **, const UINT64 * stat_vals, int *remaining_size);
@@ -156,6 +164,8 @@ static void f_dump_in_buffer_Time_obj_lock_acquire_time (char **, const UINT64 *
 static void f_dump_in_buffer_thread_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_thread_daemon_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_Time_log_commit_wait_histogram (char **s, const UINT64 * stat_vals,
+							     int *remaining_size);
 
 static void perfmon_stat_dump_in_file_fix_page_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_promote_page_array_stat (FILE *, const UINT64 * stats_ptr);
@@ -180,6 +190,10 @@ static void perfmon_stat_dump_in_buffer_page_fix_time_array_stat (const UINT64 *
 static void perfmon_stat_dump_in_buffer_snapshot_array_stat (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_thread_stats (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_thread_daemon_stats (const UINT64 * stats_ptr, char **s, int *remaining_size);
+static void perfmon_stat_dump_in_buffer_commit_wait_histogram_stat (const UINT64 * stats_ptr, char **s,
+								    int *remaining_size);
+static void perfmon_stat_dump_in_file_commit_wait_histogram_stat (FILE * stream, const UINT64 * stats_ptr);
+static void perfmon_stat_commit_wait_bucket_name (char *buffer, int bucket);
 
 static void perfmon_print_timer_to_file (FILE * stream, int stat_index, UINT64 * stats_ptr);
 static void perfmon_print_timer_to_buffer (char **s, int stat_index, UINT64 * stats_ptr, int *remained_size);
@@ -223,6 +237,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* Execution statistics for the log manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_FETCHES, "Num_log_page_fetches"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_IOREADS, "Num_log_page_ioreads"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_READ_AHEAD_LOADS, "Num_log_read_ahead_loads"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_READ_AHEAD_HITS, "Num_log_read_ahead_hits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_IOWRITES, "Num_log_page_iowrites"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_APPENDRECS, "Num_log_append_records"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_ARCHIVES, "Num_log_archives"),
@@ -231,6 +247,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_WALS, "Num_log_wals"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REPLACEMENTS_IOWRITES, "Num_log_page_iowrites_for_replacement"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REPLACEMENTS, "Num_log_page_replacements"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_COMMIT_WAIT, "log_commit_wait"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_GROUP_COMMIT_FLUSH, "log_group_commit_flush"),
 
   /* Execution statistics for the lock manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_ACQUIRED_ON_PAGES, "Num_page_locks_acquired"),
@@ -244,6 +262,11 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* TODO: Count and timer */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_WAITED_ON_OBJECTS, "Num_object_locks_waits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_WAITED_TIME_ON_OBJECTS, "Num_object_locks_time_waited_usec"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_DEADLOCK_WFG_RESOURCES, "Num_deadlock_wfg_resources_explored"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_DEADLOCK_CYCLES, "Num_deadlock_cycles"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_DEADLOCK_CYCLE_TRANS, "Num_deadlock_cycle_transactions"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_DEADLOCK_VICTIMS, "Num_deadlock_victims"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LK_DEADLOCK_DETECT, "lock_deadlock_detect"),
 
   /* Execution statistics for transactions */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TRAN_NUM_COMMITS, "Num_tran_commits"),
@@ -268,6 +291,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_SPLITS, "Num_btree_splits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_MERGES, "Num_btree_merges"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_GET_STATS, "Num_btree_get_stats"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_INSERTS_SAME_PAGE_HOLD, "Num_btree_inserts_same_page_hold"),
 
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_ONLINE_LOAD, "btree_online_load"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_BT_ONLINE_INSERT_TASK, "btree_online_insert_task"),
@@ -323,13 +347,31 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_FULL, "Num_plan_cache_full"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_DELETE, "Num_plan_cache_delete"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_INVALID_XASL_ID, "Num_plan_cache_invalid_xasl_id"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_WARM_LOAD, "Num_plan_cache_warm_load"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_WARM_REJECT, "Num_plan_cache_warm_reject"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_WARM_HIT, "Num_plan_cache_warm_hit"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PC_NUM_CACHE_ENTRIES, "Num_plan_cache_entries"),
+  /* Execution statistics for query result cache */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_LOOKUP, "Num_query_cache_lookup"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_HIT, "Num_query_cache_hit"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_MISS, "Num_query_cache_miss"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_ADD, "Num_query_cache_add"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_EVICT, "Num_query_cache_evict"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_INVALIDATE, "Num_query_cache_invalidate"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QC_NUM_MEMORY_PAGE_READS, "Num_query_cache_memory_page_reads"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QC_NUM_CACHE_ENTRIES, "Num_query_cache_entries"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QC_NUM_CACHE_PAGES, "Num_query_cache_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QC_NUM_MEMORY_PAGES, "Num_query_cache_memory_pages"),
 
   /* Vacuum process log section. */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_VACUUMED_LOG_PAGES, "Num_vacuum_log_pages_vacuumed"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES, "Num_vacuum_log_pages_to_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES, "Num_vacuum_prefetch_requests_log_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES, "Num_vacuum_prefetch_hits_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_ARCHIVE_LOG_PAGES, "Num_vacuum_archive_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PROCESSED_LOG_RECORDS, "Num_vacuum_log_records_processed"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_PENDING_BLOCKS, "Num_vacuum_blocks_pending"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_OLDEST_BLOCK_AGE_LOG_PAGES, "Num_vacuum_oldest_block_age_log_pages"),
 
   /* Track heap modify counters. */
   /* Make a complex entry for heap stats */
@@ -432,6 +474,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_VAC_JOB, "vacuum_job"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_VAC_WORKER_PROCESS_LOG, "vacuum_worker_process_log"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_VAC_WORKER_EXECUTE, "vacuum_worker_execute"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_VAC_HEAP, "vacuum_heap"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_VAC_BTREE, "vacuum_btree"),
 
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_TIME_COUNTERS, "Time_get_snapshot_acquire_time"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS, "Count_get_snapshot_retry"),
@@ -540,6 +584,15 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_PRV_GET_BIG, "Num_lfcq_prv_get_big"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_SHR_GET_CALLS, "Num_lfcq_shr_get_total_calls"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_SHR_GET_EMPTY, "Num_lfcq_shr_get_empty"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_LFCQ_LRU_SHR_GET_OTHER_NODE, "Num_lfcq_shr_get_other_node"),
+  /* scan rings of threads doing sequential access */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_SCAN_RING_ADD, "Num_scan_ring_add"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_SCAN_RING_REUSE, "Num_scan_ring_reuse"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_SCAN_RING_REUSE_FAIL, "Num_scan_ring_reuse_fail"),
+  /* read-ahead of page chains (heap pages, b-tree leaves) */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_REQUESTS, "Num_read_ahead_requests"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_DROPPED, "Num_read_ahead_dropped"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_PAGE_LOADS, "Num_read_ahead_page_loads"),
 
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_DWB_FLUSH_BLOCK_TIME_COUNTERS, "DWB_flush_block"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_DWB_FILE_SYNC_HELPER_TIME_COUNTERS, "DWB_file_sync_helper"),
@@ -601,7 +654,11 @@ PSTAT_METADATA pstat_Metadata[] = {
 			       &f_dump_in_buffer_Num_dwb_flushed_block_volumes,
 			       &f_load_Num_dwb_flushed_block_volumes),
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOAD_THREAD_STATS, "Thread_loaddb_stats_counters_timers",
-			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats)
+			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOG_COMMIT_WAIT_TIME_HISTOGRAM, "Time_log_commit_wait_histogram",
+			       &f_dump_in_file_Time_log_commit_wait_histogram,
+			       &f_dump_in_buffer_Time_log_commit_wait_histogram,
+			       &f_load_Time_log_commit_wait_histogram)
 };
 
 STATIC_INLINE void perfmon_add_stat_at_offset (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, const int offset,
@@ -1296,6 +1353,28 @@ perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes)
     }
   perfmon_add_stat_at_offset (thread_p, PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES, offset, 1);
 }
+
+/*
+ *   perfmon_log_commit_wait - register the time a commit waited for its log to be flushed
+ *   return: none
+ *   wait_usec(in): wait time in microseconds
+ */
+void
+perfmon_log_commit_wait (THREAD_ENTRY * thread_p, UINT64 wait_usec)
+{
+  int offset;
+
+  perfmon_time_stat (thread_p, PSTAT_LOG_COMMIT_WAIT, wait_usec);
+
+  for (offset = 0; offset < PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT - 1; offset++)
+    {
+      if (wait_usec <= perfmon_Log_commit_wait_bounds[offset])
+	{
+	  break;
+	}
+    }
+  perfmon_add_stat_at_offset (thread_p, PSTAT_LOG_COMMIT_WAIT_TIME_HISTOGRAM, offset, 1);
+}
 #endif /* SERVER_MODE || SA_MODE */
 
 int
@@ -2904,6 +2983,95 @@ perfmon_stat_dump_in_file_flushed_block_volumes_array_stat (FILE * stream, const
     }
 }
 
+/*
+ * perfmon_stat_commit_wait_bucket_name () - get the name of a commit wait time histogram bucket
+ *
+ * buffer(out): bucket name
+ * bucket(in): bucket index
+ */
+static void
+perfmon_stat_commit_wait_bucket_name (char *buffer, int bucket)
+{
+  if (bucket < PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT - 1)
+    {
+      sprintf (buffer, "<= %llu usec", (long long unsigned int) perfmon_Log_commit_wait_bounds[bucket]);
+    }
+  else
+    {
+      sprintf (buffer, "> %llu usec", (long long unsigned int) perfmon_Log_commit_wait_bounds[bucket - 1]);
+    }
+}
+
+/*
+ * perfmon_stat_dump_in_buffer_commit_wait_histogram_stat () -
+ *
+ * stats_ptr(in): start of array values
+ * s(in/out): output string (NULL if not used)
+ * remaining_size(in/out): remaining size in string s (NULL if not used)
+ *
+ */
+static void
+perfmon_stat_dump_in_buffer_commit_wait_histogram_stat (const UINT64 * stats_ptr, char **s, int *remaining_size)
+{
+  int bucket;
+  UINT64 counter = 0;
+  int ret;
+  char buffer[32];
+
+  assert (remaining_size != NULL);
+  assert (s != NULL);
+
+  if (*s != NULL)
+    {
+      for (bucket = 0; bucket < PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT; bucket++)
+	{
+	  counter = stats_ptr[bucket];
+	  if (counter == 0)
+	    {
+	      continue;
+	    }
+
+	  perfmon_stat_commit_wait_bucket_name (buffer, bucket);
+	  ret = snprintf (*s, *remaining_size, "%-18s = %16llu\n", buffer, (long long unsigned int) counter);
+	  *remaining_size -= ret;
+	  *s += ret;
+	  if (*remaining_size <= 0)
+	    {
+	      return;
+	    }
+	}
+    }
+}
+
+/*
+ * perfmon_stat_dump_in_file_commit_wait_histogram_stat () -
+ *
+ * stream(in): output file
+ * stats_ptr(in): start of array values
+ *
+ */
+static void
+perfmon_stat_dump_in_file_commit_wait_histogram_stat (FILE * stream, const UINT64 * stats_ptr)
+{
+  int bucket;
+  UINT64 counter = 0;
+  char buffer[32];
+
+  assert (stream != NULL);
+
+  for (bucket = 0; bucket < PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT; bucket++)
+    {
+      counter = stats_ptr[bucket];
+      if (counter == 0)
+	{
+	  continue;
+	}
+
+      perfmon_stat_commit_wait_bucket_name (buffer, bucket);
+      fprintf (stream, "%-18s = %16llu\n", buffer, (long long unsigned int) counter);
+    }
+}
+
 /*
  * perfmon_stat_dump_in_buffer_snapshot_array_stat () -
  *
@@ -3334,6 +3502,16 @@ f_load_Num_dwb_flushed_block_volumes (void)
   return PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT;
 }
 
+/*
+ * f_load_Time_log_commit_wait_histogram () - Get the number of values for Time_log_commit_wait_histogram statistic
+ *
+ */
+static int
+f_load_Time_log_commit_wait_histogram (void)
+{
+  return PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT;
+}
+
 /*
  * f_load_Time_get_snapshot_acquire_time () - Get the number of values for Time_get_snapshot_acquire_time statistic
  *
@@ -3522,6 +3700,19 @@ f_dump_in_file_Num_dwb_flushed_block_volumes (FILE * f, const UINT64 * stat_vals
     }
 }
 
+/*
+ * f_dump_in_file_Time_log_commit_wait_histogram () - Write in file the values for Time_log_commit_wait_histogram
+ *						     statistic
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_Time_log_commit_wait_histogram (FILE * f, const UINT64 * stat_vals)
+{
+  perfmon_stat_dump_in_file_commit_wait_histogram_stat (f, stat_vals);
+}
+
 /*
  * f_dump_in_buffer_Num_data_page_fix_ext () - Write to a buffer the values for Num_data_page_fix_ext
  *					       statistic
@@ -3674,6 +3865,20 @@ f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_va
     }
 }
 
+/*
+ * f_dump_in_buffer_Time_log_commit_wait_histogram () - Write to a buffer the values for
+ *						       Time_log_commit_wait_histogram statistic
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_Time_log_commit_wait_histogram (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  perfmon_stat_dump_in_buffer_commit_wait_histogram_stat (stat_vals, s, remaining_size);
+}
+
 /*
  * perfmon_get_number_of_statistic_values () - Get the number of entries in the statistic array
  *
@@ -3800,6 +4005,9 @@ perfmon_get_peek_stats (UINT64 * stats)
   /* fixme(rem) - will be fixed in stattool patch */
 #if defined (SERVER_MODE) || defined (SA_MODE)
   stats[pstat_Metadata[PSTAT_PC_NUM_CACHE_ENTRIES].start_offset] = xcache_get_entry_count ();
+  stats[pstat_Metadata[PSTAT_QC_NUM_CACHE_ENTRIES].start_offset] = qfile_get_list_cache_number_of_entries ();
+  stats[pstat_Metadata[PSTAT_QC_NUM_CACHE_PAGES].start_offset] = qfile_get_list_cache_number_of_pages ();
+  stats[pstat_Metadata[PSTAT_QC_NUM_MEMORY_PAGES].start_offset] = qfile_get_list_cache_number_of_memory_pages ();
   stats[pstat_Metadata[PSTAT_HF_NUM_STATS_ENTRIES].start_offset] = heap_get_best_space_num_stats_entries ();
   stats[pstat_Metadata[PSTAT_QM_NUM_HOLDABLE_CURSORS].start_offset] = session_get_number_of_holdable_cursors ();
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
@@ -132,6 +132,7 @@ typedef enum
 
 #define PERF_OBJ_LOCK_STAT_COUNTERS (SCH_M_LOCK + 1)
 #define PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT 10
+#define PERF_LOG_COMMIT_WAIT_HISTOGRAM_CNT 10
 
 #define SAFE_DIV(a, b) ((b) == 0 ? 0 : (a) / (b))
 
@@ -300,6 +301,8 @@ typedef enum
   /* Execution statistics for the log manager */
   PSTAT_LOG_NUM_FETCHES,
   PSTAT_LOG_NUM_IOREADS,
+  PSTAT_LOG_NUM_READ_AHEAD_LOADS,
+  PSTAT_LOG_NUM_READ_AHEAD_HITS,
   PSTAT_LOG_NUM_IOWRITES,
   PSTAT_LOG_NUM_APPENDRECS,
   PSTAT_LOG_NUM_ARCHIVES,
@@ -308,6 +311,8 @@ typedef enum
   PSTAT_LOG_NUM_WALS,
   PSTAT_LOG_NUM_REPLACEMENTS_IOWRITES,
   PSTAT_LOG_NUM_REPLACEMENTS,
+  PSTAT_LOG_COMMIT_WAIT,
+  PSTAT_LOG_GROUP_COMMIT_FLUSH,
 
   /* Execution statistics for the lock manager */
   PSTAT_LK_NUM_ACQUIRED_ON_PAGES,
@@ -320,6 +325,11 @@ typedef enum
   PSTAT_LK_NUM_WAITED_ON_OBJECTS,
   PSTAT_LK_NUM_WAITED_TIME_ON_OBJECTS,	/* include this to avoid client-server compat issue even if extended stats are
 					 * disabled */
+  PSTAT_LK_NUM_DEADLOCK_WFG_RESOURCES,
+  PSTAT_LK_NUM_DEADLOCK_CYCLES,
+  PSTAT_LK_NUM_DEADLOCK_CYCLE_TRANS,
+  PSTAT_LK_NUM_DEADLOCK_VICTIMS,
+  PSTAT_LK_DEADLOCK_DETECT,
 
   /* Execution statistics for transactions */
   PSTAT_TRAN_NUM_COMMITS,
@@ -344,6 +354,7 @@ typedef enum
   PSTAT_BT_NUM_SPLITS,
   PSTAT_BT_NUM_MERGES,
   PSTAT_BT_NUM_GET_STATS,
+  PSTAT_BT_NUM_INSERTS_SAME_PAGE_HOLD,
 
   PSTAT_BT_ONLINE_LOAD,
   PSTAT_BT_ONLINE_INSERT_TASK,
@@ -398,12 +409,31 @@ typedef enum
   PSTAT_PC_NUM_FULL,
   PSTAT_PC_NUM_DELETE,
   PSTAT_PC_NUM_INVALID_XASL_ID,
+  PSTAT_PC_NUM_WARM_LOAD,
+  PSTAT_PC_NUM_WARM_REJECT,
+  PSTAT_PC_NUM_WARM_HIT,
   PSTAT_PC_NUM_CACHE_ENTRIES,
 
+  /* Execution statistics for query result cache */
+  PSTAT_QC_NUM_LOOKUP,
+  PSTAT_QC_NUM_HIT,
+  PSTAT_QC_NUM_MISS,
+  PSTAT_QC_NUM_ADD,
+  PSTAT_QC_NUM_EVICT,
+  PSTAT_QC_NUM_INVALIDATE,
+  PSTAT_QC_NUM_MEMORY_PAGE_READS,
+  PSTAT_QC_NUM_CACHE_ENTRIES,
+  PSTAT_QC_NUM_CACHE_PAGES,
+  PSTAT_QC_NUM_MEMORY_PAGES,
+
   PSTAT_VAC_NUM_VACUUMED_LOG_PAGES,
   PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES,
+  PSTAT_VAC_NUM_ARCHIVE_LOG_PAGES,
+  PSTAT_VAC_NUM_PROCESSED_LOG_RECORDS,
+  PSTAT_VAC_NUM_PENDING_BLOCKS,
+  PSTAT_VAC_OLDEST_BLOCK_AGE_LOG_PAGES,
 
   /* Track heap modify counters. */
   PSTAT_HEAP_HOME_INSERTS,
@@ -493,6 +523,8 @@ typedef enum
   PSTAT_VAC_JOB,
   PSTAT_VAC_WORKER_PROCESS_LOG,
   PSTAT_VAC_WORKER_EXECUTE,
+  PSTAT_VAC_HEAP,
+  PSTAT_VAC_BTREE,
 
   /* Log statistics */
   PSTAT_LOG_SNAPSHOT_TIME_COUNTERS,
@@ -610,6 +642,15 @@ typedef enum
   PSTAT_PB_LFCQ_LRU_PRV_GET_BIG,
   PSTAT_PB_LFCQ_LRU_SHR_GET_CALLS,
   PSTAT_PB_LFCQ_LRU_SHR_GET_EMPTY,
+  PSTAT_PB_LFCQ_LRU_SHR_GET_OTHER_NODE,
+  /* scan rings of threads doing sequential access */
+  PSTAT_PB_SCAN_RING_ADD,
+  PSTAT_PB_SCAN_RING_REUSE,
+  PSTAT_PB_SCAN_RING_REUSE_FAIL,
+  /* read-ahead of page chains (heap pages, b-tree leaves) */
+  PSTAT_PB_READ_AHEAD_REQUESTS,
+  PSTAT_PB_READ_AHEAD_DROPPED,
+  PSTAT_PB_READ_AHEAD_PAGE_LOADS,
 
   /* DWB statistics */
   PSTAT_DWB_FLUSH_BLOCK_TIME_COUNTERS,
@@ -645,6 +686,7 @@ typedef enum
   PSTAT_THREAD_DAEMON_STATS,
   PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES,
   PSTAT_LOAD_THREAD_STATS,
+  PSTAT_LOG_COMMIT_WAIT_TIME_HISTOGRAM,
 
   PSTAT_COUNT
 } PERF_STAT_ID;
@@ -1473,6 +1515,7 @@ extern void perfmon_pbx_fix_acquire_time (THREAD_ENTRY * thread_p, int page_type
 					  int cond_type, UINT64 amount);
 extern void perfmon_mvcc_snapshot (THREAD_ENTRY * thread_p, int snapshot, int rec_type, int visibility);
 extern void perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes);
+extern void perfmon_log_commit_wait (THREAD_ENTRY * thread_p, UINT64 wait_usec);
 
 #endif /* SERVER_MODE || SA_MODE */
 
@@ -414,6 +414,40 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_JAVA_STORED_PROCEDURE_RESERVE_01 "java_stored_procedure_reserve_01"
 
+#define PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN "optimizer_enable_hash_join"
+
+#define PRM_NAME_MAX_HASH_JOIN_SIZE "max_hash_join_size"
+
+#define PRM_NAME_SORT_PARALLEL_DEGREE "sort_parallel_degree"
+
+#define PRM_NAME_HEAP_SCAN_PARALLEL_DEGREE "heap_scan_parallel_degree"
+
+#define PRM_NAME_PB_SCAN_RING_PAGES "data_buffer_scan_ring_pages"
+
+#define PRM_NAME_PB_READ_AHEAD_WORKERS "data_buffer_read_ahead_workers"
+
+#define PRM_NAME_PB_READ_AHEAD_PAGES "data_buffer_read_ahead_pages"
+
+#define PRM_NAME_PB_NUMA_AWARE "data_buffer_numa_aware"
+
+#define PRM_NAME_LIST_QUERY_CACHE_MEMORY_PAGES "query_cache_memory_result_pages"
+
+#define PRM_NAME_XASL_CACHE_PERSIST "xasl_cache_persist"
+
+#define PRM_NAME_RECOVERY_REDO_WORKERS "log_recovery_redo_workers"
+
+#define PRM_NAME_LOG_READ_AHEAD_PAGES "log_read_ahead_pages"
+
+#define PRM_NAME_VACUUM_HEAP_HELPER_COUNT "vacuum_heap_helper_count"
+
+#define PRM_NAME_INDEX_LOAD_PARALLEL_DEGREE "index_load_parallel_degree"
+
+#define PRM_NAME_INDEX_INSERT_BATCH_MEMSIZE "index_insert_batch_memsize"
+
+#define PRM_NAME_THREAD_CONNECTION_REACTOR_COUNT "thread_connection_reactor_count"
+
+#define PRM_NAME_PARALLEL_QUERY_WORKERS "parallel_query_workers"
+
 #define PRM_NAME_COMPAT_PRIMARY_KEY "compat_primary_key"
 
 #define PRM_NAME_INTL_MBS_SUPPORT "intl_mbs_support"
@@ -2292,6 +2326,102 @@ bool PRM_JAVA_STORED_PROCEDURE_RESERVE_01 = false;
 static bool prm_java_stored_procedure_reserve_01_default = false;
 static unsigned int prm_java_stored_procedure_reserve_01_flag = 0;
 
+bool PRM_OPTIMIZER_ENABLE_HASH_JOIN = false;
+static bool prm_optimizer_enable_hash_join_default = false;
+static unsigned int prm_optimizer_enable_hash_join_flag = 0;
+
+UINT64 PRM_MAX_HASH_JOIN_SIZE = 8 * 1024 * 1024;
+static UINT64 prm_max_hash_join_size_default = 8 * 1024 * 1024;
+static UINT64 prm_max_hash_join_size_upper = 1024 * 1024 * 1024;
+static UINT64 prm_max_hash_join_size_lower = 32 * 1024;
+static unsigned int prm_max_hash_join_size_flag = 0;
+
+int PRM_SORT_PARALLEL_DEGREE = 1;
+static int prm_sort_parallel_degree_default = 1;
+static int prm_sort_parallel_degree_upper = 64;
+static int prm_sort_parallel_degree_lower = 1;
+static unsigned int prm_sort_parallel_degree_flag = 0;
+
+int PRM_HEAP_SCAN_PARALLEL_DEGREE = 1;
+static int prm_heap_scan_parallel_degree_default = 1;
+static int prm_heap_scan_parallel_degree_upper = 64;
+static int prm_heap_scan_parallel_degree_lower = 1;
+static unsigned int prm_heap_scan_parallel_degree_flag = 0;
+
+int PRM_PB_SCAN_RING_PAGES = 32;
+static int prm_pb_scan_ring_pages_default = 32;
+static int prm_pb_scan_ring_pages_upper = 1024;
+static int prm_pb_scan_ring_pages_lower = 0;
+static unsigned int prm_pb_scan_ring_pages_flag = 0;
+
+int PRM_PB_READ_AHEAD_WORKERS = 4;
+static int prm_pb_read_ahead_workers_default = 4;
+static int prm_pb_read_ahead_workers_upper = 32;
+static int prm_pb_read_ahead_workers_lower = 0;
+static unsigned int prm_pb_read_ahead_workers_flag = 0;
+
+int PRM_PB_READ_AHEAD_PAGES = 32;
+static int prm_pb_read_ahead_pages_default = 32;
+static int prm_pb_read_ahead_pages_upper = 256;
+static int prm_pb_read_ahead_pages_lower = 0;
+static unsigned int prm_pb_read_ahead_pages_flag = 0;
+
+bool PRM_PB_NUMA_AWARE = false;
+static bool prm_pb_numa_aware_default = false;
+static unsigned int prm_pb_numa_aware_flag = 0;
+
+int PRM_LIST_QUERY_CACHE_MEMORY_PAGES = 4;
+static int prm_list_query_cache_memory_pages_default = 4;
+static int prm_list_query_cache_memory_pages_upper = 64;
+static int prm_list_query_cache_memory_pages_lower = 0;
+static unsigned int prm_list_query_cache_memory_pages_flag = 0;
+
+bool PRM_XASL_CACHE_PERSIST = false;
+static bool prm_xasl_cache_persist_default = false;
+static unsigned int prm_xasl_cache_persist_flag = 0;
+
+int PRM_RECOVERY_REDO_WORKERS = 4;
+static int prm_recovery_redo_workers_default = 4;
+static int prm_recovery_redo_workers_upper = 32;
+static int prm_recovery_redo_workers_lower = 0;
+static unsigned int prm_recovery_redo_workers_flag = 0;
+
+int PRM_LOG_READ_AHEAD_PAGES = 64;
+static int prm_log_read_ahead_pages_default = 64;
+static int prm_log_read_ahead_pages_upper = 1024;
+static int prm_log_read_ahead_pages_lower = 0;
+static unsigned int prm_log_read_ahead_pages_flag = 0;
+
+int PRM_VACUUM_HEAP_HELPER_COUNT = 2;
+static int prm_vacuum_heap_helper_count_default = 2;
+static int prm_vacuum_heap_helper_count_upper = 16;
+static int prm_vacuum_heap_helper_count_lower = 0;
+static unsigned int prm_vacuum_heap_helper_count_flag = 0;
+
+int PRM_INDEX_LOAD_PARALLEL_DEGREE = 1;
+static int prm_index_load_parallel_degree_default = 1;
+static int prm_index_load_parallel_degree_upper = 64;
+static int prm_index_load_parallel_degree_lower = 1;
+static unsigned int prm_index_load_parallel_degree_flag = 0;
+
+UINT64 PRM_INDEX_INSERT_BATCH_MEMSIZE = 4 * ONE_M;
+static UINT64 prm_index_insert_batch_memsize_default = 4 * ONE_M;
+static UINT64 prm_index_insert_batch_memsize_upper = 128 * ONE_M;
+static UINT64 prm_index_insert_batch_memsize_lower = 0;
+static unsigned int prm_index_insert_batch_memsize_flag = 0;
+
+int PRM_THREAD_CONNECTION_REACTOR_COUNT = 0;
+static int prm_thread_connection_reactor_count_default = 0;
+static int prm_thread_connection_reactor_count_upper = 64;
+static int prm_thread_connection_reactor_count_lower = 0;
+static unsigned int prm_thread_connection_reactor_count_flag = 0;
+
+int PRM_PARALLEL_QUERY_WORKERS = 8;
+static int prm_parallel_query_workers_default = 8;
+static int prm_parallel_query_workers_upper = 64;
+static int prm_parallel_query_workers_lower = 0;
+static unsigned int prm_parallel_query_workers_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -5892,6 +6022,193 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+   PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_optimizer_enable_hash_join_flag,
+   (void *) &prm_optimizer_enable_hash_join_default,
+   (void *) &PRM_OPTIMIZER_ENABLE_HASH_JOIN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_HASH_JOIN_SIZE,
+   PRM_NAME_MAX_HASH_JOIN_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_hash_join_size_flag,
+   (void *) &prm_max_hash_join_size_default,
+   (void *) &PRM_MAX_HASH_JOIN_SIZE,
+   (void *) &prm_max_hash_join_size_upper, (void *) &prm_max_hash_join_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_PARALLEL_DEGREE,
+   PRM_NAME_SORT_PARALLEL_DEGREE,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_FOR_SESSION),
+   PRM_INTEGER,
+   &prm_sort_parallel_degree_flag,
+   (void *) &prm_sort_parallel_degree_default,
+   (void *) &PRM_SORT_PARALLEL_DEGREE,
+   (void *) &prm_sort_parallel_degree_upper, (void *) &prm_sort_parallel_degree_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_SCAN_PARALLEL_DEGREE,
+   PRM_NAME_HEAP_SCAN_PARALLEL_DEGREE,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_FOR_SESSION),
+   PRM_INTEGER,
+   &prm_heap_scan_parallel_degree_flag,
+   (void *) &prm_heap_scan_parallel_degree_default,
+   (void *) &PRM_HEAP_SCAN_PARALLEL_DEGREE,
+   (void *) &prm_heap_scan_parallel_degree_upper, (void *) &prm_heap_scan_parallel_degree_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_SCAN_RING_PAGES,
+   PRM_NAME_PB_SCAN_RING_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_scan_ring_pages_flag,
+   (void *) &prm_pb_scan_ring_pages_default,
+   (void *) &PRM_PB_SCAN_RING_PAGES,
+   (void *) &prm_pb_scan_ring_pages_upper, (void *) &prm_pb_scan_ring_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_READ_AHEAD_WORKERS,
+   PRM_NAME_PB_READ_AHEAD_WORKERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_read_ahead_workers_flag,
+   (void *) &prm_pb_read_ahead_workers_default,
+   (void *) &PRM_PB_READ_AHEAD_WORKERS,
+   (void *) &prm_pb_read_ahead_workers_upper, (void *) &prm_pb_read_ahead_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_READ_AHEAD_PAGES,
+   PRM_NAME_PB_READ_AHEAD_PAGES,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_pb_read_ahead_pages_flag,
+   (void *) &prm_pb_read_ahead_pages_default,
+   (void *) &PRM_PB_READ_AHEAD_PAGES,
+   (void *) &prm_pb_read_ahead_pages_upper, (void *) &prm_pb_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_NUMA_AWARE,
+   PRM_NAME_PB_NUMA_AWARE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_numa_aware_flag,
+   (void *) &prm_pb_numa_aware_default,
+   (void *) &PRM_PB_NUMA_AWARE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LIST_QUERY_CACHE_MEMORY_PAGES,
+   PRM_NAME_LIST_QUERY_CACHE_MEMORY_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_list_query_cache_memory_pages_flag,
+   (void *) &prm_list_query_cache_memory_pages_default,
+   (void *) &PRM_LIST_QUERY_CACHE_MEMORY_PAGES,
+   (void *) &prm_list_query_cache_memory_pages_upper, (void *) &prm_list_query_cache_memory_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_XASL_CACHE_PERSIST,
+   PRM_NAME_XASL_CACHE_PERSIST,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_xasl_cache_persist_flag,
+   (void *) &prm_xasl_cache_persist_default,
+   (void *) &PRM_XASL_CACHE_PERSIST,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_REDO_WORKERS,
+   PRM_NAME_RECOVERY_REDO_WORKERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_redo_workers_flag,
+   (void *) &prm_recovery_redo_workers_default,
+   (void *) &PRM_RECOVERY_REDO_WORKERS,
+   (void *) &prm_recovery_redo_workers_upper, (void *) &prm_recovery_redo_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_READ_AHEAD_PAGES,
+   PRM_NAME_LOG_READ_AHEAD_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_read_ahead_pages_flag,
+   (void *) &prm_log_read_ahead_pages_default,
+   (void *) &PRM_LOG_READ_AHEAD_PAGES,
+   (void *) &prm_log_read_ahead_pages_upper, (void *) &prm_log_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_HEAP_HELPER_COUNT,
+   PRM_NAME_VACUUM_HEAP_HELPER_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_vacuum_heap_helper_count_flag,
+   (void *) &prm_vacuum_heap_helper_count_default,
+   (void *) &PRM_VACUUM_HEAP_HELPER_COUNT,
+   (void *) &prm_vacuum_heap_helper_count_upper, (void *) &prm_vacuum_heap_helper_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_LOAD_PARALLEL_DEGREE,
+   PRM_NAME_INDEX_LOAD_PARALLEL_DEGREE,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_FOR_SESSION),
+   PRM_INTEGER,
+   &prm_index_load_parallel_degree_flag,
+   (void *) &prm_index_load_parallel_degree_default,
+   (void *) &PRM_INDEX_LOAD_PARALLEL_DEGREE,
+   (void *) &prm_index_load_parallel_degree_upper, (void *) &prm_index_load_parallel_degree_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_INSERT_BATCH_MEMSIZE,
+   PRM_NAME_INDEX_INSERT_BATCH_MEMSIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_index_insert_batch_memsize_flag,
+   (void *) &prm_index_insert_batch_memsize_default,
+   (void *) &PRM_INDEX_INSERT_BATCH_MEMSIZE,
+   (void *) &prm_index_insert_batch_memsize_upper, (void *) &prm_index_insert_batch_memsize_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_CONNECTION_REACTOR_COUNT,
+   PRM_NAME_THREAD_CONNECTION_REACTOR_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_thread_connection_reactor_count_flag,
+   (void *) &prm_thread_connection_reactor_count_default,
+   (void *) &PRM_THREAD_CONNECTION_REACTOR_COUNT,
+   (void *) &prm_thread_connection_reactor_count_upper, (void *) &prm_thread_connection_reactor_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_QUERY_WORKERS,
+   PRM_NAME_PARALLEL_QUERY_WORKERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_parallel_query_workers_flag,
+   (void *) &prm_parallel_query_workers_default,
+   (void *) &PRM_PARALLEL_QUERY_WORKERS,
+   (void *) &prm_parallel_query_workers_upper, (void *) &prm_parallel_query_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 #define NUM_PRM ((int)(sizeof(prm_Def)/sizeof(prm_Def[0])))
@@ -10246,13 +10563,6 @@ prm_tune_parameters (void)
       prm_set (pb_aout_ratio_prm, "0", false);
     }
 
-  /* temporarily modifies the query result cache feature to be disabled in RB-8.2.2. because it is not verified on 64
-   * bit environment. */
-  if (query_cache_mode_prm != NULL)
-    {
-      prm_set (query_cache_mode_prm, "0", false);
-    }
-
   ha_mode_prm = prm_find (PRM_NAME_HA_MODE, NULL);
   ha_server_state_prm = prm_find (PRM_NAME_HA_SERVER_STATE, NULL);
   auto_restart_server_prm = prm_find (PRM_NAME_AUTO_RESTART_SERVER, NULL);
@@ -444,9 +444,26 @@ enum param_id
   PRM_ID_JAVA_STORED_PROCEDURE_JVM_OPTIONS,
   PRM_ID_JAVA_STORED_PROCEDURE_DEBUG,
   PRM_ID_JAVA_STORED_PROCEDURE_RESERVE_01,
+  PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+  PRM_ID_MAX_HASH_JOIN_SIZE,
+  PRM_ID_SORT_PARALLEL_DEGREE,
+  PRM_ID_HEAP_SCAN_PARALLEL_DEGREE,
+  PRM_ID_PB_SCAN_RING_PAGES,
+  PRM_ID_PB_READ_AHEAD_WORKERS,
+  PRM_ID_PB_READ_AHEAD_PAGES,
+  PRM_ID_PB_NUMA_AWARE,
+  PRM_ID_LIST_QUERY_CACHE_MEMORY_PAGES,
+  PRM_ID_XASL_CACHE_PERSIST,
+  PRM_ID_RECOVERY_REDO_WORKERS,
+  PRM_ID_LOG_READ_AHEAD_PAGES,
+  PRM_ID_VACUUM_HEAP_HELPER_COUNT,
+  PRM_ID_INDEX_LOAD_PARALLEL_DEGREE,
+  PRM_ID_INDEX_INSERT_BATCH_MEMSIZE,
+  PRM_ID_THREAD_CONNECTION_REACTOR_COUNT,
+  PRM_ID_PARALLEL_QUERY_WORKERS,
 
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_JAVA_STORED_PROCEDURE_RESERVE_01
+  PRM_LAST_ID = PRM_ID_PARALLEL_QUERY_WORKERS
 };
 typedef enum param_id PARAM_ID;
 
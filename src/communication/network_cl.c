@@ -109,6 +109,17 @@ static char net_Server_host[CUB_MAXHOSTNAMELEN + 1] = "";
 /* Contains the name of the current server name. */
 static char net_Server_name[DB_MAX_IDENTIFIER_LENGTH + 1] = "";
 
+/* true if the server executes pipelined requests in order (NET_CAP_PIPELINED_REQUESTS) */
+static bool net_Server_pipelining_enabled = false;
+
+/* number of pipelined requests whose replies are not received yet */
+static int net_Pipelined_request_count = 0;
+
+/* request sent ahead of the next request, see net_client_request_ahead; 0 if none */
+static unsigned int net_Ahead_request_rc = 0;
+static int net_Ahead_request;
+static OR_ALIGNED_BUF (OR_INT_SIZE) net_Ahead_reply;
+
 static void return_error_to_server (char *host, unsigned int eid);
 static int client_capabilities (void);
 static int check_server_capabilities (int server_cap, int client_type, int rel_compare,
@@ -119,6 +130,12 @@ static int compare_size_and_buffer (int *replysize, int size, char **replybuf, c
 				    const int line);
 static int net_client_request_internal (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					char *databuf, int datasize, char *replydata, int replydatasize);
+static int net_client_send_request_internal (int request, char *argbuf, int argsize, char *replybuf, int replysize,
+					    char *databuf, int datasize, char *replydata, int replydatasize,
+					    bool pipelined, unsigned int *rc_p);
+static int net_client_receive_reply_internal (unsigned int rc, int request, char *replybuf, int replysize,
+					      char *replydata, int replydatasize);
+static void net_client_receive_ahead_reply (bool next_request_sent);
 static int set_server_error (int error);
 
 static void net_histo_setup_names (void);
@@ -955,9 +972,50 @@ net_client_request_internal (int request, char *argbuf, int argsize, char *reply
 			     int datasize, char *replydata, int replydatasize)
 {
   unsigned int rc;
-  int size;
   int error;
-  char *reply = NULL;
+  bool pipelined;
+
+  /* the replies of pipelined requests must be received first, except for the one of a request sent ahead */
+  assert (net_Pipelined_request_count == (net_Ahead_request_rc != 0 ? 1 : 0));
+
+  /* a request sent ahead must be executed first */
+  pipelined = (net_Ahead_request_rc != 0);
+
+  error = net_client_send_request_internal (request, argbuf, argsize, replybuf, replysize, databuf, datasize,
+					    replydata, replydatasize, pipelined, &rc);
+  net_client_receive_ahead_reply (error == NO_ERROR);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  return net_client_receive_reply_internal (rc, request, replybuf, replysize, replydata, replydatasize);
+}
+
+/*
+ * net_client_send_request_internal - send a request and enroll its reply buffers
+ *
+ * return: error status
+ *
+ *   request(in): server request id
+ *   argbuf(in): argument buffer (small)
+ *   argsize(in): byte size of argbuf
+ *   replybuf(in): reply argument buffer (small)
+ *   replysize(in): size of reply argument buffer
+ *   databuf(in): data buffer to send (large)
+ *   datasize(in): size of data buffer
+ *   replydata(in): receive data buffer (large)
+ *   replydatasize(in): size of expected reply data
+ *   pipelined(in): true to flag the request as pipelined
+ *   rc_p(out): enquiry id of request
+ */
+static int
+net_client_send_request_internal (int request, char *argbuf, int argsize, char *replybuf, int replysize,
+				  char *databuf, int datasize, char *replydata, int replydatasize, bool pipelined,
+				  unsigned int *rc_p)
+{
+  unsigned int rc;
+  int error;
 
   error = 0;
 
@@ -976,42 +1034,73 @@ net_client_request_internal (int request, char *argbuf, int argsize, char *reply
     }
 #endif /* HISTO */
 
-  rc = css_send_req_to_server (net_Server_host, request, argbuf, argsize, databuf, datasize, replybuf, replysize);
+  if (pipelined)
+    {
+      rc = css_send_pipelined_req_to_server (net_Server_host, request, argbuf, argsize, databuf, datasize, replybuf,
+					     replysize);
+    }
+  else
+    {
+      rc = css_send_req_to_server (net_Server_host, request, argbuf, argsize, databuf, datasize, replybuf,
+				   replysize);
+    }
   if (rc == 0)
     {
       error = css_Errno;
       return set_server_error (error);
     }
 
-  if (rc)
+  if (replydata != NULL)
+    {
+      css_queue_receive_data_buffer (rc, replydata, replydatasize);
+    }
+
+  *rc_p = rc;
+  return error;
+}
+
+/*
+ * net_client_receive_reply_internal - receive the reply of a request sent by net_client_send_request_internal
+ *
+ * return: error status
+ *
+ *   rc(in): enquiry id of request
+ *   request(in): server request id
+ *   replybuf(in): reply argument buffer (small)
+ *   replysize(in): size of reply argument buffer
+ *   replydata(in): receive data buffer (large)
+ *   replydatasize(in): size of expected reply data
+ */
+static int
+net_client_receive_reply_internal (unsigned int rc, int request, char *replybuf, int replysize, char *replydata,
+				   int replydatasize)
+{
+  int size;
+  int error;
+  char *reply = NULL;
+
+  error = css_receive_data_from_server (rc, &reply, &size);
+  if (error != NO_ERROR)
+    {
+      COMPARE_AND_FREE_BUFFER (replybuf, reply);
+      return set_server_error (error);
+    }
+  else
+    {
+      error = COMPARE_SIZE_AND_BUFFER (&replysize, size, &replybuf, reply);
+    }
+
+  if (replydata != NULL)
     {
-      if (replydata != NULL)
-	{
-	  css_queue_receive_data_buffer (rc, replydata, replydatasize);
-	}
       error = css_receive_data_from_server (rc, &reply, &size);
       if (error != NO_ERROR)
 	{
-	  COMPARE_AND_FREE_BUFFER (replybuf, reply);
+	  COMPARE_AND_FREE_BUFFER (replydata, reply);
 	  return set_server_error (error);
 	}
       else
 	{
-	  error = COMPARE_SIZE_AND_BUFFER (&replysize, size, &replybuf, reply);
-	}
-
-      if (replydata != NULL)
-	{
-	  error = css_receive_data_from_server (rc, &reply, &size);
-	  if (error != NO_ERROR)
-	    {
-	      COMPARE_AND_FREE_BUFFER (replydata, reply);
-	      return set_server_error (error);
-	    }
-	  else
-	    {
-	      error = COMPARE_SIZE_AND_BUFFER (&replydatasize, size, &replydata, reply);
-	    }
+	  error = COMPARE_SIZE_AND_BUFFER (&replydatasize, size, &replydata, reply);
 	}
     }
 #if defined(HISTO)
@@ -1050,6 +1139,166 @@ net_client_request (int request, char *argbuf, int argsize, char *replybuf, int
 				       replydatasize));
 }
 
+/*
+ * net_client_request_pipelined - send a request without waiting for its reply
+ *
+ * return: error status
+ *
+ *   request(in): server request id
+ *   argbuf(in): argument buffer (small)
+ *   argsize(in): byte size of argbuf
+ *   replybuf(in): reply argument buffer (small)
+ *   replysize(in): size of reply argument buffer
+ *   databuf(in): data buffer to send (large)
+ *   datasize(in): size of data buffer
+ *   replydata(in): receive data buffer (large)
+ *   replydatasize(in): size of expected reply data
+ *   rc_p(out): enquiry id to receive the reply with
+ *
+ * Note: Several independent requests may be sent before receiving their replies with
+ *       net_client_receive_pipelined_reply, saving a network round trip for each but the last. The server executes
+ *       them one at a time, in the order they were sent; a request does not know the result of previous ones.
+ *       Reply buffers must remain valid until the reply is received, and all replies must be received before other
+ *       requests are sent. Servers that do not advertise NET_CAP_PIPELINED_REQUESTS would execute the requests
+ *       concurrently, so they are not sent to them; see net_client_is_pipelining_enabled.
+ */
+int
+net_client_request_pipelined (int request, char *argbuf, int argsize, char *replybuf, int replysize, char *databuf,
+			      int datasize, char *replydata, int replydatasize, unsigned int *rc_p)
+{
+  int error;
+
+  if (!net_Server_pipelining_enabled)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERFACE_NOT_SUPPORTED_OPERATION, 0);
+      return ER_INTERFACE_NOT_SUPPORTED_OPERATION;
+    }
+
+  error = net_client_send_request_internal (request, argbuf, argsize, replybuf, replysize, databuf, datasize,
+					    replydata, replydatasize, true, rc_p);
+  if (error == NO_ERROR)
+    {
+      net_Pipelined_request_count++;
+    }
+  return error;
+}
+
+/*
+ * net_client_receive_pipelined_reply - receive the reply of a request sent by net_client_request_pipelined
+ *
+ * return: error status
+ *
+ *   rc(in): enquiry id of request
+ *   request(in): server request id
+ *   replybuf(in): reply argument buffer (small), same as when the request was sent
+ *   replysize(in): size of reply argument buffer
+ *   replydata(in): receive data buffer (large), same as when the request was sent
+ *   replydatasize(in): size of expected reply data
+ */
+int
+net_client_receive_pipelined_reply (unsigned int rc, int request, char *replybuf, int replysize, char *replydata,
+				    int replydatasize)
+{
+  assert (net_Pipelined_request_count > 0);
+  net_Pipelined_request_count--;
+
+  return net_client_receive_reply_internal (rc, request, replybuf, replysize, replydata, replydatasize);
+}
+
+/*
+ * net_client_is_pipelining_enabled - check whether requests can be pipelined to the server
+ *
+ * return: true if the server advertised NET_CAP_PIPELINED_REQUESTS in the handshake
+ */
+bool
+net_client_is_pipelining_enabled (void)
+{
+  return net_Server_pipelining_enabled;
+}
+
+/*
+ * net_client_request_ahead - send a request ahead of the next request, without waiting for its reply
+ *
+ * return: error status
+ *
+ *   request(in): server request id; its reply is an error code
+ *   argbuf(in): argument buffer (small)
+ *   argsize(in): byte size of argbuf
+ *
+ * Note: The next request, sent by net_client_request or net_client_request_with_callback, is pipelined after this one
+ *       and the reply of this one is received as soon as the next is sent, so both requests share a round trip.
+ *       Errors of this request are logged and not returned to anyone; use it for requests like ending queries whose
+ *       failure the caller cannot handle anyway. Only for servers with net_client_is_pipelining_enabled.
+ */
+int
+net_client_request_ahead (int request, char *argbuf, int argsize)
+{
+  unsigned int rc;
+  int error;
+
+  /* only one request is sent ahead */
+  net_client_receive_ahead_reply (true);
+
+  error = net_client_request_pipelined (request, argbuf, argsize, OR_ALIGNED_BUF_START (net_Ahead_reply),
+					OR_INT_SIZE, NULL, 0, NULL, 0, &rc);
+  if (error == NO_ERROR)
+    {
+      net_Ahead_request_rc = rc;
+      net_Ahead_request = request;
+    }
+  return error;
+}
+
+/*
+ * net_client_receive_ahead_reply - receive the reply of the request sent by net_client_request_ahead, if any
+ *
+ * return: void
+ *
+ *   next_request_sent(in): false if sending the next request failed; the reply is then not waited for
+ *
+ * Note: Called after the next request is sent, so the server executes the request sent ahead first.
+ */
+static void
+net_client_receive_ahead_reply (bool next_request_sent)
+{
+  unsigned int rc = net_Ahead_request_rc;
+  int error;
+  int status = NO_ERROR;
+
+  if (rc == 0)
+    {
+      return;
+    }
+  net_Ahead_request_rc = 0;
+
+  if (!next_request_sent)
+    {
+      /* the connection failed; keep the error of the next request */
+      assert (net_Pipelined_request_count > 0);
+      net_Pipelined_request_count--;
+      return;
+    }
+
+  error = net_client_receive_pipelined_reply (rc, net_Ahead_request, OR_ALIGNED_BUF_START (net_Ahead_reply),
+					      OR_INT_SIZE, NULL, 0);
+  if (error == NO_ERROR)
+    {
+      (void) or_unpack_int (OR_ALIGNED_BUF_START (net_Ahead_reply), &status);
+    }
+  else
+    {
+      status = error;
+    }
+
+  if (status != NO_ERROR)
+    {
+      /* nobody waits for this result; do not let it look like an error of the next request */
+      er_log_debug (ARG_FILE_LINE, "net_client_receive_ahead_reply: request %d failed with error %d\n",
+		    net_Ahead_request, status);
+      er_clear ();
+    }
+}
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 /*
  * net_client_request_send_large_data -
@@ -1643,8 +1892,19 @@ net_client_request_with_callback (int request, char *argbuf, int argsize, char *
 	  net_histo_add_entry (request, argsize + datasize1 + datasize2);
 	}
 #endif /* HISTO */
-      rc = css_send_req_to_server_2_data (net_Server_host, request, argbuf, argsize, databuf1, datasize1, databuf2,
-					  datasize2, replybuf, replysize);
+      if (net_Ahead_request_rc != 0)
+	{
+	  /* executed after the request sent ahead */
+	  rc = css_send_pipelined_req_to_server_2_data (net_Server_host, request, argbuf, argsize, databuf1, datasize1,
+							databuf2, datasize2, replybuf, replysize);
+	}
+      else
+	{
+	  rc = css_send_req_to_server_2_data (net_Server_host, request, argbuf, argsize, databuf1, datasize1, databuf2,
+					      datasize2, replybuf, replysize);
+	}
+      /* before any callback of this request may send requests of its own */
+      net_client_receive_ahead_reply (rc != 0);
       if (rc == 0)
 	{
 	  return set_server_error (css_Errno);
@@ -3879,6 +4139,9 @@ net_client_ping_server_with_handshake (int client_type, bool check_capabilities,
       return error;
     }
 
+  /* older servers do not know NET_HEADER_FLAG_PIPELINED */
+  net_Server_pipelining_enabled = (server_capabilities & NET_CAP_PIPELINED_REQUESTS) != 0;
+
   return error;
 }
 
@@ -3926,6 +4189,11 @@ net_client_init (const char *dbname, const char *hostname)
   /* since urgent_message_handler() doesn't do anything yet, just use the default handler provided by css which writes
    * things to the system console */
 
+  /* replies of pipelined requests on a previous connection are lost */
+  net_Pipelined_request_count = 0;
+  net_Ahead_request_rc = 0;
+  net_Server_pipelining_enabled = false;
+
   /* set our host/server names for further css communication */
   if (hostname != NULL && strlen (hostname) <= CUB_MAXHOSTNAMELEN)
     {
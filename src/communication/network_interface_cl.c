@@ -96,6 +96,7 @@ static char *pack_const_string (char *buffer, const char *cstring);
 static char *pack_string_with_null_padding (char *buffer, const char *stream, int len);
 static int length_const_string (const char *cstring, int *strlen);
 static int length_string_with_null_padding (int len);
+static int qmgr_end_deferred_queries (bool ahead);
 #endif /* CS_MODE */
 #if defined (SA_MODE)
 static void enter_server_no_thread_entry (void);
@@ -6411,6 +6412,12 @@ qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt
       request_len += OR_INT_SIZE + OR_PTR_SIZE * net_Deferred_end_queries_count;
       net_Deferred_end_queries_count = 0;
     }
+  else if (net_Deferred_end_queries_count == NET_DEFER_END_QUERIES_MAX)
+    {
+      /* end the queries of closed cursors in the same round trip as this execution; errors are only logged, as they
+       * would be for queries ended with commit. Servers that cannot pipeline requests get a round trip of their own. */
+      (void) qmgr_end_deferred_queries (net_client_is_pipelining_enabled ());
+    }
 
   /* Add message in log in case of autocommit transactions. It helps to trace query execution. */
   if (prm_get_bool_value (PRM_ID_ER_LOG_DEBUG) && IS_TRAN_AUTO_COMMIT (flag))
@@ -6688,19 +6695,17 @@ qmgr_prepare_and_execute_query (char *xasl_stream, int xasl_stream_size, QUERY_I
 #endif /* !CS_MODE */
 }
 
+#if defined(CS_MODE)
 /*
- * qmgr_end_query -
- *
- * return:
+ * qmgr_end_deferred_queries - send a request to end the deferred queries
  *
- *   query_id(in):
+ * return: error code
  *
- * NOTE:
+ *   ahead(in): true to send the request ahead of the next request, without waiting for its reply
  */
-int
-qmgr_end_query (QUERY_ID query_id)
+static int
+qmgr_end_deferred_queries (bool ahead)
 {
-#if defined(CS_MODE)
   int status = ER_FAILED;
   int req_error = NO_ERROR;
   int i = 0;
@@ -6712,25 +6717,23 @@ qmgr_end_query (QUERY_ID query_id)
   OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
   char *reply = NULL;
 
-  net_Deferred_end_queries[net_Deferred_end_queries_count++] = query_id;
-  if (net_Deferred_end_queries_count < NET_DEFER_END_QUERIES_MAX)
-    {
-      /* Do not create a request for now. Defer it until NET_DEFER_END_QUERIES_MAX requests are collected or until
-       * commit/abort. */
-      return NO_ERROR;
-    }
-  assert (net_Deferred_end_queries_count == NET_DEFER_END_QUERIES_MAX);
-  net_Deferred_end_queries_count = 0;
+  assert (0 < net_Deferred_end_queries_count && net_Deferred_end_queries_count <= NET_DEFER_END_QUERIES_MAX);
 
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
 
-  ptr = or_pack_int (request, NET_DEFER_END_QUERIES_MAX);
-  for (i = 0; i < NET_DEFER_END_QUERIES_MAX; i++)
+  ptr = or_pack_int (request, net_Deferred_end_queries_count);
+  for (i = 0; i < net_Deferred_end_queries_count; i++)
     {
       ptr = or_pack_ptr (ptr, net_Deferred_end_queries[i]);
     }
   assert (CAST_BUFLEN (ptr - request) <= (int) OR_ALIGNED_BUF_SIZE (a_request));
+  net_Deferred_end_queries_count = 0;
+
+  if (ahead)
+    {
+      return net_client_request_ahead (NET_SERVER_QM_QUERY_END, request, CAST_BUFLEN (ptr - request));
+    }
 
   req_error =
     net_client_request (NET_SERVER_QM_QUERY_END, request, CAST_BUFLEN (ptr - request), reply,
@@ -6744,6 +6747,35 @@ qmgr_end_query (QUERY_ID query_id)
       status = req_error;
     }
 
+  return status;
+}
+#endif /* CS_MODE */
+
+/*
+ * qmgr_end_query -
+ *
+ * return:
+ *
+ *   query_id(in):
+ *
+ * NOTE: In client/server mode, ending queries is deferred until NET_DEFER_END_QUERIES_MAX queries are collected. They
+ *       are then ended along with the next query execution (see qmgr_execute_query), or with commit/abort.
+ */
+int
+qmgr_end_query (QUERY_ID query_id)
+{
+#if defined(CS_MODE)
+  int status = NO_ERROR;
+
+  if (net_Deferred_end_queries_count == NET_DEFER_END_QUERIES_MAX)
+    {
+      /* no query was executed since; end the deferred queries now */
+      status = qmgr_end_deferred_queries (false);
+    }
+
+  assert (net_Deferred_end_queries_count < NET_DEFER_END_QUERIES_MAX);
+  net_Deferred_end_queries[net_Deferred_end_queries_count++] = query_id;
+
   return status;
 #else /* CS_MODE */
   int success = ER_FAILED;
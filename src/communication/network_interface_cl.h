@@ -300,6 +300,13 @@ extern void net_histo_clear (void);
 extern int net_client_request_no_reply (int request, char *argbuf, int argsize);
 extern int net_client_request (int request, char *argbuf, int argsize, char *replybuf, int replysize, char *databuf,
 			       int datasize, char *replydata, int replydatasize);
+extern int net_client_request_pipelined (int request, char *argbuf, int argsize, char *replybuf, int replysize,
+					 char *databuf, int datasize, char *replydata, int replydatasize,
+					 unsigned int *rc_p);
+extern int net_client_receive_pipelined_reply (unsigned int rc, int request, char *replybuf, int replysize,
+					       char *replydata, int replydatasize);
+extern bool net_client_is_pipelining_enabled (void);
+extern int net_client_request_ahead (int request, char *argbuf, int argsize);
 #if defined(ENABLE_UNUSED_FUNCTION)
 extern int net_client_request_send_large_data (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					       char *databuf, INT64 datasize, char *replydata, int replydatasize);
@@ -419,6 +419,7 @@ server_capabilities (void)
   int capabilities = 0;
 
   capabilities |= NET_CAP_INTERRUPT_ENABLED;
+  capabilities |= NET_CAP_PIPELINED_REQUESTS;
   if (db_Disable_modifications > 0)
     {
       capabilities |= NET_CAP_UPDATE_DISABLED;
@@ -517,8 +518,8 @@ server_ping (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqle
   /* you can get something useful from the request */
   or_unpack_int (request, &client_val);
 
-  /* you can envelope something useful into the reply */
-  server_val = 0;
+  /* you can envelope something useful into the reply; echo the request so that clients can match replies */
+  server_val = client_val;
   or_pack_int (reply, server_val);
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_INT_SIZE);
 }
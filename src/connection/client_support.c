@@ -289,6 +289,47 @@ css_send_req_to_server (char *host, int request, char *arg_buffer, int arg_buffe
   return (css_make_eid (entry->id, rid));
 }
 
+/*
+ * css_send_pipelined_req_to_server() - send a pipelined request to server
+ *   return: enquiry id, or 0 if the request could not be sent
+ *   host(in): name of the remote host
+ *   request(in): the request to send to the server.
+ *   arg_buffer(in): a packed buffer containing all the arguments to be sent to the server.
+ *   arg_buffer_size(in): The size of arg_buffer.
+ *   data_buffer(in): additional data to send to the server
+ *   data_buffer_size(in): The size of the data buffer.
+ *   reply_buffer(in): enroll a data buffer to hold the resulting data.
+ *   reply_buffer_size(in): The size of the reply buffer.
+ *
+ * Note: Same as css_send_req_to_server, but the request is flagged as pipelined. The client may send more requests
+ *       before receiving the reply; the server executes the pipelined requests of a connection in order.
+ */
+unsigned int
+css_send_pipelined_req_to_server (char *host, int request, char *arg_buffer, int arg_buffer_size, char *data_buffer,
+				  int data_buffer_size, char *reply_buffer, int reply_size)
+{
+  CSS_MAP_ENTRY *entry;
+  CSS_CONN_ENTRY *conn;
+  unsigned int eid;
+
+  entry = css_return_open_entry (host, &css_Client_anchor);
+  if (entry == NULL)
+    {
+      css_Errno = SERVER_WAS_NOT_FOUND;
+      return 0;
+    }
+
+  /* entry is freed if the request cannot be sent; keep the connection */
+  conn = entry->conn;
+
+  conn->send_pipelined = true;
+  eid = css_send_req_to_server (host, request, arg_buffer, arg_buffer_size, data_buffer, data_buffer_size,
+				reply_buffer, reply_size);
+  conn->send_pipelined = false;
+
+  return eid;
+}
+
 #if 0
 /*
  * css_send_req_to_server_with_large_data() - send a request to server with
@@ -387,6 +428,50 @@ css_send_req_to_server_2_data (char *host, int request, char *arg_buffer, int ar
   return (css_make_eid (entry->id, rid));
 }
 
+/*
+ * css_send_pipelined_req_to_server_2_data() - send a pipelined request with two data buffers to server
+ *   return: enquiry id, or 0 if the request could not be sent
+ *   host(in): name of the remote host
+ *   request(in): the request to send to the server.
+ *   arg_buffer(in): a packed buffer containing all the arguments to be sent to the server.
+ *   arg_buffer_size(in): The size of arg_buffer.
+ *   data1_buffer(in): additional data to send to the server
+ *   data1_buffer_size(in): The size of the data buffer.
+ *   data2_buffer(in): additional data to send to the server
+ *   data2_buffer_size(in): The size of the data buffer.
+ *   reply_buffer(in): enroll a data buffer to hold the resulting data.
+ *   reply_buffer_size(in): The size of the reply buffer.
+ *
+ * Note: Same as css_send_req_to_server_2_data, but the request is flagged as pipelined; see
+ *       css_send_pipelined_req_to_server.
+ */
+unsigned int
+css_send_pipelined_req_to_server_2_data (char *host, int request, char *arg_buffer, int arg_buffer_size,
+					 char *data1_buffer, int data1_buffer_size, char *data2_buffer,
+					 int data2_buffer_size, char *reply_buffer, int reply_size)
+{
+  CSS_MAP_ENTRY *entry;
+  CSS_CONN_ENTRY *conn;
+  unsigned int eid;
+
+  entry = css_return_open_entry (host, &css_Client_anchor);
+  if (entry == NULL)
+    {
+      css_Errno = SERVER_WAS_NOT_FOUND;
+      return 0;
+    }
+
+  /* entry is freed if the request cannot be sent; keep the connection */
+  conn = entry->conn;
+
+  conn->send_pipelined = true;
+  eid = css_send_req_to_server_2_data (host, request, arg_buffer, arg_buffer_size, data1_buffer, data1_buffer_size,
+				       data2_buffer, data2_buffer_size, reply_buffer, reply_size);
+  conn->send_pipelined = false;
+
+  return eid;
+}
+
 /*
  * css_send_req_to_server_no_reply() - send a data request to the server and receive no reply
  *   return:
@@ -588,6 +673,11 @@ css_receive_data_from_server_with_timeout (unsigned int eid, char **buffer, int
     {
       css_test_for_server_errors (entry, eid);
     }
+  if (css_Errno != NO_ERRORS)
+    {
+      /* the caller gives up the request; its reply buffers, often on its stack, must not receive late data */
+      css_remove_user_data_buffers (entry->conn, rid);
+    }
 
   return css_Errno == NO_ERRORS ? 0 : css_Errno;
 }
@@ -42,6 +42,13 @@ extern unsigned int css_send_request_to_server_with_buffer (char *host, int requ
 extern unsigned int css_send_req_to_server (char *host, int request, char *arg_buffer, int arg_buffer_size,
 					    char *data_buffer, int data_buffer_size, char *reply_buffer,
 					    int reply_size);
+extern unsigned int css_send_pipelined_req_to_server (char *host, int request, char *arg_buffer, int arg_buffer_size,
+						      char *data_buffer, int data_buffer_size, char *reply_buffer,
+						      int reply_size);
+extern unsigned int css_send_pipelined_req_to_server_2_data (char *host, int request, char *arg_buffer,
+							     int arg_buffer_size, char *data1_buffer,
+							     int data1_buffer_size, char *data2_buffer,
+							     int data2_buffer_size, char *reply_buffer, int reply_size);
 #if 0
 extern unsigned int css_send_req_to_server_with_large_data (char *host, int request, char *arg_buffer,
 							    int arg_buffer_size, char *data_buffer,
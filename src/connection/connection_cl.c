@@ -151,6 +151,7 @@ css_initialize_conn (CSS_CONN_ENTRY * conn, SOCKET fd)
   conn->invalidate_snapshot = 1;
   conn->db_error = 0;
   conn->cnxn = NULL;
+  conn->send_pipelined = false;
 }
 
 /*
@@ -524,6 +525,8 @@ begin:
 	}
       else
 	{
+	  /* data of another request, e.g. of a pipelined request, is queued in a new buffer and copied to the buffer
+	   * registered for it when received; that buffer may no longer be valid if the request was abandoned */
 	  buf = (char *) css_return_data_buffer (conn, 0, &buf_size);
 	}
 
@@ -369,6 +369,9 @@ typedef enum ha_log_applier_state HA_LOG_APPLIER_STATE;
 #define CSS_ENTRYID_FROM_EID(eid)       ((unsigned short) HIGH16BITS(eid))
 
 #define NET_HEADER_FLAG_INVALIDATE_SNAPSHOT 0x8000
+/* request is sent before the reply of a previous request is received; the server executes the pipelined requests
+ * of a connection one at a time, in the order they were sent */
+#define NET_HEADER_FLAG_PIPELINED 0x4000
 
 /*
  * This is the format of the header for each command packet that is sent
@@ -457,6 +460,8 @@ struct css_conn_entry
   CSS_LIST buffer_queue;	/* list of buffers queued for data */
   CSS_LIST error_queue;		/* list of (server) error messages */
   struct session_state *session_p;	/* session object for current request */
+  bool pipeline_running;	/* a pipelined request is executed */
+  unsigned short pipeline_rid;	/* request id of executed pipelined request */
 #else
   FILE *file;
   CSS_QUEUE_ENTRY *request_queue;	/* the header for unseen requests */
@@ -465,6 +470,7 @@ struct css_conn_entry
   CSS_QUEUE_ENTRY *buffer_queue;	/* header of buffers queued for data */
   CSS_QUEUE_ENTRY *error_queue;	/* queue of (server) error messages */
   void *cnxn;
+  bool send_pipelined;		/* sent requests are flagged NET_HEADER_FLAG_PIPELINED */
 #endif
   SESSION_ID session_id;
   CSS_CONN_ENTRY *next;
@@ -346,6 +346,27 @@ css_queue_user_data_buffer (CSS_CONN_ENTRY * conn, unsigned short request_id, in
   return NO_ERRORS;
 }
 
+/*
+ * css_remove_user_data_buffers () - forget the data buffers queued by the client for a request
+ *   return:
+ *   conn(in/out):
+ *   request_id(in):
+ *
+ * Note: The buffers belong to the client and are not freed. Called when the client stops waiting for the data of a
+ *       request, so that data arriving later is not copied into buffers that may no longer be valid.
+ */
+void
+css_remove_user_data_buffers (CSS_CONN_ENTRY * conn, unsigned short request_id)
+{
+  CSS_QUEUE_ENTRY *buffer_q_entry_p;
+
+  while ((buffer_q_entry_p = css_find_queue_entry (conn->buffer_queue, request_id)) != NULL)
+    {
+      buffer_q_entry_p->buffer = NULL;
+      css_queue_remove_header_entry_ptr (&conn->buffer_queue, buffer_q_entry_p);
+    }
+}
+
 static bool
 css_recv_and_queue_packet (CSS_CONN_ENTRY * conn, unsigned short request_id, char *buffer, int size,
 			   CSS_QUEUE_ENTRY ** queue_p)
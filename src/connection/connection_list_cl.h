@@ -36,6 +36,7 @@ extern void css_queue_unexpected_error_packet (CSS_CONN_ENTRY * conn, unsigned s
 extern void css_queue_unexpected_packet (int type, CSS_CONN_ENTRY * conn, unsigned short request_id,
 					 NET_HEADER * header, int size);
 extern int css_queue_user_data_buffer (CSS_CONN_ENTRY * conn, unsigned short request_id, int size, char *buffer);
+extern void css_remove_user_data_buffers (CSS_CONN_ENTRY * conn, unsigned short request_id);
 extern CSS_QUEUE_ENTRY *css_find_queue_entry (CSS_QUEUE_ENTRY * header, unsigned int key);
 extern void css_queue_remove_header_entry_ptr (CSS_QUEUE_ENTRY ** anchor, CSS_QUEUE_ENTRY * entry);
 extern void css_queue_remove_header_entry (CSS_QUEUE_ENTRY ** anchor, unsigned short request_id);
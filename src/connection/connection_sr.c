@@ -105,6 +105,13 @@ typedef struct queue_search_arg
   int remove_entry;
 } CSS_QUEUE_SEARCH_ARG;
 
+typedef struct request_search_arg
+{
+  CSS_QUEUE_ENTRY *entry_ptr;
+  bool skip_pipelined;		/* a pipelined request is executed; the others must wait */
+  bool pipelined_only;
+} CSS_REQUEST_SEARCH_ARG;
+
 typedef struct wait_queue_search_arg
 {
   CSS_WAIT_QUEUE_ENTRY *entry_ptr;
@@ -192,6 +199,9 @@ static CSS_WAIT_QUEUE_ENTRY *css_find_and_remove_wait_queue_entry (CSS_LIST * li
 static void css_process_close_packet (CSS_CONN_ENTRY * conn);
 static void css_process_abort_packet (CSS_CONN_ENTRY * conn, unsigned short request_id);
 static bool css_is_request_aborted (CSS_CONN_ENTRY * conn, unsigned short request_id);
+static int css_find_startable_request (void *data, void *user);
+static void css_start_queued_request (CSS_CONN_ENTRY * conn, CSS_QUEUE_ENTRY * p, unsigned short *rid, int *request,
+				     int *buffer_size);
 static void clear_wait_queue_entry_and_free_buffer (THREAD_ENTRY * thrdp, CSS_CONN_ENTRY * conn, unsigned short rid,
 						    char **bufferp);
 static int css_return_queued_data_timeout (CSS_CONN_ENTRY * conn, unsigned short rid, char **buffer, int *bufsize,
@@ -308,6 +318,8 @@ css_initialize_conn (CSS_CONN_ENTRY * conn, SOCKET fd)
 #if defined(SERVER_MODE)
   conn->session_p = NULL;
   conn->client_type = DB_CLIENT_TYPE_UNKNOWN;
+  conn->pipeline_running = false;
+  conn->pipeline_rid = 0;
 #endif
 
   err = css_initialize_list (&conn->request_queue, 0);
@@ -382,6 +394,8 @@ css_shutdown_conn (CSS_CONN_ENTRY * conn)
       css_finalize_list (&conn->abort_queue);
       css_finalize_list (&conn->buffer_queue);
       css_finalize_list (&conn->error_queue);
+
+      conn->pipeline_running = false;
     }
 
   if (conn->free_queue_list != NULL)
@@ -2544,6 +2558,69 @@ css_is_request_aborted (CSS_CONN_ENTRY * conn, unsigned short request_id)
     }
 }
 
+/*
+ * css_find_startable_request() - find the first queued request that may be started
+ *   return: status of traverse
+ *   data(in): queue entry
+ *   user(in): search argument
+ */
+static int
+css_find_startable_request (void *data, void *user)
+{
+  CSS_REQUEST_SEARCH_ARG *arg = (CSS_REQUEST_SEARCH_ARG *) user;
+  CSS_QUEUE_ENTRY *p = (CSS_QUEUE_ENTRY *) data;
+  bool is_pipelined = (ntohs (((NET_HEADER *) p->buffer)->flags) & NET_HEADER_FLAG_PIPELINED) != 0;
+
+  if ((is_pipelined && arg->skip_pipelined) || (!is_pipelined && arg->pipelined_only))
+    {
+      return TRAV_CONT;
+    }
+
+  arg->entry_ptr = p;
+  return TRAV_STOP_DELETE;
+}
+
+/*
+ * css_start_queued_request() - return the request of a queue entry removed from request queue and free the entry
+ *   return: void
+ *   conn(in): connection entry
+ *   p(in): request queue entry
+ *   rid(out): request id
+ *   request(out): request
+ *   buffer_size(out): request buffer size
+ *
+ * Note: must be called with conn->rmutex locked.
+ */
+static void
+css_start_queued_request (CSS_CONN_ENTRY * conn, CSS_QUEUE_ENTRY * p, unsigned short *rid, int *request,
+			  int *buffer_size)
+{
+  NET_HEADER *buffer;
+
+  *rid = p->key;
+
+  buffer = (NET_HEADER *) p->buffer;
+  p->buffer = NULL;
+
+  *request = ntohs (buffer->function_code);
+  *buffer_size = ntohl (buffer->buffer_size);
+
+  if (ntohs (buffer->flags) & NET_HEADER_FLAG_PIPELINED)
+    {
+      assert (!conn->pipeline_running);
+      conn->pipeline_running = true;
+      conn->pipeline_rid = *rid;
+    }
+
+  conn->set_tran_index (p->transaction_id);
+  conn->invalidate_snapshot = p->invalidate_snapshot;
+  conn->db_error = p->db_error;
+
+  css_retire_net_header_entry (conn, buffer);
+
+  css_free_queue_entry (conn, p);
+}
+
 /*
  * css_return_queued_request() - get request from queue
  *   return: 0 if success, or error code
@@ -2551,12 +2628,14 @@ css_is_request_aborted (CSS_CONN_ENTRY * conn, unsigned short request_id)
  *   rid(out): request id
  *   request(out): request
  *   buffer_size(out): request buffer size
+ *
+ * Note: pipelined requests are skipped while another pipelined request of the connection is executed; see
+ *       css_return_next_pipelined_request.
  */
 int
 css_return_queued_request (CSS_CONN_ENTRY * conn, unsigned short *rid, int *request, int *buffer_size)
 {
-  CSS_QUEUE_ENTRY *p;
-  NET_HEADER *buffer;
+  CSS_REQUEST_SEARCH_ARG arg;
   int rc, r;
 
   r = rmutex_lock (NULL, &conn->rmutex);
@@ -2564,24 +2643,68 @@ css_return_queued_request (CSS_CONN_ENTRY * conn, unsigned short *rid, int *requ
 
   if (conn->status == CONN_OPEN)
     {
-      p = (CSS_QUEUE_ENTRY *) css_remove_list_from_head (&conn->request_queue);
-      if (p != NULL)
+      arg.entry_ptr = NULL;
+      arg.skip_pipelined = conn->pipeline_running;
+      arg.pipelined_only = false;
+      css_traverse_list (&conn->request_queue, css_find_startable_request, &arg);
+      if (arg.entry_ptr != NULL)
+	{
+	  css_start_queued_request (conn, arg.entry_ptr, rid, request, buffer_size);
+	  rc = NO_ERRORS;
+	}
+      else
 	{
-	  *rid = p->key;
+	  rc = NO_DATA_AVAILABLE;
+	}
+    }
+  else
+    {
+      rc = CONN_CLOSED;
+    }
 
-	  buffer = (NET_HEADER *) p->buffer;
-	  p->buffer = NULL;
+  r = rmutex_unlock (NULL, &conn->rmutex);
+  assert (r == NO_ERROR);
+  return rc;
+}
 
-	  *request = ntohs (buffer->function_code);
-	  *buffer_size = ntohl (buffer->buffer_size);
+/*
+ * css_return_next_pipelined_request() - end a request and, if it was pipelined, get the next pipelined request
+ *   return: 0 if next request is returned, NO_DATA_AVAILABLE if none, or error code
+ *   conn(in): connection entry
+ *   end_rid(in): request id of ended request
+ *   rid(out): request id
+ *   request(out): request
+ *   buffer_size(out): request buffer size
+ *
+ * Note: pipelined requests of a connection are executed one at a time, in the order they were sent. the thread that
+ *       ended one continues with the next; the threads started for the waiting requests find nothing to do.
+ */
+int
+css_return_next_pipelined_request (CSS_CONN_ENTRY * conn, unsigned short end_rid, unsigned short *rid, int *request,
+				   int *buffer_size)
+{
+  CSS_REQUEST_SEARCH_ARG arg;
+  int rc, r;
 
-	  conn->set_tran_index (p->transaction_id);
-	  conn->invalidate_snapshot = p->invalidate_snapshot;
-	  conn->db_error = p->db_error;
+  r = rmutex_lock (NULL, &conn->rmutex);
+  assert (r == NO_ERROR);
 
-	  css_retire_net_header_entry (conn, buffer);
+  if (!conn->pipeline_running || conn->pipeline_rid != end_rid)
+    {
+      /* ended request was not pipelined */
+      rc = NO_DATA_AVAILABLE;
+    }
+  else if (conn->status == CONN_OPEN)
+    {
+      conn->pipeline_running = false;
 
-	  css_free_queue_entry (conn, p);
+      arg.entry_ptr = NULL;
+      arg.skip_pipelined = false;
+      arg.pipelined_only = true;
+      css_traverse_list (&conn->request_queue, css_find_startable_request, &arg);
+      if (arg.entry_ptr != NULL)
+	{
+	  css_start_queued_request (conn, arg.entry_ptr, rid, request, buffer_size);
 	  rc = NO_ERRORS;
 	}
       else
@@ -2591,6 +2714,7 @@ css_return_queued_request (CSS_CONN_ENTRY * conn, unsigned short *rid, int *requ
     }
   else
     {
+      conn->pipeline_running = false;
       rc = CONN_CLOSED;
     }
 
@@ -1522,6 +1522,12 @@ css_send_request_with_data_buffer (CSS_CONN_ENTRY * conn, int request, unsigned
   *request_id = css_get_request_id (conn);
   css_set_net_header (&local_header, COMMAND_TYPE, request, *request_id, arg_size, conn->get_tran_index (),
 		      conn->invalidate_snapshot, conn->db_error);
+#if !defined (SERVER_MODE)
+  if (conn->send_pipelined)
+    {
+      local_header.flags |= htons (NET_HEADER_FLAG_PIPELINED);
+    }
+#endif /* !SERVER_MODE */
 
   if (reply_buffer && (reply_size > 0))
     {
@@ -1618,6 +1624,12 @@ css_send_req_with_2_buffers (CSS_CONN_ENTRY * conn, int request, unsigned short
   *request_id = css_get_request_id (conn);
   css_set_net_header (&local_header, COMMAND_TYPE, request, *request_id, arg_size, conn->get_tran_index (),
 		      conn->invalidate_snapshot, conn->db_error);
+#if !defined (SERVER_MODE)
+  if (conn->send_pipelined)
+    {
+      local_header.flags |= htons (NET_HEADER_FLAG_PIPELINED);
+    }
+#endif /* !SERVER_MODE */
 
   if (reply_buffer && reply_size > 0)
     {
@@ -1675,6 +1687,12 @@ css_send_req_with_3_buffers (CSS_CONN_ENTRY * conn, int request, unsigned short
   *request_id = css_get_request_id (conn);
   css_set_net_header (&local_header, COMMAND_TYPE, request, *request_id, arg_size, conn->get_tran_index (),
 		      conn->invalidate_snapshot, conn->db_error);
+#if !defined (SERVER_MODE)
+  if (conn->send_pipelined)
+    {
+      local_header.flags |= htons (NET_HEADER_FLAG_PIPELINED);
+    }
+#endif /* !SERVER_MODE */
 
   if (reply_buffer && reply_size > 0)
     {
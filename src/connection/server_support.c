@@ -31,6 +31,8 @@
 #include "session.h"
 #include "thread_entry_task.hpp"
 #include "thread_entry.hpp"
+#include "thread_daemon.hpp"
+#include "thread_looper.hpp"
 #include "thread_manager.hpp"
 #include "thread_worker_pool.hpp"
 
@@ -47,9 +49,20 @@
 #include <sys/socket.h>
 #include <fcntl.h>
 #include <netinet/in.h>
+#if defined (LINUX)
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#endif /* LINUX */
 #endif /* !WINDOWS */
 #include <assert.h>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "porting.h"
 #include "memory_alloc.h"
 #include "boot_sr.h"
@@ -203,6 +216,150 @@ private:
   CSS_CONN_ENTRY &m_conn;
 };
 
+#if defined (LINUX)
+// css_connection_reactor - handles the sockets of many client connections in a single thread, using epoll, as an
+//                          alternative to one css_connection_task (and one thread) for each connection.
+//
+//  The reactor does the job of css_connection_handler_thread for all its connections: requests are read and queued
+//  by css_read_and_queue when a socket is readable and new commands are pushed to transaction workers; connections
+//  are checked periodically for closing, for lost peers and for HA state changes.
+//
+//  Nothing that may block for long runs on the reactor thread. Peer-alive checks and the connection error handler
+//  (which waits for the transaction workers of the client) are pushed to the connection worker pool.
+//
+//  A packet is read by the reactor only if it is all in the socket receive buffer already, so reading it does not
+//  block. Otherwise, the socket is no longer watched and the packet is read by a connection thread, which watches the
+//  socket again when it is done. A stalled client blocks only that thread.
+//
+class css_connection_reactor : public cubthread::entry_task
+{
+public:
+  css_connection_reactor (int index);
+  ~css_connection_reactor ();
+
+  int init (void);
+  int add_connection (CSS_CONN_ENTRY &conn);
+  void er_log_stats (void) const;
+
+  void execute (context_type &thread_ref) override final;
+  void retire (void) override final
+  {
+    // reactor is owned by css_Connection_reactors; it is not deleted with its daemon
+  }
+
+private:
+  enum peer_state
+  {
+    PEER_ALIVE,
+    PEER_CHECK_PENDING,
+    PEER_DEAD
+  };
+
+  // reactor state of a connection; shared with the pending peer-alive check and the pending read of the connection
+  struct conn_state
+  {
+    CSS_CONN_ENTRY *m_conn;
+    SOCKET m_fd;
+    std::uint64_t m_key;    // socket and generation; connection entries and sockets are reused by new connections
+    std::chrono::steady_clock::time_point m_last_active;
+    std::atomic<int> m_peer_state;
+    std::atomic<bool> m_is_reading;   // a connection thread reads a packet; the socket is not watched
+    std::atomic<int> m_read_status;   // status of the last packet read by a connection thread
+
+    conn_state (CSS_CONN_ENTRY &conn, std::uint64_t key);
+  };
+
+  using conn_state_map = std::unordered_map<std::uint64_t, std::shared_ptr<conn_state>>;
+
+  class peer_alive_task : public cubthread::entry_task
+  {
+  public:
+    peer_alive_task (const std::shared_ptr<conn_state> &state)
+      : m_state (state)
+    {
+    }
+
+    void execute (context_type &thread_ref) override final;
+
+  private:
+    std::shared_ptr<conn_state> m_state;
+  };
+
+  // read_task - reads a packet that is not all received yet, on a connection thread
+  class read_task : public cubthread::entry_task
+  {
+  public:
+    read_task (css_connection_reactor &reactor, const std::shared_ptr<conn_state> &state)
+      : m_reactor (reactor)
+      , m_state (state)
+    {
+    }
+
+    void execute (context_type &thread_ref) override final;
+
+  private:
+    css_connection_reactor &m_reactor;
+    std::shared_ptr<conn_state> m_state;
+  };
+
+  static bool is_packet_received (SOCKET fd);
+
+  int watch_connection (conn_state &state);
+  void register_new_connections (void);
+  int read_connection (cubthread::entry &thread_ref, const std::shared_ptr<conn_state> &state, unsigned int events);
+  int check_connection (cubthread::entry &thread_ref, conn_state &state, std::chrono::steady_clock::time_point now);
+  void check_all_connections (cubthread::entry &thread_ref);
+  void remove_connection (conn_state_map::iterator &it, int status);
+
+  static const int MAX_EVENTS = 256;
+  static const int POLL_TIMEOUT_MSECS = 100;
+  static const int PEER_ALIVE_TIMEOUT_MSECS = 5000;
+
+  int m_index;
+  int m_epoll_fd;
+  std::atomic<std::uint32_t> m_next_generation;
+  std::atomic<int> m_reads_pending;   // read tasks not finished; they use the reactor
+  conn_state_map m_conns;
+  std::chrono::steady_clock::time_point m_last_check;
+
+  std::mutex m_new_conns_mutex;
+  std::vector<std::shared_ptr<conn_state>> m_new_conns;
+
+  // statistics
+  std::atomic<std::uint64_t> m_stat_conn_added;
+  std::atomic<std::uint64_t> m_stat_conn_closed;
+  std::atomic<std::uint64_t> m_stat_conn_down;
+  std::atomic<std::uint64_t> m_stat_wakeups;
+  std::atomic<std::uint64_t> m_stat_reads;
+  std::atomic<std::uint64_t> m_stat_reads_handed_off;
+  std::atomic<std::uint64_t> m_stat_commands;
+  std::atomic<std::uint64_t> m_stat_peer_checks;
+};
+
+// css_connection_down_task - executes the connection error handler of a connection removed from its reactor
+class css_connection_down_task : public cubthread::entry_task
+{
+public:
+
+  css_connection_down_task (void) = delete;
+
+  css_connection_down_task (CSS_CONN_ENTRY &conn)
+  : m_conn (conn)
+  {
+    //
+  }
+
+  void execute (context_type &thread_ref) override final;
+
+private:
+  CSS_CONN_ENTRY &m_conn;
+};
+
+static std::vector<css_connection_reactor *> css_Connection_reactors;
+static std::vector<cubthread::daemon *> css_Connection_reactor_daemons;
+static std::atomic<unsigned int> css_Connection_reactor_next (0);
+#endif /* LINUX */
+
 static const size_t CSS_JOB_QUEUE_SCAN_COLUMN_COUNT = 4;
 
 static void css_setup_server_loop (void);
@@ -223,6 +380,8 @@ static int css_reestablish_connection_to_master (void);
 static int css_connection_handler_thread (THREAD_ENTRY * thrd, CSS_CONN_ENTRY * conn);
 static css_error_code css_internal_connection_handler (CSS_CONN_ENTRY * conn);
 static int css_internal_request_handler (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_ref);
+static int css_execute_request (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_ref, unsigned short rid, int request,
+				int size, int local_tran_index);
 static int css_test_for_client_errors (CSS_CONN_ENTRY * conn, unsigned int eid);
 static int css_check_accessibility (SOCKET new_fd);
 
@@ -258,6 +417,8 @@ static cubthread::wait_seconds css_get_connection_thread_timeout_configuration (
 static bool css_get_server_request_thread_pooling_configuration (void);
 static cubthread::wait_seconds css_get_server_request_thread_timeout_configuration (void);
 static void css_start_all_threads (void);
+static int css_start_connection_reactors (void);
+static void css_stop_connection_reactors (void);
 // *INDENT-ON*
 
 #if defined (SERVER_MODE)
@@ -1182,6 +1343,19 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 {
   css_insert_into_active_conn_list (conn);
 
+#if defined (LINUX)
+  if (!css_Connection_reactors.empty ())
+    {
+      // connections are handled by reactors, assigned round robin
+      unsigned int reactor_index = css_Connection_reactor_next++ % (unsigned int) css_Connection_reactors.size ();
+      if (css_Connection_reactors[reactor_index]->add_connection (*conn) == NO_ERROR)
+	{
+	  return NO_ERRORS;
+	}
+      // fall back to a connection thread
+    }
+#endif /* LINUX */
+
   // push connection handler task
   cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_task (*conn));
 
@@ -1205,9 +1379,7 @@ static int
 css_internal_request_handler (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_ref)
 {
   unsigned short rid;
-  unsigned int eid;
   int request, rc, size = 0;
-  char *buffer = NULL;
   int local_tran_index;
   int status = CSS_UNPLANNED_SHUTDOWN;
 
@@ -1223,26 +1395,13 @@ css_internal_request_handler (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_r
 
       pthread_mutex_unlock (&thread_ref.tran_index_lock);
 
-      if (size)
+      status = css_execute_request (thread_ref, conn_ref, rid, request, size, local_tran_index);
+
+      /* pipelined requests of the connection are executed one at a time; continue with next one, if any */
+      while (css_return_next_pipelined_request (&conn_ref, rid, &rid, &request, &size) == NO_ERRORS)
 	{
-	  rc = css_receive_data (&conn_ref, rid, &buffer, &size, -1);
-	  if (rc != NO_ERRORS)
-	    {
-	      return status;
-	    }
+	  status = css_execute_request (thread_ref, conn_ref, rid, request, size, local_tran_index);
 	}
-
-      conn_ref.db_error = 0;	/* This will reset the error indicator */
-
-      eid = css_return_eid_from_conn (&conn_ref, rid);
-      /* 2. change thread's client, rid, tran_index for this request */
-      css_set_thread_info (&thread_ref, conn_ref.client_id, eid, conn_ref.get_tran_index (), request);
-
-      /* 3. Call server_request() function */
-      status = css_Server_request_handler (&thread_ref, eid, request, size, buffer);
-
-      /* 4. reset thread transaction id(may be NULL_TRAN_INDEX) */
-      css_set_thread_info (&thread_ref, -1, 0, local_tran_index, -1);
     }
   else
     {
@@ -1257,6 +1416,49 @@ css_internal_request_handler (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_r
   return status;
 }
 
+/*
+ * css_execute_request () - receive the data of a request and call the server request handler
+ *   return: status of request handler
+ *   thread_ref(in): thread entry
+ *   conn_ref(in): connection entry
+ *   rid(in): request id
+ *   request(in): request
+ *   size(in): request data size
+ *   local_tran_index(in): transaction index of thread, restored after request
+ */
+static int
+css_execute_request (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_ref, unsigned short rid, int request, int size,
+		     int local_tran_index)
+{
+  unsigned int eid;
+  int rc;
+  char *buffer = NULL;
+  int status = CSS_UNPLANNED_SHUTDOWN;
+
+  if (size)
+    {
+      rc = css_receive_data (&conn_ref, rid, &buffer, &size, -1);
+      if (rc != NO_ERRORS)
+	{
+	  return status;
+	}
+    }
+
+  conn_ref.db_error = 0;	/* This will reset the error indicator */
+
+  eid = css_return_eid_from_conn (&conn_ref, rid);
+  /* 2. change thread's client, rid, tran_index for this request */
+  css_set_thread_info (&thread_ref, conn_ref.client_id, eid, conn_ref.get_tran_index (), request);
+
+  /* 3. Call server_request() function */
+  status = css_Server_request_handler (&thread_ref, eid, request, size, buffer);
+
+  /* 4. reset thread transaction id(may be NULL_TRAN_INDEX) */
+  css_set_thread_info (&thread_ref, -1, 0, local_tran_index, -1);
+
+  return status;
+}
+
 /*
  * css_initialize_server_interfaces() - initialize the server interfaces
  *   return:
@@ -1356,6 +1558,12 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
       goto shutdown;
     }
 
+  if (css_start_connection_reactors () != NO_ERROR)
+    {
+      status = ER_FAILED;
+      goto shutdown;
+    }
+
   css_Server_connection_socket = INVALID_SOCKET;
 
   conn = css_connect_to_master_server (port_id, server_name, name_length);
@@ -1421,6 +1629,9 @@ shutdown:
   css_Server_request_worker_pool->er_log_stats ();
   css_Connection_worker_pool->er_log_stats ();
 
+  // stop reading connections before the connection threads that may still execute their error handlers
+  css_stop_connection_reactors ();
+
   // destroy thread worker pools
   thread_get_manager ()->destroy_worker_pool (css_Server_request_worker_pool);
   thread_get_manager ()->destroy_worker_pool (css_Connection_worker_pool);
@@ -2809,6 +3020,524 @@ css_connection_task::execute (context_type & thread_ref)
   thread_ref.conn_entry = NULL;
 }
 
+#if defined (LINUX)
+void
+css_connection_down_task::execute (context_type &thread_ref)
+{
+  thread_ref.conn_entry = &m_conn;
+  thread_ref.type = TT_SERVER;
+
+  // connection error handler expects tran_index_lock to be locked, like in css_connection_handler_thread
+  pthread_mutex_lock (&thread_ref.tran_index_lock);
+  (void) (*css_Connection_error_handler) (&thread_ref, &m_conn);
+
+  thread_ref.conn_entry = NULL;
+}
+
+css_connection_reactor::conn_state::conn_state (CSS_CONN_ENTRY &conn, std::uint64_t key)
+  : m_conn (&conn)
+  , m_fd (conn.fd)
+  , m_key (key)
+  , m_last_active (std::chrono::steady_clock::now ())
+  , m_peer_state (PEER_ALIVE)
+  , m_is_reading (false)
+  , m_read_status (NO_ERRORS)
+{
+}
+
+void
+css_connection_reactor::peer_alive_task::execute (context_type &thread_ref)
+{
+  (void) thread_ref;    // suppress unused warning
+
+  bool is_alive = css_peer_alive (m_state->m_fd, PEER_ALIVE_TIMEOUT_MSECS);
+  m_state->m_peer_state = is_alive ? PEER_ALIVE : PEER_DEAD;
+}
+
+void
+css_connection_reactor::read_task::execute (context_type &thread_ref)
+{
+  CSS_CONN_ENTRY *conn = m_state->m_conn;
+  int status, type;
+
+  thread_ref.type = TT_SERVER;
+  thread_ref.conn_entry = conn;
+  status = css_read_and_queue (conn, &type);
+  thread_ref.conn_entry = NULL;
+
+  if (status == NO_ERRORS && type == COMMAND_TYPE)
+    {
+      css_push_server_task (*conn);
+      ++m_reactor.m_stat_commands;
+    }
+
+  // watch the socket again before the reactor may see the connection as not reading; on error, the connection is
+  // removed by the next check of the reactor
+  if (status == NO_ERRORS && m_reactor.watch_connection (*m_state) != NO_ERROR)
+    {
+      status = ERROR_ON_READ;
+    }
+  m_state->m_read_status = status;
+  m_state->m_last_active = std::chrono::steady_clock::now ();
+  m_state->m_is_reading = false;
+
+  // last access to the reactor
+  --m_reactor.m_reads_pending;
+}
+
+css_connection_reactor::css_connection_reactor (int index)
+  : m_index (index)
+  , m_epoll_fd (-1)
+  , m_next_generation (0)
+  , m_reads_pending (0)
+  , m_conns ()
+  , m_last_check (std::chrono::steady_clock::now ())
+  , m_new_conns_mutex ()
+  , m_new_conns ()
+  , m_stat_conn_added (0)
+  , m_stat_conn_closed (0)
+  , m_stat_conn_down (0)
+  , m_stat_wakeups (0)
+  , m_stat_reads (0)
+  , m_stat_reads_handed_off (0)
+  , m_stat_commands (0)
+  , m_stat_peer_checks (0)
+{
+}
+
+css_connection_reactor::~css_connection_reactor ()
+{
+  // the read tasks still running watch sockets in the epoll set; they end when their client sends the rest of the
+  // packet or the connection is closed
+  while (m_reads_pending > 0)
+    {
+      std::this_thread::sleep_for (std::chrono::milliseconds (10));
+    }
+
+  if (m_epoll_fd >= 0)
+    {
+      close (m_epoll_fd);
+    }
+}
+
+int
+css_connection_reactor::init (void)
+{
+  m_epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+  if (m_epoll_fd < 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_CONN_INIT, 0);
+      return ER_CSS_CONN_INIT;
+    }
+  return NO_ERROR;
+}
+
+//
+// add_connection () - start handling a new connection
+//
+// return    : NO_ERROR, or error code if the connection socket cannot be watched
+// conn (in) : new connection
+//
+// note: called by the master thread. the connection is registered before its socket is watched, so the reactor knows
+//       it when the first event arrives.
+//
+int
+css_connection_reactor::add_connection (CSS_CONN_ENTRY &conn)
+{
+  // the events of a socket closed and reused by a new connection are not taken for the events of the new connection
+  std::uint64_t key = ((std::uint64_t) m_next_generation++ << 32) | (std::uint32_t) conn.fd;
+  std::shared_ptr<conn_state> state = std::make_shared<conn_state> (conn, key);
+
+  {
+    std::unique_lock<std::mutex> ulock (m_new_conns_mutex);
+    m_new_conns.push_back (state);
+  }
+
+  if (watch_connection (*state) != NO_ERROR)
+    {
+      std::unique_lock<std::mutex> ulock (m_new_conns_mutex);
+      for (auto it = m_new_conns.begin (); it != m_new_conns.end (); ++it)
+	{
+	  if (it->get () == state.get ())
+	    {
+	      m_new_conns.erase (it);
+	      break;
+	    }
+	}
+      return ER_FAILED;
+    }
+
+  ++m_stat_conn_added;
+  return NO_ERROR;
+}
+
+//
+// watch_connection () - add the socket of a connection to the epoll set of the reactor
+//
+// return     : NO_ERROR, or ER_FAILED if the socket cannot be watched
+// state (in) : connection state
+//
+int
+css_connection_reactor::watch_connection (conn_state &state)
+{
+  struct epoll_event ev;
+
+  ev.events = EPOLLIN;
+  ev.data.u64 = state.m_key;
+  if (epoll_ctl (m_epoll_fd, EPOLL_CTL_ADD, state.m_fd, &ev) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::watch_connection: epoll_ctl() error %d\n", errno);
+      return ER_FAILED;
+    }
+  return NO_ERROR;
+}
+
+void
+css_connection_reactor::register_new_connections (void)
+{
+  std::unique_lock<std::mutex> ulock (m_new_conns_mutex);
+
+  for (std::shared_ptr<conn_state> &state : m_new_conns)
+    {
+      m_conns[state->m_key] = state;
+    }
+  m_new_conns.clear ();
+}
+
+//
+// execute () - one reactor loop; wait for events on connection sockets, read and queue requests and check
+//              connections
+//
+void
+css_connection_reactor::execute (context_type &thread_ref)
+{
+  struct epoll_event events[MAX_EVENTS];
+  int n;
+
+  thread_ref.type = TT_SERVER;
+
+  n = epoll_wait (m_epoll_fd, events, MAX_EVENTS, POLL_TIMEOUT_MSECS);
+  if (n < 0 && errno != EINTR)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::execute: epoll_wait() error %d\n", errno);
+    }
+  ++m_stat_wakeups;
+
+  // after epoll_wait, so all connections with events are known
+  register_new_connections ();
+
+  for (int i = 0; i < n; i++)
+    {
+      conn_state_map::iterator it = m_conns.find (events[i].data.u64);
+      if (it == m_conns.end ())
+	{
+	  // already removed
+	  continue;
+	}
+
+      int status = read_connection (thread_ref, it->second, events[i].events);
+      if (status != NO_ERRORS)
+	{
+	  remove_connection (it, status);
+	}
+    }
+
+  if (std::chrono::steady_clock::now () - m_last_check >= std::chrono::milliseconds (POLL_TIMEOUT_MSECS))
+    {
+      check_all_connections (thread_ref);
+    }
+}
+
+//
+// is_packet_received () - is the next packet of a readable socket all in its receive buffer, so that
+//                         css_read_and_queue does not block?
+//
+// return  : true if the packet is received, or if the socket has no data; then it is closed or has an error, and the
+//           read returns at once
+// fd (in) : readable socket
+//
+// note: a packet is a header; the data of a data or error packet follows it in the same read
+//
+bool
+css_connection_reactor::is_packet_received (SOCKET fd)
+{
+  char header_buf[sizeof (int) + sizeof (NET_HEADER)];	// header length and header
+  NET_HEADER header;
+  int available, needed, type, size;
+
+  if (ioctl (fd, FIONREAD, &available) != 0 || available == 0)
+    {
+      return true;
+    }
+
+  needed = (int) sizeof (header_buf);
+  if (available < needed)
+    {
+      return false;
+    }
+  if (recv (fd, header_buf, sizeof (header_buf), MSG_PEEK | MSG_DONTWAIT) != (ssize_t) sizeof (header_buf))
+    {
+      return false;
+    }
+  memcpy (&header, header_buf + sizeof (int), sizeof (NET_HEADER));
+
+  type = ntohl (header.type);
+  if (type == DATA_TYPE || type == ERROR_TYPE)
+    {
+      size = ntohl (header.buffer_size);
+      needed += (int) sizeof (int) + MAX (size, 0);
+    }
+  return available >= needed;
+}
+
+//
+// read_connection () - read and queue a request from a readable connection; what css_connection_handler_thread does
+//                      when poll returns
+//
+int
+css_connection_reactor::read_connection (cubthread::entry &thread_ref, const std::shared_ptr<conn_state> &state,
+					 unsigned int events)
+{
+  CSS_CONN_ENTRY *conn = state->m_conn;
+  int status, type;
+
+  if (conn->stop_talk || state->m_is_reading)
+    {
+      // removed on next check, or the read task is about to finish
+      return NO_ERRORS;
+    }
+
+  state->m_last_active = std::chrono::steady_clock::now ();
+
+  if (events & (EPOLLERR | EPOLLHUP))
+    {
+      return ERROR_ON_READ;
+    }
+
+  if (!is_packet_received (state->m_fd))
+    {
+      // the rest of the packet may take long to arrive; read it on a connection thread and stop watching the socket
+      // until then
+      (void) epoll_ctl (m_epoll_fd, EPOLL_CTL_DEL, state->m_fd, NULL);
+      state->m_is_reading = true;
+      ++m_reads_pending;
+      ++m_stat_reads_handed_off;
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool, new read_task (*this, state));
+      return NO_ERRORS;
+    }
+
+  thread_ref.conn_entry = conn;
+  status = css_read_and_queue (conn, &type);
+  thread_ref.conn_entry = NULL;
+  ++m_stat_reads;
+
+  if (status != NO_ERRORS)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::read_connection: css_read_and_queue() error\n");
+      return status;
+    }
+
+  if (type == COMMAND_TYPE)
+    {
+      // push new task
+      css_push_server_task (*conn);
+      ++m_stat_commands;
+    }
+  return NO_ERRORS;
+}
+
+//
+// check_connection () - check a connection is still open, its client is alive and it may stay connected; what
+//                       css_connection_handler_thread does between polls
+//
+// return     : NO_ERRORS to keep the connection, CONNECTION_CLOSED if the connection stops talking
+//              (CONNECTION_CLOSED or ERROR_ON_READ), or the status why the connection is lost
+//
+int
+css_connection_reactor::check_connection (cubthread::entry &thread_ref, conn_state &state,
+					  std::chrono::steady_clock::time_point now)
+{
+  CSS_CONN_ENTRY *conn = state.m_conn;
+  int conn_status;
+
+  conn_status = conn->status;
+  if (conn_status == CONN_CLOSING)
+    {
+      // synchronize with worker thread which may be in sboot_notify_unregister_client; see
+      // css_connection_handler_thread
+      rmutex_lock (&thread_ref, &conn->rmutex);
+      conn_status = conn->status;
+      rmutex_unlock (&thread_ref, &conn->rmutex);
+    }
+
+  if (conn_status != CONN_OPEN)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::check_connection: conn->status (%d) is not CONN_OPEN.",
+		    conn_status);
+      return CONNECTION_CLOSED;
+    }
+
+  if (state.m_peer_state == PEER_DEAD)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::check_connection: css_peer_alive() error\n");
+      return CONNECTION_CLOSED;
+    }
+
+  if (now - state.m_last_active < std::chrono::milliseconds (PEER_ALIVE_TIMEOUT_MSECS))
+    {
+      return NO_ERRORS;
+    }
+  state.m_last_active = now;
+
+  if (CHECK_CLIENT_IS_ALIVE () && state.m_peer_state == PEER_ALIVE)
+    {
+      // may take up to PEER_ALIVE_TIMEOUT_MSECS; the result is seen by a later check
+      state.m_peer_state = PEER_CHECK_PENDING;
+      ++m_stat_peer_checks;
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool,
+					    new peer_alive_task (m_conns.find (state.m_key)->second));
+    }
+
+  /* check server's HA state */
+  if (ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+      && css_count_transaction_worker_threads (&thread_ref, conn->get_tran_index (), conn->client_id) == 0)
+    {
+      return REQUEST_REFUSED;
+    }
+
+  return NO_ERRORS;
+}
+
+void
+css_connection_reactor::check_all_connections (cubthread::entry &thread_ref)
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now ();
+
+  m_last_check = now;
+  for (conn_state_map::iterator it = m_conns.begin (); it != m_conns.end ();)
+    {
+      int status = NO_ERRORS;
+
+      if (it->second->m_is_reading)
+	{
+	  // a connection thread reads a packet; the connection is checked when it is done
+	  ++it;
+	  continue;
+	}
+
+      status = it->second->m_read_status;
+      if (status == NO_ERRORS && !it->second->m_conn->stop_talk)
+	{
+	  status = check_connection (thread_ref, *it->second, now);
+	  if (status == NO_ERRORS)
+	    {
+	      ++it;
+	      continue;
+	    }
+	}
+      // stopped talking or lost
+      remove_connection (it, status);
+    }
+}
+
+//
+// remove_connection () - stop handling a connection; if it was lost, push its error handler to a connection thread
+//
+// it (in/out) : connection iterator; is moved to next connection
+// status (in) : why the connection is removed; NO_ERRORS if it stopped talking
+//
+void
+css_connection_reactor::remove_connection (conn_state_map::iterator &it, int status)
+{
+  CSS_CONN_ENTRY *conn = it->second->m_conn;
+
+  // the socket may have been closed already
+  (void) epoll_ctl (m_epoll_fd, EPOLL_CTL_DEL, it->second->m_fd, NULL);
+  it = m_conns.erase (it);
+  ++m_stat_conn_closed;
+
+  if (status != NO_ERRORS || css_check_conn (conn) != NO_ERROR)
+    {
+      er_log_debug (ARG_FILE_LINE,
+		    "css_connection_reactor::remove_connection: status %d conn { status %d transaction_id %d "
+		    "db_error %d stop_talk %d stop_phase %d }\n", status, conn->status, conn->get_tran_index (),
+		    conn->db_error, conn->stop_talk, conn->stop_phase);
+      ++m_stat_conn_down;
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_down_task (*conn));
+    }
+  else
+    {
+      assert (conn->stop_talk == true);
+    }
+}
+
+void
+css_connection_reactor::er_log_stats (void) const
+{
+  _er_log_debug (ARG_FILE_LINE, "connection reactor %d statistics: connections added = %llu, removed = %llu, "
+		 "lost = %llu; wakeups = %llu, reads = %llu, reads by connection threads = %llu, commands = %llu, "
+		 "peer alive checks = %llu\n", m_index, (unsigned long long) m_stat_conn_added,
+		 (unsigned long long) m_stat_conn_closed, (unsigned long long) m_stat_conn_down,
+		 (unsigned long long) m_stat_wakeups, (unsigned long long) m_stat_reads,
+		 (unsigned long long) m_stat_reads_handed_off, (unsigned long long) m_stat_commands,
+		 (unsigned long long) m_stat_peer_checks);
+}
+#endif /* LINUX */
+
+//
+// css_start_connection_reactors () - start the connection reactors configured by thread_connection_reactor_count;
+//                                    with no reactors, each connection is handled by its own connection thread
+//
+static int
+css_start_connection_reactors (void)
+{
+#if defined (LINUX)
+  int reactor_count = prm_get_integer_value (PRM_ID_THREAD_CONNECTION_REACTOR_COUNT);
+  int error;
+
+  for (int i = 0; i < reactor_count; i++)
+    {
+      css_connection_reactor *reactor = new css_connection_reactor (i);
+
+      error = reactor->init ();
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  delete reactor;
+	  css_stop_connection_reactors ();
+	  return error;
+	}
+      css_Connection_reactors.push_back (reactor);
+
+      // the reactor waits for events itself; loop without sleeping
+      cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (0));
+      css_Connection_reactor_daemons.push_back (cubthread::get_manager ()->create_daemon (looper, reactor,
+						"connection_reactor"));
+    }
+#endif /* LINUX */
+
+  return NO_ERROR;
+}
+
+static void
+css_stop_connection_reactors (void)
+{
+#if defined (LINUX)
+  for (cubthread::daemon *&daemon_p : css_Connection_reactor_daemons)
+    {
+      cubthread::get_manager ()->destroy_daemon (daemon_p);
+    }
+  css_Connection_reactor_daemons.clear ();
+
+  for (css_connection_reactor *reactor : css_Connection_reactors)
+    {
+      reactor->er_log_stats ();
+      delete reactor;
+    }
+  css_Connection_reactors.clear ();
+#endif /* LINUX */
+}
+
 //
 // css_stop_non_log_writer () - function mapped over worker pools to search and stop non-log writer workers
 //
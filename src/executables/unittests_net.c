@@ -0,0 +1,619 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * unittests_net.c : tests and benchmark of pipelined client requests
+ *
+ * Checks against a running server that it advertises pipelining in the handshake, that replies of pipelined requests
+ * reach the requests that sent them, that queries execute correctly when the end of previous queries is sent ahead of
+ * them, and that such a query can be interrupted.
+ *
+ * When the server handles connections with reactor threads (thread_connection_reactor_count > 0), it also connects
+ * and disconnects many times, sending requests too large to be received at once, so that connection entries and
+ * sockets are reused while reads are handed to connection threads.
+ *
+ * With a request count, it also sends small requests (NET_SERVER_PING) one round trip at a time, then pipelined in
+ * batches of growing depth, and prints the time of each request. Network latency dominates the time of such
+ * requests; run it against a remote server (database@host) to measure what pipelining saves.
+ *
+ * usage: unittests_net database[@host] [request count [max pipeline depth]]
+ */
+
+#include "porting.h"
+#include "dbi.h"
+#include "dbtype.h"
+#include "error_manager.h"
+#include "network.h"
+#include "network_interface_cl.h"
+#include "object_representation.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#define DEFAULT_MAX_DEPTH	  32
+
+/* more than the number of queries whose end is deferred by the client */
+#define END_QUERY_TEST_COUNT	  32
+
+/* runs for minutes unless interrupted */
+#define LONG_QUERY \
+  "SELECT COUNT (*) FROM db_attribute a, db_attribute b, db_attribute c, db_attribute d"
+#define INTERRUPT_DELAY_USEC	  200000
+
+#define RECONNECT_TEST_COUNT	  200
+/* every few connections, a query larger than a socket receive buffer */
+#define RECONNECT_LARGE_QUERY_PERIOD 10
+#define LARGE_QUERY_STRING_SIZE	  (4 * 1024 * 1024)
+
+static struct timeval start_time;
+
+static void
+begin (const char *test_name)
+{
+  printf ("%-40s", test_name);
+  fflush (stdout);
+
+  gettimeofday (&start_time, NULL);
+}
+
+static void
+end (int request_count, double *usec_per_request)
+{
+  struct timeval end_time;
+  double elapsed_usec;
+
+  gettimeofday (&end_time, NULL);
+  elapsed_usec = (end_time.tv_sec - start_time.tv_sec) * 1000000.0 + (end_time.tv_usec - start_time.tv_usec);
+  *usec_per_request = elapsed_usec / request_count;
+
+  printf ("%10.3f sec %10.2f usec/request\n", elapsed_usec / 1000000.0, *usec_per_request);
+}
+
+/*
+ * test_sync_requests () - send requests one round trip at a time
+ *
+ * return            : error code
+ * request_count (in) : number of requests
+ */
+static int
+test_sync_requests (int request_count)
+{
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_request;
+  char *request = OR_ALIGNED_BUF_START (a_request);
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  int reply_val;
+  int error;
+  int i;
+
+  for (i = 0; i < request_count; i++)
+    {
+      or_pack_int (request, i);
+      error = net_client_request (NET_SERVER_PING, request, OR_INT_SIZE, reply, OR_INT_SIZE, NULL, 0, NULL, 0);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      /* the server echoes the request */
+      or_unpack_int (reply, &reply_val);
+      if (reply_val != i)
+	{
+	  fprintf (stderr, "request %d got reply %d\n", i, reply_val);
+	  return ER_FAILED;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * test_pipelined_requests () - send requests in pipelined batches; the replies of a batch are received after all its
+ *                              requests are sent
+ *
+ * return            : error code
+ * request_count (in) : number of requests
+ * depth (in)         : number of requests in a batch
+ */
+static int
+test_pipelined_requests (int request_count, int depth)
+{
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_request;
+  char *request = OR_ALIGNED_BUF_START (a_request);
+  int *replies;
+  unsigned int *rcs;
+  int error = NO_ERROR;
+  int sent, received, batch;
+  int i;
+
+  /* reply buffers must be valid until replies are received */
+  replies = (int *) malloc (depth * sizeof (int));
+  rcs = (unsigned int *) malloc (depth * sizeof (unsigned int));
+  if (replies == NULL || rcs == NULL)
+    {
+      error = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, depth * (sizeof (int) + sizeof (unsigned int)));
+      goto end;
+    }
+
+  for (sent = 0; sent < request_count; sent += batch)
+    {
+      batch = MIN (depth, request_count - sent);
+
+      for (i = 0; i < batch; i++)
+	{
+	  or_pack_int (request, sent + i);
+	  error = net_client_request_pipelined (NET_SERVER_PING, request, OR_INT_SIZE, (char *) &replies[i],
+						OR_INT_SIZE, NULL, 0, NULL, 0, &rcs[i]);
+	  if (error != NO_ERROR)
+	    {
+	      batch = i;
+	      break;
+	    }
+	}
+
+      /* receive all replies of sent requests, even after an error */
+      for (received = 0; received < batch; received++)
+	{
+	  int reply_error = net_client_receive_pipelined_reply (rcs[received], NET_SERVER_PING,
+								(char *) &replies[received], OR_INT_SIZE, NULL, 0);
+	  int reply_val;
+
+	  if (reply_error != NO_ERROR)
+	    {
+	      if (error == NO_ERROR)
+		{
+		  error = reply_error;
+		}
+	      continue;
+	    }
+
+	  /* the server echoes the request; the reply must be the one of this request */
+	  or_unpack_int ((char *) &replies[received], &reply_val);
+	  if (reply_val != sent + received && error == NO_ERROR)
+	    {
+	      fprintf (stderr, "request %d got reply %d\n", sent + received, reply_val);
+	      error = ER_FAILED;
+	    }
+	}
+
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+end:
+  if (replies != NULL)
+    {
+      free (replies);
+    }
+  if (rcs != NULL)
+    {
+      free (rcs);
+    }
+  return error;
+}
+
+/*
+ * test_reply_order () - check that replies of pipelined requests reach their requests, also when synchronous requests
+ *                       are sent between batches
+ *
+ * return : error code
+ */
+static int
+test_reply_order (void)
+{
+  int depth;
+  int error;
+
+  for (depth = 1; depth <= DEFAULT_MAX_DEPTH; depth *= 2)
+    {
+      error = test_pipelined_requests (depth * 3 + 1, depth);
+      if (error == NO_ERROR)
+	{
+	  error = test_sync_requests (2);
+	}
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * query_int () - execute a query returning one integer
+ *
+ * return     : error code
+ * sql (in)   : query
+ * value (out) : result
+ */
+static int
+query_int (const char *sql, int *value)
+{
+  DB_QUERY_RESULT *result = NULL;
+  DB_QUERY_ERROR query_error;
+  DB_VALUE db_value;
+  int error;
+
+  error = db_execute (sql, &result, &query_error);
+  if (error >= 0)
+    {
+      error = db_query_first_tuple (result);
+    }
+  if (error == NO_ERROR)
+    {
+      error = db_query_get_tuple_value (result, 0, &db_value);
+    }
+  if (error == NO_ERROR)
+    {
+      *value = (DB_VALUE_TYPE (&db_value) == DB_TYPE_BIGINT) ? (int) db_get_bigint (&db_value) : db_get_int (&db_value);
+      db_value_clear (&db_value);
+    }
+  if (result != NULL)
+    {
+      /* the end of the query is deferred and sent ahead of a later query execution */
+      db_query_end (result);
+    }
+
+  return error < 0 ? error : NO_ERROR;
+}
+
+/*
+ * test_end_query_ahead () - execute more queries than the client defers the end of, and check their results
+ *
+ * return : error code
+ */
+static int
+test_end_query_ahead (void)
+{
+  char sql[64];
+  int value;
+  int error;
+  int i;
+
+  for (i = 0; i < END_QUERY_TEST_COUNT; i++)
+    {
+      sprintf (sql, "SELECT %d FROM db_root", i);
+      error = query_int (sql, &value);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      if (value != i)
+	{
+	  fprintf (stderr, "%s returned %d\n", sql, value);
+	  return ER_FAILED;
+	}
+    }
+
+  return db_commit_transaction ();
+}
+
+static void *
+interrupt_thread (void *arg)
+{
+  usleep (INTERRUPT_DELAY_USEC);
+  db_set_interrupt (1);
+  return NULL;
+}
+
+/*
+ * test_interrupt () - interrupt a query executed after the end of previous queries was sent ahead of it, then check
+ *                     that the connection still works
+ *
+ * return : error code
+ */
+static int
+test_interrupt (void)
+{
+  pthread_t thread;
+  char sql[64];
+  int value;
+  int error;
+  int i;
+
+  /* collect deferred ends, so that the long query is pipelined after them */
+  for (i = 0; i < END_QUERY_TEST_COUNT; i++)
+    {
+      sprintf (sql, "SELECT %d FROM db_root", i);
+      error = query_int (sql, &value);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  if (pthread_create (&thread, NULL, interrupt_thread, NULL) != 0)
+    {
+      return ER_FAILED;
+    }
+  error = query_int (LONG_QUERY, &value);
+  pthread_join (thread, NULL);
+  db_set_interrupt (0);
+
+  if (error != ER_INTERRUPTED)
+    {
+      fprintf (stderr, "interrupted query returned %d instead of %d\n", error, ER_INTERRUPTED);
+      return ER_FAILED;
+    }
+  er_clear ();
+  (void) db_abort_transaction ();
+
+  error = test_reply_order ();
+  if (error == NO_ERROR)
+    {
+      error = test_end_query_ahead ();
+    }
+  return error;
+}
+
+/*
+ * boot () - log in and boot the database
+ *
+ * return             : error code
+ * program_name (in)  : program name
+ * database_name (in) : database[@host]
+ */
+static int
+boot (const char *program_name, const char *database_name)
+{
+  int error;
+
+  error = db_login ("DBA", NULL);
+  if (error == NO_ERROR)
+    {
+      error = db_restart (program_name, TRUE, database_name);
+    }
+  return error;
+}
+
+/*
+ * get_connection_reactor_count () - get thread_connection_reactor_count of the server
+ *
+ * return      : error code
+ * count (out) : number of connection reactors
+ */
+static int
+get_connection_reactor_count (int *count)
+{
+  char data[LINE_MAX] = "thread_connection_reactor_count";
+  const char *value;
+  int error;
+
+  error = db_get_system_parameters (data, LINE_MAX);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  value = strchr (data, '=');
+  if (value == NULL)
+    {
+      return ER_FAILED;
+    }
+  *count = atoi (value + 1);
+  return NO_ERROR;
+}
+
+/*
+ * test_reconnect () - disconnect and connect again many times and check queries on each connection, some of them too
+ *                     large to be received at once
+ *
+ * return             : error code
+ * program_name (in)  : program name
+ * database_name (in) : database[@host]
+ */
+static int
+test_reconnect (const char *program_name, const char *database_name)
+{
+  const char *large_query_head = "SELECT LENGTH ('";
+  const char *large_query_tail = "') FROM db_root";
+  char *large_query;
+  char sql[64];
+  int value;
+  int error = NO_ERROR;
+  int i;
+
+  large_query = (char *) malloc (strlen (large_query_head) + LARGE_QUERY_STRING_SIZE + strlen (large_query_tail) + 1);
+  if (large_query == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  strcpy (large_query, large_query_head);
+  memset (large_query + strlen (large_query_head), 'x', LARGE_QUERY_STRING_SIZE);
+  strcpy (large_query + strlen (large_query_head) + LARGE_QUERY_STRING_SIZE, large_query_tail);
+
+  for (i = 0; i < RECONNECT_TEST_COUNT && error == NO_ERROR; i++)
+    {
+      db_shutdown ();
+      error = boot (program_name, database_name);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      sprintf (sql, "SELECT %d FROM db_root", i);
+      error = query_int (sql, &value);
+      if (error == NO_ERROR && value != i)
+	{
+	  fprintf (stderr, "%s returned %d\n", sql, value);
+	  error = ER_FAILED;
+	}
+      if (error == NO_ERROR && i % RECONNECT_LARGE_QUERY_PERIOD == 0)
+	{
+	  error = query_int (large_query, &value);
+	  if (error == NO_ERROR && value != LARGE_QUERY_STRING_SIZE)
+	    {
+	      fprintf (stderr, "large query returned %d instead of %d\n", value, LARGE_QUERY_STRING_SIZE);
+	      error = ER_FAILED;
+	    }
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+    }
+
+  free (large_query);
+  return error;
+}
+
+int
+main (int argc, char **argv)
+{
+  const char *database_name;
+  int request_count = 0;
+  int max_depth = DEFAULT_MAX_DEPTH;
+  double sync_usec, pipelined_usec;
+  char test_name[64];
+  int reactor_count;
+  int depth;
+  int error;
+
+  if (argc < 2)
+    {
+      fprintf (stderr, "usage: %s database[@host] [request count [max pipeline depth]]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  database_name = argv[1];
+  if (argc > 2)
+    {
+      request_count = atoi (argv[2]);
+    }
+  if (argc > 3)
+    {
+      max_depth = atoi (argv[3]);
+    }
+  if (argc > 2 && (request_count <= 0 || max_depth <= 0))
+    {
+      fprintf (stderr, "request count and max pipeline depth must be positive\n");
+      return EXIT_FAILURE;
+    }
+
+  error = boot (argv[0], database_name);
+  if (error != NO_ERROR)
+    {
+      fprintf (stderr, "%s\n", db_error_string (3));
+      return EXIT_FAILURE;
+    }
+
+  printf ("============================================================\n");
+  printf ("%-40s", "pipelining capability");
+  if (!net_client_is_pipelining_enabled ())
+    {
+      /* the server of the same release must advertise NET_CAP_PIPELINED_REQUESTS in the handshake */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERFACE_NOT_SUPPORTED_OPERATION, 0);
+      goto fail;
+    }
+  printf ("ok\n");
+
+  printf ("%-40s", "reply order");
+  fflush (stdout);
+  error = test_reply_order ();
+  if (error != NO_ERROR)
+    {
+      goto fail;
+    }
+  printf ("ok\n");
+
+  printf ("%-40s", "end query ahead of execution");
+  fflush (stdout);
+  error = test_end_query_ahead ();
+  if (error != NO_ERROR)
+    {
+      goto fail;
+    }
+  printf ("ok\n");
+
+  printf ("%-40s", "interrupt");
+  fflush (stdout);
+  error = test_interrupt ();
+  if (error != NO_ERROR)
+    {
+      goto fail;
+    }
+  printf ("ok\n");
+
+  printf ("%-40s", "reconnect to connection reactors");
+  fflush (stdout);
+  error = get_connection_reactor_count (&reactor_count);
+  if (error != NO_ERROR)
+    {
+      goto fail;
+    }
+  if (reactor_count > 0)
+    {
+      error = test_reconnect (argv[0], database_name);
+      if (error != NO_ERROR)
+	{
+	  goto fail;
+	}
+      printf ("ok\n");
+    }
+  else
+    {
+      printf ("skipped (thread_connection_reactor_count = 0)\n");
+    }
+
+  if (request_count == 0)
+    {
+      printf ("============================================================\n");
+      db_shutdown ();
+      return EXIT_SUCCESS;
+    }
+
+  printf ("============================================================\n");
+  printf ("Round trip bound requests (%d requests):\n", request_count);
+
+  begin ("synchronous");
+  error = test_sync_requests (request_count);
+  if (error != NO_ERROR)
+    {
+      goto fail;
+    }
+  end (request_count, &sync_usec);
+
+  for (depth = 2; depth <= max_depth; depth *= 2)
+    {
+      sprintf (test_name, "pipelined, depth %d", depth);
+      begin (test_name);
+      error = test_pipelined_requests (request_count, depth);
+      if (error != NO_ERROR)
+	{
+	  goto fail;
+	}
+      end (request_count, &pipelined_usec);
+      printf ("%-40s%10.2fx\n", "  speedup", sync_usec / pipelined_usec);
+    }
+
+  printf ("============================================================\n");
+  db_shutdown ();
+  return EXIT_SUCCESS;
+
+fail:
+  printf ("failed\n");
+  fprintf (stderr, "%s\n", db_error_string (3));
+  db_shutdown ();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,919 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * unittests_query.c : regression tests of query processing, run against an existing database
+ *
+ * Each test sets the system parameters it needs through the environment or for its session, boots the database,
+ * checks query results and shuts the database down. Tests create and drop their own tables.
+ *
+ * unittests_query runs in stand-alone mode; unittests_query_cs is built from the same source and connects to a
+ * running server, where parallel query execution is available.
+ *
+ * usage: unittests_query database [test name]
+ *        without a test name, all tests are run
+ */
+
+#include "porting.h"
+#include "dbi.h"
+#include "dbtype.h"
+#include "environment_variable.h"
+#include "error_manager.h"
+#include "optimizer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef int (*TEST_FUNC) (const char *db_name);
+
+typedef struct test_entry TEST_ENTRY;
+struct test_entry
+{
+  const char *name;
+  TEST_FUNC func;
+};
+
+static const char *program_name;
+
+/*
+ * boot () - log in and boot the database
+ *
+ * return       : error code
+ * db_name (in) : database name
+ */
+static int
+boot (const char *db_name)
+{
+  int error;
+
+  error = db_login ("DBA", NULL);
+  if (error == NO_ERROR)
+    {
+      error = db_restart (program_name, TRUE, db_name);
+    }
+  if (error != NO_ERROR)
+    {
+      fprintf (stderr, "cannot boot %s: %s\n", db_name, db_error_string (3));
+    }
+  return error;
+}
+
+/*
+ * execute () - execute a statement and discard its result
+ *
+ * return   : error code
+ * sql (in) : statement
+ */
+static int
+execute (const char *sql)
+{
+  DB_QUERY_RESULT *result = NULL;
+  DB_QUERY_ERROR query_error;
+  int error;
+
+  error = db_execute (sql, &result, &query_error);
+  if (result != NULL)
+    {
+      db_query_end (result);
+    }
+  if (error < 0)
+    {
+      fprintf (stderr, "%s: %s\n", sql, db_error_string (3));
+      return error;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * query_column_bigint () - execute a query and get an integer column of its first row
+ *
+ * return      : error code
+ * sql (in)    : query or SHOW statement
+ * column (in) : column name; NULL for the first column
+ * value (out) : column value of first row
+ */
+static int
+query_column_bigint (const char *sql, const char *column, DB_BIGINT * value)
+{
+  DB_QUERY_RESULT *result = NULL;
+  DB_QUERY_ERROR query_error;
+  DB_VALUE db_value;
+  int error;
+
+  error = db_execute (sql, &result, &query_error);
+  if (error >= 0)
+    {
+      error = db_query_first_tuple (result);
+    }
+  if (error == NO_ERROR)
+    {
+      if (column == NULL)
+	{
+	  error = db_query_get_tuple_value (result, 0, &db_value);
+	}
+      else
+	{
+	  error = db_query_get_tuple_value_by_name (result, (char *) column, &db_value);
+	}
+    }
+  if (error == NO_ERROR)
+    {
+      switch (DB_VALUE_TYPE (&db_value))
+	{
+	case DB_TYPE_INTEGER:
+	  *value = db_get_int (&db_value);
+	  break;
+	case DB_TYPE_BIGINT:
+	  *value = db_get_bigint (&db_value);
+	  break;
+	case DB_TYPE_NULL:
+	  *value = 0;
+	  break;
+	default:
+	  error = ER_FAILED;
+	  break;
+	}
+      db_value_clear (&db_value);
+    }
+  if (result != NULL)
+    {
+      db_query_end (result);
+    }
+  if (error < 0)
+    {
+      fprintf (stderr, "%s: %s\n", sql, db_error_string (3));
+      return error;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * query_bigint () - execute a query returning a single integer value
+ *
+ * return     : error code
+ * sql (in)   : query
+ * value (out) : first column of first row
+ */
+static int
+query_bigint (const char *sql, DB_BIGINT * value)
+{
+  return query_column_bigint (sql, NULL, value);
+}
+
+/*
+ * expect_bigint () - check the integer result of a query
+ *
+ * return        : error code; ER_FAILED if result is not the expected one
+ * sql (in)      : query
+ * expected (in) : expected result
+ */
+static int
+expect_bigint (const char *sql, DB_BIGINT expected)
+{
+  DB_BIGINT value;
+  int error;
+
+  error = query_bigint (sql, &value);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  if (value != expected)
+    {
+      fprintf (stderr, "%s: expected %lld, got %lld\n", sql, (long long) expected, (long long) value);
+      return ER_FAILED;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * query_checksum () - execute a query and compute a checksum of its rows, in the order they are returned
+ *
+ * return        : error code
+ * sql (in)      : query; columns are integers, big integers or strings
+ * rows (out)    : number of rows
+ * checksum (out) : checksum of rows
+ */
+static int
+query_checksum (const char *sql, DB_BIGINT * rows, unsigned int *checksum)
+{
+  DB_QUERY_RESULT *result = NULL;
+  DB_QUERY_ERROR query_error;
+  DB_VALUE db_value;
+  const char *str;
+  int n_columns;
+  int error;
+  int pos;
+  int i;
+
+  *rows = 0;
+  *checksum = 0;
+
+  error = db_execute (sql, &result, &query_error);
+  if (error >= 0)
+    {
+      n_columns = db_query_column_count (result);
+      pos = db_query_first_tuple (result);
+      error = NO_ERROR;
+      while (pos == DB_CURSOR_SUCCESS && error == NO_ERROR)
+	{
+	  for (i = 0; i < n_columns && error == NO_ERROR; i++)
+	    {
+	      error = db_query_get_tuple_value (result, i, &db_value);
+	      if (error != NO_ERROR)
+		{
+		  break;
+		}
+	      switch (DB_VALUE_TYPE (&db_value))
+		{
+		case DB_TYPE_NULL:
+		  *checksum = *checksum * 31 + 1;
+		  break;
+		case DB_TYPE_INTEGER:
+		  *checksum = *checksum * 31 + (unsigned int) db_get_int (&db_value);
+		  break;
+		case DB_TYPE_BIGINT:
+		  *checksum = *checksum * 31 + (unsigned int) db_get_bigint (&db_value);
+		  break;
+		case DB_TYPE_CHAR:
+		case DB_TYPE_VARCHAR:
+		  for (str = db_get_string (&db_value); *str != '\0'; str++)
+		    {
+		      *checksum = *checksum * 31 + (unsigned char) *str;
+		    }
+		  break;
+		default:
+		  error = ER_FAILED;
+		  break;
+		}
+	      db_value_clear (&db_value);
+	    }
+	  (*rows)++;
+	  pos = db_query_next_tuple (result);
+	}
+      if (error == NO_ERROR && pos != DB_CURSOR_END)
+	{
+	  error = pos;
+	}
+    }
+  if (result != NULL)
+    {
+      db_query_end (result);
+    }
+  if (error < 0)
+    {
+      fprintf (stderr, "%s: %s\n", sql, db_error_string (3));
+      return error;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * test_list_cache_shutdown () - use the query result cache, then shut down and boot again
+ *
+ * return       : error code
+ * db_name (in) : database name
+ *
+ * Note: XASL cache entries release their cached results at shutdown, after the result cache itself is finalized.
+ *       Changes to a class must invalidate cached results of the queries on that class at commit.
+ */
+static int
+test_list_cache_shutdown (const char *db_name)
+{
+  const char *cached_query = "SELECT /*+ QUERY_CACHE */ COUNT (*) FROM t_list_cache";
+  int error;
+  int i;
+
+  envvar_set ("QUERY_CACHE_MODE", "2");
+  envvar_set ("MAX_QUERY_CACHE_ENTRIES", "100");
+
+  for (i = 0; i < 2; i++)
+    {
+      error = boot (db_name);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      error = execute ("DROP TABLE IF EXISTS t_list_cache");
+      if (error == NO_ERROR)
+	{
+	  error = execute ("CREATE TABLE t_list_cache (a INT)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("INSERT INTO t_list_cache VALUES (1), (2), (3)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+      if (error == NO_ERROR)
+	{
+	  /* second execution is served from the cache */
+	  error = expect_bigint (cached_query, 3);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = expect_bigint (cached_query, 3);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("INSERT INTO t_list_cache VALUES (4)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+      if (error == NO_ERROR)
+	{
+	  error = expect_bigint (cached_query, 4);
+	}
+
+      /* shut down with cached results, the second iteration boots again */
+      db_shutdown ();
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  error = boot (db_name);
+  if (error == NO_ERROR)
+    {
+      error = execute ("DROP TABLE t_list_cache");
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+      db_shutdown ();
+    }
+  return error;
+}
+
+/*
+ * test_index_load_parallel () - load an index serially and with parallel workers and compare the keys
+ *
+ * return       : error code
+ * db_name (in) : database name
+ *
+ * Note: The keys are read in index order by a covering index scan. Keys extracted from heap pages by parallel workers,
+ *       offline or online, must be loaded in the same order as the keys extracted by a single thread.
+ */
+static int
+test_index_load_parallel (const char *db_name)
+{
+  const char *builds[][2] = {
+    {"SET SYSTEM PARAMETERS 'index_load_parallel_degree=1'", "CREATE INDEX i_px_load ON t_px_load (a, b)"},
+    {"SET SYSTEM PARAMETERS 'index_load_parallel_degree=4'", "CREATE INDEX i_px_load ON t_px_load (a, b)"},
+    {"SET SYSTEM PARAMETERS 'index_load_parallel_degree=4'",
+     "CREATE INDEX i_px_load ON t_px_load (a, b) WITH ONLINE PARALLEL 2"}
+  };
+  const char *index_scan = "SELECT a, b FROM t_px_load WHERE a >= 0 USING INDEX i_px_load(+)";
+  DB_BIGINT n_objects, rows;
+  unsigned int checksum, serial_checksum = 0;
+  int error;
+  int i;
+
+  error = boot (db_name);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* duplicate keys and null keys; enough heap pages for several workers */
+  error = execute ("DROP TABLE IF EXISTS t_px_load");
+  if (error == NO_ERROR)
+    {
+      error = execute ("CREATE TABLE t_px_load (a INT, b VARCHAR (64))");
+    }
+  if (error == NO_ERROR)
+    {
+      error = execute ("INSERT INTO t_px_load SELECT MOD (ROWNUM * 7919, 20011), "
+		       "CASE WHEN MOD (ROWNUM, 97) = 0 THEN NULL "
+		       "ELSE 'key' || MOD (ROWNUM, 1013) || REPEAT ('x', 32) END "
+		       "FROM db_class c1, db_class c2, db_class c3 LIMIT 100000");
+    }
+  if (error == NO_ERROR)
+    {
+      error = db_commit_transaction ();
+    }
+  if (error == NO_ERROR)
+    {
+      error = query_bigint ("SELECT COUNT (*) FROM t_px_load", &n_objects);
+    }
+
+  for (i = 0; i < (int) (sizeof (builds) / sizeof (builds[0])) && error == NO_ERROR; i++)
+    {
+      error = execute (builds[i][0]);
+      if (error == NO_ERROR)
+	{
+	  error = execute (builds[i][1]);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+      if (error == NO_ERROR)
+	{
+	  error = query_checksum (index_scan, &rows, &checksum);
+	}
+      if (error == NO_ERROR)
+	{
+	  if (i == 0)
+	    {
+	      serial_checksum = checksum;
+	    }
+	  if (rows != n_objects || checksum != serial_checksum)
+	    {
+	      fprintf (stderr, "%s: %lld keys, checksum %u; expected %lld keys, checksum %u\n", builds[i][1],
+		       (long long) rows, checksum, (long long) n_objects, serial_checksum);
+	      error = ER_FAILED;
+	    }
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("DROP INDEX i_px_load ON t_px_load");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+    }
+
+  (void) execute ("DROP TABLE IF EXISTS t_px_load");
+  (void) db_commit_transaction ();
+  db_shutdown ();
+  return error;
+}
+
+/*
+ * expect_same_rows () - check that two queries return the same rows in the same order
+ *
+ * return            : error code; ER_FAILED if rows differ
+ * sql (in)          : query
+ * expected_sql (in) : query returning the expected rows
+ */
+static int
+expect_same_rows (const char *sql, const char *expected_sql)
+{
+  DB_BIGINT rows, expected_rows;
+  unsigned int checksum, expected_checksum;
+  int error;
+
+  error = query_checksum (sql, &rows, &checksum);
+  if (error == NO_ERROR)
+    {
+      error = query_checksum (expected_sql, &expected_rows, &expected_checksum);
+    }
+  if (error == NO_ERROR && (rows != expected_rows || checksum != expected_checksum))
+    {
+      fprintf (stderr, "%s: %lld rows, checksum %u; expected %lld rows, checksum %u\n", sql, (long long) rows,
+	       checksum, (long long) expected_rows, expected_checksum);
+      error = ER_FAILED;
+    }
+  return error;
+}
+
+/*
+ * test_index_load_fence_keys () - load a multi-column index with and without fence keys, then change it
+ *
+ * return       : error code
+ * db_name (in) : database name
+ *
+ * Note: With fence keys, loaded leaves drop the leading columns shared by their keys and need fewer pages. The
+ *       compressed leaves must then be split, re-compressed and uncompressed by inserts and deletes, and the index
+ *       must always return the rows of the heap in the same order.
+ */
+static int
+test_index_load_fence_keys (const char *db_name)
+{
+  const char *fence_params[] = {
+    "SET SYSTEM PARAMETERS 'use_btree_fence_key=no'",
+    "SET SYSTEM PARAMETERS 'use_btree_fence_key=yes'"
+  };
+  const char *changes[] = {
+    /* keys between the loaded keys of every leaf, until leaves split */
+    "INSERT INTO t_fence_load SELECT MOD (ROWNUM, 50), 'common prefix of all keys in leaf ' || MOD (ROWNUM, 7) || 'y', "
+      "100000 + ROWNUM FROM db_class c1, db_class c2, db_class c3 LIMIT 30000",
+    "DELETE FROM t_fence_load WHERE MOD (c, 3) = 0",
+    /* keys sharing only the first column with their neighbors */
+    "INSERT INTO t_fence_load SELECT MOD (ROWNUM, 50), 'other ' || ROWNUM, 200000 + ROWNUM "
+      "FROM db_class c1, db_class c2, db_class c3 LIMIT 10000",
+    "DELETE FROM t_fence_load WHERE a = 25"
+  };
+  const char *capacity = "SHOW INDEX CAPACITY OF t_fence_load.i_fence_load";
+  const char *index_scan = "SELECT a, b, c FROM t_fence_load WHERE a >= 0 USING INDEX i_fence_load(+)";
+  const char *heap_scan = "SELECT a, b, c FROM t_fence_load ORDER BY a, b, c USING INDEX NONE";
+  DB_BIGINT leaf_pages[2] = { 0, 0 };
+  int error;
+  int i, j;
+
+  error = boot (db_name);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* few distinct values of the first two columns; many leaves share them */
+  error = execute ("DROP TABLE IF EXISTS t_fence_load");
+  if (error == NO_ERROR)
+    {
+      error = execute ("CREATE TABLE t_fence_load (a INT, b VARCHAR (64), c INT)");
+    }
+  if (error == NO_ERROR)
+    {
+      error = execute ("INSERT INTO t_fence_load SELECT MOD (ROWNUM, 50), "
+		       "'common prefix of all keys in leaf ' || MOD (ROWNUM, 7), ROWNUM "
+		       "FROM db_class c1, db_class c2, db_class c3 LIMIT 60000");
+    }
+  if (error == NO_ERROR)
+    {
+      error = db_commit_transaction ();
+    }
+
+  for (i = 0; i < 2 && error == NO_ERROR; i++)
+    {
+      error = execute (fence_params[i]);
+      if (error == NO_ERROR)
+	{
+	  error = execute ("CREATE INDEX i_fence_load ON t_fence_load (a, b, c)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+      if (error == NO_ERROR)
+	{
+	  error = query_column_bigint (capacity, "Num_leaf_page", &leaf_pages[i]);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = expect_same_rows (index_scan, heap_scan);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("DROP INDEX i_fence_load ON t_fence_load");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+    }
+
+  if (error == NO_ERROR && leaf_pages[1] >= leaf_pages[0])
+    {
+      fprintf (stderr, "%lld leaf pages loaded with fence keys, %lld without\n", (long long) leaf_pages[1],
+	       (long long) leaf_pages[0]);
+      error = ER_FAILED;
+    }
+
+  /* change the compressed leaves of a loaded index */
+  if (error == NO_ERROR)
+    {
+      error = execute ("CREATE INDEX i_fence_load ON t_fence_load (a, b, c)");
+    }
+  if (error == NO_ERROR)
+    {
+      error = db_commit_transaction ();
+    }
+  for (j = 0; j < (int) (sizeof (changes) / sizeof (changes[0])) && error == NO_ERROR; j++)
+    {
+      error = execute (changes[j]);
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+      if (error == NO_ERROR)
+	{
+	  error = expect_same_rows (index_scan, heap_scan);
+	}
+    }
+
+  (void) execute (fence_params[1]);
+  (void) execute ("DROP TABLE IF EXISTS t_fence_load");
+  (void) db_commit_transaction ();
+  db_shutdown ();
+  return error;
+}
+
+/*
+ * expect_unique_violation () - execute a statement that must fail on a unique index
+ *
+ * return   : error code; ER_FAILED if statement does not fail on a unique index
+ * sql (in) : statement
+ */
+static int
+expect_unique_violation (const char *sql)
+{
+  DB_QUERY_RESULT *result = NULL;
+  DB_QUERY_ERROR query_error;
+  int error;
+
+  error = db_execute (sql, &result, &query_error);
+  if (result != NULL)
+    {
+      db_query_end (result);
+    }
+  if (error >= 0)
+    {
+      fprintf (stderr, "%s: unique violation expected\n", sql);
+      return ER_FAILED;
+    }
+  if (error != ER_BTREE_UNIQUE_FAILED && error != ER_UNIQUE_VIOLATION_WITHKEY)
+    {
+      fprintf (stderr, "%s: %s\n", sql, db_error_string (3));
+      return error;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * test_insert_batch () - run the same multi-row inserts with index key batches of different sizes and row by row
+ *
+ * return       : error code
+ * db_name (in) : database name
+ *
+ * Note: Keys of non-unique indexes are collected and inserted sorted at the end of a multi-row insert, or whenever
+ *       the batch is full. A unique violation in the middle of a statement must discard the collected keys and roll
+ *       back the ones already flushed, and the result must be the same as with keys inserted row by row.
+ */
+static int
+test_insert_batch (const char *db_name)
+{
+  const char *batch_params[] = {
+    "SET SYSTEM PARAMETERS 'index_insert_batch_memsize=0'",
+    "SET SYSTEM PARAMETERS 'index_insert_batch_memsize=8192'",
+    "SET SYSTEM PARAMETERS 'index_insert_batch_memsize=4M'"
+  };
+  struct
+  {
+    const char *sql;
+    bool is_unique_violation;
+  } inserts[] = {
+    {"INSERT INTO t_ins_batch SELECT MOD (ROWNUM * 7919, 1000), 'key ' || MOD (ROWNUM, 13), ROWNUM "
+       "FROM db_class c1, db_class c2, db_class c3 LIMIT 20000", false},
+    {"INSERT INTO t_ins_batch VALUES (5, 'key 5', 100001), (5, 'key 5', 100002), (NULL, NULL, 100003), "
+       "(999, 'zz', 100004)", false},
+    /* the duplicate comes after thousands of collected keys */
+    {"INSERT INTO t_ins_batch SELECT MOD (ROWNUM, 500), 'dup ' || ROWNUM, "
+       "CASE WHEN ROWNUM = 15000 THEN 1 ELSE 200000 + ROWNUM END FROM db_class c1, db_class c2, db_class c3 "
+       "LIMIT 20000", true},
+    /* the duplicate is inserted by the same statement */
+    {"INSERT INTO t_ins_batch VALUES (1, 'a', 300001), (2, 'b', 300002), (3, 'c', 300001)", true},
+    {"INSERT INTO t_ins_batch SELECT a + 1, b, c + 400000 FROM t_ins_batch WHERE MOD (c, 2) = 0", false}
+  };
+  const char *index_scans[][2] = {
+    {"SELECT a, b FROM t_ins_batch WHERE a >= 0 USING INDEX i_ins_batch_ab(+)",
+     "SELECT a, b FROM t_ins_batch WHERE a >= 0 ORDER BY a, b USING INDEX NONE"},
+    {"SELECT b FROM t_ins_batch WHERE b >= '' USING INDEX i_ins_batch_b(+)",
+     "SELECT b FROM t_ins_batch WHERE b >= '' ORDER BY b USING INDEX NONE"}
+  };
+  const char *rows = "SELECT a, b, c FROM t_ins_batch ORDER BY c USING INDEX NONE";
+  const int n_params = (int) (sizeof (batch_params) / sizeof (batch_params[0]));
+  DB_BIGINT row_count[3];
+  unsigned int checksum[3];
+  int error;
+  int i, j, k;
+
+  error = boot (db_name);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  for (i = 0; i < n_params && error == NO_ERROR; i++)
+    {
+      error = execute (batch_params[i]);
+      if (error == NO_ERROR)
+	{
+	  error = execute ("DROP TABLE IF EXISTS t_ins_batch");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("CREATE TABLE t_ins_batch (a INT, b VARCHAR (32), c INT UNIQUE)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("CREATE INDEX i_ins_batch_ab ON t_ins_batch (a, b)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = execute ("CREATE INDEX i_ins_batch_b ON t_ins_batch (b)");
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+
+      for (j = 0; j < (int) (sizeof (inserts) / sizeof (inserts[0])) && error == NO_ERROR; j++)
+	{
+	  if (inserts[j].is_unique_violation)
+	    {
+	      error = expect_unique_violation (inserts[j].sql);
+	    }
+	  else
+	    {
+	      error = execute (inserts[j].sql);
+	    }
+	  if (error == NO_ERROR)
+	    {
+	      error = db_commit_transaction ();
+	    }
+	  for (k = 0; k < (int) (sizeof (index_scans) / sizeof (index_scans[0])) && error == NO_ERROR; k++)
+	    {
+	      error = expect_same_rows (index_scans[k][0], index_scans[k][1]);
+	    }
+	}
+
+      if (error == NO_ERROR)
+	{
+	  error = query_checksum (rows, &row_count[i], &checksum[i]);
+	}
+      if (error == NO_ERROR && (row_count[i] != row_count[0] || checksum[i] != checksum[0]))
+	{
+	  fprintf (stderr, "%s: %lld rows, checksum %u; %lld rows, checksum %u inserted row by row\n",
+		   batch_params[i], (long long) row_count[i], checksum[i], (long long) row_count[0], checksum[0]);
+	  error = ER_FAILED;
+	}
+    }
+
+  (void) execute ("SET SYSTEM PARAMETERS 'index_insert_batch_memsize=4M'");
+  (void) execute ("DROP TABLE IF EXISTS t_ins_batch");
+  (void) db_commit_transaction ();
+  db_shutdown ();
+  return error;
+}
+
+/*
+ * test_hash_join () - join with hash joins and with nested loops, and compare the results
+ *
+ * return       : error code
+ * db_name (in) : database name
+ *
+ * Note: Hash join plans are forced by giving them no cost. Join columns have NULLs, duplicates and different types,
+ *       and one key of the inner table has many more tuples than a small max_hash_join_size holds: both lists are
+ *       partitioned, and the partition of that key is split again and finally joined in chunks.
+ */
+static int
+test_hash_join (const char *db_name)
+{
+  const char *size_params[] = {
+    "SET SYSTEM PARAMETERS 'max_hash_join_size=8M'",
+    "SET SYSTEM PARAMETERS 'max_hash_join_size=32K'"
+  };
+  const char *joins[] = {
+    "o.a, o.b, o.v, i.a, i.b, i.v FROM t_hj_outer o, t_hj_inner i WHERE o.a = i.a ORDER BY o.v, i.v",
+    "o.a, o.b, o.v, i.a, i.b, i.v FROM t_hj_outer o, t_hj_inner i WHERE o.a = i.a AND o.b = i.b ORDER BY o.v, i.v",
+    /* the skewed inner table is the build list */
+    "o.a, o.b, o.v, i.a, i.b, i.v FROM t_hj_outer o LEFT OUTER JOIN t_hj_inner i ON o.a = i.a ORDER BY o.v, i.v",
+    "o.a, o.b, o.v, i.a, i.b, i.v FROM t_hj_inner i RIGHT OUTER JOIN t_hj_outer o ON o.a = i.a ORDER BY o.v, i.v"
+  };
+  char hash_sql[256], nl_sql[256];
+  int error;
+  int i, j;
+
+  error = boot (db_name);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  error = execute ("DROP TABLE IF EXISTS t_hj_outer, t_hj_inner");
+  if (error == NO_ERROR)
+    {
+      error = execute ("CREATE TABLE t_hj_outer (a INT, b VARCHAR (16), v INT)");
+    }
+  if (error == NO_ERROR)
+    {
+      error = execute ("CREATE TABLE t_hj_inner (a BIGINT, b VARCHAR (16), v INT)");
+    }
+  if (error == NO_ERROR)
+    {
+      error = execute ("INSERT INTO t_hj_outer SELECT CASE WHEN MOD (ROWNUM, 101) = 0 THEN NULL "
+		       "ELSE MOD (ROWNUM, 2000) END, 'b' || MOD (ROWNUM, 3), ROWNUM "
+		       "FROM db_class c1, db_class c2, db_class c3 LIMIT 3000");
+    }
+  if (error == NO_ERROR)
+    {
+      error = execute ("INSERT INTO t_hj_inner SELECT CASE WHEN MOD (ROWNUM, 89) = 0 THEN NULL "
+		       "ELSE MOD (ROWNUM, 3000) END, 'b' || MOD (ROWNUM, 5), ROWNUM "
+		       "FROM db_class c1, db_class c2, db_class c3 LIMIT 4000");
+    }
+  if (error == NO_ERROR)
+    {
+      /* a single key joined by three outer rows */
+      error = execute ("INSERT INTO t_hj_inner SELECT 7, 'b' || MOD (ROWNUM, 3), 100000 + ROWNUM "
+		       "FROM db_class c1, db_class c2, db_class c3 LIMIT 10000");
+    }
+  if (error == NO_ERROR)
+    {
+      error = db_commit_transaction ();
+    }
+  if (error == NO_ERROR)
+    {
+      error = execute ("SET SYSTEM PARAMETERS 'optimizer_enable_hash_join=yes'");
+    }
+  (void) qo_plan_set_cost_fn ("h-join", '0');
+
+  for (i = 0; i < (int) (sizeof (size_params) / sizeof (size_params[0])) && error == NO_ERROR; i++)
+    {
+      error = execute (size_params[i]);
+      for (j = 0; j < (int) (sizeof (joins) / sizeof (joins[0])) && error == NO_ERROR; j++)
+	{
+	  snprintf (hash_sql, sizeof (hash_sql), "SELECT %s", joins[j]);
+	  snprintf (nl_sql, sizeof (nl_sql), "SELECT /*+ USE_NL */ %s", joins[j]);
+	  error = expect_same_rows (hash_sql, nl_sql);
+	}
+    }
+
+  (void) qo_plan_set_cost_fn ("h-join", 'd');
+  (void) execute ("SET SYSTEM PARAMETERS 'optimizer_enable_hash_join=no'");
+  (void) execute ("SET SYSTEM PARAMETERS 'max_hash_join_size=8M'");
+  (void) execute ("DROP TABLE IF EXISTS t_hj_outer, t_hj_inner");
+  (void) db_commit_transaction ();
+  db_shutdown ();
+  return error;
+}
+
+static TEST_ENTRY tests[] = {
+  {"list_cache_shutdown", test_list_cache_shutdown},
+  {"index_load_parallel", test_index_load_parallel},
+  {"index_load_fence_keys", test_index_load_fence_keys},
+  {"insert_batch", test_insert_batch},
+  {"hash_join", test_hash_join},
+  {NULL, NULL}
+};
+
+int
+main (int argc, char **argv)
+{
+  const char *db_name;
+  const char *test_name = NULL;
+  int failed = 0;
+  int found = 0;
+  int i;
+
+  if (argc < 2)
+    {
+      fprintf (stderr, "usage: %s database [test name]\n", argv[0]);
+      fprintf (stderr, "tests:\n");
+      for (i = 0; tests[i].name != NULL; i++)
+	{
+	  fprintf (stderr, "  %s\n", tests[i].name);
+	}
+      return EXIT_FAILURE;
+    }
+  program_name = argv[0];
+  db_name = argv[1];
+  if (argc > 2)
+    {
+      test_name = argv[2];
+    }
+
+  for (i = 0; tests[i].name != NULL; i++)
+    {
+      if (test_name != NULL && strcmp (test_name, tests[i].name) != 0)
+	{
+	  continue;
+	}
+      found++;
+
+      printf ("%-40s", tests[i].name);
+      fflush (stdout);
+      if (tests[i].func (db_name) == NO_ERROR)
+	{
+	  printf ("ok\n");
+	}
+      else
+	{
+	  printf ("failed\n");
+	  failed++;
+	}
+    }
+
+  if (found == 0)
+    {
+      fprintf (stderr, "unknown test %s\n", test_name);
+      return EXIT_FAILURE;
+    }
+
+  return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -40,6 +40,9 @@
 #include <direct.h>
 #define	SIGALRM	14
 #endif /* WINDOWS */
+#if defined (CS_MODE) && !defined (WINDOWS)
+#include <sys/mman.h>
+#endif /* CS_MODE && !WINDOWS */
 
 #include "authenticate.h"
 #include "utility.h"
@@ -98,6 +101,30 @@ static char *class_processed = NULL;
 
 static OID null_oid;
 
+#if defined (CS_MODE) && !defined (WINDOWS)
+/*
+ * Classes to unload by several unload processes. It is created before the processes are forked and lives in
+ * shared memory; each process claims the next class by incrementing next.
+ */
+typedef struct unload_class_queue UNLOAD_CLASS_QUEUE;
+struct unload_class_queue
+{
+  int num_classes;		/* number of classes in class_oids */
+  volatile int next;		/* index of the next class to claim */
+  OID class_oids[1];		/* classes to unload, largest first */
+};
+
+typedef struct unload_class_size UNLOAD_CLASS_SIZE;
+struct unload_class_size
+{
+  OID class_oid;
+  int npages;
+};
+
+static UNLOAD_CLASS_QUEUE *class_queue = NULL;
+static size_t class_queue_size = 0;
+#endif /* CS_MODE && !WINDOWS */
+
 static const char *prohibited_classes[] = {
   "db_authorizations",		/* old name for db_root */
   "db_root",
@@ -178,6 +205,10 @@ static int process_value (DB_VALUE * value);
 static void update_hash (OID * object_oid, OID * class_oid, int *data);
 static DB_OBJECT *is_class (OID * obj_oid, OID * class_oid);
 static int all_classes_processed (void);
+#if defined (CS_MODE) && !defined (WINDOWS)
+static int compare_class_size (const void *a, const void *b);
+static int process_queued_classes (const char *output_dirname, const char *output_prefix);
+#endif /* CS_MODE && !WINDOWS */
 
 /*
  * get_estimated_objs - get the estimated number of object reside in file heap
@@ -339,7 +370,11 @@ check_referenced_domain (DB_DOMAIN * dom_list, bool set_cls_ref, int *num_cls_re
 static void
 extractobjects_cleanup (void)
 {
-  if (obj_out)
+  /*
+   * A running background writer may still own the buffer and the file; it is stopped on the normal exit path
+   * before this is called. When called from the signal handler, the process exits anyway.
+   */
+  if (obj_out && obj_out->writer == NULL)
     {
       if (obj_out->buffer != NULL)
 	free_and_init (obj_out->buffer);
@@ -450,6 +485,8 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
 #endif
   LOG_LSA lsa;
   char unloadlog_filename[PATH_MAX];
+  char process_hash_filename[PATH_MAX];
+  const char *obj_hash_filename = hash_filename;
 
   /* register new signal handlers */
   prev_intr_handler = os_set_signal_handler (SIGINT, extractobjects_term_handler);
@@ -531,6 +568,15 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
 
     obj_out->ptr = obj_out->buffer;	/* init */
     obj_out->count = 0;		/* init */
+
+    /*
+     * Write full buffers in background, while the next objects are fetched and printed.
+     * If the writer cannot be started, buffers are written synchronously.
+     */
+    if (obj_out->buffer != NULL)
+      {
+	(void) text_print_start_writer (obj_out);
+      }
   }
 
   /*
@@ -855,8 +901,14 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
   /*
    * Create the hash table
    */
+  if (process_count > 1 && hash_filename != NULL)
+    {
+      /* each unload process needs its own hash file */
+      snprintf (process_hash_filename, sizeof (process_hash_filename) - 1, "%s.%d", hash_filename, process_index);
+      obj_hash_filename = process_hash_filename;
+    }
   obj_table =
-    fh_create ("object hash", est_size, page_size, cached_pages, hash_filename, FH_OID_KEY, DB_SIZEOF (int),
+    fh_create ("object hash", est_size, page_size, cached_pages, obj_hash_filename, FH_OID_KEY, DB_SIZEOF (int),
 	       oid_hash, oid_compare_equals);
 
   if (obj_table == NULL)
@@ -869,7 +921,15 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
    * Dump the object definitions
    */
   total_approximate_class_objects = est_objects;
-  snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb.log", output_prefix);
+  if (process_count > 1)
+    {
+      snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_%d_unloaddb.log", output_prefix,
+		process_index);
+    }
+  else
+    {
+      snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb.log", output_prefix);
+    }
   unloadlog_file = fopen (unloadlog_filename, "w+");
   if (unloadlog_file != NULL)
     {
@@ -880,62 +940,75 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
       fprintf (stdout, HEADER_FORMAT, "Class Name", "Total Instances");
     }
 
-  do
+#if defined (CS_MODE) && !defined (WINDOWS)
+  if (class_queue != NULL)
     {
-      for (i = 0; i < class_table->num; i++)
+      if (process_queued_classes (output_dirname, output_prefix) != NO_ERROR)
 	{
-	  if (!WS_IS_DELETED (class_table->mops[i]) && class_table->mops[i] != sm_Root_class_mop)
+	  status = 1;
+	  goto end;
+	}
+    }
+  else
+#endif /* CS_MODE && !WINDOWS */
+    {
+      do
+	{
+	  for (i = 0; i < class_table->num; i++)
 	    {
-	      int ret_val;
-
-	      if (datafile_per_class && IS_CLASS_REQUESTED (i))
+	      if (!WS_IS_DELETED (class_table->mops[i]) && class_table->mops[i] != sm_Root_class_mop)
 		{
-		  char outfile[PATH_MAX];
+		  int ret_val;
 
-		  ws_find (class_table->mops[i], (MOBJ *) (&class_ptr));
-		  if (class_ptr == NULL)
+		  if (datafile_per_class && IS_CLASS_REQUESTED (i))
 		    {
-		      status = 1;
-		      goto end;
-		    }
+		      char outfile[PATH_MAX];
 
-		  snprintf (outfile, PATH_MAX - 1, "%s/%s_%s%s", output_dirname, output_prefix,
-			    sm_ch_name ((MOBJ) class_ptr), OBJECT_SUFFIX);
+		      ws_find (class_table->mops[i], (MOBJ *) (&class_ptr));
+		      if (class_ptr == NULL)
+			{
+			  status = 1;
+			  goto end;
+			}
 
-		  obj_out->fp = fopen_ex (outfile, "wb");
-		  if (obj_out->fp == NULL)
-		    {
-		      status = 1;
-		      goto end;
+		      snprintf (outfile, PATH_MAX - 1, "%s/%s_%s%s", output_dirname, output_prefix,
+				sm_ch_name ((MOBJ) class_ptr), OBJECT_SUFFIX);
+
+		      obj_out->fp = fopen_ex (outfile, "wb");
+		      if (obj_out->fp == NULL)
+			{
+			  status = 1;
+			  goto end;
+			}
 		    }
-		}
 
-	      ret_val = process_class (i);
+		  ret_val = process_class (i);
 
-	      if (datafile_per_class && IS_CLASS_REQUESTED (i))
-		{
-		  if (text_print_flush (obj_out) != NO_ERROR)
+		  if (datafile_per_class && IS_CLASS_REQUESTED (i))
 		    {
-		      status = 1;
-		      goto end;
-		    }
+		      if (text_print_flush (obj_out) != NO_ERROR)
+			{
+			  status = 1;
+			  goto end;
+			}
 
-		  fclose (obj_out->fp);
-		  obj_out->fp = NULL;
-		}
+		      fclose (obj_out->fp);
+		      obj_out->fp = NULL;
+		    }
 
-	      if (ret_val != NO_ERROR)
-		{
-		  if (!ignore_err_flag)
+		  if (ret_val != NO_ERROR)
 		    {
-		      status = 1;
-		      goto end;
+		      if (!ignore_err_flag)
+			{
+			  status = 1;
+			  goto end;
+			}
 		    }
 		}
 	    }
 	}
+      while (!all_classes_processed ());
     }
-  while (!all_classes_processed ());
 
   if (failed_objects != 0)
     {
@@ -982,6 +1055,7 @@ end:
   /*
    * Cleanup
    */
+  text_print_stop_writer (obj_out);
   free_and_init (unload_class_table);
   extractobjects_cleanup ();
 
@@ -1830,6 +1904,187 @@ all_classes_processed (void)
   return 1;
 }
 
+#if defined (CS_MODE) && !defined (WINDOWS)
+/*
+ * create_class_queue - list the classes to unload, largest first, in memory shared with the unload processes
+ *    return: NO_ERROR if successful, error code otherwise
+ * Note:
+ *    The unload processes are forked after this and claim the classes one by one, so the largest classes are
+ *    started first and the small ones are spread over the processes that finish early.
+ */
+int
+create_class_queue (void)
+{
+  UNLOAD_CLASS_SIZE *sizes;
+  SM_CLASS *class_ptr;
+  HFID *hfid;
+  int i, num_classes = 0;
+  int nobjs, npages;
+  void *area;
+
+  assert (class_queue == NULL);
+
+  sizes = (UNLOAD_CLASS_SIZE *) malloc (DB_SIZEOF (UNLOAD_CLASS_SIZE) * (class_table->num + 1));
+  if (sizes == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      sizeof (UNLOAD_CLASS_SIZE) * (class_table->num + 1));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < class_table->num; i++)
+    {
+      if (WS_IS_DELETED (class_table->mops[i]) || class_table->mops[i] == sm_Root_class_mop)
+	{
+	  continue;
+	}
+      if (au_fetch_class (class_table->mops[i], NULL, AU_FETCH_READ, AU_SELECT) != NO_ERROR)
+	{
+	  continue;
+	}
+      ws_find (class_table->mops[i], (MOBJ *) (&class_ptr));
+      if (class_ptr == NULL)
+	{
+	  continue;
+	}
+
+      npages = 0;
+      hfid = sm_ch_heap ((MOBJ) class_ptr);
+      if (!HFID_IS_NULL (hfid) && heap_get_class_num_objects_pages (hfid, 1, &nobjs, &npages) < 0)
+	{
+	  npages = 0;
+	}
+
+      COPY_OID (&sizes[num_classes].class_oid, ws_oid (class_table->mops[i]));
+      sizes[num_classes].npages = npages;
+      num_classes++;
+    }
+
+  qsort (sizes, num_classes, sizeof (UNLOAD_CLASS_SIZE), compare_class_size);
+
+  class_queue_size = sizeof (UNLOAD_CLASS_QUEUE) + sizeof (OID) * num_classes;
+  area = mmap (NULL, class_queue_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (area == MAP_FAILED)
+    {
+      free_and_init (sizes);
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, class_queue_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  class_queue = (UNLOAD_CLASS_QUEUE *) area;
+  class_queue->num_classes = num_classes;
+  class_queue->next = 0;
+  for (i = 0; i < num_classes; i++)
+    {
+      COPY_OID (&class_queue->class_oids[i], &sizes[i].class_oid);
+    }
+
+  free_and_init (sizes);
+  return NO_ERROR;
+}
+
+/*
+ * destroy_class_queue - release the class queue of the unload processes
+ *    return: void
+ */
+void
+destroy_class_queue (void)
+{
+  if (class_queue != NULL)
+    {
+      (void) munmap ((void *) class_queue, class_queue_size);
+      class_queue = NULL;
+      class_queue_size = 0;
+    }
+}
+
+/*
+ * compare_class_size - order classes by decreasing number of heap pages
+ *    return: negative if a is larger than b, positive if smaller, 0 if equal
+ */
+static int
+compare_class_size (const void *a, const void *b)
+{
+  const UNLOAD_CLASS_SIZE *size_a = (const UNLOAD_CLASS_SIZE *) a;
+  const UNLOAD_CLASS_SIZE *size_b = (const UNLOAD_CLASS_SIZE *) b;
+
+  if (size_a->npages != size_b->npages)
+    {
+      return (size_a->npages > size_b->npages) ? -1 : 1;
+    }
+  return oid_compare (&size_a->class_oid, &size_b->class_oid);
+}
+
+/*
+ * process_queued_classes - dump the requested classes claimed from the class queue, each in its own object file
+ *    return: NO_ERROR, if successful, error number, if not successful.
+ *    output_dirname(in): directory of the object files
+ *    output_prefix(in): prefix of the object file names
+ * Note:
+ *    The other unload processes claim from the same queue, so every class is dumped by exactly one of them.
+ *    Classes created after the queue was made are not in it and are not dumped, as they are not in the schema
+ *    file either.
+ */
+static int
+process_queued_classes (const char *output_dirname, const char *output_prefix)
+{
+  char outfile[PATH_MAX];
+  SM_CLASS *class_ptr;
+  int *cls_no_ptr;
+  int cl_no, next;
+  int error;
+
+  while ((next = ATOMIC_INC_32 (&class_queue->next, 1) - 1) < class_queue->num_classes)
+    {
+      cls_no_ptr = NULL;
+      error = fh_get (cl_table, &class_queue->class_oids[next], (FH_DATA *) (&cls_no_ptr));
+      if (error != NO_ERROR || cls_no_ptr == NULL)
+	{
+	  /* not a class of this unload */
+	  continue;
+	}
+
+      cl_no = *cls_no_ptr;
+      if (!IS_CLASS_REQUESTED (cl_no))
+	{
+	  continue;
+	}
+
+      ws_find (class_table->mops[cl_no], (MOBJ *) (&class_ptr));
+      if (class_ptr == NULL)
+	{
+	  return ER_FAILED;
+	}
+
+      snprintf (outfile, PATH_MAX - 1, "%s/%s_%s%s", output_dirname, output_prefix, sm_ch_name ((MOBJ) class_ptr),
+		OBJECT_SUFFIX);
+
+      obj_out->fp = fopen_ex (outfile, "wb");
+      if (obj_out->fp == NULL)
+	{
+	  return ER_FAILED;
+	}
+
+      error = process_class (cl_no);
+
+      if (text_print_flush (obj_out) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      fclose (obj_out->fp);
+      obj_out->fp = NULL;
+
+      if (error != NO_ERROR && !ignore_err_flag)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+#endif /* CS_MODE && !WINDOWS */
+
 /*
  * ltrim - trim a given string.
  *    return: pointer to the trimed string.
@@ -27,7 +27,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 #include <assert.h>
+#if !defined (WINDOWS)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif /* !WINDOWS */
 
 #include "porting.h"
 #include "authenticate.h"
@@ -47,7 +54,7 @@ char *database_name = NULL;
 const char *output_dirname = NULL;
 char *input_filename = NULL;
 FILE *output_file = NULL;
-TEXT_OUTPUT object_output = { NULL, NULL, 0, 0, NULL };
+TEXT_OUTPUT object_output = { NULL, NULL, 0, 0, NULL, NULL };
 
 TEXT_OUTPUT *obj_out = &object_output;
 int page_size = 4096;
@@ -60,6 +67,8 @@ bool include_references = false;
 
 bool required_class_only = false;
 bool datafile_per_class = false;
+int process_count = 1;
+int process_index = 0;
 LIST_MOPS *class_table = NULL;
 DB_OBJECT **req_class_table = NULL;
 
@@ -84,6 +93,11 @@ unload_usage (const char *argv0)
   util_log_write_errid (MSGCAT_UTIL_GENERIC_INVALID_ARGUMENT);
 }
 
+#if defined (CS_MODE) && !defined (WINDOWS)
+static int unload_objects_in_processes (const char *exec_name, const char *user, const char *password);
+static int unload_objects_in_child (const char *exec_name, const char *user, const char *password);
+#endif /* CS_MODE && !WINDOWS */
+
 /*
  * unloaddb - main function
  *    return: 0 if successful, non zero if error.
@@ -104,6 +118,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   int au_save;
   EMIT_STORAGE_ORDER order;
   extract_context unload_context;
+  bool is_connected = false;
 
   if (utility_get_option_string_table_size (arg_map) != 1)
     {
@@ -127,6 +142,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   database_name = utility_get_option_string_value (arg_map, OPTION_STRING_TABLE, 0);
   user = utility_get_option_string_value (arg_map, UNLOAD_USER_S, 0);
   password = utility_get_option_string_value (arg_map, UNLOAD_PASSWORD_S, 0);
+  process_count = utility_get_option_int_value (arg_map, UNLOAD_PROCESS_COUNT_S);
   if (utility_get_option_bool_value (arg_map, UNLOAD_KEEP_STORAGE_ORDER_S))
     {
       order = FOLLOW_STORAGE_ORDER;
@@ -148,6 +164,12 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       goto end;
     }
 
+  if (process_count < 1)
+    {
+      unload_usage (arg->argv0);
+      return -1;
+    }
+
   if (!output_prefix)
     {
       output_prefix = database_name;
@@ -200,6 +222,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       status = error;
       goto end;
     }
+  is_connected = true;
 
   ignore_err_flag = prm_get_bool_value (PRM_ID_UNLOADDB_IGNORE_ERROR);
 
@@ -218,6 +241,22 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       fprintf (stdout, "warning: '-ir' option is ignored.\n");
       fflush (stdout);
     }
+#if defined (SA_MODE) || defined (WINDOWS)
+  if (process_count > 1)
+    {
+      /* a stand-alone process opens the database exclusively */
+      process_count = 1;
+      fprintf (stdout, "warning: '--process-count' option is ignored in this mode.\n");
+      fflush (stdout);
+    }
+#endif /* SA_MODE || WINDOWS */
+  if (process_count > 1 && !datafile_per_class)
+    {
+      /* the processes cannot share one object file */
+      datafile_per_class = true;
+      fprintf (stdout, "warning: '--process-count' option turns on '--datafile-per-class'.\n");
+      fflush (stdout);
+    }
 
   class_table = locator_get_all_mops (sm_Root_class_mop, DB_FETCH_READ, NULL);
   if (input_filename)
@@ -336,6 +375,32 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   AU_SAVE_AND_ENABLE (au_save);
   if (!status && (do_objects || !do_schema))
     {
+#if defined (CS_MODE) && !defined (WINDOWS)
+      if (process_count > 1)
+	{
+	  if (create_class_queue () != NO_ERROR)
+	    {
+	      status = 1;
+	    }
+	  else
+	    {
+	      /* the unload processes connect on their own */
+	      error = db_shutdown ();
+	      is_connected = false;
+	      if (error != NO_ERROR)
+		{
+		  PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+		  status = error;
+		}
+	      else if (unload_objects_in_processes (exec_name, user, password) != 0)
+		{
+		  status = 1;
+		}
+	      destroy_class_queue ();
+	    }
+	}
+      else
+#endif /* CS_MODE && !WINDOWS */
       if (extract_objects (exec_name, output_dirname, output_prefix))
 	{
 	  status = 1;
@@ -344,7 +409,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   AU_RESTORE (au_save);
 
   /* if an error occur, print error message */
-  if (status)
+  if (status && is_connected)
     {
       if (db_error_code () != NO_ERROR)
 	{
@@ -355,11 +420,14 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   /*
    * Shutdown db
    */
-  error = db_shutdown ();
-  if (error != NO_ERROR)
+  if (is_connected)
     {
-      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
-      status = error;
+      error = db_shutdown ();
+      if (error != NO_ERROR)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+	  status = error;
+	}
     }
 
 end:
@@ -376,3 +444,143 @@ end:
 
   return status;
 }
+
+#if defined (CS_MODE) && !defined (WINDOWS)
+/*
+ * unload_objects_in_processes - unload the objects in process_count client processes
+ *    return: 0 if successful, non zero if error.
+ *    exec_name(in): utility name
+ *    user(in): user name to connect with
+ *    password(in): password of user
+ * Note:
+ *    Each process has its own connection and transaction, and dumps the classes it claims from the class queue
+ *    into their own object files. The caller creates the queue and closes its connection before this.
+ */
+static int
+unload_objects_in_processes (const char *exec_name, const char *user, const char *password)
+{
+  pid_t *pids;
+  int i, num_started = 0;
+  int child_status;
+  int status = 0;
+
+  pids = (pid_t *) malloc (sizeof (pid_t) * process_count);
+  if (pids == NULL)
+    {
+      util_log_write_errid (MSGCAT_UTIL_GENERIC_NO_MEM);
+      return 1;
+    }
+
+  /* the processes must not repeat what is still buffered */
+  fflush (stdout);
+  fflush (stderr);
+
+  for (i = 0; i < process_count; i++)
+    {
+      pids[i] = fork ();
+      if (pids[i] == 0)
+	{
+	  process_index = i;
+	  child_status = unload_objects_in_child (exec_name, user, password);
+	  fflush (stdout);
+	  fflush (stderr);
+	  _exit (child_status);
+	}
+      else if (pids[i] < 0)
+	{
+	  /* the processes already started claim the classes of the missing ones */
+	  PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, strerror (errno));
+	  if (num_started == 0)
+	    {
+	      status = 1;
+	    }
+	  break;
+	}
+      num_started++;
+    }
+
+  for (i = 0; i < num_started; i++)
+    {
+      if (waitpid (pids[i], &child_status, 0) < 0 || !WIFEXITED (child_status) || WEXITSTATUS (child_status) != 0)
+	{
+	  status = 1;
+	}
+    }
+
+  free_and_init (pids);
+  return status;
+}
+
+/*
+ * unload_objects_in_child - connect and unload the objects in one unload process
+ *    return: 0 if successful, 1 if error.
+ *    exec_name(in): utility name
+ *    user(in): user name to connect with
+ *    password(in): password of user
+ */
+static int
+unload_objects_in_child (const char *exec_name, const char *user, const char *password)
+{
+  int au_save;
+  int i;
+  int status = 0;
+
+  /* the class objects of the parent connection went away with its workspace */
+  locator_free_list_mops (class_table);
+  class_table = NULL;
+
+  if (db_restart_ex (exec_name, database_name, user, password, NULL, DB_CLIENT_TYPE_ADMIN_UTILITY) != NO_ERROR)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+      return 1;
+    }
+  db_set_lock_timeout (prm_get_integer_value (PRM_ID_UNLOADDB_LOCK_TIMEOUT));
+
+  class_table = locator_get_all_mops (sm_Root_class_mop, DB_FETCH_READ, NULL);
+  if (class_table == NULL)
+    {
+      util_log_write_errstr ("%s\n", db_error_string (3));
+      status = 1;
+      goto end;
+    }
+
+  free_and_init (req_class_table);
+  req_class_table = (DB_OBJECT **) malloc (DB_SIZEOF (void *) * class_table->num);
+  if (req_class_table == NULL)
+    {
+      util_log_write_errid (MSGCAT_UTIL_GENERIC_NO_MEM);
+      status = 1;
+      goto end;
+    }
+  for (i = 0; i < class_table->num; ++i)
+    {
+      req_class_table[i] = NULL;
+    }
+  if (get_requested_classes (input_filename, req_class_table) != 0)
+    {
+      util_log_write_errstr ("%s\n", db_error_string (3));
+      status = 1;
+      goto end;
+    }
+
+  AU_SAVE_AND_ENABLE (au_save);
+  if (extract_objects (exec_name, output_dirname, output_prefix))
+    {
+      status = 1;
+    }
+  AU_RESTORE (au_save);
+
+  if (status && db_error_code () != NO_ERROR)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+    }
+
+end:
+  if (db_shutdown () != NO_ERROR)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+      status = 1;
+    }
+  return status;
+}
+#endif /* CS_MODE && !WINDOWS */
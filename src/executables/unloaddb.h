@@ -49,6 +49,8 @@ extern bool do_objects;
 extern bool ignore_err_flag;
 extern bool required_class_only;
 extern bool datafile_per_class;
+extern int process_count;
+extern int process_index;
 extern LIST_MOPS *class_table;
 extern DB_OBJECT **req_class_table;
 extern int is_req_class (DB_OBJECT * class_);
@@ -65,6 +67,10 @@ extern int extract_triggers_to_file (extract_context & ctxt, const char *output_
 extern int extract_indexes_to_file (extract_context & ctxt, const char *output_filename);
 extern int extract_classes (extract_context & ctxt, print_output & schema_output_ctx);
 extern int extract_objects (const char *exec_name, const char *output_dirname, const char *output_prefix);
+#if defined (CS_MODE) && !defined (WINDOWS)
+extern int create_class_queue (void);
+extern void destroy_class_queue (void);
+#endif
 
 extern int create_filename_schema (const char *output_dirname, const char *output_prefix,
 				   char *output_filename_p, const size_t filename_size);
@@ -513,6 +513,7 @@ static UTIL_ARG_MAP ua_Unload_Option_Map[] = {
   {UNLOAD_USER_S, {ARG_STRING}, {0}},
   {UNLOAD_PASSWORD_S, {ARG_STRING}, {0}},
   {UNLOAD_KEEP_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
+  {UNLOAD_PROCESS_COUNT_S, {ARG_INTEGER}, {(void *) 1}},
   {0, {0}, {0}}
 };
 
@@ -536,6 +537,7 @@ static GETOPT_LONG ua_Unload_Option[] = {
   {UNLOAD_USER_L, 1, 0, LOAD_USER_S},
   {UNLOAD_PASSWORD_L, 1, 0, LOAD_PASSWORD_S},
   {UNLOAD_KEEP_STORAGE_ORDER_L, 0, 0, UNLOAD_KEEP_STORAGE_ORDER_S},
+  {UNLOAD_PROCESS_COUNT_L, 1, 0, UNLOAD_PROCESS_COUNT_S},
   {0, 0, 0, 0}
 };
 
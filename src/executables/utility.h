@@ -1276,6 +1276,8 @@ typedef struct _ha_config
 #define UNLOAD_PASSWORD_L                       "password"
 #define UNLOAD_KEEP_STORAGE_ORDER_S		11918
 #define UNLOAD_KEEP_STORAGE_ORDER_L		"keep-storage-order"
+#define UNLOAD_PROCESS_COUNT_S			11919
+#define UNLOAD_PROCESS_COUNT_L			"process-count"
 
 /* compactdb option list */
 #define COMPACT_VERBOSE_S                       'v'
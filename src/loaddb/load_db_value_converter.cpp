@@ -37,12 +37,14 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstring> // for std::memcpy
 
 const std::size_t MAX_DIGITS_FOR_SHORT = 5;   // default for 16 bit signed shorts: 32767 (0x7FFF)
 const std::size_t MAX_DIGITS_FOR_INT = 10;    // default for 32 bit signed integers: 2147483647 (0x7FFFFFFF)
 const std::size_t MAX_DIGITS_FOR_BIGINT = 19; // default for 64 bit signed big integers: 9223372036854775807
 // (0x7FFFFFFFFFFFFFFF)
+const std::size_t MAX_DIGITS_FOR_FAST_INT = 18; // any number of up to 18 digits fits into a 64 bit signed integer
 
 namespace cubload
 {
@@ -201,6 +203,97 @@ namespace cubload
     return c_func;
   }
 
+#if OR_BYTE_ORDER == OR_LITTLE_ENDIAN
+  /*
+   * is_eight_digits () - check all eight characters loaded into chunk are decimal digits
+   */
+  static inline bool
+  is_eight_digits (const std::uint64_t chunk)
+  {
+    return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+	   == 0x3333333333333333ULL;
+  }
+
+  /*
+   * eight_digits_to_int () - convert eight decimal digits loaded into chunk, first digit in the lowest byte
+   */
+  static inline std::uint32_t
+  eight_digits_to_int (std::uint64_t chunk)
+  {
+    chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return (std::uint32_t) (((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+  }
+#endif /* OR_BYTE_ORDER == OR_LITTLE_ENDIAN */
+
+  bool
+  parse_int64_digits (const char *str, const size_t str_size, std::int64_t &value)
+  {
+    const char *p = str;
+    const char *end = str + str_size;
+    bool is_negative = false;
+    std::uint64_t result = 0;
+
+    if (p < end && (*p == '-' || *p == '+'))
+      {
+	is_negative = (*p == '-');
+	p++;
+      }
+    if (p == end || (std::size_t) (end - p) > MAX_DIGITS_FOR_FAST_INT)
+      {
+	return false;
+      }
+
+#if OR_BYTE_ORDER == OR_LITTLE_ENDIAN
+    // convert eight digits at a time, without a multiplication and a branch for each digit
+    for (; end - p >= 8; p += 8)
+      {
+	std::uint64_t chunk;
+
+	std::memcpy (&chunk, p, sizeof (chunk));
+	if (!is_eight_digits (chunk))
+	  {
+	    return false;
+	  }
+	result = result * 100000000 + eight_digits_to_int (chunk);
+      }
+#endif /* OR_BYTE_ORDER == OR_LITTLE_ENDIAN */
+
+    for (; p < end; p++)
+      {
+	if (*p < '0' || *p > '9')
+	  {
+	    return false;
+	  }
+	result = result * 10 + (*p - '0');
+      }
+
+    value = is_negative ? - (std::int64_t) result : (std::int64_t) result;
+    return true;
+  }
+
+  bool
+  is_ascii_string (const char *str, const size_t str_size)
+  {
+    std::uint64_t high_bits = 0;
+    std::size_t i = 0;
+
+    // no early out; the loop is branch free and the compiler is free to vectorize it
+    for (; i + sizeof (std::uint64_t) <= str_size; i += sizeof (std::uint64_t))
+      {
+	std::uint64_t chunk;
+
+	std::memcpy (&chunk, str + i, sizeof (chunk));
+	high_bits |= chunk;
+      }
+    for (; i < str_size; i++)
+      {
+	high_bits |= (unsigned char) str[i];
+      }
+
+    return (high_bits & 0x8080808080808080ULL) == 0;
+  }
+
   int
   mismatch (const char *str, const size_t str_size, const attribute *attr, db_value *val)
   {
@@ -228,9 +321,21 @@ namespace cubload
   to_db_short (const char *str, const size_t str_size, const attribute *attr, db_value *val)
   {
     char *str_ptr;
+    std::int64_t fast_val;
 
     db_make_short (val, 0);
 
+    if (parse_int64_digits (str, str_size, fast_val))
+      {
+	if (OR_CHECK_SHORT_OVERFLOW (fast_val))
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IT_DATA_OVERFLOW, 1, pr_type_name (DB_TYPE_SHORT));
+	    return ER_IT_DATA_OVERFLOW;
+	  }
+	val->data.sh = (short) fast_val;
+	return NO_ERROR;
+      }
+
     /* Let try take the fastest path here, if we know that number we are getting fits into a long, use strtol, else we
      * need to convert it to a double and coerce it, checking for overflow. Note if integers with leading zeros are
      * entered this can take the slower route. */
@@ -268,9 +373,21 @@ namespace cubload
   to_db_int (const char *str, const size_t str_size, const attribute *attr, db_value *val)
   {
     char *str_ptr;
+    std::int64_t fast_val;
 
     db_make_int (val, 0);
 
+    if (parse_int64_digits (str, str_size, fast_val))
+      {
+	if (OR_CHECK_INT_OVERFLOW (fast_val))
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IT_DATA_OVERFLOW, 1, pr_type_name (DB_TYPE_INTEGER));
+	    return ER_IT_DATA_OVERFLOW;
+	  }
+	val->data.i = (int) fast_val;
+	return NO_ERROR;
+      }
+
     /* Let try take the fastest path here, if we know that number we are getting fits into a long, use strtol, else we
      * need to convert it to a double and coerce it, checking for overflow. Note if integers with leading zeros are
      * entered this can take the slower route. */
@@ -322,8 +439,16 @@ namespace cubload
   int
   to_db_bigint (const char *str, const size_t str_size, const attribute *attr, db_value *val)
   {
+    std::int64_t fast_val;
+
     db_make_bigint (val, 0);
 
+    if (parse_int64_digits (str, str_size, fast_val))
+      {
+	val->data.bigint = fast_val;
+	return NO_ERROR;
+      }
+
     /* Let try take the fastest path here, if we know that number we are getting fits into a long, use strtol, else we
      * need to convert it to a double and coerce it, checking for overflow. Note if integers with leading zeros are
      * entered this can take the slower route. */
@@ -366,7 +491,16 @@ namespace cubload
     int precision = domain.precision;
     INTL_CODESET codeset = (INTL_CODESET) domain.codeset;
 
-    intl_char_count ((unsigned char *) str, str_len, codeset, &char_count);
+    // ASCII characters are single byte in all codesets; counting characters of a multi-byte codeset is expensive
+    bool is_ascii = is_ascii_string (str, str_size);
+    if (is_ascii)
+      {
+	char_count = str_len;
+      }
+    else
+      {
+	intl_char_count ((unsigned char *) str, str_len, codeset, &char_count);
+      }
 
     if (char_count > precision)
       {
@@ -378,7 +512,14 @@ namespace cubload
 	const char *p;
 	int truncate_size;
 
-	intl_char_size ((unsigned char *) str, precision, codeset, &truncate_size);
+	if (is_ascii)
+	  {
+	    truncate_size = precision;
+	  }
+	else
+	  {
+	    intl_char_size ((unsigned char *) str, precision, codeset, &truncate_size);
+	  }
 
 	p = intl_skip_spaces (&str[truncate_size],  &str[str_len], codeset);
 	if (p >= &str[str_len])
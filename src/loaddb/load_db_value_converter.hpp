@@ -27,6 +27,8 @@
 #include "dbtype_def.h"
 #include "load_common.hpp"
 
+#include <cstdint>
+
 namespace cubload
 {
   // forward declaration
@@ -36,6 +38,22 @@ namespace cubload
 
   conv_func &get_conv_func (const data_type ldr_type, const DB_TYPE db_type);
 
+  /*
+   * parse_int64_digits () - fast conversion of an integer token ([+-]?[0-9]+) of up to 18 digits
+   *
+   *    return: false if the token is not a plain decimal number or is too long, then the caller must fall back to the
+   *            generic conversion
+   *    str(in)      : token
+   *    str_size(in) : token size
+   *    value(out)   : converted value
+   */
+  bool parse_int64_digits (const char *str, const size_t str_size, std::int64_t &value);
+
+  /*
+   * is_ascii_string () - check the string has only 7-bit characters, which are single byte in any codeset
+   */
+  bool is_ascii_string (const char *str, const size_t str_size);
+
 } // namespace cubload
 
 #endif /* _LOAD_DB_VALUE_CONVERTER_HPP_ */
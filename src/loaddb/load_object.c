@@ -34,6 +34,12 @@
 #include <ctype.h>
 #include <sys/stat.h>
 #include <math.h>
+#include <signal.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
 
 #include "utility.h"
 #include "misc_string.h"
@@ -435,17 +441,195 @@ error:
 }
 
 /*
- * text_print_flush - flush TEXT_OUTPUT contents to file
+ * text_output_writer - writes full TEXT_OUTPUT buffers to file in a background thread, while the next buffer is being
+ *                      printed.
+ */
+/* *INDENT-OFF* */
+struct text_output_writer
+{
+  std::thread thread;
+  std::mutex mutex;
+  std::condition_variable cond;
+  char *spare_buffer;		/* buffer not used by either the printer or the writer */
+  char *pending_buffer;		/* buffer handed to the writer, NULL if writer is idle */
+  int pending_count;
+  FILE *pending_fp;
+  bool has_error;
+  bool stop;
+
+  text_output_writer ()
+    : thread ()
+    , mutex ()
+    , cond ()
+    , spare_buffer (NULL)
+    , pending_buffer (NULL)
+    , pending_count (0)
+    , pending_fp (NULL)
+    , has_error (false)
+    , stop (false)
+  {
+  }
+};
+/* *INDENT-ON* */
+
+static void text_output_writer_execute (struct text_output_writer *writer);
+static int text_print_write_buffer (TEXT_OUTPUT * tout);
+
+/*
+ * text_output_writer_execute - writer thread loop
+ *    return: void
+ *    writer(in/out): writer
+ */
+static void
+text_output_writer_execute (struct text_output_writer *writer)
+{
+#if !defined (WINDOWS)
+  sigset_t sigs;
+
+  /* the termination handlers of the utility must run on the printing thread */
+  sigemptyset (&sigs);
+  sigaddset (&sigs, SIGINT);
+  sigaddset (&sigs, SIGTERM);
+  sigaddset (&sigs, SIGQUIT);
+  pthread_sigmask (SIG_BLOCK, &sigs, NULL);
+#endif /* !WINDOWS */
+
+  /* *INDENT-OFF* */
+  std::unique_lock<std::mutex> ulock (writer->mutex);
+  /* *INDENT-ON* */
+
+  while (true)
+    {
+      /* *INDENT-OFF* */
+      writer->cond.wait (ulock, [writer] { return writer->stop || writer->pending_buffer != NULL; });
+      /* *INDENT-ON* */
+      if (writer->pending_buffer == NULL)
+	{
+	  /* stopped and nothing left to write */
+	  break;
+	}
+
+      char *buffer = writer->pending_buffer;
+      int count = writer->pending_count;
+      FILE *fp = writer->pending_fp;
+
+      ulock.unlock ();
+      bool is_written = (count == (int) fwrite (buffer, 1, count, fp));
+      ulock.lock ();
+
+      if (!is_written)
+	{
+	  writer->has_error = true;
+	}
+      assert (writer->spare_buffer == NULL);
+      writer->spare_buffer = buffer;
+      writer->pending_buffer = NULL;
+      writer->cond.notify_all ();
+    }
+}
+
+/*
+ * text_print_start_writer - start writing full buffers of TEXT_OUTPUT in a background thread
+ *    return: NO_ERROR if successful, error code otherwise
+ *    tout(in/out): TEXT_OUTPUT structure with allocated buffer
+ *
+ * Note: the buffers are written to the file tout->fp refers to when they are handed to the writer. Before closing
+ *       or replacing tout->fp, the caller must call text_print_flush.
+ */
+int
+text_print_start_writer (TEXT_OUTPUT * tout)
+{
+  struct text_output_writer *writer;
+
+  assert (tout->writer == NULL && tout->buffer != NULL);
+
+  writer = new (std::nothrow) text_output_writer ();
+  if (writer == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  writer->spare_buffer = (char *) malloc (tout->iosize);
+  if (writer->spare_buffer == NULL)
+    {
+      delete writer;
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  writer->thread = std::thread (text_output_writer_execute, writer);
+  tout->writer = writer;
+
+  return NO_ERROR;
+}
+
+/*
+ * text_print_stop_writer - wait for the background writer to finish its pending buffer and stop it
+ *    return: void
+ *    tout(in/out): TEXT_OUTPUT structure
+ */
+void
+text_print_stop_writer (TEXT_OUTPUT * tout)
+{
+  struct text_output_writer *writer = tout->writer;
+
+  if (writer == NULL)
+    {
+      return;
+    }
+
+  {
+    /* *INDENT-OFF* */
+    std::unique_lock<std::mutex> ulock (writer->mutex);
+    /* *INDENT-ON* */
+    writer->stop = true;
+  }
+  writer->cond.notify_all ();
+  writer->thread.join ();
+
+  free_and_init (writer->spare_buffer);
+  delete writer;
+  tout->writer = NULL;
+}
+
+/*
+ * text_print_write_buffer - write buffered TEXT_OUTPUT contents to file, or hand them to the background writer
  *    return: NO_ERROR if successful, ER_IO_WRITE if file I/O error occurred
  *    tout(in/out): TEXT_OUTPUT structure
  */
-int
-text_print_flush (TEXT_OUTPUT * tout)
+static int
+text_print_write_buffer (TEXT_OUTPUT * tout)
 {
-  /* flush to disk */
-  if (tout->count != (int) fwrite (tout->buffer, 1, tout->count, tout->fp))
+  struct text_output_writer *writer = tout->writer;
+
+  if (writer == NULL)
     {
-      return ER_IO_WRITE;
+      /* flush to disk */
+      if (tout->count != (int) fwrite (tout->buffer, 1, tout->count, tout->fp))
+	{
+	  return ER_IO_WRITE;
+	}
+    }
+  else if (tout->count > 0)
+    {
+      /* *INDENT-OFF* */
+      std::unique_lock<std::mutex> ulock (writer->mutex);
+
+      /* wait until the writer is done with previous buffer, then swap it with the buffer to write */
+      writer->cond.wait (ulock, [writer] { return writer->pending_buffer == NULL; });
+      /* *INDENT-ON* */
+      if (writer->has_error)
+	{
+	  return ER_IO_WRITE;
+	}
+
+      writer->pending_buffer = tout->buffer;
+      writer->pending_count = tout->count;
+      writer->pending_fp = tout->fp;
+      tout->buffer = writer->spare_buffer;
+      writer->spare_buffer = NULL;
+
+      ulock.unlock ();
+      writer->cond.notify_all ();
     }
 
   /* re-init */
@@ -455,6 +639,32 @@ text_print_flush (TEXT_OUTPUT * tout)
   return NO_ERROR;
 }
 
+/*
+ * text_print_flush - flush TEXT_OUTPUT contents to file
+ *    return: NO_ERROR if successful, ER_IO_WRITE if file I/O error occurred
+ *    tout(in/out): TEXT_OUTPUT structure
+ *
+ * Note: all contents are written when the function returns, even with a background writer.
+ */
+int
+text_print_flush (TEXT_OUTPUT * tout)
+{
+  struct text_output_writer *writer = tout->writer;
+  int error;
+
+  error = text_print_write_buffer (tout);
+  if (error != NO_ERROR || writer == NULL)
+    {
+      return error;
+    }
+
+  /* *INDENT-OFF* */
+  std::unique_lock<std::mutex> ulock (writer->mutex);
+  writer->cond.wait (ulock, [writer] { return writer->pending_buffer == NULL; });
+  /* *INDENT-ON* */
+  return writer->has_error ? ER_IO_WRITE : NO_ERROR;
+}
+
 /*
  * text_print - print formatted text to TEXT_OUTPUT
  *    return: NO_ERROR if successful, error code otherwise
@@ -501,7 +711,7 @@ start:
 	}
       else
 	{			/* need more buffer */
-	  CHECK_PRINT_ERROR (text_print_flush (tout));
+	  CHECK_PRINT_ERROR (text_print_write_buffer (tout));
 	  goto start;		/* retry */
 	}
     }
@@ -74,8 +74,12 @@ typedef struct text_output
   int count;
   /* output file */
   FILE *fp;
+  /* background writer of full buffers, NULL if buffers are written synchronously */
+  struct text_output_writer *writer;
 } TEXT_OUTPUT;
 
+extern int text_print_start_writer (TEXT_OUTPUT * tout);
+extern void text_print_stop_writer (TEXT_OUTPUT * tout);
 extern int text_print_flush (TEXT_OUTPUT * tout);
 extern int text_print (TEXT_OUTPUT * tout, const char *buf, int buflen, char const *fmt, ...);
 extern DESC_OBJ *make_desc_obj (SM_CLASS * class_);
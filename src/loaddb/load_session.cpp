@@ -171,6 +171,9 @@ namespace cubload
 	// We don't need anything from the driver anymore.
 	driver->clear ();
 
+	// Last line committed by this batch, zero if the batch is aborted.
+	int committed_line = 0;
+
 	if (m_session.is_failed () || (!is_syntax_check_only && (!parser_result || er_has_error ())))
 	  {
 	    // if a batch transaction was aborted and syntax only is not enabled then abort entire loaddb session
@@ -180,14 +183,13 @@ namespace cubload
 	  }
 	else
 	  {
-	    // order batch commits, therefore wait until previous batch is committed
-	    m_session.wait_for_previous_batch (m_batch.get_id ());
-
+	    // batches commit as soon as they are done; the session reports the last committed line only after all
+	    // previous batches are committed too
 	    xtran_server_commit (&thread_ref, false);
 
 	    // update load statistics after commit
 	    m_session.stats_update_rows_committed (rows_number);
-	    m_session.stats_update_last_committed_line (line_no + 1);
+	    committed_line = line_no + 1;
 
 	    MSGCAT_LOADDB_MSG msg_type;
 	    if (m_session.get_args ().syntax_check)
@@ -206,7 +208,7 @@ namespace cubload
 	worker_tdes->client.reset ();
 
 	// notify session that batch is done
-	notify_done_and_tran_end (tran_index);
+	notify_done_and_tran_end (tran_index, committed_line);
       }
 
     private:
@@ -217,10 +219,10 @@ namespace cubload
 	m_was_session_notified = true;
       }
 
-      void notify_done_and_tran_end (int tran_index)
+      void notify_done_and_tran_end (int tran_index, int committed_line)
       {
 	assert (!m_was_session_notified);
-	m_session.notify_batch_done_and_register_tran_end (m_batch.get_id (), tran_index);
+	m_session.notify_batch_done_and_register_tran_end (m_batch.get_id (), tran_index, committed_line);
 	m_was_session_notified = true;
       }
 
@@ -237,6 +239,7 @@ namespace cubload
     , m_args (args)
     , m_last_batch_id {NULL_BATCH_ID}
     , m_max_batch_id {NULL_BATCH_ID}
+    , m_done_batches ()
     , m_active_task_count {0}
     , m_class_registry ()
     , m_stats ()
@@ -282,20 +285,6 @@ namespace cubload
     return m_last_batch_id == m_max_batch_id;
   }
 
-  void
-  session::wait_for_previous_batch (const batch_id id)
-  {
-    auto pred = [this, &id] () -> bool { return is_failed () || id == (m_last_batch_id + 1); };
-
-    if (id == FIRST_BATCH_ID || pred ())
-      {
-	return;
-      }
-
-    std::unique_lock<std::mutex> ulock (m_mutex);
-    m_cond_var.wait (ulock, pred);
-  }
-
   void
   session::wait_for_completion ()
   {
@@ -322,8 +311,7 @@ namespace cubload
     --m_active_task_count;
     if (!is_failed ())
       {
-	assert (m_last_batch_id == id - 1);
-	m_last_batch_id = id;
+	mark_batch_done (id, 0);
       }
     ulock.unlock ();
     notify_waiting_threads ();
@@ -332,7 +320,7 @@ namespace cubload
   }
 
   void
-  session::notify_batch_done_and_register_tran_end (batch_id id, int tran_index)
+  session::notify_batch_done_and_register_tran_end (batch_id id, int tran_index, int committed_line)
   {
     std::unique_lock<std::mutex> ulock (m_mutex);
     // free transaction index
@@ -342,8 +330,7 @@ namespace cubload
     --m_active_task_count;
     if (!is_failed ())
       {
-	assert (m_last_batch_id == id - 1);
-	m_last_batch_id = id;
+	mark_batch_done (id, committed_line);
       }
     if (m_tran_indexes.erase (tran_index) != 1)
       {
@@ -438,22 +425,24 @@ namespace cubload
   }
 
   void
-  session::stats_update_last_committed_line (int last_committed_line)
+  session::mark_batch_done (batch_id id, int committed_line)
   {
-    if (last_committed_line <= m_stats.last_committed_line)
-      {
-	return;
-      }
+    // note: caller holds m_mutex
 
-    std::unique_lock<std::mutex> ulock (m_mutex);
+    // batches may finish in any order; m_last_batch_id only advances over consecutive batch ids, so the last
+    // committed line reported to the client always has all lines before it committed
+    assert (id > m_last_batch_id);
+    m_done_batches.emplace (id, committed_line);
 
-    // check if again after lock was acquired
-    if (last_committed_line <= m_stats.last_committed_line)
+    for (auto it = m_done_batches.begin (); it != m_done_batches.end () && it->first == m_last_batch_id + 1;
+	 it = m_done_batches.erase (it))
       {
-	return;
+	m_last_batch_id = it->first;
+	if (it->second > m_stats.last_committed_line)
+	  {
+	    m_stats.last_committed_line = it->second;
+	  }
       }
-
-    m_stats.last_committed_line = last_committed_line;
   }
 
   void
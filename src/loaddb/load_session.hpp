@@ -33,6 +33,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -101,9 +102,8 @@ namespace cubload
 		      load_status &status);
 
       void wait_for_completion ();
-      void wait_for_previous_batch (batch_id id);
       void notify_batch_done (batch_id id);
-      void notify_batch_done_and_register_tran_end (batch_id id, int tran_index);
+      void notify_batch_done_and_register_tran_end (batch_id id, int tran_index, int committed_line);
       void register_tran_start (int tran_index);
 
       void on_error (std::string &err_msg);
@@ -117,7 +117,6 @@ namespace cubload
       void stats_update_rows_committed (int rows_committed);
       int stats_get_rows_committed ();
 
-      void stats_update_last_committed_line (int last_committed_line);
       void stats_update_current_line (int current_line);
 
       void update_class_statistics (cubthread::entry &thread_ref);
@@ -131,6 +130,7 @@ namespace cubload
     private:
       void notify_waiting_threads ();
       bool is_completed ();
+      void mark_batch_done (batch_id id, int committed_line);
       void collect_stats ();
 
       template<typename T>
@@ -141,8 +141,9 @@ namespace cubload
       std::set<int> m_tran_indexes;
 
       load_args m_args;
-      batch_id m_last_batch_id;
+      batch_id m_last_batch_id;     // all batches up to this id are done
       std::atomic<batch_id> m_max_batch_id;
+      std::map<batch_id, int> m_done_batches;   // batches done ahead of m_last_batch_id and their committed line
       std::atomic<size_t> m_active_task_count;    // note: all decrements need to be protected by mutex
 
       class_registry m_class_registry;
@@ -170,6 +170,7 @@ make_fetch_proc (QO_ENV * env, QO_PLAN * plan)
  *	to initialize anything other than the type and the access
  *	spec; the scan evidently uses the val_list, etc. from the
  *	outer block.
+ *	For hash join plans, the left and right results are not sorted.
  */
 static XASL_NODE *
 make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * left_list, BITSET * left_exprs,
@@ -206,6 +207,8 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
   ls_merge = &merge->proc.mergelist.ls_merge;
 
   ls_merge->join_type = plan->plan_un.join.join_type;
+  ls_merge->join_method =
+    (plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN) ? QFILE_JOIN_METHOD_HASH : QFILE_JOIN_METHOD_MERGE;
 
   ncols = ls_merge->ls_column_cnt = bitset_cardinality (&(plan->plan_un.join.join_terms));
   assert (ncols > 0);
@@ -301,6 +304,13 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
 	}
       ls_merge->ls_inner_unique[cnt] = false;	/* currently, unused */
 
+      if (ls_merge->join_method == QFILE_JOIN_METHOD_HASH)
+	{
+	  /* hash join lists need not be sorted */
+	  cnt++;
+	  continue;
+	}
+
       /* set outer list order entry */
       prev_order = NULL;
       for (order = left->orderby_list; order; order = order->next)
@@ -923,7 +933,8 @@ add_sort_spec (QO_ENV * env, XASL_NODE * xasl, QO_PLAN * plan, DB_VALUE * ordby_
   if (instnum_flag)
     {
       if (xasl && subplan->plan_type == QO_PLANTYPE_JOIN
-	  && subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+	  && (subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+	      || subplan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN))
 	{
 	  PT_NODE *instnum_pred;
 
@@ -1830,6 +1841,7 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	  break;
 
 	case QO_JOINMETHOD_MERGE_JOIN:
+	case QO_JOINMETHOD_HASH_JOIN:
 	  /*
 	   * The optimizer isn't supposed to produce plans in which a
 	   * merge join isn't "shielded" by a sort (temp file) plan,
@@ -4229,7 +4241,8 @@ qo_check_join_for_multi_range_opt (QO_PLAN * plan)
 
   /* verify that this is a valid join for multi range optimization */
   if (plan == NULL || plan->plan_type != QO_PLANTYPE_JOIN || plan->plan_un.join.join_type != JOIN_INNER
-      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       return false;
     }
@@ -142,6 +142,7 @@ static void qo_sscan_cost (QO_PLAN *);
 static void qo_iscan_cost (QO_PLAN *);
 static void qo_sort_cost (QO_PLAN *);
 static void qo_mjoin_cost (QO_PLAN *);
+static void qo_hjoin_cost (QO_PLAN *);
 static void qo_follow_cost (QO_PLAN *);
 static void qo_worst_cost (QO_PLAN *);
 static void qo_zero_cost (QO_PLAN *);
@@ -179,6 +180,8 @@ static int qo_examine_nl_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSE
 			       BITSET *, int);
 static int qo_examine_merge_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
 				  BITSET *);
+static int qo_examine_hash_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
+				 BITSET *);
 static int qo_examine_correlated_index (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_follow (QO_INFO *, QO_TERM *, QO_INFO *, BITSET *, BITSET *);
 static void qo_compute_projected_segs (QO_PLANNER *, BITSET *, BITSET *, BITSET *);
@@ -323,6 +326,17 @@ static QO_PLAN_VTBL qo_merge_join_plan_vtbl = {
   "Merge join"
 };
 
+static QO_PLAN_VTBL qo_hash_join_plan_vtbl = {
+  "h-join",
+  qo_join_fprint,
+  qo_join_walk,
+  qo_join_free,
+  qo_hjoin_cost,
+  qo_hjoin_cost,
+  qo_join_info,
+  "Hash join"
+};
+
 static QO_PLAN_VTBL qo_follow_plan_vtbl = {
   "follow",
   qo_follow_fprint,
@@ -363,6 +377,7 @@ QO_PLAN_VTBL *all_vtbls[] = {
   &qo_nl_join_plan_vtbl,
   &qo_idx_join_plan_vtbl,
   &qo_merge_join_plan_vtbl,
+  &qo_hash_join_plan_vtbl,
   &qo_follow_plan_vtbl,
   &qo_set_follow_plan_vtbl,
   &qo_worst_plan_vtbl
@@ -2729,6 +2744,27 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
 	}
 
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+
+      plan->vtbl = &qo_hash_join_plan_vtbl;
+
+      /* The hash join emits tuples in the order of the probe list, which depends on the join type and on the list
+       * sizes known only at execution; the result is therefore always unordered.
+       */
+      plan->order = QO_UNORDERED;
+
+      /* Like merge joins, hash joins consume two list files. Neither of them needs to be sorted. */
+      if (outer->plan_type != QO_PLANTYPE_SORT)
+	{
+	  outer = qo_sort_new (outer, QO_UNORDERED, SORT_TEMP);
+	}
+      if (inner->plan_type != QO_PLANTYPE_SORT)
+	{
+	  inner = qo_sort_new (inner, QO_UNORDERED, SORT_TEMP);
+	}
+
+      break;
     }
 
   assert (inner != NULL && outer != NULL);
@@ -2827,7 +2863,7 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
    * not storing them into a listfile. We could push the cost into the merge plan itself, I suppose, but a rational
    * implementation wouldn't impose this cost, and so I have hope that one day we'll be able to eliminate it.
    */
-  if (join_method == QO_JOINMETHOD_MERGE_JOIN)
+  if (join_method == QO_JOINMETHOD_MERGE_JOIN || join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       plan = qo_sort_new (plan, plan->order, SORT_TEMP);
     }
@@ -3224,6 +3260,93 @@ qo_mjoin_cost (QO_PLAN * planp)
   planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
 }
 
+/*
+ * qo_hjoin_cost () -
+ *   return:
+ *   planp(in):
+ */
+static void
+qo_hjoin_cost (QO_PLAN * planp)
+{
+  QO_PLAN *inner;
+  QO_PLAN *outer;
+  QO_ENV *env;
+  double outer_cardinality = 0.0, inner_cardinality = 0.0;
+  double outer_pages, inner_pages, build_pages, mem_pages;
+
+  inner = planp->plan_un.join.inner;
+
+  /* for worst cost */
+  if (inner->fixed_cpu_cost == QO_INFINITY || inner->fixed_io_cost == QO_INFINITY
+      || inner->variable_cpu_cost == QO_INFINITY || inner->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  outer = planp->plan_un.join.outer;
+
+  /* for worst cost */
+  if (outer->fixed_cpu_cost == QO_INFINITY || outer->fixed_io_cost == QO_INFINITY
+      || outer->variable_cpu_cost == QO_INFINITY || outer->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  env = outer->info->env;
+  if (outer->has_sort_limit)
+    {
+      outer_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (env));
+    }
+  else
+    {
+      outer_cardinality = outer->info->cardinality;
+    }
+
+  if (inner->has_sort_limit)
+    {
+      inner_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (env));
+    }
+  else
+    {
+      inner_cardinality = inner->info->cardinality;
+    }
+
+  outer_pages = MAX (1.0, outer_cardinality * (double) outer->info->projected_size / (double) IO_PAGESIZE);
+  inner_pages = MAX (1.0, inner_cardinality * (double) inner->info->projected_size / (double) IO_PAGESIZE);
+
+  /* outer joins build the hash table on the list whose tuples are not preserved; inner joins on the smaller one */
+  if (planp->plan_un.join.join_type == JOIN_LEFT)
+    {
+      build_pages = inner_pages;
+    }
+  else if (planp->plan_un.join.join_type == JOIN_RIGHT)
+    {
+      build_pages = outer_pages;
+    }
+  else
+    {
+      build_pages = MIN (outer_pages, inner_pages);
+    }
+
+  /* CPU and IO costs which are fixed against join */
+  planp->fixed_cpu_cost = outer->fixed_cpu_cost + inner->fixed_cpu_cost;
+  planp->fixed_io_cost = outer->fixed_io_cost + inner->fixed_io_cost;
+  /* CPU and IO costs which are variable according to the join plan; every tuple is either hashed into the table or
+   * probed against it exactly once */
+  planp->variable_cpu_cost = outer->variable_cpu_cost + inner->variable_cpu_cost;
+  planp->variable_cpu_cost += (outer_cardinality + inner_cardinality) * (double) QO_CPU_WEIGHT;
+  planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
+
+  mem_pages = (double) prm_get_bigint_value (PRM_ID_MAX_HASH_JOIN_SIZE) / (double) IO_PAGESIZE;
+  if (build_pages > mem_pages)
+    {
+      /* the build list does not fit in memory; both lists are partitioned into temporary files and read again */
+      planp->variable_io_cost += 2.0 * (outer_pages + inner_pages);
+    }
+}
+
 /*
  * qo_follow_new () -
  *   return:
@@ -5964,6 +6087,93 @@ exit:
   return n;
 }
 
+/*
+ * qo_examine_hash_join () -
+ *   return:
+ *   info(in):
+ *   join_type(in):
+ *   outer(in):
+ *   inner(in):
+ *   sm_join_terms(in): equi-join terms used as hash keys
+ *   duj_terms(in):
+ *   afj_terms(in):
+ *   sarged_terms(in):
+ *   pinned_subqueries(in):
+ *
+ * Note: The hash join uses the same equi-join edges as the merge join, but needs neither of its operands to be
+ *       sorted.
+ */
+static int
+qo_examine_hash_join (QO_INFO * info, JOIN_TYPE join_type, QO_INFO * outer, QO_INFO * inner, BITSET * sm_join_terms,
+		      BITSET * duj_terms, BITSET * afj_terms, BITSET * sarged_terms, BITSET * pinned_subqueries)
+{
+  int n = 0;
+  QO_PLAN *outer_plan, *inner_plan;
+  QO_NODE *inner_node;
+  BITSET other_duj_terms;
+
+  bitset_init (&other_duj_terms, info->env);
+
+  /* fake terms need nested loops; see qo_examine_merge_join () */
+  if (bitset_intersects (sarged_terms, &(info->env->fake_terms)))
+    {
+      goto exit;
+    }
+
+  if (join_type != JOIN_INNER && join_type != JOIN_LEFT && join_type != JOIN_RIGHT)
+    {
+      goto exit;
+    }
+
+  if (IS_OUTER_JOIN_TYPE (join_type))
+    {
+      /* The hash join matches tuples on the hash keys only. Outer joins having other ON clause terms are left to the
+       * other join methods. */
+      bitset_assign (&other_duj_terms, duj_terms);
+      bitset_difference (&other_duj_terms, sm_join_terms);
+      if (!bitset_is_empty (&other_duj_terms))
+	{
+	  goto exit;
+	}
+    }
+
+  /* At here, inner is single class spec */
+  inner_node = QO_ENV_NODE (inner->env, bitset_first_member (&(inner->nodes)));
+
+  if (QO_NODE_HINT (inner_node) & (PT_HINT_USE_NL | PT_HINT_USE_IDX | PT_HINT_USE_MERGE))
+    {
+      /* join hint: force another join method */
+      goto exit;
+    }
+  else if (!prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN))
+    {
+      /* optimizer prm: keep out h-join; */
+      goto exit;
+    }
+
+  outer_plan = qo_find_best_plan_on_info (outer, QO_UNORDERED, 1.0);
+  if (outer_plan == NULL)
+    {
+      goto exit;
+    }
+
+  inner_plan = qo_find_best_plan_on_info (inner, QO_UNORDERED, 1.0);
+  if (inner_plan == NULL)
+    {
+      goto exit;
+    }
+
+  n =
+    qo_check_plan_on_info (info,
+			   qo_join_new (info, join_type, QO_JOINMETHOD_HASH_JOIN, outer_plan, inner_plan,
+					sm_join_terms, duj_terms, afj_terms, sarged_terms, pinned_subqueries));
+
+exit:
+  bitset_delset (&other_duj_terms);
+
+  return n;
+}
+
 /*
  * qo_examine_correlated_index () -
  *   return: int
@@ -7086,6 +7296,14 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
 				     &sarged_terms, &pinned_subqueries);
 	  }
 #endif /* MERGE_JOINS */
+
+	/* STEP 5-5: examine hash-join */
+	if (!bitset_is_empty (&sm_join_terms))
+	  {
+	    kept +=
+	      qo_examine_hash_join (new_info, join_type, head_info, tail_info, &sm_join_terms, &duj_terms, &afj_terms,
+				    &sarged_terms, &pinned_subqueries);
+	  }
       }
 
     /* At this point, kept indicates the number of worthwhile plans generated by examine_joins (i.e., plans that where
@@ -10786,7 +11004,7 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
 	    }
 	  else
 	    {
-	      /* QO_JOINMETHOD_MERGE_JOIN */
+	      /* QO_JOINMETHOD_MERGE_JOIN, QO_JOINMETHOD_HASH_JOIN */
 	      plan = NULL;
 	    }
 	  break;
@@ -11330,6 +11548,10 @@ qo_plan_join_print_json (QO_PLAN * plan)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -11641,6 +11863,10 @@ qo_plan_join_print_text (FILE * fp, QO_PLAN * plan, int indent)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -7109,6 +7109,10 @@ show_type
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| VACUUM STATUS
+		{{
+			$$ = SHOWSTMT_VACUUM_STATUS;
+		}}
 	;
 
 show_type_of_like
@@ -689,6 +689,33 @@ metadata_of_threads (void)
   return &md;
 }
 
+/* for show vacuum status */
+static SHOWSTMT_METADATA *
+metadata_of_vacuum_status (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Num_workers", "int"},
+    {"Num_active_workers", "int"},
+    {"Last_blockid", "bigint"},
+    {"Oldest_unvacuumed_blockid", "bigint"},
+    {"Num_blocks_pending", "bigint"},
+    {"Oldest_block_age_log_pages", "bigint"},
+    {"Keep_from_log_pageid", "bigint"},
+    {"Oldest_unvacuumed_mvccid", "bigint"},
+    {"Num_log_records", "bigint"},
+    {"Worker_records_per_sec", "double"},
+    {"Heap_time_msecs", "bigint"},
+    {"Btree_time_msecs", "bigint"},
+    {"Num_archive_log_pages", "bigint"}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_VACUUM_STATUS, true /* only_for_dba */ , "show vacuum status",
+    cols, DIM (cols), NULL, 0, NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
 /*
  * showstmt_get_metadata() -  return show statement column infos
  *   return:-
@@ -930,6 +957,7 @@ showstmt_metadata_init (void)
   show_Metas[SHOWSTMT_FULL_TIMEZONES] = metadata_of_full_timezones ();
   show_Metas[SHOWSTMT_TRAN_TABLES] = metadata_of_tran_tables ();
   show_Metas[SHOWSTMT_THREADS] = metadata_of_threads ();
+  show_Metas[SHOWSTMT_VACUUM_STATUS] = metadata_of_vacuum_status ();
 
   for (i = 0; i < DIM (show_Metas); i++)
     {
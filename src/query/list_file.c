@@ -98,6 +98,8 @@ struct qfile_list_cache
   unsigned int hit_counter;	/* counter of cache hit */
   unsigned int miss_counter;	/* counter of cache miss */
   unsigned int full_counter;	/* counter of cache full & replacement */
+  int n_memory_pages;		/* total number of result pages also kept in memory */
+  UINT64 epoch;			/* incremented whenever cached results are cleared */
 };
 
 typedef struct qfile_list_cache_candidate QFILE_LIST_CACHE_CANDIDATE;
@@ -115,6 +117,15 @@ struct qfile_list_cache_candidate
   bool include_in_use;
 };
 
+/* entries that may be removed to free cache pages, see qfile_collect_lru_list_cache_entry () */
+typedef struct qfile_list_cache_lru_victims QFILE_LIST_CACHE_LRU_VICTIMS;
+struct qfile_list_cache_lru_victims
+{
+  QFILE_LIST_CACHE_ENTRY **entries;	/* entries neither in use nor uncommitted */
+  int n_entries;		/* number of entries collected */
+  int max_entries;		/* size of entries array */
+};
+
 /* list cache entry pooling */
 #define FIXED_SIZE_OF_POOLED_LIST_CACHE_ENTRY   4096
 #define ADDITION_FOR_POOLED_LIST_CACHE_ENTRY    offsetof(QFILE_POOLED_LIST_CACHE_ENTRY, s.entry)
@@ -153,7 +164,7 @@ struct qfile_list_cache_entry_pool
  */
 
 /* list cache and related information */
-static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, NULL, 0, 0, 0, 0, 0, 0 };
+static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, NULL, 0, 0, 0, 0, 0, 0, 0, 1 };
 
 /* information of candidates to be removed from XASL cache */
 static QFILE_LIST_CACHE_CANDIDATE qfile_List_cache_candidate = { 0, 0, 0, 0, NULL, NULL, NULL, 0, 0, false };
@@ -271,6 +282,11 @@ static int qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, voi
 static bool qfile_is_early_time (struct timeval *a, struct timeval *b);
 
 static int qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args);
+static int qfile_collect_lru_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args);
+static int qfile_compare_list_cache_entry_last_used (const void *a, const void *b);
+static int qfile_copy_list_pages_to_memory (THREAD_ENTRY * thread_p, const QFILE_LIST_ID * list_id, VPID ** vpids_p,
+					    char **pages_p);
+static PAGE_PTR qfile_get_list_cache_memory_page (const QFILE_LIST_CACHE_ENTRY * lent, const VPID * vpid);
 
 static int qfile_get_list_cache_entry_size_for_allocate (int nparam);
 #if defined(SERVER_MODE)
@@ -2091,8 +2107,10 @@ xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol
   QMGR_QUERY_ENTRY *query_entry_p = NULL;
   QFILE_LIST_ID *list_id_p;
   QMGR_TEMP_FILE *tfile_vfid_p;
+  QFILE_LIST_CACHE_ENTRY *list_cache_entry_p = NULL;
   VPID vpid, next_vpid;
   PAGE_PTR page_p;
+  bool is_memory_page;
   int one_page_size = DB_PAGESIZE;
   int tran_index;
 
@@ -2143,17 +2161,37 @@ xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol
 
       list_id_p = query_entry_p->list_id;
       tfile_vfid_p = list_id_p->tfile_vfid;
+
+      /* the result may come from (or be stored into) the list cache and be kept in memory */
+      if (query_entry_p->list_ent != NULL && query_entry_p->list_ent->n_memory_pages > 0
+	  && VFID_EQ (&query_entry_p->list_ent->list_id.temp_vfid, &list_id_p->temp_vfid))
+	{
+	  list_cache_entry_p = query_entry_p->list_ent;
+	}
     }
 
 get_page:
   /* append pages until a network page is full */
   while ((*page_size_p + DB_PAGESIZE) <= IO_MAX_PAGE_SIZE)
     {
-      page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
-      if (page_p == NULL)
+      page_p = NULL;
+      if (list_cache_entry_p != NULL)
 	{
-	  assert (er_errid () != NO_ERROR);
-	  return er_errid ();
+	  page_p = qfile_get_list_cache_memory_page (list_cache_entry_p, &vpid);
+	}
+      is_memory_page = (page_p != NULL);
+      if (is_memory_page)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_MEMORY_PAGE_READS);
+	}
+      else
+	{
+	  page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
+	  if (page_p == NULL)
+	    {
+	      assert (er_errid () != NO_ERROR);
+	      return er_errid ();
+	    }
 	}
 
       /* find next page to append */
@@ -2186,7 +2224,10 @@ get_page:
 	}
 
       memcpy ((page_buf_p + *page_size_p), page_p, one_page_size);
-      qmgr_free_old_page_and_init (thread_p, page_p, tfile_vfid_p);
+      if (!is_memory_page)
+	{
+	  qmgr_free_old_page_and_init (thread_p, page_p, tfile_vfid_p);
+	}
 
       *page_size_p += DB_PAGESIZE;
 
@@ -4851,6 +4892,7 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
     }
   qfile_List_cache.n_entries = 0;
   qfile_List_cache.n_pages = 0;
+  qfile_List_cache.n_memory_pages = 0;
   qfile_List_cache.lookup_counter = 0;
   qfile_List_cache.hit_counter = 0;
   qfile_List_cache.miss_counter = 0;
@@ -4959,6 +5001,7 @@ qfile_finalize_list_cache (THREAD_ENTRY * thread_p)
     {
       free_and_init (qfile_List_cache.ht_assigned);
     }
+  qfile_List_cache.n_hts = 0;
 
   /* list cache entry pool */
   if (qfile_List_cache_entry_pool.pool)
@@ -5020,8 +5063,10 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release)
       return ER_FAILED;
     }
 
-  if (qfile_List_cache.n_hts == 0 || qfile_List_cache.ht_assigned[list_ht_no] == false)
+  if (list_ht_no < 0 || list_ht_no >= (int) qfile_List_cache.n_hts || qfile_List_cache.ht_assigned == NULL
+      || qfile_List_cache.ht_assigned[list_ht_no] == false)
     {
+      /* e.g. XASL cache entries cleared after list cache is finalized at shutdown */
       return ER_FAILED;
     }
 
@@ -5030,6 +5075,13 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release)
       return ER_FAILED;
     }
 
+  if (list_ht_no >= (int) qfile_List_cache.n_hts || qfile_List_cache.list_hts == NULL)
+    {
+      /* finalized meanwhile */
+      csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+      return ER_FAILED;
+    }
+
   cnt = 0;
   do
     {
@@ -5054,6 +5106,13 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release)
     }
   (void) mht_clear (qfile_List_cache.list_hts[list_ht_no], NULL, NULL);
 
+  /* results being computed now may be older than the ones just cleared; do not let them into the cache */
+  (void) ATOMIC_INC_64 (&qfile_List_cache.epoch, 1);
+  if (!release)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_QC_NUM_INVALIDATE);
+    }
+
   /* release assigned memory hash table */
   if (release)
     {
@@ -5066,6 +5125,74 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release)
   return NO_ERROR;
 }
 
+/*
+ * qfile_get_list_cache_epoch () - Get the current list cache epoch
+ *   return: epoch
+ *
+ * Note: A query must read the epoch before it starts and pass it to qfile_update_list_cache_entry (). The result is
+ *       not cached if any cached result was cleared meanwhile, because it may have been computed on older data.
+ */
+UINT64
+qfile_get_list_cache_epoch (void)
+{
+  return ATOMIC_LOAD_64 (&qfile_List_cache.epoch);
+}
+
+/*
+ * qfile_increment_list_cache_epoch () - Keep the results of queries running now out of the list cache
+ *   return:
+ *
+ * Note: Called when the changes of a committing transaction become visible, whether or not the modified classes
+ *       have cached results yet.
+ */
+void
+qfile_increment_list_cache_epoch (THREAD_ENTRY * thread_p)
+{
+  if (QFILE_IS_LIST_CACHE_DISABLED)
+    {
+      return;
+    }
+
+  /* serialized with the epoch check of qfile_update_list_cache_entry () */
+  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+    {
+      (void) ATOMIC_INC_64 (&qfile_List_cache.epoch, 1);
+      return;
+    }
+  (void) ATOMIC_INC_64 (&qfile_List_cache.epoch, 1);
+  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+}
+
+/*
+ * qfile_get_list_cache_number_of_entries () - Get the number of cached results
+ *   return: number of entries
+ */
+int
+qfile_get_list_cache_number_of_entries (void)
+{
+  return qfile_List_cache.n_entries;
+}
+
+/*
+ * qfile_get_list_cache_number_of_pages () - Get the number of list file pages used by cached results
+ *   return: number of pages
+ */
+int
+qfile_get_list_cache_number_of_pages (void)
+{
+  return qfile_List_cache.n_pages;
+}
+
+/*
+ * qfile_get_list_cache_number_of_memory_pages () - Get the number of cached result pages also kept in memory
+ *   return: number of pages
+ */
+int
+qfile_get_list_cache_number_of_memory_pages (void)
+{
+  return qfile_List_cache.n_memory_pages;
+}
+
 /*
  * qfile_allocate_list_cache_entry () - Allocate the entry or get one from the pool
  *   return:
@@ -5149,6 +5276,12 @@ qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
     }
   (void) db_change_private_heap (thread_p, old_pri_heap_id);
 
+  if (lent->memory_pages != NULL)
+    {
+      free_and_init (lent->memory_vpids);
+      free_and_init (lent->memory_pages);
+    }
+
   /* if this entry is from the pool return it, else free it */
   pent = POOLED_LIST_CACHE_ENTRY_FROM_LIST_CACHE_ENTRY (lent);
   if (pent->s.next == -2)
@@ -5292,11 +5425,11 @@ qfile_dump_list_cache_internal (THREAD_ENTRY * thread_p, FILE * fp)
     }
 
   fprintf (fp,
-	   "LIST_CACHE {\n  n_hts %d\n  n_entries %d  n_pages %d\n"
+	   "LIST_CACHE {\n  n_hts %d\n  n_entries %d  n_pages %d  n_memory_pages %d\n"
 	   "  lookup_counter %d\n  hit_counter %d\n  miss_counter %d\n  full_counter %d\n}\n",
 	   qfile_List_cache.n_hts, qfile_List_cache.n_entries, qfile_List_cache.n_pages,
-	   qfile_List_cache.lookup_counter, qfile_List_cache.hit_counter, qfile_List_cache.miss_counter,
-	   qfile_List_cache.full_counter);
+	   qfile_List_cache.n_memory_pages, qfile_List_cache.lookup_counter, qfile_List_cache.hit_counter,
+	   qfile_List_cache.miss_counter, qfile_List_cache.full_counter);
 
   for (i = 0; i < qfile_List_cache.n_hts; i++)
     {
@@ -5473,6 +5606,7 @@ qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
       /* update counter */
       qfile_List_cache.n_entries--;
       qfile_List_cache.n_pages -= lent->list_id.page_cnt;
+      qfile_List_cache.n_memory_pages -= lent->n_memory_pages;
 
       /* remove the entry from the hash table */
       if (mht_rem2 (qfile_List_cache.list_hts[lent->list_ht_no], &lent->param_values, lent, NULL, NULL) != NO_ERROR)
@@ -5647,13 +5781,16 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
 	  lent->ref_count++;
 	}
     }
+  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_LOOKUP);
   if (lent)
     {
       qfile_List_cache.hit_counter++;	/* counter */
+      perfmon_inc_stat (thread_p, PSTAT_QC_NUM_HIT);
     }
   else
     {
       qfile_List_cache.miss_counter++;	/* counter */
+      perfmon_inc_stat (thread_p, PSTAT_QC_NUM_MISS);
     }
 
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
@@ -5775,6 +5912,165 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
   return NO_ERROR;
 }
 
+/*
+ * qfile_collect_lru_list_cache_entry () - Collect an entry that may be removed from the list cache
+ *                               Will be used by mht_map_no_key() function
+ *   return:
+ *   data(in)   :
+ *   args(in/out)   : QFILE_LIST_CACHE_LRU_VICTIMS collecting the entries
+ */
+static int
+qfile_collect_lru_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
+{
+  QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
+  QFILE_LIST_CACHE_LRU_VICTIMS *victims = (QFILE_LIST_CACHE_LRU_VICTIMS *) args;
+
+  if (lent->deletion_marker)
+    {
+      return NO_ERROR;
+    }
+#if defined(SERVER_MODE)
+  if (lent->last_ta_idx > 0 || lent->uncommitted_marker)
+    {
+      /* do not select one that is in use or still linked to its transaction */
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE */
+
+  if (victims->n_entries >= victims->max_entries)
+    {
+      /* more entries than counted; the others are left for the next time */
+      return ER_FAILED;
+    }
+  victims->entries[victims->n_entries++] = lent;
+
+  return NO_ERROR;
+}
+
+/*
+ * qfile_compare_list_cache_entry_last_used () - Order list cache entries from the least recently used
+ *   return: negative if a was used before b, positive if after, 0 if at the same time
+ *   a(in)      : pointer to QFILE_LIST_CACHE_ENTRY pointer
+ *   b(in)      : pointer to QFILE_LIST_CACHE_ENTRY pointer
+ */
+static int
+qfile_compare_list_cache_entry_last_used (const void *a, const void *b)
+{
+  QFILE_LIST_CACHE_ENTRY *lent_a = *(QFILE_LIST_CACHE_ENTRY * const *) a;
+  QFILE_LIST_CACHE_ENTRY *lent_b = *(QFILE_LIST_CACHE_ENTRY * const *) b;
+
+  if (qfile_is_early_time (&lent_a->time_last_used, &lent_b->time_last_used))
+    {
+      return -1;
+    }
+  if (qfile_is_early_time (&lent_b->time_last_used, &lent_a->time_last_used))
+    {
+      return 1;
+    }
+  return 0;
+}
+
+/*
+ * qfile_copy_list_pages_to_memory () - Copy the pages of a small query result to memory
+ *   return: number of pages copied, 0 if the result is not kept in memory
+ *   list_id(in)        : query result
+ *   vpids_p(out)       : identifiers of the copied pages
+ *   pages_p(out)       : copy of the pages
+ *
+ * Note: Results of at most query_cache_memory_result_pages pages are kept in memory, so that cache hits send them
+ *       to the client without fixing the list file pages.
+ */
+static int
+qfile_copy_list_pages_to_memory (THREAD_ENTRY * thread_p, const QFILE_LIST_ID * list_id, VPID ** vpids_p,
+				 char **pages_p)
+{
+  VPID vpid, next_vpid;
+  PAGE_PTR page_p;
+  int n_pages = 0;
+
+  *vpids_p = NULL;
+  *pages_p = NULL;
+
+  if (list_id->page_cnt <= 0 || list_id->page_cnt > prm_get_integer_value (PRM_ID_LIST_QUERY_CACHE_MEMORY_PAGES)
+      || VPID_ISNULL (&list_id->first_vpid))
+    {
+      return 0;
+    }
+
+  *vpids_p = (VPID *) malloc (list_id->page_cnt * sizeof (VPID));
+  *pages_p = (char *) malloc ((size_t) list_id->page_cnt * DB_PAGESIZE);
+  if (*vpids_p == NULL || *pages_p == NULL)
+    {
+      goto error;
+    }
+
+  vpid = list_id->first_vpid;
+  while (vpid.pageid != NULL_PAGEID)
+    {
+      if (n_pages >= list_id->page_cnt)
+	{
+	  assert (false);
+	  goto error;
+	}
+
+      page_p = qmgr_get_old_page (thread_p, &vpid, list_id->tfile_vfid);
+      if (page_p == NULL)
+	{
+	  /* the result is still cached, just not kept in memory */
+	  er_clear ();
+	  goto error;
+	}
+
+      /* follow the pages in the order xqfile_get_list_file_page () sends them */
+      QFILE_GET_OVERFLOW_VPID (&next_vpid, page_p);
+      if (next_vpid.pageid == NULL_PAGEID)
+	{
+	  QFILE_GET_NEXT_VPID (&next_vpid, page_p);
+	}
+
+      memcpy (*pages_p + (size_t) n_pages * DB_PAGESIZE, page_p, DB_PAGESIZE);
+      qmgr_free_old_page_and_init (thread_p, page_p, list_id->tfile_vfid);
+
+      (*vpids_p)[n_pages++] = vpid;
+      vpid = next_vpid;
+    }
+
+  return n_pages;
+
+error:
+  if (*vpids_p != NULL)
+    {
+      free_and_init (*vpids_p);
+    }
+  if (*pages_p != NULL)
+    {
+      free_and_init (*pages_p);
+    }
+  return 0;
+}
+
+/*
+ * qfile_get_list_cache_memory_page () - Get the in-memory copy of a cached result page
+ *   return: copy of the page or NULL if the page is not kept in memory
+ *   lent(in)   : list cache entry used by the query
+ *   vpid(in)   : result page identifier
+ */
+static PAGE_PTR
+qfile_get_list_cache_memory_page (const QFILE_LIST_CACHE_ENTRY * lent, const VPID * vpid)
+{
+  int i;
+
+  for (i = 0; i < lent->n_memory_pages; i++)
+    {
+      if (VPID_EQ (&lent->memory_vpids[i], vpid))
+	{
+	  return (PAGE_PTR) (lent->memory_pages + (size_t) i * DB_PAGESIZE);
+	}
+    }
+
+  return NULL;
+}
+
 /*
  * qfile_update_list_cache_entry () - Update list cache entry if exist or create new
  *                               one
@@ -5783,15 +6079,18 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
  *   params(in) :
  *   list_id(in)        :
  *   query_string(in)   :
+ *   start_epoch(in)    : list cache epoch read before the query started
  *
  * Note: Put the query result into the proper hash table with the key of
  *       the parameter values (DB_VALUE array) and the data of LIST ID.
  *       If there already exists the entry with the same key, update its data.
  *       As a side effect, the given 'list_hash_no' will be change if it was -1.
+ *       When the cache is over query_cache_size_in_pages, the least recently
+ *       used results are removed until the new one fits.
  */
 QFILE_LIST_CACHE_ENTRY *
 qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, const DB_VALUE_ARRAY * params,
-			       const QFILE_LIST_ID * list_id, const char *query_string)
+			       const QFILE_LIST_ID * list_id, const char *query_string, UINT64 start_epoch)
 {
   QFILE_LIST_CACHE_ENTRY *lent, *old, **p, **q, **r;
   MHT_TABLE *ht;
@@ -5811,6 +6110,10 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   HL_HEAPID old_pri_heap_id;
   int i, j, k;
   int alloc_size;
+  int max_pages;
+  int n_memory_pages;
+  VPID *memory_vpids;
+  char *memory_pages;
 
   if (QFILE_IS_LIST_CACHE_DISABLED)
     {
@@ -5821,19 +6124,43 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
       return NULL;
     }
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  max_pages = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES);
+  if (max_pages > 0 && list_id->page_cnt > max_pages)
     {
+      /* it would push every other result out of the cache */
       return NULL;
     }
 
+  /* copy small results before entering the critical section */
+  n_memory_pages = qfile_copy_list_pages_to_memory (thread_p, list_id, &memory_vpids, &memory_pages);
+  if (max_pages > 0 && list_id->page_cnt + n_memory_pages > max_pages)
+    {
+      free_and_init (memory_vpids);
+      free_and_init (memory_pages);
+      n_memory_pages = 0;
+    }
+
+  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+    {
+      lent = NULL;
+      goto exit;
+    }
+
+  if (ATOMIC_LOAD_64 (&qfile_List_cache.epoch) != start_epoch)
+    {
+      /* cached results were cleared while this one was computed; it may be computed on data that changed since */
+      lent = NULL;
+      goto end;
+    }
+
   /* assign an hash table if it was not set */
   if (*list_ht_no_ptr < 0)
     {
       *list_ht_no_ptr = qfile_assign_list_cache ();
       if (*list_ht_no_ptr < 0)
 	{
-	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
-	  return NULL;
+	  lent = NULL;
+	  goto end;
 	}
     }
 
@@ -5920,8 +6247,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
 
   /* check the number of list cache entries */
   if ((int) mht_count (ht) >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
-      || qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
-      || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES))
+      || qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES))
     {
 
       qfile_List_cache.full_counter++;	/* counter */
@@ -6024,10 +6350,55 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
 	{
 	  old = *r;
 	  (void) qfile_delete_list_cache_entry (thread_p, old, &tran_index);
+	  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_EVICT);
 	}
       qfile_List_cache_candidate.v_idx = 0;
     }
 
+  /* check the number of pages used by the cache; remove the least recently used results until the new one fits */
+  if (max_pages > 0
+      && qfile_List_cache.n_pages + qfile_List_cache.n_memory_pages + list_id->page_cnt + n_memory_pages > max_pages)
+    {
+      QFILE_LIST_CACHE_LRU_VICTIMS lru_victims;
+
+      qfile_List_cache.full_counter++;	/* counter */
+
+      /* collect the entries that may be removed in one pass and remove them from the least recently used one */
+      lru_victims.n_entries = 0;
+      lru_victims.max_entries = qfile_List_cache.n_entries;
+      lru_victims.entries = NULL;
+      if (lru_victims.max_entries > 0)
+	{
+	  lru_victims.entries =
+	    (QFILE_LIST_CACHE_ENTRY **) malloc (lru_victims.max_entries * sizeof (QFILE_LIST_CACHE_ENTRY *));
+	}
+      if (lru_victims.entries != NULL)
+	{
+	  for (n = 0; n < qfile_List_cache.n_hts && lru_victims.n_entries < lru_victims.max_entries; n++)
+	    {
+	      if (qfile_List_cache.ht_assigned[n])
+		{
+		  (void) mht_map_no_key (thread_p, qfile_List_cache.list_hts[n], qfile_collect_lru_list_cache_entry,
+					 &lru_victims);
+		}
+	    }
+
+	  qsort (lru_victims.entries, lru_victims.n_entries, sizeof (QFILE_LIST_CACHE_ENTRY *),
+		 qfile_compare_list_cache_entry_last_used);
+
+	  /* if all the others are in use, the new one is cached anyway */
+	  for (i = 0; i < lru_victims.n_entries
+	       && (qfile_List_cache.n_pages + qfile_List_cache.n_memory_pages + list_id->page_cnt + n_memory_pages
+		   > max_pages); i++)
+	    {
+	      (void) qfile_delete_list_cache_entry (thread_p, lru_victims.entries[i], &tran_index);
+	      perfmon_inc_stat (thread_p, PSTAT_QC_NUM_EVICT);
+	    }
+
+	  free_and_init (lru_victims.entries);
+	}
+    }
+
   /* make new QFILE_LIST_CACHE_ENTRY */
 
   /* get new entry from the QFILE_LIST_CACHE_ENTRY_POOL */
@@ -6119,13 +6490,30 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   /* append to the list of uncommitted entries in the transaction */
   qfile_add_uncommitted_list_cache_entry (tran_index, lent);
 
+  /* keep the copy of a small result; the entry owns it from now on */
+  lent->n_memory_pages = n_memory_pages;
+  lent->memory_vpids = memory_vpids;
+  lent->memory_pages = memory_pages;
+  memory_vpids = NULL;
+  memory_pages = NULL;
+
   /* update counter */
   qfile_List_cache.n_entries++;
   qfile_List_cache.n_pages += lent->list_id.page_cnt;
+  qfile_List_cache.n_memory_pages += lent->n_memory_pages;
+  perfmon_inc_stat (thread_p, PSTAT_QC_NUM_ADD);
 
 end:
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
 
+exit:
+  if (memory_pages != NULL)
+    {
+      /* not used by the cache */
+      free_and_init (memory_vpids);
+      free_and_init (memory_pages);
+    }
+
   return lent;
 }
 
@@ -96,6 +96,9 @@ struct qfile_list_cache_entry
   struct timeval time_last_used;	/* when this entry used lastly */
   int ref_count;		/* how many times this query used */
   bool deletion_marker;		/* this entry will be deleted if marker set */
+  int n_memory_pages;		/* number of result pages also kept in memory */
+  VPID *memory_vpids;		/* identifiers of the result pages kept in memory */
+  char *memory_pages;		/* copy of the result pages kept in memory; n_memory_pages * DB_PAGESIZE bytes */
 };
 
 enum
@@ -152,6 +155,11 @@ extern QFILE_LIST_ID *qfile_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 extern int qfile_initialize_list_cache (THREAD_ENTRY * thread_p);
 extern int qfile_finalize_list_cache (THREAD_ENTRY * thread_p);
 extern int qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release);
+extern UINT64 qfile_get_list_cache_epoch (void);
+extern void qfile_increment_list_cache_epoch (THREAD_ENTRY * thread_p);
+extern int qfile_get_list_cache_number_of_entries (void);
+extern int qfile_get_list_cache_number_of_pages (void);
+extern int qfile_get_list_cache_number_of_memory_pages (void);
 extern int qfile_dump_list_cache_internal (THREAD_ENTRY * thread_p, FILE * fp);
 #if defined (CUBRID_DEBUG)
 extern int qfile_dump_list_cache (THREAD_ENTRY * thread_p, const char *fname);
@@ -162,7 +170,7 @@ QFILE_LIST_CACHE_ENTRY *qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p,
 						       const DB_VALUE_ARRAY * params);
 QFILE_LIST_CACHE_ENTRY *qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr,
 						       const DB_VALUE_ARRAY * params, const QFILE_LIST_ID * list_id,
-						       const char *query_string);
+						       const char *query_string, UINT64 start_epoch);
 int qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker);
 
 /* Scan related routines */
@@ -237,6 +237,7 @@ qdump_print_list_merge_info (QFILE_LIST_MERGE_INFO * merge_info_p)
     }
 
   fprintf (foutput, "[join type:%d]", merge_info_p->join_type);
+  fprintf (foutput, "[join method:%s]", (merge_info_p->join_method == QFILE_JOIN_METHOD_HASH) ? "hash" : "merge");
   fprintf (foutput, "[single fetch:%d]\n", merge_info_p->single_fetch);
 
   qdump_print_column ("outer column position", merge_info_p->ls_column_cnt, merge_info_p->ls_outer_column);
@@ -75,12 +75,19 @@
 #include "dbtype.h"
 #include "string_regex.hpp"
 #include "thread_entry.hpp"
+#if defined (SERVER_MODE)
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+#include "parallel_query_worker_pool.hpp"
+#endif /* SERVER_MODE */
 #include "regu_var.hpp"
 #include "xasl.h"
 #include "xasl_aggregate.hpp"
 #include "xasl_analytic.hpp"
 #include "xasl_predicate.hpp"
+#include "xasl_unpack_info.hpp"
 
+#include <functional>
 #include <vector>
 
 // XASL_STATE
@@ -389,6 +396,7 @@ static QPROC_TPLDESCR_STATUS qexec_generate_tuple_descriptor (THREAD_ENTRY * thr
 static int qexec_upddel_add_unique_oid_to_ehid (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				    QFILE_TUPLE_RECORD * tplrec);
+static void qexec_resolve_buildvalue_outptr_domains (XASL_NODE * xasl);
 static void qexec_failure_line (int line, XASL_STATE * xasl_state);
 static void qexec_reset_regu_variable (REGU_VARIABLE * var);
 static void qexec_reset_regu_variable_list (REGU_VARIABLE_LIST list);
@@ -502,6 +510,9 @@ static QFILE_LIST_ID *qexec_merge_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 static QFILE_LIST_ID *qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID * inner_sid,
 					      QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred,
 					      XASL_STATE * xasl_state, int ls_flag);
+static QFILE_LIST_ID *qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+					    QFILE_LIST_ID * inner_list_idp, QFILE_LIST_MERGE_INFO * merge_infop,
+					    int ls_flag);
 static int qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
 			    bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
@@ -1273,9 +1284,6 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
     {
       if (xasl->proc.buildvalue.agg_list != NULL)
 	{
-	  AGGREGATE_TYPE *agg_node = NULL;
-	  REGU_VARIABLE_LIST out_list_val = NULL;
-
 	  if (xasl->proc.buildvalue.agg_list != NULL && !xasl->proc.buildvalue.agg_domains_resolved)
 	    {
 	      if (qexec_resolve_domains_for_aggregation (thread_p, xasl->proc.buildvalue.agg_list, xasl_state, tplrec,
@@ -1292,31 +1300,7 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	    }
 
 	  /* resolve domains for aggregates */
-	  for (out_list_val = xasl->outptr_list->valptrp; out_list_val != NULL; out_list_val = out_list_val->next)
-	    {
-	      assert (out_list_val->value.domain != NULL);
-
-	      /* aggregates corresponds to CONSTANT regu vars in outptr_list */
-	      if (out_list_val->value.type != TYPE_CONSTANT
-		  || (TP_DOMAIN_TYPE (out_list_val->value.domain) != DB_TYPE_VARIABLE
-		      && TP_DOMAIN_COLLATION_FLAG (out_list_val->value.domain) == TP_DOMAIN_COLL_NORMAL))
-		{
-		  continue;
-		}
-
-	      /* search in aggregate list by comparing DB_VALUE pointers */
-	      for (agg_node = xasl->proc.buildvalue.agg_list; agg_node != NULL; agg_node = agg_node->next)
-		{
-		  if (out_list_val->value.value.dbvalptr == agg_node->accumulator.value
-		      && TP_DOMAIN_TYPE (agg_node->domain) != DB_TYPE_NULL)
-		    {
-		      assert (agg_node->domain != NULL);
-		      assert (TP_DOMAIN_COLLATION_FLAG (agg_node->domain) == TP_DOMAIN_COLL_NORMAL);
-		      out_list_val->value.domain = agg_node->domain;
-		    }
-		}
-
-	    }
+	  qexec_resolve_buildvalue_outptr_domains (xasl);
 	}
     }
 
@@ -1327,6 +1311,45 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * qexec_resolve_buildvalue_outptr_domains () - set resolved domains of aggregates to the output list
+ *   return:
+ *   xasl(in)   : BUILDVALUE_PROC XASL node
+ */
+static void
+qexec_resolve_buildvalue_outptr_domains (XASL_NODE * xasl)
+{
+  AGGREGATE_TYPE *agg_node = NULL;
+  REGU_VARIABLE_LIST out_list_val = NULL;
+
+  assert (xasl->type == BUILDVALUE_PROC);
+
+  for (out_list_val = xasl->outptr_list->valptrp; out_list_val != NULL; out_list_val = out_list_val->next)
+    {
+      assert (out_list_val->value.domain != NULL);
+
+      /* aggregates corresponds to CONSTANT regu vars in outptr_list */
+      if (out_list_val->value.type != TYPE_CONSTANT
+	  || (TP_DOMAIN_TYPE (out_list_val->value.domain) != DB_TYPE_VARIABLE
+	      && TP_DOMAIN_COLLATION_FLAG (out_list_val->value.domain) == TP_DOMAIN_COLL_NORMAL))
+	{
+	  continue;
+	}
+
+      /* search in aggregate list by comparing DB_VALUE pointers */
+      for (agg_node = xasl->proc.buildvalue.agg_list; agg_node != NULL; agg_node = agg_node->next)
+	{
+	  if (out_list_val->value.value.dbvalptr == agg_node->accumulator.value
+	      && TP_DOMAIN_TYPE (agg_node->domain) != DB_TYPE_NULL)
+	    {
+	      assert (agg_node->domain != NULL);
+	      assert (TP_DOMAIN_COLLATION_FLAG (agg_node->domain) == TP_DOMAIN_COLL_NORMAL);
+	      out_list_val->value.domain = agg_node->domain;
+	    }
+	}
+    }
+}
+
 /*
  * Clean_up processing routines
  */
@@ -6302,221 +6325,1071 @@ exit_on_error:
 }
 
 /*
- * qexec_merge_listfiles () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     :
- *
- * Note: This function is used for a direct merge of two LIST files
- * during XASL tree interpretation.
+ * Hash join of two list files.
  *
- * Note: For a direct list file merge, currently the outer and inner columns
- * should have the same data type.
+ * The tuples of one list file (the build list) are copied into an in-memory hash table keyed on the join columns and
+ * the other list file (the probe list) is scanned once, looking up each tuple in the table. When the build list does
+ * not fit in max_hash_join_size, both lists are first split into partition list files on the hash of the join
+ * columns and each pair of partitions is joined on its own. Partitions still too big are split again; those that
+ * cannot be split, such as the tuples of a single frequent join value, are joined one memory-sized chunk at a time.
  */
-static int
-qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
-{
-  QFILE_LIST_ID *list_id = NULL;
-  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
-  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
-  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
-  XASL_NODE *outer_xasl, *inner_xasl;
-  int ls_flag = 0;
-
-  outer_xasl = xasl->proc.mergelist.outer_xasl;
-  inner_xasl = xasl->proc.mergelist.inner_xasl;
 
-  /* open the empty list file if not already open */
-
-  if (outer_xasl->list_id->type_list.type_cnt == 0)
-    {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-    }
-  if (inner_xasl->list_id->type_list.type_cnt == 0)
-    {
-      /* start main block iterations */
-      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-    }
+/* upper limit on the number of partitions of a partitioned hash join */
+#define QEXEC_HASH_JOIN_MAX_PARTITIONS 128
 
-  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the
-   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
-   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
-   * last result file. */
+/* range of the hash values computed for each join column */
+#define QEXEC_HASH_JOIN_HASH_RANGE 0x7fffffff
 
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
-    {
-      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
-    }
+/* upper limit on the number of times a partition too big for memory is partitioned again */
+#define QEXEC_HASH_JOIN_MAX_LEVELS 3
 
-  if (merge_infop->join_type == JOIN_INNER)
-    {
-      /* call list file merge routine */
-      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
-    }
-  else
-    {
-      outer_spec = xasl->proc.mergelist.outer_spec_list;
-      inner_spec = xasl->proc.mergelist.inner_spec_list;
+/* partition of a tuple; uses other bits than the hash table buckets, and other bits again at each level */
+#define QEXEC_HASH_JOIN_PARTITION(hash, level, part_cnt) \
+  ((int) ((((hash) * (0x9e3779b1U + 2 * (unsigned int) (level))) >> 16) % (unsigned int) (part_cnt)))
 
-      assert (xasl->scan_op_type == S_SELECT);
-      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
-			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
+typedef struct qexec_hash_join_entry QEXEC_HASH_JOIN_ENTRY;
+struct qexec_hash_join_entry
+{
+  unsigned int hash;		/* hash value of the join columns */
+  QFILE_TUPLE tpl;		/* copy of the build list tuple */
+  QEXEC_HASH_JOIN_ENTRY *next;	/* next build tuple having the same hash value */
+};
 
-      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
-			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
-			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
+typedef struct qexec_hash_join_info QEXEC_HASH_JOIN_INFO;
+struct qexec_hash_join_info
+{
+  QFILE_LIST_MERGE_INFO *merge_infop;	/* join columns and result tuple layout */
+  QFILE_LIST_ID *list_idp;	/* result list file */
+  QFILE_TUPLE_RECORD tplrec;	/* area to build big result tuples */
+  bool build_is_outer;		/* true if the hash table is built on the outer list */
+  bool preserve_probe;		/* true if unmatched probe tuples are joined with NULLs */
+  int nvals;			/* join columns count */
+  int *build_indp;		/* join columns of the build list */
+  int *probe_indp;		/* join columns of the probe list */
+  TP_DOMAIN **build_domp;	/* join column domains of the build list */
+  TP_DOMAIN **probe_domp;	/* join column domains of the probe list */
+  bool *build_coerce;		/* true if build values must be coerced to the probe domain before hashing */
+  char **build_valp;		/* join column values of the current build tuple */
+  char **probe_valp;		/* join column values of the current probe tuple */
+  UINT64 mem_limit;		/* memory available to the hash table */
+};
 
-      /* call outer join merge routine */
-      list_id =
-	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
-				xasl_state, ls_flag);
+/*
+ * qexec_hash_join_entry_hash () - hash function of the hash join table
+ *   return: hash value
+ *   key(in): hash join entry
+ *   ht_size(in): hash table size
+ */
+static unsigned int
+qexec_hash_join_entry_hash (const void *key, unsigned int ht_size)
+{
+  return ((const QEXEC_HASH_JOIN_ENTRY *) key)->hash % ht_size;
+}
 
-      qexec_close_scan (thread_p, outer_spec);
-      outer_spec = NULL;
+/*
+ * qexec_hash_join_entry_eq () - compare function of the hash join table
+ *   return: true if both entries have the same hash value
+ *   key1(in): hash join entry
+ *   key2(in): hash join entry
+ *
+ * Note: Entries are grouped by hash value only; the join column values are compared when probing.
+ */
+static int
+qexec_hash_join_entry_eq (const void *key1, const void *key2)
+{
+  return ((const QEXEC_HASH_JOIN_ENTRY *) key1)->hash == ((const QEXEC_HASH_JOIN_ENTRY *) key2)->hash;
+}
 
-      qexec_close_scan (thread_p, inner_spec);
-      inner_spec = NULL;
-    }
+/*
+ * qexec_hash_join_free_entries () - free a chain of hash join entries
+ *   return: NO_ERROR
+ *   key(in): unused
+ *   data(in): first entry of the chain
+ *   args(in): thread entry
+ */
+static int
+qexec_hash_join_free_entries (const void *key, void *data, void *args)
+{
+  THREAD_ENTRY *thread_p = (THREAD_ENTRY *) args;
+  QEXEC_HASH_JOIN_ENTRY *entry = (QEXEC_HASH_JOIN_ENTRY *) data, *next;
 
-  if (list_id == NULL)
+  while (entry != NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      next = entry->next;
+      db_private_free (thread_p, entry);
+      entry = next;
     }
 
-  /* make this the resultant list file */
-  qfile_copy_list_id (xasl->list_id, list_id, true);
-  QFILE_FREE_AND_INIT_LIST_ID (list_id);
-
   return NO_ERROR;
-
-exit_on_error:
-
-  if (outer_spec)
-    {
-      qexec_close_scan (thread_p, outer_spec);
-    }
-  if (inner_spec)
-    {
-      qexec_close_scan (thread_p, inner_spec);
-    }
-
-  return ER_FAILED;
 }
 
 /*
- * Interpreter routines
- */
-
-/*
- * qexec_open_scan () -
+ * qexec_hash_join_hash_tuple () - compute the hash value of the join columns of a tuple
  *   return: NO_ERROR, or ER_code
- *   curr_spec(in)      : Access Specification Node
- *   val_list(in)       : Value list pointer
- *   vd(in)     : Value descriptor
- *   force_select_lock(in)  :
- *   fixed(in)  : Fixed scan flag
- *   grouped(in)        : Grouped scan flag
- *   iscan_oid_order(in)       :
- *   s_id(out)   : Set to the scan identifier
- *   p_mvcc_select_lock_needed(out): true, whether instance lock needed at select
+ *   thread_p(in):
+ *   hj_info(in): hash join information
+ *   tpl(in): tuple of the build or the probe list
+ *   is_build(in): true if tpl belongs to the build list
+ *   hash_p(out): hash value
+ *   can_match_p(out): false if the tuple cannot match any tuple of the other list (NULL join column)
  *
- * Note: This routine is used to open a scan on an access specification
- * node. A scan identifier is created with the given parameters.
+ * Note: Build values are hashed in the domain of the probe columns, so that values which compare equal across
+ *       different domains get the same hash value.
  */
 static int
-qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
-		 bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
-		 QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
-		 bool * p_mvcc_select_lock_needed)
+qexec_hash_join_hash_tuple (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_INFO * hj_info, QFILE_TUPLE tpl, bool is_build,
+			    unsigned int *hash_p, bool * can_match_p)
 {
-  SCAN_TYPE scan_type;
-  INDX_INFO *indx_info;
-  bool mvcc_select_lock_needed = false;
-  int error_code = NO_ERROR;
+  int *indp = is_build ? hj_info->build_indp : hj_info->probe_indp;
+  TP_DOMAIN **domp = is_build ? hj_info->build_domp : hj_info->probe_domp;
+  DB_VALUE value, coerced_value, *hash_value;
+  OR_BUF buf;
+  char *valp;
+  unsigned int hash = 0;
+  int k, len;
 
-  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && !curr_spec->pruned)
+  *can_match_p = false;
+  *hash_p = 0;
+
+  for (k = 0; k < hj_info->nvals; k++)
     {
-      error_code = qexec_prune_spec (thread_p, curr_spec, vd, scan_op_type);
-      if (error_code != NO_ERROR)
+      QFILE_GET_TUPLE_VALUE_HEADER_POSITION (tpl, indp[k], valp);
+      len = QFILE_GET_TUPLE_VALUE_LENGTH (valp);
+      if (QFILE_GET_TUPLE_VALUE_FLAG (valp) == V_UNBOUND || len == 0)
 	{
-	  ASSERT_ERROR ();
-	  goto exit_on_error;
+	  /* NULL does not match anything */
+	  return NO_ERROR;
 	}
-    }
 
-  if (curr_spec->type == TARGET_CLASS && mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
-    {
-      assert (!force_select_lock);
+      db_make_null (&value);
+      db_make_null (&coerced_value);
 
-      /* We expect to update or delete a non MVCC objects via a scan are only db_serial, db_ha_apply_info and
-       * _db_collation objects. */
-      assert ((scan_op_type != S_DELETE && scan_op_type != S_UPDATE) || oid_is_serial (&ACCESS_SPEC_CLS_OID (curr_spec))
-	      || (oid_check_cached_class_oid (OID_CACHE_HA_APPLY_INFO_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec)))
-	      || (oid_check_cached_class_oid (OID_CACHE_COLLATION_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec))));
-    }
-  else
-    {
-      if (force_select_lock)
+      /* Do not copy the string--just use the pointer. */
+      or_init (&buf, valp + QFILE_TUPLE_VALUE_HEADER_SIZE, len);
+      if (domp[k]->type->data_readval (&buf, &value, domp[k], -1, pr_is_set_type (TP_DOMAIN_TYPE (domp[k])), NULL,
+				       0) != NO_ERROR)
 	{
-	  mvcc_select_lock_needed = true;
+	  ASSERT_ERROR_AND_SET (len);
+	  return len;
 	}
-      else
+      if (DB_IS_NULL (&value))
 	{
-	  mvcc_select_lock_needed = (curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE);
+	  pr_clear_value (&value);
+	  return NO_ERROR;
+	}
+
+      hash_value = &value;
+      if (is_build && hj_info->build_coerce[k])
+	{
+	  if (tp_value_coerce (&value, &coerced_value, hj_info->probe_domp[k]) != DOMAIN_COMPATIBLE)
+	    {
+	      /* the value has no representation in the probe domain, hence no equal probe value */
+	      pr_clear_value (&value);
+	      pr_clear_value (&coerced_value);
+	      return NO_ERROR;
+	    }
+	  hash_value = &coerced_value;
 	}
+
+      hash = ((hash << 5) | (hash >> 27)) ^ mht_get_hash_number (QEXEC_HASH_JOIN_HASH_RANGE, hash_value);
+
+      pr_clear_value (&value);
+      pr_clear_value (&coerced_value);
     }
 
-  switch (curr_spec->type)
+  *hash_p = hash;
+  *can_match_p = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_join_build () - load the next tuples of the build list into the hash table
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   hj_info(in): hash join information
+ *   build_sid(in): open scan of the build list
+ *   ht(in): empty hash table
+ *   is_build_end_p(out): true if all tuples of the build list are loaded
+ *
+ * Note: Tuples are loaded until their copies use up max_hash_join_size; the scan stops at the next tuple to load.
+ */
+static int
+qexec_hash_join_build (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_INFO * hj_info, QFILE_LIST_SCAN_ID * build_sid,
+		       MHT_TABLE * ht, bool * is_build_end_p)
+{
+  QFILE_TUPLE_RECORD build_tplrec = { NULL, 0 };
+  QEXEC_HASH_JOIN_ENTRY *entry, *head;
+  SCAN_CODE scan = S_SUCCESS;
+  UINT64 mem_used = 0;
+  unsigned int hash;
+  bool can_match;
+  int tpl_len, entry_size, error = NO_ERROR;
+
+  *is_build_end_p = false;
+
+  while (mem_used < hj_info->mem_limit
+	 && (scan = qfile_scan_list_next (thread_p, build_sid, &build_tplrec, PEEK)) == S_SUCCESS)
     {
-    case TARGET_CLASS:
-      if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL)
+      error = qexec_hash_join_hash_tuple (thread_p, hj_info, build_tplrec.tpl, true, &hash, &can_match);
+      if (error != NO_ERROR)
 	{
-	  /* open a sequential heap file scan */
-	  scan_type = S_HEAP_SCAN;
-	  indx_info = NULL;
+	  return error;
 	}
-      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO)
+      if (!can_match)
 	{
-	  /* open a sequential heap file scan that reads record info */
-	  scan_type = S_HEAP_SCAN_RECORD_INFO;
-	  indx_info = NULL;
+	  /* build tuples are never preserved */
+	  continue;
 	}
-      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+
+      tpl_len = QFILE_GET_TUPLE_LENGTH (build_tplrec.tpl);
+      entry_size = DB_ALIGN (sizeof (QEXEC_HASH_JOIN_ENTRY), MAX_ALIGNMENT) + tpl_len;
+      entry = (QEXEC_HASH_JOIN_ENTRY *) db_private_alloc (thread_p, entry_size);
+      if (entry == NULL)
 	{
-	  /* open a sequential heap file scan that reads page info */
-	  scan_type = S_HEAP_PAGE_SCAN;
-	  indx_info = NULL;
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
 	}
-      else if (curr_spec->access == ACCESS_METHOD_INDEX)
+
+      entry->hash = hash;
+      entry->tpl = (QFILE_TUPLE) ((char *) entry + DB_ALIGN (sizeof (QEXEC_HASH_JOIN_ENTRY), MAX_ALIGNMENT));
+      memcpy (entry->tpl, build_tplrec.tpl, tpl_len);
+      entry->next = NULL;
+
+      /* the table keeps one chain per hash value */
+      head = (QEXEC_HASH_JOIN_ENTRY *) mht_get (ht, entry);
+      if (head != NULL)
 	{
-	  /* open an indexed heap file scan */
-	  scan_type = S_INDX_SCAN;
-	  indx_info = curr_spec->indexptr;
+	  entry->next = head->next;
+	  head->next = entry;
 	}
-      else if (curr_spec->access == ACCESS_METHOD_INDEX_KEY_INFO)
+      else if (mht_put (ht, entry, entry) == NULL)
 	{
-	  scan_type = S_INDX_KEY_INFO_SCAN;
-	  indx_info = curr_spec->indexptr;
+	  db_private_free (thread_p, entry);
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
 	}
-      else if (curr_spec->access == ACCESS_METHOD_INDEX_NODE_INFO)
-	{
-	  scan_type = S_INDX_NODE_INFO_SCAN;
+      mem_used += entry_size;
+    }
+
+  if (scan == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  *is_build_end_p = (scan == S_END);
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_join_probe () - probe the hash table with the tuples of the probe list
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   hj_info(in): hash join information
+ *   probe_list_idp(in): probe list file
+ *   ht(in): hash table built on the build list; NULL if the build list is empty, or to preserve the probe tuples left
+ *	     unmatched by all chunks of the build list
+ *   probe_matched(in/out): bitmap of the probe tuples matched so far, when the build list is joined in chunks; NULL
+ *			    otherwise
+ */
+static int
+qexec_hash_join_probe (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_INFO * hj_info, QFILE_LIST_ID * probe_list_idp,
+		       MHT_TABLE * ht, unsigned char *probe_matched)
+{
+  QFILE_LIST_SCAN_ID probe_sid;
+  QFILE_TUPLE_RECORD probe_tplrec = { NULL, 0 };
+  QFILE_TUPLE_RECORD build_tplrec = { NULL, 0 };
+  QFILE_TUPLE_RECORD *outer_tplrecp, *inner_tplrecp;
+  QEXEC_HASH_JOIN_ENTRY key, *entry;
+  DB_VALUE_COMPARE_RESULT val_cmp;
+  SCAN_CODE scan;
+  UINT64 tpl_idx = 0;
+  bool can_match, matched, preserve;
+  int k, error = NO_ERROR;
+
+  probe_sid.status = S_CLOSED;
+  if (qfile_open_list_scan (probe_list_idp, &probe_sid) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  outer_tplrecp = hj_info->build_is_outer ? &build_tplrec : &probe_tplrec;
+  inner_tplrecp = hj_info->build_is_outer ? &probe_tplrec : &build_tplrec;
+
+  while ((scan = qfile_scan_list_next (thread_p, &probe_sid, &probe_tplrec, PEEK)) == S_SUCCESS)
+    {
+      matched = false;
+
+      if (ht != NULL)
+	{
+	  error = qexec_hash_join_hash_tuple (thread_p, hj_info, probe_tplrec.tpl, false, &key.hash, &can_match);
+	  if (error != NO_ERROR)
+	    {
+	      goto end;
+	    }
+
+	  entry = can_match ? (QEXEC_HASH_JOIN_ENTRY *) mht_get (ht, &key) : NULL;
+	  if (entry != NULL)
+	    {
+	      for (k = 0; k < hj_info->nvals; k++)
+		{
+		  QFILE_GET_TUPLE_VALUE_HEADER_POSITION (probe_tplrec.tpl, hj_info->probe_indp[k],
+							 hj_info->probe_valp[k]);
+		}
+	    }
+
+	  for (; entry != NULL; entry = entry->next)
+	    {
+	      for (k = 0; k < hj_info->nvals; k++)
+		{
+		  QFILE_GET_TUPLE_VALUE_HEADER_POSITION (entry->tpl, hj_info->build_indp[k], hj_info->build_valp[k]);
+		}
+
+	      if (hj_info->build_is_outer)
+		{
+		  val_cmp =
+		    qexec_cmp_tpl_vals_merge (hj_info->build_valp, hj_info->build_domp, hj_info->probe_valp,
+					      hj_info->probe_domp, hj_info->nvals);
+		}
+	      else
+		{
+		  val_cmp =
+		    qexec_cmp_tpl_vals_merge (hj_info->probe_valp, hj_info->probe_domp, hj_info->build_valp,
+					      hj_info->build_domp, hj_info->nvals);
+		}
+
+	      if (val_cmp != DB_EQ)
+		{
+		  if (val_cmp == DB_UNK && er_errid () != NO_ERROR)
+		    {
+		      error = er_errid ();
+		      goto end;
+		    }
+		  /* hash collision */
+		  continue;
+		}
+
+	      build_tplrec.tpl = entry->tpl;
+	      error =
+		qexec_merge_tuple_add_list (thread_p, hj_info->list_idp, outer_tplrecp, inner_tplrecp,
+					    hj_info->merge_infop, &hj_info->tplrec);
+	      if (error != NO_ERROR)
+		{
+		  goto end;
+		}
+	      matched = true;
+	    }
+	}
+
+      preserve = (!matched && hj_info->preserve_probe);
+      if (probe_matched != NULL)
+	{
+	  /* a probe tuple is preserved only after the last chunk of the build list, if no chunk matched it */
+	  if (matched)
+	    {
+	      probe_matched[tpl_idx / 8] |= (unsigned char) (1 << (tpl_idx % 8));
+	    }
+	  preserve = preserve && ht == NULL && (probe_matched[tpl_idx / 8] & (1 << (tpl_idx % 8))) == 0;
+	}
+      tpl_idx++;
+
+      if (preserve)
+	{
+	  /* join the probe tuple with a NULL tuple */
+	  error =
+	    qexec_merge_tuple_add_list (thread_p, hj_info->list_idp, hj_info->build_is_outer ? NULL : &probe_tplrec,
+					hj_info->build_is_outer ? &probe_tplrec : NULL, hj_info->merge_infop,
+					&hj_info->tplrec);
+	  if (error != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	}
+    }
+
+  if (scan == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+    }
+
+end:
+  qfile_close_scan (thread_p, &probe_sid);
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_lists () - join a build list and a probe list in memory
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   hj_info(in): hash join information
+ *   build_list_idp(in): build list file
+ *   probe_list_idp(in): probe list file
+ *
+ * Note: A build list that does not fit in max_hash_join_size, like a partition of many tuples having the same join
+ *       columns, is loaded in chunks and the probe list is scanned once for each chunk, as in a block nested loop join.
+ */
+static int
+qexec_hash_join_lists (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_INFO * hj_info, QFILE_LIST_ID * build_list_idp,
+		       QFILE_LIST_ID * probe_list_idp)
+{
+  QFILE_LIST_SCAN_ID build_sid;
+  MHT_TABLE *ht = NULL;
+  unsigned char *probe_matched = NULL;
+  UINT64 est_entries;
+  size_t probe_matched_size;
+  bool is_build_end = false;
+  int error = NO_ERROR;
+
+  if (probe_list_idp->tuple_cnt == 0 || (build_list_idp->tuple_cnt == 0 && !hj_info->preserve_probe))
+    {
+      return NO_ERROR;
+    }
+
+  if (build_list_idp->tuple_cnt == 0)
+    {
+      return qexec_hash_join_probe (thread_p, hj_info, probe_list_idp, NULL, NULL);
+    }
+
+  build_sid.status = S_CLOSED;
+  if (qfile_open_list_scan (build_list_idp, &build_sid) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  est_entries = MIN ((UINT64) build_list_idp->tuple_cnt, hj_info->mem_limit / sizeof (QEXEC_HASH_JOIN_ENTRY));
+  ht = mht_create ("Hash join table", (int) MAX (est_entries, 2), qexec_hash_join_entry_hash,
+		   qexec_hash_join_entry_eq);
+  if (ht == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto end;
+    }
+
+  while (!is_build_end)
+    {
+      error = qexec_hash_join_build (thread_p, hj_info, &build_sid, ht, &is_build_end);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      if (!is_build_end && probe_matched == NULL && hj_info->preserve_probe)
+	{
+	  /* more than one chunk; the probe tuples are preserved after the last one */
+	  probe_matched_size = (size_t) ((probe_list_idp->tuple_cnt + 7) / 8);
+	  probe_matched = (unsigned char *) db_private_alloc (thread_p, probe_matched_size);
+	  if (probe_matched == NULL)
+	    {
+	      ASSERT_ERROR_AND_SET (error);
+	      goto end;
+	    }
+	  memset (probe_matched, 0, probe_matched_size);
+	}
+
+      error = qexec_hash_join_probe (thread_p, hj_info, probe_list_idp, ht, probe_matched);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      (void) mht_clear (ht, qexec_hash_join_free_entries, thread_p);
+    }
+
+  if (probe_matched != NULL)
+    {
+      error = qexec_hash_join_probe (thread_p, hj_info, probe_list_idp, NULL, probe_matched);
+    }
+
+end:
+  qfile_close_scan (thread_p, &build_sid);
+  if (ht != NULL)
+    {
+      (void) mht_map (ht, qexec_hash_join_free_entries, thread_p);
+      mht_destroy (ht);
+    }
+  if (probe_matched != NULL)
+    {
+      db_private_free_and_init (thread_p, probe_matched);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_partition () - split a list file into partitions on the hash value of its join columns
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   hj_info(in): hash join information
+ *   list_idp(in): build or probe list file
+ *   is_build(in): true for the build list
+ *   level(in): partitioning level; zero for the lists being joined
+ *   part_list_idp(in): open partition list files
+ *   part_cnt(in): number of partitions
+ */
+static int
+qexec_hash_join_partition (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_INFO * hj_info, QFILE_LIST_ID * list_idp,
+			   bool is_build, int level, QFILE_LIST_ID ** part_list_idp, int part_cnt)
+{
+  QFILE_LIST_SCAN_ID sid;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE scan;
+  unsigned int hash;
+  bool can_match;
+  int error = NO_ERROR;
+
+  sid.status = S_CLOSED;
+  if (qfile_open_list_scan (list_idp, &sid) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  while ((scan = qfile_scan_list_next (thread_p, &sid, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      error = qexec_hash_join_hash_tuple (thread_p, hj_info, tplrec.tpl, is_build, &hash, &can_match);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      if (!can_match)
+	{
+	  if (is_build || !hj_info->preserve_probe)
+	    {
+	      /* the tuple does not contribute to the result */
+	      continue;
+	    }
+	  /* hash is zero; the tuple will not match anything in its partition either */
+	}
+
+      error =
+	qfile_add_tuple_to_list (thread_p, part_list_idp[QEXEC_HASH_JOIN_PARTITION (hash, level, part_cnt)],
+				 tplrec.tpl);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+  if (scan == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+    }
+
+end:
+  qfile_close_scan (thread_p, &sid);
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_split () - join a build list and a probe list, partitioning them first if the build list does not
+ *			      fit in memory
+ *   return: NO_ERROR, or ER_code
+ *   thread_p(in):
+ *   hj_info(in): hash join information
+ *   build_list_idp(in): build list file
+ *   probe_list_idp(in): probe list file
+ *   level(in): partitioning level; zero for the lists being joined
+ *
+ * Note: A build partition that is still too big is partitioned again, on other bits of the hash value, up to
+ *       QEXEC_HASH_JOIN_MAX_LEVELS times. A partition that does not split, because all its tuples have the same hash
+ *       value, is joined in chunks by qexec_hash_join_lists ().
+ */
+static int
+qexec_hash_join_split (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_INFO * hj_info, QFILE_LIST_ID * build_list_idp,
+		       QFILE_LIST_ID * probe_list_idp, int level)
+{
+  QFILE_LIST_ID **build_part_list_idp = NULL, **probe_part_list_idp = NULL;
+  UINT64 build_size;
+  int k, part_cnt, error = NO_ERROR;
+
+  build_size = (UINT64) build_list_idp->page_cnt * DB_PAGESIZE;
+  if (build_size <= hj_info->mem_limit || level >= QEXEC_HASH_JOIN_MAX_LEVELS || probe_list_idp->tuple_cnt == 0)
+    {
+      return qexec_hash_join_lists (thread_p, hj_info, build_list_idp, probe_list_idp);
+    }
+
+  /* the build list does not fit in memory; partition both lists so that each build partition does */
+  part_cnt = (int) MIN (QEXEC_HASH_JOIN_MAX_PARTITIONS, 2 * (build_size / hj_info->mem_limit + 1));
+
+  build_part_list_idp = (QFILE_LIST_ID **) db_private_alloc (thread_p, part_cnt * sizeof (QFILE_LIST_ID *));
+  probe_part_list_idp = (QFILE_LIST_ID **) db_private_alloc (thread_p, part_cnt * sizeof (QFILE_LIST_ID *));
+  if (build_part_list_idp == NULL || probe_part_list_idp == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      part_cnt = 0;		/* no partition is open */
+      goto end;
+    }
+  memset (build_part_list_idp, 0, part_cnt * sizeof (QFILE_LIST_ID *));
+  memset (probe_part_list_idp, 0, part_cnt * sizeof (QFILE_LIST_ID *));
+
+  for (k = 0; k < part_cnt; k++)
+    {
+      build_part_list_idp[k] =
+	qfile_open_list (thread_p, &build_list_idp->type_list, NULL, build_list_idp->query_id, 0);
+      probe_part_list_idp[k] =
+	qfile_open_list (thread_p, &probe_list_idp->type_list, NULL, probe_list_idp->query_id, 0);
+      if (build_part_list_idp[k] == NULL || probe_part_list_idp[k] == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto end;
+	}
+    }
+
+  error = qexec_hash_join_partition (thread_p, hj_info, build_list_idp, true, level, build_part_list_idp, part_cnt);
+  if (error == NO_ERROR)
+    {
+      error =
+	qexec_hash_join_partition (thread_p, hj_info, probe_list_idp, false, level, probe_part_list_idp, part_cnt);
+    }
+  if (error != NO_ERROR)
+    {
+      goto end;
+    }
+
+  for (k = 0; k < part_cnt; k++)
+    {
+      qfile_close_list (thread_p, build_part_list_idp[k]);
+      qfile_close_list (thread_p, probe_part_list_idp[k]);
+
+      if (build_part_list_idp[k]->tuple_cnt == build_list_idp->tuple_cnt)
+	{
+	  /* partitioning did not split the build tuples; they most likely all have the same join columns */
+	  error = qexec_hash_join_lists (thread_p, hj_info, build_part_list_idp[k], probe_part_list_idp[k]);
+	}
+      else
+	{
+	  error = qexec_hash_join_split (thread_p, hj_info, build_part_list_idp[k], probe_part_list_idp[k], level + 1);
+	}
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      /* partitions are no longer necessary */
+      qfile_destroy_list (thread_p, build_part_list_idp[k]);
+      QFILE_FREE_AND_INIT_LIST_ID (build_part_list_idp[k]);
+      qfile_destroy_list (thread_p, probe_part_list_idp[k]);
+      QFILE_FREE_AND_INIT_LIST_ID (probe_part_list_idp[k]);
+    }
+
+end:
+  for (k = 0; k < part_cnt; k++)
+    {
+      if (build_part_list_idp != NULL && build_part_list_idp[k] != NULL)
+	{
+	  qfile_close_list (thread_p, build_part_list_idp[k]);
+	  qfile_destroy_list (thread_p, build_part_list_idp[k]);
+	  QFILE_FREE_AND_INIT_LIST_ID (build_part_list_idp[k]);
+	}
+      if (probe_part_list_idp != NULL && probe_part_list_idp[k] != NULL)
+	{
+	  qfile_close_list (thread_p, probe_part_list_idp[k]);
+	  qfile_destroy_list (thread_p, probe_part_list_idp[k]);
+	  QFILE_FREE_AND_INIT_LIST_ID (probe_part_list_idp[k]);
+	}
+    }
+  if (build_part_list_idp != NULL)
+    {
+      db_private_free_and_init (thread_p, build_part_list_idp);
+    }
+  if (probe_part_list_idp != NULL)
+    {
+      db_private_free_and_init (thread_p, probe_part_list_idp);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_list () - hash join two list files
+ *   return: QFILE_LIST_ID *, or NULL
+ *   outer_list_idp(in) : First (left) list file to be joined
+ *   inner_list_idp(in) : Second (right) list file to be joined
+ *   merge_infop(in)    : List file merge information
+ *   ls_flag(in)        :
+ *
+ * Note: Inner joins build the hash table on the smaller list, left (right) outer joins on the inner (outer) list,
+ *       whose tuples need not be preserved. Unlike qexec_merge_list (), none of the list files has to be sorted.
+ */
+static QFILE_LIST_ID *
+qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+		      QFILE_LIST_MERGE_INFO * merge_infop, int ls_flag)
+{
+  QEXEC_HASH_JOIN_INFO hj_info;
+  QFILE_LIST_ID *list_idp = NULL;
+  QFILE_LIST_ID *build_list_idp, *probe_list_idp;
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  int k, nvals;
+
+  memset (&hj_info, 0, sizeof (hj_info));
+  hj_info.merge_infop = merge_infop;
+  nvals = hj_info.nvals = merge_infop->ls_column_cnt;
+  hj_info.mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_JOIN_SIZE);
+
+  switch (merge_infop->join_type)
+    {
+    case JOIN_INNER:
+      hj_info.build_is_outer = (outer_list_idp->page_cnt < inner_list_idp->page_cnt);
+      hj_info.preserve_probe = false;
+      break;
+    case JOIN_LEFT:
+      hj_info.build_is_outer = false;
+      hj_info.preserve_probe = true;
+      break;
+    case JOIN_RIGHT:
+      hj_info.build_is_outer = true;
+      hj_info.preserve_probe = true;
+      break;
+    default:
+      assert (false);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      return NULL;
+    }
+
+  build_list_idp = hj_info.build_is_outer ? outer_list_idp : inner_list_idp;
+  probe_list_idp = hj_info.build_is_outer ? inner_list_idp : outer_list_idp;
+
+  /* form the typelist for the resultant list file */
+  type_list.type_cnt = merge_infop->ls_pos_cnt;
+  type_list.domp = (TP_DOMAIN **) malloc (type_list.type_cnt * sizeof (TP_DOMAIN *));
+  if (type_list.domp == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, type_list.type_cnt * sizeof (TP_DOMAIN *));
+      goto exit_on_error;
+    }
+
+  for (k = 0; k < type_list.type_cnt; k++)
+    {
+      type_list.domp[k] = ((merge_infop->ls_outer_inner_list[k] == QFILE_OUTER_LIST)
+			   ? outer_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]
+			   : inner_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]);
+    }
+
+  /* open the result list file; same query id with outer(inner) list file */
+  list_idp = qfile_open_list (thread_p, &type_list, NULL, outer_list_idp->query_id, ls_flag);
+  if (list_idp == NULL)
+    {
+      goto exit_on_error;
+    }
+  hj_info.list_idp = list_idp;
+
+  if (probe_list_idp->tuple_cnt == 0 || (build_list_idp->tuple_cnt == 0 && !hj_info.preserve_probe))
+    {
+      goto exit_on_end;
+    }
+
+  /* allocate the area to store the merged tuple */
+  if (qfile_reallocate_tuple (&hj_info.tplrec, DB_PAGESIZE) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  hj_info.build_indp = hj_info.build_is_outer ? merge_infop->ls_outer_column : merge_infop->ls_inner_column;
+  hj_info.probe_indp = hj_info.build_is_outer ? merge_infop->ls_inner_column : merge_infop->ls_outer_column;
+
+  hj_info.build_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  hj_info.probe_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  hj_info.build_coerce = (bool *) db_private_alloc (thread_p, nvals * sizeof (bool));
+  hj_info.build_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  hj_info.probe_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  if (hj_info.build_domp == NULL || hj_info.probe_domp == NULL || hj_info.build_coerce == NULL
+      || hj_info.build_valp == NULL || hj_info.probe_valp == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  for (k = 0; k < nvals; k++)
+    {
+      hj_info.build_domp[k] = build_list_idp->type_list.domp[hj_info.build_indp[k]];
+      hj_info.probe_domp[k] = probe_list_idp->type_list.domp[hj_info.probe_indp[k]];
+      hj_info.build_coerce[k] = (hj_info.build_domp[k] != hj_info.probe_domp[k]
+				 && !tp_domain_match (hj_info.build_domp[k], hj_info.probe_domp[k], TP_EXACT_MATCH));
+    }
+
+  if (qexec_hash_join_split (thread_p, &hj_info, build_list_idp, probe_list_idp, 0) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+exit_on_end:
+  if (type_list.domp != NULL)
+    {
+      free_and_init (type_list.domp);
+    }
+
+  if (hj_info.tplrec.tpl != NULL)
+    {
+      db_private_free_and_init (thread_p, hj_info.tplrec.tpl);
+    }
+  if (hj_info.build_domp != NULL)
+    {
+      db_private_free_and_init (thread_p, hj_info.build_domp);
+    }
+  if (hj_info.probe_domp != NULL)
+    {
+      db_private_free_and_init (thread_p, hj_info.probe_domp);
+    }
+  if (hj_info.build_coerce != NULL)
+    {
+      db_private_free_and_init (thread_p, hj_info.build_coerce);
+    }
+  if (hj_info.build_valp != NULL)
+    {
+      db_private_free_and_init (thread_p, hj_info.build_valp);
+    }
+  if (hj_info.probe_valp != NULL)
+    {
+      db_private_free_and_init (thread_p, hj_info.probe_valp);
+    }
+
+  if (list_idp != NULL)
+    {
+      qfile_close_list (thread_p, list_idp);
+    }
+
+  return list_idp;
+
+exit_on_error:
+  if (list_idp != NULL)
+    {
+      qfile_close_list (thread_p, list_idp);
+      QFILE_FREE_AND_INIT_LIST_ID (list_idp);
+    }
+
+  list_idp = NULL;
+  goto exit_on_end;
+}
+
+/*
+ * qexec_merge_listfiles () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     :
+ *
+ * Note: This function is used for a direct merge of two LIST files
+ * during XASL tree interpretation.
+ *
+ * Note: For a direct list file merge, currently the outer and inner columns
+ * should have the same data type.
+ */
+static int
+qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+{
+  QFILE_LIST_ID *list_id = NULL;
+  ACCESS_SPEC_TYPE *outer_spec = NULL;	/* left */
+  ACCESS_SPEC_TYPE *inner_spec = NULL;	/* right */
+  QFILE_LIST_MERGE_INFO *merge_infop = &(xasl->proc.mergelist.ls_merge);
+  XASL_NODE *outer_xasl, *inner_xasl;
+  int ls_flag = 0;
+
+  outer_xasl = xasl->proc.mergelist.outer_xasl;
+  inner_xasl = xasl->proc.mergelist.inner_xasl;
+
+  /* open the empty list file if not already open */
+
+  if (outer_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, outer_xasl, xasl_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  if (inner_xasl->list_id->type_list.type_cnt == 0)
+    {
+      /* start main block iterations */
+      if (qexec_start_mainblock_iterations (thread_p, inner_xasl, xasl_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+  /* If MERGELIST_PROC does not have 'order by' (xasl->orderby_list), then the list file to be open at here will be the
+   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
+   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
+   * last result file. */
+
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+    {
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+    }
+
+  if (merge_infop->join_method == QFILE_JOIN_METHOD_HASH)
+    {
+      /* the optimizer chooses hash outer joins only when all during join terms are equi-join terms, which are
+       * already checked while probing; xasl->after_join_pred need not be evaluated */
+      /* call list file hash join routine */
+      list_id = qexec_hash_join_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else if (merge_infop->join_type == JOIN_INNER)
+    {
+      /* call list file merge routine */
+      list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else
+    {
+      outer_spec = xasl->proc.mergelist.outer_spec_list;
+      inner_spec = xasl->proc.mergelist.inner_spec_list;
+
+      assert (xasl->scan_op_type == S_SELECT);
+      if (qexec_open_scan (thread_p, outer_spec, xasl->proc.mergelist.outer_val_list, &xasl_state->vd, false,
+			   outer_spec->fixed_scan, outer_spec->grouped_scan, true, &outer_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      if (qexec_open_scan (thread_p, inner_spec, xasl->proc.mergelist.inner_val_list, &xasl_state->vd, false,
+			   inner_spec->fixed_scan, inner_spec->grouped_scan, true, &inner_spec->s_id,
+			   xasl_state->query_id, S_SELECT, false, NULL) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      /* call outer join merge routine */
+      list_id =
+	qexec_merge_list_outer (thread_p, &outer_spec->s_id, &inner_spec->s_id, merge_infop, xasl->after_join_pred,
+				xasl_state, ls_flag);
+
+      qexec_close_scan (thread_p, outer_spec);
+      outer_spec = NULL;
+
+      qexec_close_scan (thread_p, inner_spec);
+      inner_spec = NULL;
+    }
+
+  if (list_id == NULL)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* make this the resultant list file */
+  qfile_copy_list_id (xasl->list_id, list_id, true);
+  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (outer_spec)
+    {
+      qexec_close_scan (thread_p, outer_spec);
+    }
+  if (inner_spec)
+    {
+      qexec_close_scan (thread_p, inner_spec);
+    }
+
+  return ER_FAILED;
+}
+
+/*
+ * Interpreter routines
+ */
+
+/*
+ * qexec_open_scan () -
+ *   return: NO_ERROR, or ER_code
+ *   curr_spec(in)      : Access Specification Node
+ *   val_list(in)       : Value list pointer
+ *   vd(in)     : Value descriptor
+ *   force_select_lock(in)  :
+ *   fixed(in)  : Fixed scan flag
+ *   grouped(in)        : Grouped scan flag
+ *   iscan_oid_order(in)       :
+ *   s_id(out)   : Set to the scan identifier
+ *   p_mvcc_select_lock_needed(out): true, whether instance lock needed at select
+ *
+ * Note: This routine is used to open a scan on an access specification
+ * node. A scan identifier is created with the given parameters.
+ */
+static int
+qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
+		 bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
+		 QUERY_ID query_id, SCAN_OPERATION_TYPE scan_op_type, bool scan_immediately_stop,
+		 bool * p_mvcc_select_lock_needed)
+{
+  SCAN_TYPE scan_type;
+  INDX_INFO *indx_info;
+  bool mvcc_select_lock_needed = false;
+  int error_code = NO_ERROR;
+
+  if (curr_spec->pruning_type == DB_PARTITIONED_CLASS && !curr_spec->pruned)
+    {
+      error_code = qexec_prune_spec (thread_p, curr_spec, vd, scan_op_type);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit_on_error;
+	}
+    }
+
+  if (curr_spec->type == TARGET_CLASS && mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (curr_spec)))
+    {
+      assert (!force_select_lock);
+
+      /* We expect to update or delete a non MVCC objects via a scan are only db_serial, db_ha_apply_info and
+       * _db_collation objects. */
+      assert ((scan_op_type != S_DELETE && scan_op_type != S_UPDATE) || oid_is_serial (&ACCESS_SPEC_CLS_OID (curr_spec))
+	      || (oid_check_cached_class_oid (OID_CACHE_HA_APPLY_INFO_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec)))
+	      || (oid_check_cached_class_oid (OID_CACHE_COLLATION_CLASS_ID, &ACCESS_SPEC_CLS_OID (curr_spec))));
+    }
+  else
+    {
+      if (force_select_lock)
+	{
+	  mvcc_select_lock_needed = true;
+	}
+      else
+	{
+	  mvcc_select_lock_needed = (curr_spec->flags & ACCESS_SPEC_FLAG_FOR_UPDATE);
+	}
+    }
+
+  switch (curr_spec->type)
+    {
+    case TARGET_CLASS:
+      if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL)
+	{
+	  /* open a sequential heap file scan */
+	  scan_type = S_HEAP_SCAN;
+	  indx_info = NULL;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_RECORD_INFO)
+	{
+	  /* open a sequential heap file scan that reads record info */
+	  scan_type = S_HEAP_SCAN_RECORD_INFO;
+	  indx_info = NULL;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_SEQUENTIAL_PAGE_SCAN)
+	{
+	  /* open a sequential heap file scan that reads page info */
+	  scan_type = S_HEAP_PAGE_SCAN;
+	  indx_info = NULL;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_INDEX)
+	{
+	  /* open an indexed heap file scan */
+	  scan_type = S_INDX_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_INDEX_KEY_INFO)
+	{
+	  scan_type = S_INDX_KEY_INFO_SCAN;
+	  indx_info = curr_spec->indexptr;
+	}
+      else if (curr_spec->access == ACCESS_METHOD_INDEX_NODE_INFO)
+	{
+	  scan_type = S_INDX_NODE_INFO_SCAN;
 	  indx_info = curr_spec->indexptr;
 	}
       else
@@ -10880,6 +11753,7 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
   HEAP_SCANCACHE scan_cache;
   bool scan_cache_inited = false;
   int scan_cache_op_type = 0;
+  bool use_insert_batch = false;
   int force_count = 0;
   int num_default_expr = 0;
   LC_COPYAREA_OPERATION operation = LC_FLUSH_INSERT;
@@ -11247,6 +12121,11 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
       scan_cache_op_type = SINGLE_ROW_INSERT;
     }
 
+  /* Keys of plain indexes are inserted sorted at the end of a multi-row insert, unless the statement looks up its own
+   * rows in indexes (replace, on duplicate key update) or routes them to partitions. */
+  use_insert_batch = (scan_cache_op_type == MULTI_ROW_INSERT && pcontext == NULL && !insert->do_replace
+		      && odku_assignments == NULL && xasl->dptr_list == NULL && btree_insert_batch::is_enabled ());
+
   if (specp)
     {
       /* we are inserting multiple values ... ie. insert into foo select ... */
@@ -11263,6 +12142,10 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	  GOTO_EXIT_ON_ERROR;
 	}
       scan_cache_inited = true;
+      if (use_insert_batch)
+	{
+	  scan_cache.m_insert_batch = new btree_insert_batch ();
+	}
 
       assert (xasl->scan_op_type == S_SELECT);
 
@@ -11441,6 +12324,10 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	  GOTO_EXIT_ON_ERROR;
 	}
       scan_cache_inited = true;
+      if (use_insert_batch)
+	{
+	  scan_cache.m_insert_batch = new btree_insert_batch ();
+	}
 
       if (XASL_IS_FLAGED (xasl, XASL_LINK_TO_REGU_VARIABLE) && scan_cache.file_type == FILE_HEAP_REUSE_SLOTS)
 	{
@@ -11596,6 +12483,15 @@ qexec_execute_insert (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xa
 	}
     }
 
+  if (scan_cache_inited && scan_cache.m_insert_batch != NULL)
+    {
+      error = scan_cache.m_insert_batch->flush (thread_p);
+      if (error != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
   /* check uniques */
   /* In this case, consider only single class. Therefore, uniqueness checking is performed based on the local
    * statistical information kept in scan_cache. And then, it is reflected into the transaction's statistical
@@ -13088,10 +13984,327 @@ qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, xasl_node * xasl, xas
     case MERGELIST_PROC:
     case UNION_PROC:
     case DIFFERENCE_PROC:
-    case INTERSECTION_PROC:	/* start SET block iterations */
+    case INTERSECTION_PROC:	/* start SET block iterations */
+      break;
+
+    case CTE_PROC:
+      break;
+
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      GOTO_EXIT_ON_ERROR;
+    }				/* switch */
+
+  /* initialize inst_num() value, instnum_flag */
+  if (xasl->instnum_val && qexec_init_instnum_val (xasl, thread_p, xasl_state) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  /* initialize orderby_num() value */
+  if (xasl->ordbynum_val)
+    {
+      db_make_bigint (xasl->ordbynum_val, 0);
+    }
+
+  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+    {
+      /* initialize level_val value */
+      if (xasl->level_val)
+	{
+	  db_make_int (xasl->level_val, 0);
+	}
+      /* initialize isleaf_val value */
+      if (xasl->isleaf_val)
+	{
+	  db_make_int (xasl->isleaf_val, 0);
+	}
+      /* initialize iscycle_val value */
+      if (xasl->iscycle_val)
+	{
+	  db_make_int (xasl->iscycle_val, 0);
+	}
+    }
+
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (xasl->type == BUILDLIST_PROC)
+    {
+      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+	{
+	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	}
+    }
+  return ER_FAILED;
+}
+
+/*
+ * qexec_end_buildvalueblock_iterations () -
+ *   return: NO_ERROR or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *
+ * Note: This routines performs the finish-up operations for BUILDVALUE
+ * block iteration.
+ */
+static int
+qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				      QFILE_TUPLE_RECORD * tplrec)
+{
+  QFILE_LIST_ID *t_list_id = NULL;
+  int status = NO_ERROR;
+  int ls_flag = 0;
+  QPROC_TPLDESCR_STATUS tpldescr_status;
+  DB_LOGICAL ev_res = V_UNKNOWN;
+  QFILE_LIST_ID *output = NULL;
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+
+  /* make final pass on aggregate list nodes */
+  if (buildvalue->agg_list && qdata_finalize_aggregate_list (thread_p, buildvalue->agg_list, false) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* evaluate having predicate */
+  if (buildvalue->having_pred != NULL)
+    {
+      ev_res = eval_pred (thread_p, buildvalue->having_pred, &xasl_state->vd, NULL);
+      if (ev_res == V_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      else if (ev_res != V_TRUE
+	       && qdata_set_valptr_list_unbound (thread_p, xasl->outptr_list, &xasl_state->vd) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+
+  /* a list of one tuple with a single value needs to be produced */
+  if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  /* If BUILDVALUE_PROC does not have 'order by'(xasl->orderby_list), then the list file to be open at here will be the
+   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
+   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
+   * last result file. */
+  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+    {
+      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+    }
+  t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
+  if (t_list_id == NULL)
+    {
+      if (type_list.domp)
+	{
+	  db_private_free_and_init (thread_p, type_list.domp);
+	}
+      GOTO_EXIT_ON_ERROR;
+    }
+
+      /***** WHAT IN THE WORLD IS THIS? *****/
+  if (type_list.domp)
+    {
+      db_private_free_and_init (thread_p, type_list.domp);
+    }
+
+  if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+    {
+      GOTO_EXIT_ON_ERROR;
+    }
+
+  output = xasl->list_id;
+  QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+
+  if (buildvalue->having_pred == NULL || ev_res == V_TRUE)
+    {
+      tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
+      if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+
+      switch (tpldescr_status)
+	{
+	case QPROC_TPLDESCR_SUCCESS:
+	  /* build tuple into the list file page */
+	  if (qfile_generate_tuple_into_list (thread_p, xasl->list_id, T_NORMAL) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  break;
+
+	case QPROC_TPLDESCR_RETRY_SET_TYPE:
+	case QPROC_TPLDESCR_RETRY_BIG_REC:
+	  if (tplrec->tpl == NULL)
+	    {
+	      /* allocate tuple descriptor */
+	      tplrec->size = DB_PAGESIZE;
+	      tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
+	      if (tplrec->tpl == NULL)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	  if (qdata_copy_valptr_list_to_tuple (thread_p, xasl->outptr_list, &xasl_state->vd, tplrec) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  if (qfile_add_tuple_to_list (thread_p, xasl->list_id, tplrec->tpl) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	  break;
+
+	default:
+	  break;
+	}
+    }
+
+end:
+
+  QEXEC_CLEAR_AGG_LIST_VALUE (buildvalue->agg_list);
+  if (t_list_id)
+    {
+      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+    }
+  if (output)
+    {
+      qfile_close_list (thread_p, output);
+    }
+
+  return status;
+
+exit_on_error:
+
+  status = ER_FAILED;
+  goto end;
+}
+
+/*
+ * qexec_end_mainblock_iterations () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL tree state information
+ *   tplrec(out) : Tuple record descriptor to store result tuples
+ *
+ * Note: This routines performs the finish-up operations for a main
+ * procedure block iteration. The main procedure block nodes can
+ * be of type BUILDLIST_PROC, BUILDVALUE, UNION_PROC,
+ * DIFFERENCE_PROC and INTERSECTION_PROC.
+ */
+static int
+qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
+				QFILE_TUPLE_RECORD * tplrec)
+{
+  QFILE_LIST_ID *t_list_id = NULL;
+  int status = NO_ERROR;
+  bool distinct_needed;
+  int ls_flag = 0;
+
+  distinct_needed = (xasl->option == Q_DISTINCT) ? true : false;
+
+#if defined (ENABLE_COMPOSITE_LOCK)
+  /* Acquire the lockset if composite locking is enabled. */
+  if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
+      && (!XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG)))
+    {
+      if (lock_finalize_composite_lock (thread_p, &xasl->composite_lock) != LK_GRANTED)
+	{
+	  return ER_FAILED;
+	}
+    }
+#endif /* defined (ENABLE_COMPOSITE_LOCK) */
+
+  switch (xasl->type)
+    {
+
+    case BUILDLIST_PROC:	/* end BUILDLIST_PROC iterations */
+      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
+      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
+	{
+	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
+	}
+      /* fall through */
+    case CONNECTBY_PROC:
+    case BUILD_SCHEMA_PROC:
+      /* close the list file */
+      qfile_close_list (thread_p, xasl->list_id);
+      break;
+
+    case MERGELIST_PROC:
+      /* do a direct list file merge to generate resultant list file */
+      if (qexec_merge_listfiles (thread_p, xasl, xasl_state) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      break;
+
+    case BUILDVALUE_PROC:	/* end BUILDVALUE_PROC iterations */
+      status = qexec_end_buildvalueblock_iterations (thread_p, xasl, xasl_state, tplrec);
+      break;
+
+    case UNION_PROC:
+    case DIFFERENCE_PROC:
+    case INTERSECTION_PROC:
+      if (xasl->type == UNION_PROC)
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_UNION);
+	}
+      else if (xasl->type == DIFFERENCE_PROC)
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DIFFERENCE);
+	}
+      else
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_INTERSECT);
+	}
+
+      if (distinct_needed)
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DISTINCT);
+	}
+      else
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	}
+
+      /* For UNION_PROC, DIFFERENCE_PROC, and INTERSECTION_PROC, if they do not have 'order by'(xasl->orderby_list),
+       * then the list file to be open at here will be the last one. Otherwise, the last list file will be open at
+       * qexec_groupby() or qexec_orderby_distinct(). (Note that only one that can have 'group by' is BUILDLIST_PROC
+       * type.) And, the top most XASL is the other condition for the list file to be the last result file. */
+
+      if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
+	  && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)))
+	{
+	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+	}
+
+      t_list_id =
+	qfile_combine_two_list (thread_p, xasl->proc.union_.left->list_id, xasl->proc.union_.right->list_id, ls_flag);
+      distinct_needed = false;
+      if (!t_list_id)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
       break;
 
     case CTE_PROC:
+      /* close the list file */
+      qfile_close_list (thread_p, xasl->list_id);
       break;
 
     default:
@@ -13099,516 +14312,781 @@ qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, xasl_node * xasl, xas
       GOTO_EXIT_ON_ERROR;
     }				/* switch */
 
-  /* initialize inst_num() value, instnum_flag */
-  if (xasl->instnum_val && qexec_init_instnum_val (xasl, thread_p, xasl_state) != NO_ERROR)
-    {
-      goto exit_on_error;
-    }
+  /* DISTINCT processing (i.e, duplicates elimination) is performed at qexec_orderby_distinct() after GROUP BY
+   * processing */
 
-  /* initialize orderby_num() value */
-  if (xasl->ordbynum_val)
+success:
+  if (t_list_id)
     {
-      db_make_bigint (xasl->ordbynum_val, 0);
+      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
     }
+  return status;
 
-  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+exit_on_error:
+  status = ER_FAILED;
+  goto success;
+
+}
+
+/*
+ * qexec_clear_mainblock_iterations () -
+ *   return:
+ *   xasl(in)   : XASL Tree pointer
+ */
+static void
+qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  AGGREGATE_TYPE *agg_p;
+
+  switch (xasl->type)
     {
-      /* initialize level_val value */
-      if (xasl->level_val)
-	{
-	  db_make_int (xasl->level_val, 0);
-	}
-      /* initialize isleaf_val value */
-      if (xasl->isleaf_val)
+    case BUILDLIST_PROC:
+      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
+      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
 	{
-	  db_make_int (xasl->isleaf_val, 0);
+	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
 	}
-      /* initialize iscycle_val value */
-      if (xasl->iscycle_val)
+      /* fall through */
+    case CONNECTBY_PROC:
+      qfile_close_list (thread_p, xasl->list_id);
+      break;
+
+    case BUILDVALUE_PROC:
+      for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
 	{
-	  db_make_int (xasl->iscycle_val, 0);
+	  qfile_close_list (thread_p, agg_p->list_id);
+	  qfile_destroy_list (thread_p, agg_p->list_id);
 	}
+      break;
+
+    case UNION_PROC:
+    case DIFFERENCE_PROC:
+    case INTERSECTION_PROC:
+    case OBJFETCH_PROC:
+    case SCAN_PROC:
+    case MERGELIST_PROC:
+    case UPDATE_PROC:
+    case DELETE_PROC:
+    case INSERT_PROC:
+    case DO_PROC:
+    case MERGE_PROC:
+    case BUILD_SCHEMA_PROC:
+    case CTE_PROC:
+      break;
+
+    default:
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
+      break;
     }
 
-  return NO_ERROR;
+  return;
+}
 
-exit_on_error:
+/*
+ * qexec_execute_mainblock () -
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : XASL Tree pointer
+ *   xasl_state(in)     : XASL state information
+ *   p_class_instance_lock_info(in/out): class instance lock info
+ *
+ */
+int
+qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate,
+			 UPDDEL_CLASS_INSTANCE_LOCK_INFO * p_class_instance_lock_info)
+{
+  int error = NO_ERROR;
+  bool on_trace;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+  UINT64 old_fetches = 0, old_ioreads = 0;
 
-  if (xasl->type == BUILDLIST_PROC)
+  if (thread_get_recursion_depth (thread_p) > prm_get_integer_value (PRM_ID_MAX_RECURSION_SQL_DEPTH))
     {
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
-	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
-	}
+      error = ER_MAX_RECURSION_SQL_DEPTH;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, prm_get_integer_value (PRM_ID_MAX_RECURSION_SQL_DEPTH));
+      return error;
     }
-  return ER_FAILED;
+  thread_inc_recursion_depth (thread_p);
+
+  on_trace = thread_is_on_trace (thread_p);
+  if (on_trace)
+    {
+      tsc_getticks (&start_tick);
+
+      old_fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
+      old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
+    }
+
+  error = qexec_execute_mainblock_internal (thread_p, xasl, xstate, p_class_instance_lock_info);
+
+  if (on_trace)
+    {
+      tsc_getticks (&end_tick);
+      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+      TSC_ADD_TIMEVAL (xasl->xasl_stats.elapsed_time, tv_diff);
+
+      xasl->xasl_stats.fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
+      xasl->xasl_stats.ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
+    }
+
+  thread_dec_recursion_depth (thread_p);
+
+  return error;
 }
 
 /*
- * qexec_end_buildvalueblock_iterations () -
- *   return: NO_ERROR or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
+ * qexec_check_limit_clause () - checks validity of limit clause
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): XASL Tree pointer
+ *   xasl_state(in): XASL state information
+ *   empty_result(out): true if no result will be generated
  *
- * Note: This routines performs the finish-up operations for BUILDVALUE
- * block iteration.
  */
 static int
-qexec_end_buildvalueblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-				      QFILE_TUPLE_RECORD * tplrec)
+qexec_check_limit_clause (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool * empty_result)
 {
-  QFILE_LIST_ID *t_list_id = NULL;
-  int status = NO_ERROR;
-  int ls_flag = 0;
-  QPROC_TPLDESCR_STATUS tpldescr_status;
-  DB_LOGICAL ev_res = V_UNKNOWN;
-  QFILE_LIST_ID *output = NULL;
-  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
-  BUILDVALUE_PROC_NODE *buildvalue = &xasl->proc.buildvalue;
+  DB_VALUE *limit_valp;
+  DB_VALUE zero_val;
+  DB_VALUE_COMPARE_RESULT cmp_with_zero;
 
-  /* make final pass on aggregate list nodes */
-  if (buildvalue->agg_list && qdata_finalize_aggregate_list (thread_p, buildvalue->agg_list, false) != NO_ERROR)
+  /* init output */
+  *empty_result = false;
+
+  db_make_int (&zero_val, 0);
+
+  if (xasl->limit_offset != NULL)
     {
-      GOTO_EXIT_ON_ERROR;
+      /* limit_offset should be greater than 0. Otherwise, raises an error. */
+      if (fetch_peek_dbval (thread_p, xasl->limit_offset, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
+      if (cmp_with_zero != DB_GT && cmp_with_zero != DB_EQ)
+	{
+	  /* still want better error code */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_PARAMETER, 0);
+	  return ER_FAILED;
+	}
     }
 
-  /* evaluate having predicate */
-  if (buildvalue->having_pred != NULL)
-    {
-      ev_res = eval_pred (thread_p, buildvalue->having_pred, &xasl_state->vd, NULL);
-      if (ev_res == V_ERROR)
+  if (xasl->limit_row_count != NULL)
+    {
+      /* When limit_row_count is
+       *   > 0, go to execute the query.
+       *   = 0, no result will be generated. stop execution for optimization.
+       *   < 0, raise an error.
+       */
+      if (fetch_peek_dbval (thread_p, xasl->limit_row_count, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) !=
+	  NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
+      if (cmp_with_zero == DB_GT)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  /* validated */
+	  return NO_ERROR;
 	}
-      else if (ev_res != V_TRUE
-	       && qdata_set_valptr_list_unbound (thread_p, xasl->outptr_list, &xasl_state->vd) != NO_ERROR)
+      else if (cmp_with_zero == DB_EQ)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  *empty_result = true;
+	  return NO_ERROR;
+	}
+      else
+	{
+	  /* still want better error code */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_PARAMETER, 0);
+	  return ER_FAILED;
 	}
     }
 
-  /* a list of one tuple with a single value needs to be produced */
-  if (qdata_get_valptr_type_list (thread_p, xasl->outptr_list, &type_list) != NO_ERROR)
-    {
-      GOTO_EXIT_ON_ERROR;
-    }
+  return NO_ERROR;
+}
 
-  /* If BUILDVALUE_PROC does not have 'order by'(xasl->orderby_list), then the list file to be open at here will be the
-   * last one. Otherwise, the last list file will be open at qexec_orderby_distinct(). (Note that only one that can
-   * have 'group by' is BUILDLIST_PROC type.) And, the top most XASL is the other condition for the list file to be the
-   * last result file. */
-  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
-  if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-      && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)) && xasl->option != Q_DISTINCT)
+#if defined (SERVER_MODE)
+/* minimum number of heap pages each worker of a parallel heap scan should get */
+#define QEXEC_PX_HEAP_SCAN_MIN_PAGES_PER_WORKER 64
+
+typedef struct qexec_px_heap_scan_context QEXEC_PX_HEAP_SCAN_CONTEXT;
+typedef struct qexec_px_heap_scan_worker QEXEC_PX_HEAP_SCAN_WORKER;
+
+struct qexec_px_heap_scan_worker
+{
+  XASL_NODE *xasl;		/* worker's own XASL tree holding the partial aggregates */
+  XASL_UNPACK_INFO *unpack_info;	/* unpack info of xasl */
+  int error_code;		/* error of worker */
+  void *error;			/* error of worker detached from its thread, to be reported by the main thread */
+};
+
+/* tasks are queued in the workers shared by all transactions. the main thread scans too, so all pages are scanned
+ * even if no task starts; it waits only for the tasks that started before it finished. tasks that start later see
+ * is_closed and end without touching anything but the context, which the last of its holders frees. */
+struct qexec_px_heap_scan_context
+{
+  char *xasl_stream;		/* XASL stream each worker unpacks its own tree from */
+  int xasl_stream_size;
+  XASL_STATE *xasl_state;	/* XASL state of main thread */
+  int tran_index;		/* transaction the workers work on behalf of */
+  PX_HEAP_SCAN_PAGES pages;	/* heap pages distributed among workers */
+
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;		/* signaled with mutex when a worker is done or when aggregates are merged */
+  int n_started;		/* number of workers started scanning, main thread included */
+  int n_done;			/* number of workers done with scanning */
+  bool is_closed;		/* all pages are claimed; tasks that start now end immediately */
+  bool is_merged;		/* partial aggregates are merged; workers may free their XASL trees */
+  volatile int ref_count;	/* main thread and tasks not ended yet */
+
+  QEXEC_PX_HEAP_SCAN_WORKER *workers;	/* one for each task and one for main thread */
+};
+
+/*
+ * qexec_px_heap_scan_is_eligible () - check whether the aggregation of the query can be computed by scanning its heap
+ *				       file in parallel
+ *   return: true if eligible
+ *   xasl(in)   : XASL Tree pointer
+ *
+ * Note: Only the top-most BUILDVALUE_PROC that aggregates a single class by a sequential scan, without subqueries, path
+ *       expressions or aggregates that need all values at once (DISTINCT, GROUP_CONCAT, MEDIAN...), is eligible.
+ *       Partial aggregates of each worker must be mergeable by qdata_aggregate_accumulator_to_accumulator.
+ */
+static bool
+qexec_px_heap_scan_is_eligible (XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *specp;
+  AGGREGATE_TYPE *agg_p;
+
+  if (prm_get_integer_value (PRM_ID_HEAP_SCAN_PARALLEL_DEGREE) <= 1)
     {
-      QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+      return false;
     }
-  t_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, ls_flag);
-  if (t_list_id == NULL)
+
+  if (xasl->type != BUILDVALUE_PROC || !xasl->query_in_progress || xasl->proc.buildvalue.agg_list == NULL
+      || xasl->proc.buildvalue.is_always_false)
     {
-      if (type_list.domp)
-	{
-	  db_private_free_and_init (thread_p, type_list.domp);
-	}
-      GOTO_EXIT_ON_ERROR;
+      /* not the aggregation of top-most XASL */
+      return false;
     }
 
-      /***** WHAT IN THE WORLD IS THIS? *****/
-  if (type_list.domp)
+  if (xasl->scan_op_type != S_SELECT || xasl->selected_upd_list != NULL || xasl->scan_ptr != NULL
+      || xasl->merge_spec != NULL || xasl->aptr_list != NULL || xasl->dptr_list != NULL || xasl->bptr_list != NULL
+      || xasl->fptr_list != NULL || xasl->connect_by_ptr != NULL || xasl->if_pred != NULL
+      || xasl->after_join_pred != NULL || xasl->instnum_pred != NULL || xasl->instnum_val != NULL
+      || XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY) || XASL_IS_FLAGED (xasl, XASL_NEED_SINGLE_TUPLE_SCAN))
     {
-      db_private_free_and_init (thread_p, type_list.domp);
+      return false;
     }
 
-  if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+  specp = xasl->spec_list;
+  if (specp == NULL || specp->next != NULL || specp->type != TARGET_CLASS
+      || specp->access != ACCESS_METHOD_SEQUENTIAL || specp->pruning_type != DB_NOT_PARTITIONED_CLASS
+      || (specp->flags & ACCESS_SPEC_FLAG_FOR_UPDATE) || mvcc_is_mvcc_disabled_class (&ACCESS_SPEC_CLS_OID (specp)))
     {
-      GOTO_EXIT_ON_ERROR;
+      return false;
     }
 
-  output = xasl->list_id;
-  QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-
-  if (buildvalue->having_pred == NULL || ev_res == V_TRUE)
+  for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
     {
-      tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
-      if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
+      if (agg_p->option == Q_DISTINCT || agg_p->sort_list != NULL || agg_p->flag_agg_optimize)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  return false;
 	}
 
-      switch (tpldescr_status)
+      switch (agg_p->function)
 	{
-	case QPROC_TPLDESCR_SUCCESS:
-	  /* build tuple into the list file page */
-	  if (qfile_generate_tuple_into_list (thread_p, xasl->list_id, T_NORMAL) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  break;
-
-	case QPROC_TPLDESCR_RETRY_SET_TYPE:
-	case QPROC_TPLDESCR_RETRY_BIG_REC:
-	  if (tplrec->tpl == NULL)
-	    {
-	      /* allocate tuple descriptor */
-	      tplrec->size = DB_PAGESIZE;
-	      tplrec->tpl = (QFILE_TUPLE) db_private_alloc (thread_p, DB_PAGESIZE);
-	      if (tplrec->tpl == NULL)
-		{
-		  GOTO_EXIT_ON_ERROR;
-		}
-	    }
-	  if (qdata_copy_valptr_list_to_tuple (thread_p, xasl->outptr_list, &xasl_state->vd, tplrec) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  if (qfile_add_tuple_to_list (thread_p, xasl->list_id, tplrec->tpl) != NO_ERROR)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
+	case PT_COUNT_STAR:
+	case PT_COUNT:
+	case PT_SUM:
+	case PT_AVG:
+	case PT_MIN:
+	case PT_MAX:
+	case PT_AGG_BIT_AND:
+	case PT_AGG_BIT_OR:
+	case PT_AGG_BIT_XOR:
+	case PT_STDDEV:
+	case PT_STDDEV_POP:
+	case PT_STDDEV_SAMP:
+	case PT_VARIANCE:
+	case PT_VAR_POP:
+	case PT_VAR_SAMP:
 	  break;
 
 	default:
-	  break;
+	  return false;
 	}
     }
 
-end:
+  return true;
+}
 
-  QEXEC_CLEAR_AGG_LIST_VALUE (buildvalue->agg_list);
-  if (t_list_id)
-    {
-      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-    }
-  if (output)
+/*
+ * qexec_px_heap_scan_release_context () - release a reference to parallel heap scan context; the last one frees it
+ *   return:
+ *   context(in)    : parallel heap scan context
+ */
+static void
+qexec_px_heap_scan_release_context (QEXEC_PX_HEAP_SCAN_CONTEXT * context)
+{
+  if (ATOMIC_INC_32 (&context->ref_count, -1) > 0)
     {
-      qfile_close_list (thread_p, output);
+      return;
     }
 
-  return status;
-
-exit_on_error:
-
-  status = ER_FAILED;
-  goto end;
+  (void) pthread_cond_destroy (&context->cond);
+  (void) pthread_mutex_destroy (&context->mutex);
+  free (context);
 }
 
 /*
- * qexec_end_mainblock_iterations () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL tree state information
- *   tplrec(out) : Tuple record descriptor to store result tuples
+ * qexec_px_heap_scan_pages () - scan the pages of heap file left and compute partial aggregates
+ *   return:
+ *   context(in)    : parallel heap scan context
+ *   worker(in/out) : gets the XASL tree holding partial aggregates, or the error
  *
- * Note: This routines performs the finish-up operations for a main
- * procedure block iteration. The main procedure block nodes can
- * be of type BUILDLIST_PROC, BUILDVALUE, UNION_PROC,
- * DIFFERENCE_PROC and INTERSECTION_PROC.
+ * Note: Executed by the main thread and by the tasks that start before all pages are claimed. The XASL tree is
+ *       allocated by this thread and must be freed by it with qexec_px_heap_scan_free_worker_xasl () after merge.
  */
-static int
-qexec_end_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
-				QFILE_TUPLE_RECORD * tplrec)
+static void
+qexec_px_heap_scan_pages (THREAD_ENTRY * thread_p, QEXEC_PX_HEAP_SCAN_CONTEXT * context,
+			  QEXEC_PX_HEAP_SCAN_WORKER * worker)
 {
-  QFILE_LIST_ID *t_list_id = NULL;
-  int status = NO_ERROR;
-  bool distinct_needed;
-  int ls_flag = 0;
-
-  distinct_needed = (xasl->option == Q_DISTINCT) ? true : false;
+  XASL_UNPACK_INFO *unpack_info = NULL;
+  XASL_NODE *xasl = NULL;
+  XASL_STATE xasl_state;
+  ACCESS_SPEC_TYPE *specp = NULL;
+  AGGREGATE_TYPE *agg_p;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE xb_scan, ls_scan;
+  bool mvcc_select_lock_needed = false;
+  bool scan_opened = false;
+  int error_code = NO_ERROR;
 
-#if defined (ENABLE_COMPOSITE_LOCK)
-  /* Acquire the lockset if composite locking is enabled. */
-  if ((COMPOSITE_LOCK (xasl->scan_op_type) || QEXEC_IS_MULTI_TABLE_UPDATE_DELETE (xasl))
-      && (!XASL_IS_FLAGED (xasl, XASL_MULTI_UPDATE_AGG)))
+  /* each worker needs its own XASL tree for attribute caches, scan identifiers and accumulators */
+  error_code = stx_map_stream_to_xasl (thread_p, &xasl, false, context->xasl_stream, context->xasl_stream_size,
+				       &unpack_info);
+  if (error_code != NO_ERROR)
     {
-      if (lock_finalize_composite_lock (thread_p, &xasl->composite_lock) != LK_GRANTED)
-	{
-	  return ER_FAILED;
-	}
+      goto end;
     }
-#endif /* defined (ENABLE_COMPOSITE_LOCK) */
 
-  switch (xasl->type)
-    {
+  xasl_state = *context->xasl_state;
+  xasl_state.vd.xasl_state = &xasl_state;
 
-    case BUILDLIST_PROC:	/* end BUILDLIST_PROC iterations */
-      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
-	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
-	}
-      /* fall through */
-    case CONNECTBY_PROC:
-    case BUILD_SCHEMA_PROC:
-      /* close the list file */
-      qfile_close_list (thread_p, xasl->list_id);
-      break;
+  /* nullify domains */
+  for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
+    {
+      agg_p->accumulator_domain.value_dom = NULL;
+      agg_p->accumulator_domain.value2_dom = NULL;
+    }
+  xasl->proc.buildvalue.agg_domains_resolved = 0;
 
-    case MERGELIST_PROC:
-      /* do a direct list file merge to generate resultant list file */
-      if (qexec_merge_listfiles (thread_p, xasl, xasl_state) != NO_ERROR)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      break;
+  error_code = qexec_start_mainblock_iterations (thread_p, xasl, &xasl_state);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
 
-    case BUILDVALUE_PROC:	/* end BUILDVALUE_PROC iterations */
-      status = qexec_end_buildvalueblock_iterations (thread_p, xasl, xasl_state, tplrec);
-      break;
+  specp = xasl->spec_list;
+  specp->fixed_scan = !XASL_IS_FLAGED (xasl, XASL_NO_FIXED_SCAN);
+  specp->grouped_scan = false;
+  error_code =
+    qexec_open_scan (thread_p, specp, xasl->val_list, &xasl_state.vd, false, specp->fixed_scan, specp->grouped_scan,
+		     xasl->iscan_oid_order, &specp->s_id, xasl_state.query_id, xasl->scan_op_type, false,
+		     &mvcc_select_lock_needed);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  scan_opened = true;
+  assert (specp->s_id.type == S_HEAP_SCAN && !mvcc_select_lock_needed);
+  specp->s_id.s.hsid.px_pages = &context->pages;
 
-    case UNION_PROC:
-    case DIFFERENCE_PROC:
-    case INTERSECTION_PROC:
-      if (xasl->type == UNION_PROC)
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_UNION);
-	}
-      else if (xasl->type == DIFFERENCE_PROC)
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DIFFERENCE);
-	}
-      else
+  while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
+    {
+      while ((ls_scan = scan_next_scan (thread_p, &xasl->curr_spec->s_id)) == S_SUCCESS)
 	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_INTERSECT);
+	  error_code = qexec_end_one_iteration (thread_p, xasl, &xasl_state, &tplrec);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
 	}
 
-      if (distinct_needed)
-	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_DISTINCT);
-	}
-      else
+      if (ls_scan != S_END)
 	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_ALL);
+	  error_code = ER_FAILED;
+	  goto end;
 	}
+    }
 
-      /* For UNION_PROC, DIFFERENCE_PROC, and INTERSECTION_PROC, if they do not have 'order by'(xasl->orderby_list),
-       * then the list file to be open at here will be the last one. Otherwise, the last list file will be open at
-       * qexec_groupby() or qexec_orderby_distinct(). (Note that only one that can have 'group by' is BUILDLIST_PROC
-       * type.) And, the top most XASL is the other condition for the list file to be the last result file. */
+  if (xb_scan != S_END)
+    {
+      error_code = ER_FAILED;
+    }
 
-      if (XASL_IS_FLAGED (xasl, XASL_TOP_MOST_XASL) && XASL_IS_FLAGED (xasl, XASL_TO_BE_CACHED)
-	  && (xasl->orderby_list == NULL || XASL_IS_FLAGED (xasl, XASL_SKIP_ORDERBY_LIST)))
+end:
+  if (scan_opened)
+    {
+      /* release the pages before waiting for the merge */
+      qexec_end_scan (thread_p, specp);
+      qexec_close_scan (thread_p, specp);
+      if (xasl->curr_spec != NULL)
 	{
-	  QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
+	  xasl->curr_spec->curent = NULL;
+	  xasl->curr_spec = NULL;
 	}
+    }
+  if (tplrec.tpl != NULL)
+    {
+      db_private_free_and_init (thread_p, tplrec.tpl);
+    }
 
-      t_list_id =
-	qfile_combine_two_list (thread_p, xasl->proc.union_.left->list_id, xasl->proc.union_.right->list_id, ls_flag);
-      distinct_needed = false;
-      if (!t_list_id)
-	{
-	  GOTO_EXIT_ON_ERROR;
-	}
-      if (qfile_copy_list_id (xasl->list_id, t_list_id, true) != NO_ERROR)
+  worker->xasl = xasl;
+  worker->unpack_info = unpack_info;
+  if (error_code != NO_ERROR)
+    {
+      worker->error_code = er_errid ();
+      if (worker->error_code == NO_ERROR)
 	{
-	  GOTO_EXIT_ON_ERROR;
+	  worker->error_code = error_code;
 	}
-      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
-      break;
-
-    case CTE_PROC:
-      /* close the list file */
-      qfile_close_list (thread_p, xasl->list_id);
-      break;
-
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      GOTO_EXIT_ON_ERROR;
-    }				/* switch */
+      /* the error with its arguments is set again by the main thread */
+      worker->error = er_detach_error ();
+      er_clear ();
 
-  /* DISTINCT processing (i.e, duplicates elimination) is performed at qexec_orderby_distinct() after GROUP BY
-   * processing */
+      /* stop other workers early */
+      (void) ATOMIC_TAS_32 (&context->pages.next_page, context->pages.n_vpids);
+    }
+}
 
-success:
-  if (t_list_id)
+/*
+ * qexec_px_heap_scan_free_worker_xasl () - free the XASL tree of a worker; by the thread that unpacked it
+ *   return:
+ *   xasl(in)       : XASL tree of worker
+ *   unpack_info(in): unpack info of xasl
+ */
+static void
+qexec_px_heap_scan_free_worker_xasl (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_UNPACK_INFO * unpack_info)
+{
+  if (xasl != NULL)
     {
-      QFILE_FREE_AND_INIT_LIST_ID (t_list_id);
+      (void) qexec_clear_xasl (thread_p, xasl, true);
+    }
+  if (unpack_info != NULL)
+    {
+      free_xasl_unpack_info (thread_p, unpack_info);
     }
-  return status;
-
-exit_on_error:
-  status = ER_FAILED;
-  goto success;
-
 }
 
 /*
- * qexec_clear_mainblock_iterations () -
+ * qexec_px_heap_scan_execute () - task of a worker thread of parallel heap scan
  *   return:
- *   xasl(in)   : XASL Tree pointer
+ *   thread_ref(in) : worker thread
+ *   context(in)    : parallel heap scan context
  */
 static void
-qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+qexec_px_heap_scan_execute (cubthread::entry & thread_ref, QEXEC_PX_HEAP_SCAN_CONTEXT * context)
 {
-  AGGREGATE_TYPE *agg_p;
+  THREAD_ENTRY *thread_p = &thread_ref;
+  QEXEC_PX_HEAP_SCAN_WORKER *worker;
+  XASL_NODE *xasl;
+  XASL_UNPACK_INFO *unpack_info;
+  int rv;
 
-  switch (xasl->type)
+  rv = pthread_mutex_lock (&context->mutex);
+  assert (rv == NO_ERROR);
+
+  if (context->is_closed)
     {
-    case BUILDLIST_PROC:
-      /* Destroy the extendible hash files for SELECT statement generated for UPDATE/DELETE */
-      if (xasl->proc.buildlist.upddel_oid_locator_ehids != NULL)
-	{
-	  qexec_destroy_upddel_ehash_files (thread_p, xasl);
-	}
-      /* fall through */
-    case CONNECTBY_PROC:
-      qfile_close_list (thread_p, xasl->list_id);
-      break;
+      /* started too late; pages were scanned by others and the main thread may have returned */
+      pthread_mutex_unlock (&context->mutex);
+      qexec_px_heap_scan_release_context (context);
+      return;
+    }
+  worker = &context->workers[context->n_started++];
 
-    case BUILDVALUE_PROC:
-      for (agg_p = xasl->proc.buildvalue.agg_list; agg_p != NULL; agg_p = agg_p->next)
-	{
-	  qfile_close_list (thread_p, agg_p->list_id);
-	  qfile_destroy_list (thread_p, agg_p->list_id);
-	}
-      break;
+  pthread_mutex_unlock (&context->mutex);
 
-    case UNION_PROC:
-    case DIFFERENCE_PROC:
-    case INTERSECTION_PROC:
-    case OBJFETCH_PROC:
-    case SCAN_PROC:
-    case MERGELIST_PROC:
-    case UPDATE_PROC:
-    case DELETE_PROC:
-    case INSERT_PROC:
-    case DO_PROC:
-    case MERGE_PROC:
-    case BUILD_SCHEMA_PROC:
-    case CTE_PROC:
-      break;
+  /* work on behalf of the query transaction */
+  thread_p->tran_index = context->tran_index;
 
-    default:
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_XASLNODE, 0);
-      break;
+  qexec_px_heap_scan_pages (thread_p, context, worker);
+  xasl = worker->xasl;
+  unpack_info = worker->unpack_info;
+
+  /* report and wait until the main thread merges the partial aggregates */
+  rv = pthread_mutex_lock (&context->mutex);
+  assert (rv == NO_ERROR);
+
+  context->n_done++;
+  pthread_cond_broadcast (&context->cond);
+
+  while (!context->is_merged)
+    {
+      pthread_cond_wait (&context->cond, &context->mutex);
     }
 
-  return;
+  pthread_mutex_unlock (&context->mutex);
+
+  /* the worker slot may be freed by now; memory of XASL tree belongs to this thread */
+  qexec_px_heap_scan_free_worker_xasl (thread_p, xasl, unpack_info);
+
+  thread_p->tran_index = NULL_TRAN_INDEX;
+
+  qexec_px_heap_scan_release_context (context);
 }
 
 /*
- * qexec_execute_mainblock () -
- *   return: NO_ERROR, or ER_code
- *   xasl(in)   : XASL Tree pointer
- *   xasl_state(in)     : XASL state information
- *   p_class_instance_lock_info(in/out): class instance lock info
- *
+ * qexec_px_heap_scan_merge_aggregates () - merge the partial aggregates of a worker into the aggregates of main XASL
+ *   return: error code
+ *   xasl(in/out)   : main XASL
+ *   worker_xasl(in): XASL of worker
  */
-int
-qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate,
-			 UPDDEL_CLASS_INSTANCE_LOCK_INFO * p_class_instance_lock_info)
+static int
+qexec_px_heap_scan_merge_aggregates (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_NODE * worker_xasl)
 {
-  int error = NO_ERROR;
-  bool on_trace;
-  TSC_TICKS start_tick, end_tick;
-  TSCTIMEVAL tv_diff;
-  UINT64 old_fetches = 0, old_ioreads = 0;
-
-  if (thread_get_recursion_depth (thread_p) > prm_get_integer_value (PRM_ID_MAX_RECURSION_SQL_DEPTH))
-    {
-      error = ER_MAX_RECURSION_SQL_DEPTH;
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, prm_get_integer_value (PRM_ID_MAX_RECURSION_SQL_DEPTH));
-      return error;
-    }
-  thread_inc_recursion_depth (thread_p);
+  AGGREGATE_TYPE *agg_p, *worker_agg_p;
+  int error_code = NO_ERROR;
 
-  on_trace = thread_is_on_trace (thread_p);
-  if (on_trace)
+  for (agg_p = xasl->proc.buildvalue.agg_list, worker_agg_p = worker_xasl->proc.buildvalue.agg_list;
+       agg_p != NULL; agg_p = agg_p->next, worker_agg_p = worker_agg_p->next)
     {
-      tsc_getticks (&start_tick);
+      assert (worker_agg_p != NULL && worker_agg_p->function == agg_p->function);
 
-      old_fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
-      old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
-    }
+      if (worker_agg_p->accumulator.curr_cnt < 1)
+	{
+	  /* worker aggregated no values */
+	  continue;
+	}
 
-  error = qexec_execute_mainblock_internal (thread_p, xasl, xstate, p_class_instance_lock_info);
+      if (agg_p->accumulator_domain.value_dom == NULL || agg_p->accumulator_domain.value2_dom == NULL)
+	{
+	  /* first values; domains were resolved by the worker */
+	  agg_p->domain = worker_agg_p->domain;
+	  agg_p->opr_dbtype = worker_agg_p->opr_dbtype;
+	  agg_p->accumulator_domain = worker_agg_p->accumulator_domain;
 
-  if (on_trace)
-    {
-      tsc_getticks (&end_tick);
-      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-      TSC_ADD_TIMEVAL (xasl->xasl_stats.elapsed_time, tv_diff);
+	  if (agg_p->accumulator.value != NULL && agg_p->accumulator_domain.value_dom != NULL
+	      && DB_VALUE_TYPE (agg_p->accumulator.value) == DB_TYPE_NULL)
+	    {
+	      error_code = db_value_domain_init (agg_p->accumulator.value,
+						 TP_DOMAIN_TYPE (agg_p->accumulator_domain.value_dom),
+						 DB_DEFAULT_PRECISION, DB_DEFAULT_SCALE);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
+	    }
+	  if (agg_p->accumulator.value2 != NULL && agg_p->accumulator_domain.value2_dom != NULL
+	      && DB_VALUE_TYPE (agg_p->accumulator.value2) == DB_TYPE_NULL)
+	    {
+	      error_code = db_value_domain_init (agg_p->accumulator.value2,
+						 TP_DOMAIN_TYPE (agg_p->accumulator_domain.value2_dom),
+						 DB_DEFAULT_PRECISION, DB_DEFAULT_SCALE);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
+	    }
+	}
 
-      xasl->xasl_stats.fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
-      xasl->xasl_stats.ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
+      error_code = qdata_aggregate_accumulator_to_accumulator (thread_p, &agg_p->accumulator,
+							       &agg_p->accumulator_domain, agg_p->function,
+							       agg_p->domain, &worker_agg_p->accumulator);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
     }
 
-  thread_dec_recursion_depth (thread_p);
+  qexec_resolve_buildvalue_outptr_domains (xasl);
 
-  return error;
+  return NO_ERROR;
 }
 
 /*
- * qexec_check_limit_clause () - checks validity of limit clause
- *   return: NO_ERROR, or ER_code
- *   xasl(in): XASL Tree pointer
- *   xasl_state(in): XASL state information
- *   empty_result(out): true if no result will be generated
+ * qexec_execute_px_heap_scan () - compute the aggregates of BUILDVALUE_PROC by scanning the heap file in parallel
+ *   return: error code
+ *   xasl(in)       : XASL Tree pointer
+ *   xasl_state(in) : XASL state information
+ *   executed(out)  : true if aggregates were computed; false if the caller has to scan serially
  *
+ * Note: The user pages of heap file are collected from file table and claimed one by one by workers, this thread
+ *       being one of them. Each worker unpacks its own XASL tree from the cached XASL stream, evaluates the scan
+ *       predicate and aggregates its pages.
+ *       Partial aggregates are merged by this thread into the aggregates of xasl, which must already be initialized.
+ *       All workers share the MVCC snapshot of the transaction.
  */
 static int
-qexec_check_limit_clause (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool * empty_result)
+qexec_execute_px_heap_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state, bool * executed)
 {
-  DB_VALUE *limit_valp;
-  DB_VALUE zero_val;
-  DB_VALUE_COMPARE_RESULT cmp_with_zero;
+  QEXEC_PX_HEAP_SCAN_CONTEXT *context = NULL;
+  QEXEC_PX_HEAP_SCAN_WORKER *workers = NULL;
+  PX_HEAP_SCAN_PAGES pages = { NULL, 0, 0 };
+  QMGR_QUERY_ENTRY *query_p;
+  cubthread::entry_workpool *worker_pool = NULL;
+  int n_workers, n_started;
+  int i;
+  int rv;
+  int error_code = NO_ERROR;
 
-  /* init output */
-  *empty_result = false;
+  *executed = false;
 
-  db_make_int (&zero_val, 0);
+  /* the XASL stream is needed for workers to have their own XASL tree */
+  query_p = qmgr_get_query_entry (thread_p, xasl_state->query_id, NULL_TRAN_INDEX);
+  if (query_p == NULL || query_p->xasl_ent == NULL || query_p->xasl_ent->stream.buffer == NULL)
+    {
+      er_clear ();
+      return NO_ERROR;
+    }
 
-  if (xasl->limit_offset != NULL)
+  worker_pool = cubthread::parallel_query_worker_pool::get_instance ();
+  if (worker_pool == NULL)
     {
-      /* limit_offset should be greater than 0. Otherwise, raises an error. */
-      if (fetch_peek_dbval (thread_p, xasl->limit_offset, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) != NO_ERROR)
-	{
-	  return ER_FAILED;
-	}
+      /* parallel query execution is disabled */
+      return NO_ERROR;
+    }
 
-      cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
-      if (cmp_with_zero != DB_GT && cmp_with_zero != DB_EQ)
+  /* this thread is one of the workers */
+  n_workers = MIN (prm_get_integer_value (PRM_ID_HEAP_SCAN_PARALLEL_DEGREE), fileio_os_sysconf ());
+  n_workers = MIN (n_workers, (int) cubthread::parallel_query_worker_pool::get_worker_count () + 1);
+
+  error_code = file_collect_user_pages (thread_p, &ACCESS_SPEC_HFID (xasl->spec_list).vfid, &pages.vpids,
+					&pages.n_vpids);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  n_workers = MIN (n_workers, pages.n_vpids / QEXEC_PX_HEAP_SCAN_MIN_PAGES_PER_WORKER);
+  if (n_workers <= 1)
+    {
+      /* small heap; not worth it */
+      if (pages.vpids != NULL)
 	{
-	  /* still want better error code */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_PARAMETER, 0);
-	  return ER_FAILED;
+	  db_private_free_and_init (thread_p, pages.vpids);
 	}
+      return NO_ERROR;
     }
 
-  if (xasl->limit_row_count != NULL)
+  /* build the snapshot before workers use it */
+  if (logtb_get_mvcc_snapshot (thread_p) == NULL)
     {
-      /* When limit_row_count is
-       *   > 0, go to execute the query.
-       *   = 0, no result will be generated. stop execution for optimization.
-       *   < 0, raise an error.
-       */
-      if (fetch_peek_dbval (thread_p, xasl->limit_row_count, &xasl_state->vd, NULL, NULL, NULL, &limit_valp) !=
-	  NO_ERROR)
+      ASSERT_ERROR_AND_SET (error_code);
+      db_private_free_and_init (thread_p, pages.vpids);
+      return error_code;
+    }
+
+  /* the context may outlive this call; it is freed by the last task, which may start after the query ended. the
+   * workers and the pages are used only by the workers this thread waits for. */
+  context = (QEXEC_PX_HEAP_SCAN_CONTEXT *) malloc (sizeof (QEXEC_PX_HEAP_SCAN_CONTEXT));
+  workers = (QEXEC_PX_HEAP_SCAN_WORKER *) db_private_alloc (thread_p, n_workers * sizeof (QEXEC_PX_HEAP_SCAN_WORKER));
+  if (context == NULL || workers == NULL)
+    {
+      if (context == NULL)
 	{
-	  return ER_FAILED;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QEXEC_PX_HEAP_SCAN_CONTEXT));
+	}
+      else
+	{
+	  free_and_init (context);
 	}
+      if (workers != NULL)
+	{
+	  db_private_free_and_init (thread_p, workers);
+	}
+      db_private_free_and_init (thread_p, pages.vpids);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
 
-      cmp_with_zero = tp_value_compare (limit_valp, &zero_val, 1, 0);
-      if (cmp_with_zero == DB_GT)
+  for (i = 0; i < n_workers; i++)
+    {
+      workers[i].xasl = NULL;
+      workers[i].unpack_info = NULL;
+      workers[i].error_code = NO_ERROR;
+      workers[i].error = NULL;
+    }
+
+  context->xasl_stream = query_p->xasl_ent->stream.buffer;
+  context->xasl_stream_size = query_p->xasl_ent->stream.buffer_size;
+  context->xasl_state = xasl_state;
+  context->tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  context->pages = pages;
+  context->n_started = 1;	/* this thread takes the first worker */
+  context->n_done = 0;
+  context->is_closed = false;
+  context->is_merged = false;
+  context->ref_count = n_workers;
+  context->workers = workers;
+  (void) pthread_mutex_init (&context->mutex, NULL);
+  (void) pthread_cond_init (&context->cond, NULL);
+
+  for (i = 1; i < n_workers; i++)
+    {
+      thread_get_manager ()->push_task (worker_pool,
+					new cubthread::entry_callable_task (std::bind (qexec_px_heap_scan_execute,
+										       std::placeholders::_1,
+										       context)));
+    }
+
+  /* scan along with the tasks that start; if none starts, this thread scans all pages */
+  qexec_px_heap_scan_pages (thread_p, context, &workers[0]);
+
+  /* all pages are claimed; wait only for the workers that started to scan. they stop at the next page when the
+   * query is interrupted. */
+  rv = pthread_mutex_lock (&context->mutex);
+  assert (rv == NO_ERROR);
+  context->n_done++;
+  context->is_closed = true;
+  while (context->n_done < context->n_started)
+    {
+      pthread_cond_wait (&context->cond, &context->mutex);
+    }
+  n_started = context->n_started;
+  pthread_mutex_unlock (&context->mutex);
+
+  /* workers are waiting; their XASL trees can be safely read */
+  for (i = 0; i < n_started; i++)
+    {
+      if (error_code != NO_ERROR)
 	{
-	  /* validated */
-	  return NO_ERROR;
+	  er_free_detached_error (workers[i].error);
 	}
-      else if (cmp_with_zero == DB_EQ)
+      else if (workers[i].error_code != NO_ERROR)
 	{
-	  *empty_result = true;
-	  return NO_ERROR;
+	  /* report the error of worker as it was set */
+	  error_code = workers[i].error_code;
+	  (void) er_attach_error (workers[i].error);
 	}
       else
 	{
-	  /* still want better error code */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_INVALID_PARAMETER, 0);
-	  return ER_FAILED;
+	  error_code = qexec_px_heap_scan_merge_aggregates (thread_p, xasl, workers[i].xasl);
 	}
     }
 
-  return NO_ERROR;
+  /* let workers free their XASL trees; they do not use workers and pages anymore */
+  rv = pthread_mutex_lock (&context->mutex);
+  assert (rv == NO_ERROR);
+  context->is_merged = true;
+  pthread_cond_broadcast (&context->cond);
+  pthread_mutex_unlock (&context->mutex);
+
+  qexec_px_heap_scan_free_worker_xasl (thread_p, workers[0].xasl, workers[0].unpack_info);
+  db_private_free_and_init (thread_p, workers);
+  db_private_free_and_init (thread_p, pages.vpids);
+
+  qexec_px_heap_scan_release_context (context);
+
+  if (error_code == NO_ERROR)
+    {
+      *executed = true;
+    }
+  return error_code;
 }
+#endif /* SERVER_MODE */
 
 /*
  * qexec_execute_mainblock_internal () -
@@ -13633,6 +15111,7 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
   int multi_upddel = false;
   QFILE_LIST_MERGE_INFO *merge_infop;
   XASL_NODE *outer_xasl = NULL, *inner_xasl = NULL;
+  bool px_heap_scan_executed = false;
   XASL_NODE *fixed_scan_xasl = NULL;
   bool iscan_oid_order, force_select_lock = false;
   bool has_index_scan = false;
@@ -14000,8 +15479,20 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
        * this modification is to pretend that the server's scan time is very fast so that it affect only little portion
        * of whole turnaround time in the point of view of the JDBC driver. */
 
+#if defined (SERVER_MODE)
+      /* aggregates of a large heap may be computed by parallel workers; then the scan is skipped */
+      if (xasl->spec_list && qexec_px_heap_scan_is_eligible (xasl))
+	{
+	  if (qexec_execute_px_heap_scan (thread_p, xasl, xasl_state, &px_heap_scan_executed) != NO_ERROR)
+	    {
+	      qexec_clear_mainblock_iterations (thread_p, xasl);
+	      GOTO_EXIT_ON_ERROR;
+	    }
+	}
+#endif /* SERVER_MODE */
+
       /* iterative processing is done only for XASL blocks that has access specification list blocks. */
-      if (xasl->spec_list)
+      if (xasl->spec_list && !px_heap_scan_executed)
 	{
 	  /* Decide which scan will use fixed flags and which won't. There are several cases here: 1. Do not use fixed
 	   * scans if locks on objects are required. 2. Disable all fixed scans if any index scan is used (this is
@@ -14956,26 +16447,13 @@ tranid_compare (const void *t1, const void *t2)
 int
 qexec_clear_list_cache_by_class (THREAD_ENTRY * thread_p, const OID * class_oid)
 {
-#if 0
-  /* TODO: Update this in xasl_cache.c */
-  XASL_CACHE_ENTRY *ent;
-  void *last;
-
-  /* for all entries in the class oid hash table Note that mht_put2() allows mutiple data with the same key, so we have
-   * to use mht_get2() */
-
-  last = NULL;
-  do
+  if (QFILE_IS_LIST_CACHE_DISABLED)
     {
-      /* look up the hash table with the key */
-      ent = (XASL_CACHE_ENTRY *) mht_get2 (xasl_ent_cache.oid_ht, class_oid, &last);
-      if (ent && ent->list_ht_no >= 0)
-	{
-	  (void) qfile_clear_list_cache (thread_p, ent->list_ht_no, false);
-	}
+      return NO_ERROR;
     }
-  while (ent);
-#endif /* 0 */
+
+  /* clear the results cached by the XASL cache entries that are related to the class */
+  xcache_clear_list_cache_by_oid (thread_p, class_oid);
 
   return NO_ERROR;
 }
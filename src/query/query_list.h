@@ -332,11 +332,19 @@ typedef enum
   QPROC_NO_SINGLE_OUTER		/* 1 NULL row or n qualified rows */
 } QPROC_SINGLE_FETCH;
 
+/* List File Join Method */
+typedef enum
+{
+  QFILE_JOIN_METHOD_MERGE = 0,	/* sort both lists and merge them */
+  QFILE_JOIN_METHOD_HASH	/* build a hash table on one list and probe it with the other */
+} QFILE_JOIN_METHOD;
+
 /* List File Merge Information */
 typedef struct qfile_list_merge_info QFILE_LIST_MERGE_INFO;
 struct qfile_list_merge_info
 {
   JOIN_TYPE join_type;		/* inner, left, right or outer */
+  QFILE_JOIN_METHOD join_method;	/* merge or hash */
   QPROC_SINGLE_FETCH single_fetch;	/* merge in single fetch mode */
   int ls_column_cnt;		/* join columns count */
   int ls_pos_cnt;		/* tuple value fetch count */
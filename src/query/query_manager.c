@@ -105,6 +105,7 @@ struct qmgr_tran_entry
   QMGR_QUERY_ENTRY *free_query_entry_list_p;	/* free query entry list */
 
   OID_BLOCK_LIST *modified_classes_p;	/* array of class OIDs */
+  UINT64 list_cache_epoch;	/* list cache epoch at the first query of a repeatable read transaction; 0 if not read */
 };
 
 typedef struct qmgr_temp_file_list QMGR_TEMP_FILE_LIST;
@@ -154,6 +155,7 @@ static void qmgr_delete_query_entry (THREAD_ENTRY * thread_p, QUERY_ID query_id,
 static void qmgr_free_tran_entries (THREAD_ENTRY * thread_p);
 
 static void qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p);
+static bool qmgr_is_related_class_modified (QMGR_TRAN_ENTRY * tran_entry_p, XASL_CACHE_ENTRY * xasl_cache_entry_p);
 static OID_BLOCK_LIST *qmgr_allocate_oid_block (THREAD_ENTRY * thread_p);
 static void qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block);
 static int qmgr_init_external_file_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
@@ -603,6 +605,7 @@ qmgr_initialize_tran_entry (QMGR_TRAN_ENTRY * tran_entry_p)
   tran_entry_p->query_entry_list_p = NULL;
   tran_entry_p->free_query_entry_list_p = NULL;
   tran_entry_p->modified_classes_p = NULL;
+  tran_entry_p->list_cache_epoch = 0;
 }
 
 /*
@@ -1240,6 +1243,8 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   QMGR_TRAN_ENTRY *tran_entry_p;
   QFILE_LIST_ID *list_id_p, *tmp_list_id_p;
   bool cached_result;
+  bool use_result_cache;
+  UINT64 list_cache_epoch;
   bool saved_is_stats_on;
   bool xasl_trace;
   bool is_xasl_pinned_reference;
@@ -1361,7 +1366,31 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
       goto exit_on_error;
     }
 
-  if (qmgr_can_get_result_from_cache (*flag_p))
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+
+  /* The cached results do not see the uncommitted changes of this transaction and the results of this transaction
+   * must not be seen by the others; bypass the cache if the query reads a class modified by the transaction.
+   * A result may be cached only if no cached result was cleared since the snapshot it is computed on was taken. The
+   * repeatable read transactions keep their snapshot, so they must not read newer results either. */
+  use_result_cache = !QFILE_IS_LIST_CACHE_DISABLED;
+  if (use_result_cache && qmgr_is_related_class_modified (tran_entry_p, xasl_cache_entry_p))
+    {
+      use_result_cache = false;
+    }
+  list_cache_epoch = qfile_get_list_cache_epoch ();
+  if (use_result_cache && logtb_find_isolation (tran_index) >= TRAN_REPEATABLE_READ)
+    {
+      if (tran_entry_p->list_cache_epoch == 0)
+	{
+	  tran_entry_p->list_cache_epoch = list_cache_epoch;
+	}
+      else if (tran_entry_p->list_cache_epoch != list_cache_epoch)
+	{
+	  use_result_cache = false;
+	}
+    }
+
+  if (use_result_cache && qmgr_can_get_result_from_cache (*flag_p))
     {
       /* lookup the list cache with the parameter values (DB_VALUE array) */
       list_cache_entry_p = qfile_lookup_list_cache_entry (thread_p, xasl_cache_entry_p->list_ht_no, &params);
@@ -1386,8 +1415,6 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
   /* Make an query entry */
   /* mark that this transaction is running a query */
-  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
-
 #if defined(ENABLE_SYSTEMTAP)
   if (tran_entry_p->trans_stat == QMGR_TRAN_NULL || tran_entry_p->trans_stat == QMGR_TRAN_TERMINATED)
     {
@@ -1480,10 +1507,12 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   /* If it is allowed to cache the query result or if it is required to cache, put the list file id(QFILE_LIST_ID) into
    * the list cache. Provided are the corresponding XASL cache entry to be linked, and the parameters (host variables -
    * DB_VALUES). */
-  if (qmgr_is_allowed_result_cache (*flag_p))
+  if (use_result_cache && qmgr_is_allowed_result_cache (*flag_p))
     {
-      /* check once more to ensure that the related XASL entry is still valid */
-      if (xcache_can_entry_cache_list (xasl_cache_entry_p))
+      /* check once more to ensure that the related XASL entry is still valid and that the query did not modify
+       * the classes it reads */
+      if (xcache_can_entry_cache_list (xasl_cache_entry_p)
+	  && !qmgr_is_related_class_modified (tran_entry_p, xasl_cache_entry_p))
 	{
 	  if (list_id_p == NULL)
 	    {
@@ -1516,7 +1545,7 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 	   * is, or make new one */
 	  list_cache_entry_p =
 	    qfile_update_list_cache_entry (thread_p, &xasl_cache_entry_p->list_ht_no, &params, list_id_p,
-					   xasl_cache_entry_p->sql_info.sql_hash_text);
+					   xasl_cache_entry_p->sql_info.sql_hash_text, list_cache_epoch);
 	  if (list_cache_entry_p == NULL)
 	    {
 	      char *s;
@@ -2024,6 +2053,75 @@ qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tr
     }
 }
 
+/*
+ * qmgr_is_related_class_modified () - check whether the transaction modified a class the query is related to
+ *   return: true if the query reads a class modified by the transaction
+ *   tran_entry_p(in)   :
+ *   xasl_cache_entry_p(in)     :
+ */
+static bool
+qmgr_is_related_class_modified (QMGR_TRAN_ENTRY * tran_entry_p, XASL_CACHE_ENTRY * xasl_cache_entry_p)
+{
+  OID_BLOCK_LIST *oid_block_p;
+  OID *class_oid_p;
+  int i, j;
+
+  for (oid_block_p = tran_entry_p->modified_classes_p; oid_block_p; oid_block_p = oid_block_p->next)
+    {
+      for (i = 0, class_oid_p = oid_block_p->oid_array; i < oid_block_p->last_oid_idx; i++, class_oid_p++)
+	{
+	  for (j = 0; j < xasl_cache_entry_p->n_related_objects; j++)
+	    {
+	      if (OID_EQ (&xasl_cache_entry_p->related_objects[j].oid, class_oid_p))
+		{
+		  return true;
+		}
+	    }
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qmgr_clear_list_cache_of_modified_classes () -
+ *   return:
+ *   tran_index(in)     : Log Transaction index
+ *
+ * Note: This routine is called by the transaction manager once the changes of a committing transaction are visible
+ * to the other transactions. It clears the cached query results related to the classes modified by the transaction.
+ * Cached results are not cleared by each insert, update or delete; a result computed while the transaction was
+ * still active is kept out of the cache by the list cache epoch.
+ */
+void
+qmgr_clear_list_cache_of_modified_classes (THREAD_ENTRY * thread_p, int tran_index)
+{
+  QMGR_TRAN_ENTRY *tran_entry_p;
+
+  if (tran_index >= qmgr_Query_table.num_trans)
+    {
+      return;
+    }
+
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+  if (tran_entry_p->modified_classes_p == NULL)
+    {
+      return;
+    }
+
+  if (!QFILE_IS_LIST_CACHE_DISABLED)
+    {
+      /* before clearing, so that a result checked against the old epoch is inserted before it is cleared. The
+       * epoch advances even if no cached result of the classes is found: the first result of a class may be
+       * computed now. */
+      qfile_increment_list_cache_epoch (thread_p);
+      qmgr_clear_relative_cache_entries (thread_p, tran_entry_p);
+    }
+
+  qmgr_free_oid_block (thread_p, tran_entry_p->modified_classes_p);
+  tran_entry_p->modified_classes_p = NULL;
+}
+
 /*
  * qmgr_clear_trans_wakeup () -
  *   return:
@@ -2070,17 +2168,15 @@ qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool is_tran_d
       qfile_clear_uncommited_list_cache_entry (thread_p, tran_index);
     }
 
-  /* if the transaction is aborting, clear relative cache entries */
-  if (tran_entry_p->modified_classes_p)
+  /* The changes of an aborted transaction were never seen by the other transactions and the transaction did not
+   * cache results of the classes it modified. A committing transaction clears relative cache entries in
+   * qmgr_clear_list_cache_of_modified_classes () once its changes are visible. */
+  if (tran_entry_p->modified_classes_p && (is_abort || is_tran_died))
     {
-      if (is_abort)
-	{
-	  qmgr_clear_relative_cache_entries (thread_p, tran_entry_p);
-	}
-
       qmgr_free_oid_block (thread_p, tran_entry_p->modified_classes_p);
       tran_entry_p->modified_classes_p = NULL;
     }
+  tran_entry_p->list_cache_epoch = 0;
 
   if (tran_entry_p->query_entry_list_p == NULL)
     {
@@ -170,6 +170,7 @@ static void scan_init_scan_id (SCAN_ID * scan_id, bool force_select_lock, SCAN_O
 static int scan_init_index_key_limit (THREAD_ENTRY * thread_p, INDX_SCAN_ID * isidp, KEY_INFO * key_infop,
 				      VAL_DESCR * vd);
 static SCAN_CODE scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static SCAN_CODE scan_px_heap_next (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes, int is_peeking);
 static SCAN_CODE scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -2832,6 +2833,23 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
 
+  hsidp->px_pages = NULL;
+  hsidp->seq_access_started = false;
+
+  /* file size decides if pages are recycled through scan ring; read it once, not on every (re)start of the scan, and
+   * only for read-only scans of all rows. updates, locking reads and single row fetches do not use the ring and should
+   * not latch the file header page of hot tables. */
+  hsidp->seq_access_npages = 0;
+  if (scan_op_type == S_SELECT && !mvcc_select_lock_needed && single_fetch == QPROC_NO_SINGLE_INNER
+      && pgbuf_is_sequential_access_enabled ())
+    {
+      if (file_get_num_user_pages (thread_p, &hsidp->hfid.vfid, &hsidp->seq_access_npages) != NO_ERROR)
+	{
+	  er_clear ();
+	  hsidp->seq_access_npages = 0;
+	}
+    }
+
   return NO_ERROR;
 }
 
@@ -3644,6 +3662,8 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* regulator variable list for other than predicates */
   llsidp->rest_regu_list = regu_list_rest;
 
+  llsidp->seq_access_started = false;
+
   return NO_ERROR;
 }
 
@@ -3986,6 +4006,11 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	  hsidp->caches_inited = true;
 	}
+      if (!hsidp->seq_access_started)
+	{
+	  /* big tables are read through a small recycling set of buffers, to protect pages of other transactions */
+	  hsidp->seq_access_started = pgbuf_start_sequential_access (thread_p, hsidp->seq_access_npages);
+	}
       break;
 
     case S_HEAP_PAGE_SCAN:
@@ -4144,6 +4169,10 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  goto exit_on_error;
 	}
       qfile_start_scan_fix (thread_p, &llsidp->lsid);
+      if (!llsidp->seq_access_started)
+	{
+	  llsidp->seq_access_started = pgbuf_start_sequential_access (thread_p, llsidp->list_id->page_cnt);
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -4531,6 +4560,12 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	}
 
+      if (hsidp->seq_access_started)
+	{
+	  pgbuf_end_sequential_access (thread_p);
+	  hsidp->seq_access_started = false;
+	}
+
       /* switch scan direction for further iterations */
       if (scan_id->direction == S_FORWARD)
 	{
@@ -4574,6 +4609,11 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       llsidp = &scan_id->s.llsid;
       qfile_end_scan_fix (thread_p, &llsidp->lsid);
       qfile_close_scan (thread_p, &llsidp->lsid);
+      if (llsidp->seq_access_started)
+	{
+	  pgbuf_end_sequential_access (thread_p);
+	  llsidp->seq_access_started = false;
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -4958,6 +4998,58 @@ typedef enum
   OBJ_REPEAT_GET_WITH_LOCK = 1,
   OBJ_GET_WITH_LOCK_COMPLETE = 2
 } OBJECT_GET_STATUS;
+/*
+ * scan_px_heap_next () - get next object from the pages shared with other parallel workers
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   hsidp(in/out): heap scan identifier
+ *   recdes(out): record descriptor
+ *   is_peeking(in): PEEK or COPY
+ *
+ * Note: When the current page is consumed, the next page not yet claimed by any worker is picked. Workers work on
+ *       behalf of the query transaction and stop at the next page when it is interrupted.
+ */
+static SCAN_CODE
+scan_px_heap_next (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes, int is_peeking)
+{
+  PX_HEAP_SCAN_PAGES *px_pages = hsidp->px_pages;
+  SCAN_CODE sp_scan;
+  int page_idx;
+  bool dummy_continue_checking;
+
+  while (true)
+    {
+      if (OID_ISNULL (&hsidp->curr_oid))
+	{
+	  /* the interrupt is left set for the other workers and the query */
+	  if (logtb_get_check_interrupt (thread_p) && logtb_is_interrupted (thread_p, false, &dummy_continue_checking))
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	      return S_ERROR;
+	    }
+
+	  /* claim next page */
+	  page_idx = ATOMIC_INC_32 (&px_pages->next_page, 1) - 1;
+	  if (page_idx >= px_pages->n_vpids)
+	    {
+	      return S_END;
+	    }
+	  hsidp->curr_oid.volid = px_pages->vpids[page_idx].volid;
+	  hsidp->curr_oid.pageid = px_pages->vpids[page_idx].pageid;
+	  hsidp->curr_oid.slotid = NULL_SLOTID;
+	}
+
+      sp_scan =
+	heap_next_in_page (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, recdes, &hsidp->scan_cache,
+			   is_peeking);
+      if (sp_scan != S_END)
+	{
+	  return sp_scan;
+	}
+      assert (OID_ISNULL (&hsidp->curr_oid));
+      recdes->data = NULL;
+    }
+}
+
 /*
  * scan_next_heap_scan () - The scan is moved to the next heap scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
@@ -5033,7 +5125,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  if (scan_id->direction == S_FORWARD)
 	    {
 	      /* move forward */
-	      if (scan_id->type == S_HEAP_SCAN)
+	      if (scan_id->type == S_HEAP_SCAN && hsidp->px_pages != NULL)
+		{
+		  sp_scan = scan_px_heap_next (thread_p, hsidp, &recdes, is_peeking);
+		}
+	      else if (scan_id->type == S_HEAP_SCAN)
 		{
 		  sp_scan =
 		    heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
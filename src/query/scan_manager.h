@@ -90,6 +90,15 @@ typedef enum
   S_INDX_NODE_INFO_SCAN		/* scans b-tree nodes for info */
 } SCAN_TYPE;
 
+/* heap pages shared by the scans of parallel workers; each page is scanned by one worker */
+typedef struct px_heap_scan_pages PX_HEAP_SCAN_PAGES;
+struct px_heap_scan_pages
+{
+  VPID *vpids;			/* user pages of heap file */
+  int n_vpids;			/* number of pages */
+  volatile int next_page;	/* index of next page to be scanned */
+};
+
 typedef struct heap_scan_id HEAP_SCAN_ID;
 struct heap_scan_id
 {
@@ -107,6 +116,9 @@ struct heap_scan_id
   bool scanrange_inited;
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   regu_variable_list_node *recordinfo_regu_list;	/* regulator variable list for record info */
+  PX_HEAP_SCAN_PAGES *px_pages;	/* pages to share with other workers, or NULL to follow the heap chain */
+  bool seq_access_started;	/* true if pages are recycled through page buffer scan ring */
+  int seq_access_npages;	/* heap file pages when scan was opened */
 };				/* Regular Heap File Scan Identifier */
 
 typedef struct heap_page_scan_id HEAP_PAGE_SCAN_ID;
@@ -250,6 +262,7 @@ struct llist_scan_id
   SCAN_PRED scan_pred;		/* scan predicates(filters) */
   regu_variable_list_node *rest_regu_list;	/* regulator variable list */
   QFILE_TUPLE_RECORD *tplrecp;	/* tuple record pointer; output param */
+  bool seq_access_started;	/* true if pages are recycled through page buffer scan ring */
 };
 
 typedef struct showstmt_scan_id SHOWSTMT_SCAN_ID;
@@ -61,6 +61,7 @@
 #include "server_support.h"
 #include "dbtype.h"
 #include "thread_manager.hpp"
+#include "vacuum.h"
 
 typedef SCAN_CODE (*NEXT_SCAN_FUNC) (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt,
 				     void *ctx);
@@ -229,6 +230,12 @@ showstmt_scan_init (void)
   req->next_func = showstmt_array_next_scan;
   req->end_func = showstmt_array_end_scan;
 
+  req = &show_Requests[SHOWSTMT_VACUUM_STATUS];
+  req->show_type = SHOWSTMT_VACUUM_STATUS;
+  req->start_func = vacuum_status_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
   /* append to init other show statement scan function here */
 
 
@@ -3060,6 +3060,9 @@ stx_build_ls_merge_info (THREAD_ENTRY * thread_p, char *ptr, QFILE_LIST_MERGE_IN
   ptr = or_unpack_int (ptr, &tmp);
   list_merge_info->join_type = (JOIN_TYPE) tmp;
 
+  ptr = or_unpack_int (ptr, &tmp);
+  list_merge_info->join_method = (QFILE_JOIN_METHOD) tmp;
+
   ptr = or_unpack_int (ptr, &single_fetch);
   list_merge_info->single_fetch = (QPROC_SINGLE_FETCH) single_fetch;
 
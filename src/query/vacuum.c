@@ -42,6 +42,7 @@
 #include "page_buffer.h"
 #include "perf_monitor.h"
 #include "resource_shared_pool.hpp"
+#include "show_scan.h"
 #include "thread_entry_task.hpp"
 #if defined (SERVER_MODE)
 #include "thread_daemon.hpp"
@@ -50,13 +51,16 @@
 #include "thread_manager.hpp"
 #if defined (SERVER_MODE)
 #include "thread_worker_pool.hpp"
+#include "tsc_timer.h"
 #endif // SERVER_MODE
 #include "util_func.h"
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <stack>
+#include <vector>
 
 #include <cstring>
 
@@ -489,6 +493,30 @@ lockfree::circular_queue<VACUUM_LOG_BLOCKID> *vacuum_Finished_job_queue = NULL;
 /* Static array of vacuum workers */
 VACUUM_WORKER vacuum_Workers[VACUUM_MAX_WORKER_COUNT];
 
+/* Vacuum statistics shown by SHOW VACUUM STATUS; they are collected even if performance monitoring is off. */
+typedef struct vacuum_statistics VACUUM_STATISTICS;
+struct vacuum_statistics
+{
+  // *INDENT-OFF*
+  std::atomic<UINT64> num_log_records;		/* log records processed by workers */
+  std::atomic<UINT64> job_usecs;		/* time spent by workers to process blocks */
+  std::atomic<UINT64> heap_usecs;		/* time spent by workers to vacuum heap objects */
+  std::atomic<UINT64> btree_usecs;		/* time spent by workers to vacuum b-tree entries */
+  std::atomic<UINT64> num_archive_log_pages;	/* log pages read by workers from archives */
+  // *INDENT-ON*
+};
+static VACUUM_STATISTICS vacuum_Stats;
+
+/* Heap helpers vacuum parts of the heap objects collected by a worker from a large log block. */
+#define VACUUM_MAX_HEAP_HELPER_COUNT 16
+VACUUM_WORKER vacuum_Heap_helpers[VACUUM_MAX_HEAP_HELPER_COUNT];
+
+/* Minimum number of heap pages in a part of heap objects vacuumed in parallel. Blocks with less than two parts of
+ * pages are vacuumed by the worker alone. */
+#define VACUUM_HEAP_PARALLEL_MIN_PART_PAGES 16
+/* Number of parts for each thread vacuuming a block; more parts than threads balance the load. */
+#define VACUUM_HEAP_PARALLEL_PARTS_PER_THREAD 4
+
 /* VACUUM_HEAP_HELPER -
  * Structure used by vacuum heap functions.
  */
@@ -694,6 +722,13 @@ static int vacuum_compare_heap_object (const void *a, const void *b);
 static int vacuum_collect_heap_objects (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, OID * oid, VFID * vfid);
 static void vacuum_cleanup_collected_by_vfid (VACUUM_WORKER * worker, VFID * vfid);
 static int vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted);
+static void vacuum_get_lag (VACUUM_LOG_BLOCKID * oldest_blockid, INT64 * num_pending_blocks, INT64 * age_log_pages);
+static int vacuum_heap_objects (THREAD_ENTRY * thread_p, VACUUM_HEAP_OBJECT * heap_objects, int n_heap_objects,
+				MVCCID threshold_mvccid, bool was_interrupted);
+#if defined (SERVER_MODE)
+static int vacuum_heap_parallel (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid,
+				 bool was_interrupted);
+#endif /* SERVER_MODE */
 static int vacuum_heap_prepare_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record_insid_and_prev_version (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
@@ -918,6 +953,218 @@ class vacuum_worker_task : public cubthread::entry_task
     VACUUM_DATA_ENTRY m_data;
 };
 
+#if defined (SERVER_MODE)
+// class vacuum_heap_helper_context_manager
+//
+//  description:
+//    entry manager for heap helper threads. helpers only vacuum heap pages, so they are always in execute state and
+//    do not need the resources of a vacuum worker.
+//
+class vacuum_heap_helper_context_manager : public cubthread::entry_manager
+{
+  public:
+    vacuum_heap_helper_context_manager () : cubthread::entry_manager ()
+    {
+      m_pool = new resource_shared_pool<VACUUM_WORKER> (vacuum_Heap_helpers, VACUUM_MAX_HEAP_HELPER_COUNT);
+    }
+
+    ~vacuum_heap_helper_context_manager ()
+    {
+      delete m_pool;
+    }
+
+  private:
+
+    void on_create (cubthread::entry & context) final
+    {
+      context.tran_index = 0;
+
+      vacuum_init_thread_context (context, TT_VACUUM_WORKER, m_pool->claim ());
+      context.vacuum_worker->state = VACUUM_WORKER_STATE::VACUUM_WORKER_STATE_EXECUTE;
+    }
+
+    void on_retire (cubthread::entry & context) final
+    {
+      context.retire_system_worker ();
+
+      if (context.vacuum_worker != NULL)
+	{
+	  context.vacuum_worker->state = VACUUM_WORKER_STATE::VACUUM_WORKER_STATE_INACTIVE;
+	  m_pool->retire (*context.vacuum_worker);
+	  context.vacuum_worker = NULL;
+	}
+      else
+	{
+	  assert (false);
+	}
+    }
+
+    void on_recycle (cubthread::entry & context) final
+    {
+      // reset tran_index (it is recycled as NULL_TRAN_INDEX)
+      context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+    }
+
+    // members
+    resource_shared_pool<VACUUM_WORKER>* m_pool;
+};
+
+// class vacuum_heap_parallel_job
+//
+//  description:
+//    heap objects of one log block, sorted and split in parts of whole heap pages. parts are claimed and vacuumed by
+//    the worker owning the objects and by heap helpers. the worker claims parts too, so the job is completed even if
+//    helpers are busy or stopped. the worker must wait for all claimed parts before releasing its objects.
+//
+class vacuum_heap_parallel_job
+{
+  public:
+    vacuum_heap_parallel_job (VACUUM_HEAP_OBJECT * heap_objects, std::vector<int> &&part_bounds,
+			      MVCCID threshold_mvccid, bool was_interrupted)
+      : m_heap_objects (heap_objects)
+      , m_part_bounds (std::move (part_bounds))
+      , m_threshold_mvccid (threshold_mvccid)
+      , m_was_interrupted (was_interrupted)
+      , m_mutex ()
+      , m_cond ()
+      , m_next_part (0)
+      , m_running_count (0)
+      , m_is_stopped (false)
+      , m_failed_parts ()
+    {
+    }
+
+    size_t get_part_count () const
+    {
+      return m_part_bounds.size () - 1;
+    }
+
+    // claim and vacuum parts until none is left. helper failures are saved to be retried by worker.
+    int execute_parts (cubthread::entry & thread_ref, bool is_helper)
+    {
+      size_t part;
+      int error_code = NO_ERROR;
+
+      while (claim_part (part))
+	{
+	  error_code = vacuum_heap_objects (&thread_ref, m_heap_objects + m_part_bounds[part],
+					    m_part_bounds[part + 1] - m_part_bounds[part], m_threshold_mvccid,
+					    m_was_interrupted);
+	  finish_part (part, error_code, is_helper);
+	  if (error_code != NO_ERROR)
+	    {
+	      if (is_helper)
+		{
+		  // the part is retried by worker
+		  er_clear ();
+		  error_code = NO_ERROR;
+		}
+	      break;
+	    }
+	}
+      return error_code;
+    }
+
+    // worker only: stop claiming and wait for the parts claimed by helpers
+    void wait_helpers ()
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+
+      m_is_stopped = true;
+      m_cond.wait (ulock, [this] { return m_running_count == 0; });
+    }
+
+    // worker only: vacuum again the parts helpers failed; call after wait_helpers
+    int retry_failed_parts (cubthread::entry & thread_ref)
+    {
+      int error_code = NO_ERROR;
+
+      for (size_t part : m_failed_parts)
+	{
+	  // part may be partially vacuumed
+	  error_code = vacuum_heap_objects (&thread_ref, m_heap_objects + m_part_bounds[part],
+					    m_part_bounds[part + 1] - m_part_bounds[part], m_threshold_mvccid, true);
+	  if (error_code != NO_ERROR)
+	    {
+	      break;
+	    }
+	}
+      return error_code;
+    }
+
+  private:
+    bool claim_part (size_t &part)
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      if (m_is_stopped || m_next_part >= get_part_count ())
+	{
+	  return false;
+	}
+      part = m_next_part++;
+      m_running_count++;
+      return true;
+    }
+
+    void finish_part (size_t part, int error_code, bool is_helper)
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      if (error_code != NO_ERROR)
+	{
+	  if (is_helper)
+	    {
+	      m_failed_parts.push_back (part);
+	    }
+	  else
+	    {
+	      // worker gives up; no more parts are claimed
+	      m_is_stopped = true;
+	    }
+	}
+      if (--m_running_count == 0)
+	{
+	  m_cond.notify_all ();
+	}
+    }
+
+    VACUUM_HEAP_OBJECT *m_heap_objects;     // sorted heap objects, owned by worker
+    std::vector<int> m_part_bounds;         // part i has objects [m_part_bounds[i], m_part_bounds[i + 1])
+    MVCCID m_threshold_mvccid;
+    bool m_was_interrupted;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    size_t m_next_part;                     // next part to claim
+    size_t m_running_count;                 // claimed parts being vacuumed
+    bool m_is_stopped;                      // no more parts can be claimed
+    std::vector<size_t> m_failed_parts;     // parts helpers could not vacuum
+};
+
+// class vacuum_heap_helper_task
+//
+//  description:
+//    heap helper task; vacuums parts of a parallel job
+//
+class vacuum_heap_helper_task : public cubthread::entry_task
+{
+  public:
+    vacuum_heap_helper_task (const std::shared_ptr<vacuum_heap_parallel_job> &job)
+      : m_job (job)
+    {
+    }
+
+    void execute (cubthread::entry & thread_ref) final
+    {
+      (void) m_job->execute_parts (thread_ref, true);
+    }
+
+  private:
+    vacuum_heap_helper_task ();
+
+    // job is shared because the task may run after worker has finished the job
+    std::shared_ptr<vacuum_heap_parallel_job> m_job;
+};
+#endif // SERVER_MODE
+
 // vacuum master globals
 static cubthread::daemon *vacuum_Master_daemon = NULL;                       // daemon thread
 static vacuum_master_context_manager *vacuum_Master_context_manager = NULL;  // context manager
@@ -926,6 +1173,12 @@ static vacuum_master_context_manager *vacuum_Master_context_manager = NULL;  //
 static cubthread::entry_workpool *vacuum_Worker_threads = NULL;              // thread pool
 static vacuum_worker_context_manager *vacuum_Worker_context_manager = NULL;  // context manager
 
+#if defined (SERVER_MODE)
+// vacuum heap helper globals
+static cubthread::entry_workpool *vacuum_Heap_helper_threads = NULL;                  // thread pool
+static vacuum_heap_helper_context_manager *vacuum_Heap_helper_context_manager = NULL; // context manager
+#endif // SERVER_MODE
+
 /* *INDENT-ON* */
 
 #if defined (SA_MODE)
@@ -1196,6 +1449,23 @@ vacuum_initialize (THREAD_ENTRY * thread_p, int vacuum_log_block_npages, VFID *
       vacuum_Workers[i].allocated_resources = false;
     }
 
+  /* Initialize heap helpers */
+  for (i = 0; i < VACUUM_MAX_HEAP_HELPER_COUNT; i++)
+    {
+      vacuum_Heap_helpers[i].drop_files_version = 0;
+      vacuum_Heap_helpers[i].state = VACUUM_WORKER_STATE_INACTIVE;
+      vacuum_Heap_helpers[i].log_zip_p = NULL;
+      vacuum_Heap_helpers[i].undo_data_buffer = NULL;
+      vacuum_Heap_helpers[i].undo_data_buffer_capacity = 0;
+      vacuum_Heap_helpers[i].private_lru_index = -1;
+      vacuum_Heap_helpers[i].heap_objects = NULL;
+      vacuum_Heap_helpers[i].heap_objects_capacity = 0;
+      vacuum_Heap_helpers[i].prefetch_log_buffer = NULL;
+      vacuum_Heap_helpers[i].prefetch_first_pageid = NULL_PAGEID;
+      vacuum_Heap_helpers[i].prefetch_last_pageid = NULL_PAGEID;
+      vacuum_Heap_helpers[i].allocated_resources = false;
+    }
+
   return NO_ERROR;
 
 error:
@@ -1259,6 +1529,17 @@ vacuum_boot (THREAD_ENTRY * thread_p)
 					vacuum_Worker_context_manager, 1, log_vacuum_worker_pool);
   assert (vacuum_Worker_threads != NULL);
 
+  // create heap helpers pool; without helpers, each block is vacuumed by one worker
+  int heap_helper_count = prm_get_integer_value (PRM_ID_VACUUM_HEAP_HELPER_COUNT);
+  if (heap_helper_count > 0)
+    {
+      vacuum_Heap_helper_context_manager = new vacuum_heap_helper_context_manager ();
+      vacuum_Heap_helper_threads =
+	thread_manager->create_worker_pool (heap_helper_count, VACUUM_MAX_TASKS_IN_WORKER_POOL, "vacuum heap helpers",
+					    vacuum_Heap_helper_context_manager, 1, log_vacuum_worker_pool);
+      assert (vacuum_Heap_helper_threads != NULL);
+    }
+
   int vacuum_master_wakeup_interval_msec = prm_get_integer_value (PRM_ID_VACUUM_MASTER_WAKEUP_INTERVAL);
   cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (vacuum_master_wakeup_interval_msec));
 
@@ -1299,6 +1580,18 @@ vacuum_stop_workers (THREAD_ENTRY * thread_p)
 
   delete vacuum_Worker_context_manager;
   vacuum_Worker_context_manager = NULL;
+
+#if defined (SERVER_MODE)
+  // workers are stopped and no longer wait for helpers
+  if (vacuum_Heap_helper_threads != NULL)
+    {
+      vacuum_Heap_helper_threads->stop_execution ();
+      cubthread::get_manager ()->destroy_worker_pool (vacuum_Heap_helper_threads);
+    }
+
+  delete vacuum_Heap_helper_context_manager;
+  vacuum_Heap_helper_context_manager = NULL;
+#endif // SERVER_MODE
 }
 
 void
@@ -1400,22 +1693,13 @@ vacuum_finalize (THREAD_ENTRY * thread_p)
  *
  * return		 : Error code.
  * thread_p (in)	 : Thread entry.
- * heap_objects (in)	 : Array of heap objects (VFID & OID).
- * n_heap_objects (in)	 : Number of heap objects.
+ * worker (in)		 : Vacuum worker with the heap objects (VFID & OID) collected from log block.
  * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
  * was_interrutped (in)  : True if same job was executed and interrupted.
  */
 static int
 vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
 {
-  VACUUM_HEAP_OBJECT *page_ptr;
-  VACUUM_HEAP_OBJECT *obj_ptr;
-  int error_code = NO_ERROR;
-  VFID vfid = VFID_INITIALIZER;
-  HFID hfid = HFID_INITIALIZER;
-  bool reusable = false;
-  int object_count = 0;
-
   if (worker->n_heap_objects == 0)
     {
       return NO_ERROR;
@@ -1429,8 +1713,41 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
    * each different heap page. */
   qsort (worker->heap_objects, worker->n_heap_objects, sizeof (VACUUM_HEAP_OBJECT), vacuum_compare_heap_object);
 
+#if defined (SERVER_MODE)
+  if (vacuum_Heap_helper_threads != NULL && worker->n_heap_objects >= 2 * VACUUM_HEAP_PARALLEL_MIN_PART_PAGES)
+    {
+      return vacuum_heap_parallel (thread_p, worker, threshold_mvccid, was_interrupted);
+    }
+#endif /* SERVER_MODE */
+
+  return vacuum_heap_objects (thread_p, worker->heap_objects, worker->n_heap_objects, threshold_mvccid,
+			      was_interrupted);
+}
+
+/*
+ * vacuum_heap_objects () - Vacuum sorted heap objects page by page.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * heap_objects (in)	 : Array of heap objects (VFID & OID), sorted by vacuum_compare_heap_object.
+ * n_heap_objects (in)	 : Number of heap objects.
+ * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
+ * was_interrutped (in)  : True if same job was executed and interrupted.
+ */
+static int
+vacuum_heap_objects (THREAD_ENTRY * thread_p, VACUUM_HEAP_OBJECT * heap_objects, int n_heap_objects,
+		     MVCCID threshold_mvccid, bool was_interrupted)
+{
+  VACUUM_HEAP_OBJECT *page_ptr;
+  VACUUM_HEAP_OBJECT *obj_ptr;
+  int error_code = NO_ERROR;
+  VFID vfid = VFID_INITIALIZER;
+  HFID hfid = HFID_INITIALIZER;
+  bool reusable = false;
+  int object_count = 0;
+
   /* Start parsing array. Vacuum objects page by page. */
-  for (page_ptr = worker->heap_objects; page_ptr < worker->heap_objects + worker->n_heap_objects;)
+  for (page_ptr = heap_objects; page_ptr < heap_objects + n_heap_objects;)
     {
       if (!VFID_EQ (&vfid, &page_ptr->vfid))
 	{
@@ -1442,7 +1759,7 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
       /* Find all objects for this page. */
       object_count = 1;
       for (obj_ptr = page_ptr + 1;
-	   obj_ptr < worker->heap_objects + worker->n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
+	   obj_ptr < heap_objects + n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
 	   && obj_ptr->oid.volid == page_ptr->oid.volid; obj_ptr++)
 	{
 	  object_count++;
@@ -1464,6 +1781,7 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
 	      // debug crashes; but can release do about it? just try to clean as much as possible
 	      er_clear ();
 	      error_code = NO_ERROR;
+	      page_ptr = obj_ptr;
 	      continue;
 	    }
 #endif // not DEBUG
@@ -1476,6 +1794,93 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
   return NO_ERROR;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * vacuum_heap_parallel () - Vacuum sorted heap objects of worker together with heap helpers.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * worker (in)		 : Vacuum worker with sorted heap objects.
+ * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
+ * was_interrutped (in)  : True if same job was executed and interrupted.
+ *
+ * NOTE: Objects are split in parts of whole heap pages, so no page is vacuumed by two threads.
+ */
+static int
+vacuum_heap_parallel (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
+{
+  VACUUM_HEAP_OBJECT *objects = worker->heap_objects;
+  int n_objects = worker->n_heap_objects;
+  int helper_count = prm_get_integer_value (PRM_ID_VACUUM_HEAP_HELPER_COUNT);
+  int max_parts = (helper_count + 1) * VACUUM_HEAP_PARALLEL_PARTS_PER_THREAD;
+  int n_pages = 1;
+  int part_pages;
+  int part_page_count;
+  int i;
+  int error_code = NO_ERROR;
+
+  for (i = 1; i < n_objects; i++)
+    {
+      if (!VPID_EQ_FOR_OIDS (&objects[i].oid, &objects[i - 1].oid))
+	{
+	  n_pages++;
+	}
+    }
+  if (n_pages < 2 * VACUUM_HEAP_PARALLEL_MIN_PART_PAGES)
+    {
+      return vacuum_heap_objects (thread_p, objects, n_objects, threshold_mvccid, was_interrupted);
+    }
+
+  part_pages = MAX (VACUUM_HEAP_PARALLEL_MIN_PART_PAGES, CEIL_PTVDIV (n_pages, max_parts));
+
+  /* *INDENT-OFF* */
+  std::vector<int> part_bounds;
+  /* *INDENT-ON* */
+  part_bounds.push_back (0);
+  part_page_count = 1;
+  for (i = 1; i < n_objects; i++)
+    {
+      if (VPID_EQ_FOR_OIDS (&objects[i].oid, &objects[i - 1].oid))
+	{
+	  continue;
+	}
+      if (part_page_count == part_pages)
+	{
+	  part_bounds.push_back (i);
+	  part_page_count = 0;
+	}
+      part_page_count++;
+    }
+  part_bounds.push_back (n_objects);
+
+  /* *INDENT-OFF* */
+  std::shared_ptr<vacuum_heap_parallel_job> job =
+    std::make_shared<vacuum_heap_parallel_job> (objects, std::move (part_bounds), threshold_mvccid, was_interrupted);
+  /* *INDENT-ON* */
+
+  vacuum_er_log (VACUUM_ER_LOG_HEAP | VACUUM_ER_LOG_WORKER, "vacuum %d objects in %d pages split in %zu parts",
+		 n_objects, n_pages, job->get_part_count ());
+
+  /* the worker vacuums a part too */
+  helper_count = MIN (helper_count, (int) job->get_part_count () - 1);
+  for (i = 0; i < helper_count; i++)
+    {
+      vacuum_Heap_helper_threads->execute (new vacuum_heap_helper_task (job));
+    }
+
+  error_code = job->execute_parts (*thread_p, false);
+
+  /* objects must not be released while helpers still vacuum them */
+  job->wait_helpers ();
+  if (error_code == NO_ERROR)
+    {
+      error_code = job->retry_failed_parts (*thread_p);
+    }
+
+  return error_code;
+}
+#endif /* SERVER_MODE */
+
 /*
  * vacuum_heap_page () - Vacuum objects in one heap page.
  *
@@ -2944,6 +3349,13 @@ vacuum_master_task::execute (cubthread::entry &thread_ref)
   pgbuf_flush_if_requested (&thread_ref, (PAGE_PTR) vacuum_Data.last_page);
 
   m_cursor.force_data_update ();
+
+  VACUUM_LOG_BLOCKID oldest_blockid;
+  INT64 num_pending_blocks, age_log_pages;
+  vacuum_get_lag (&oldest_blockid, &num_pending_blocks, &age_log_pages);
+  perfmon_set_stat (&thread_ref, PSTAT_VAC_NUM_PENDING_BLOCKS, (int) num_pending_blocks, false);
+  perfmon_set_stat (&thread_ref, PSTAT_VAC_OLDEST_BLOCK_AGE_LOG_PAGES, (int) age_log_pages, false);
+
   vacuum_er_log (VACUUM_ER_LOG_MASTER | VACUUM_ER_LOG_JOBS, "Start searching jobs at " vacuum_job_cursor_print_format,
                  vacuum_job_cursor_print_args (m_cursor));
   for (; m_cursor.is_valid () && !should_interrupt_iteration (); m_cursor.increment_blockid ())
@@ -3146,6 +3558,10 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
 
   PERF_UTIME_TRACKER perf_tracker;
   PERF_UTIME_TRACKER job_time_tracker;
+  TSC_TICKS job_start_tick, start_tick, end_tick;
+  UINT64 elapsed_usecs;
+  UINT64 btree_usecs = 0;
+  UINT64 num_log_records = 0;
 #if defined (SA_MODE)
   bool dummy_continue_check = false;
 #endif /* SA_MODE */
@@ -3162,6 +3578,7 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
 
   PERF_UTIME_TRACKER_START (thread_p, &perf_tracker);
   PERF_UTIME_TRACKER_START (thread_p, &job_time_tracker);
+  tsc_getticks (&job_start_tick);
 
   /* Initialize log_vacuum */
   LSA_SET_NULL (&log_vacuum.prev_mvcc_op_log_lsa);
@@ -3252,6 +3669,7 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
 
       worker->state = VACUUM_WORKER_STATE_EXECUTE;
       PERF_UTIME_TRACKER_TIME_AND_RESTART (thread_p, &perf_tracker, PSTAT_VAC_WORKER_PROCESS_LOG);
+      num_log_records++;
 
       if (is_file_dropped)
 	{
@@ -3302,6 +3720,8 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
 
 	  assert (undo_data != NULL);
 
+	  tsc_getticks (&start_tick);
+
 	  if (log_record_data.rcvindex == RVBT_MVCC_INSERT_OBJECT_UNQ)
 	    {
 	      btree_rv_read_keybuf_two_objects (thread_p, undo_data, undo_data_size, &btid_int, &old_version,
@@ -3398,6 +3818,9 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
 	      error_code = NO_ERROR;
 	      /* Release should not stop. Continue. */
 	    }
+
+	  tsc_getticks (&end_tick);
+	  btree_usecs += tsc_elapsed_utime (end_tick, start_tick);
 	}
       else if (log_record_data.rcvindex == RVES_NOTIFY_VACUUM)
 	{
@@ -3428,7 +3851,12 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
   assert (worker->state == VACUUM_WORKER_STATE_EXECUTE);
   assert (!LOG_FIND_CURRENT_TDES (thread_p)->is_under_sysop ());
 
+  tsc_getticks (&start_tick);
   error_code = vacuum_heap (thread_p, worker, threshold_mvccid, was_interrupted);
+  tsc_getticks (&end_tick);
+  elapsed_usecs = tsc_elapsed_utime (end_tick, start_tick);
+  vacuum_Stats.heap_usecs += elapsed_usecs;
+  perfmon_time_stat (thread_p, PSTAT_VAC_HEAP, elapsed_usecs);
   if (error_code != NO_ERROR)
     {
       vacuum_check_shutdown_interruption (thread_p, error_code);
@@ -3463,6 +3891,16 @@ end:
   PERF_UTIME_TRACKER_TIME_AND_RESTART (thread_p, &perf_tracker, PSTAT_VAC_WORKER_EXECUTE);
   PERF_UTIME_TRACKER_TIME (thread_p, &job_time_tracker, PSTAT_VAC_JOB);
 
+  tsc_getticks (&end_tick);
+  vacuum_Stats.job_usecs += tsc_elapsed_utime (end_tick, job_start_tick);
+  vacuum_Stats.num_log_records += num_log_records;
+  vacuum_Stats.btree_usecs += btree_usecs;
+  perfmon_add_stat (thread_p, PSTAT_VAC_NUM_PROCESSED_LOG_RECORDS, (int) num_log_records);
+  if (btree_usecs > 0)
+    {
+      perfmon_time_stat (thread_p, PSTAT_VAC_BTREE, btree_usecs);
+    }
+
   return error_code;
 }
 
@@ -5598,6 +6036,125 @@ vacuum_is_safe_to_remove_archives (void)
   return vacuum_Data.is_archive_removal_safe;
 }
 
+/*
+ * vacuum_get_lag () - Get how far vacuum is behind the log.
+ *
+ * return		   : Void.
+ * oldest_blockid (out)	   : First block not vacuumed yet.
+ * num_pending_blocks (out) : Blocks from first not vacuumed to last logged. Blocks in between may be vacuumed already.
+ * age_log_pages (out)	   : Log pages between first page kept for vacuum and the end of flushed log.
+ *
+ * NOTE: Values are read without synchronization and may be slightly outdated.
+ */
+static void
+vacuum_get_lag (VACUUM_LOG_BLOCKID * oldest_blockid, INT64 * num_pending_blocks, INT64 * age_log_pages)
+{
+  LOG_PAGEID keep_from_log_pageid = vacuum_Data.keep_from_log_pageid;
+  VACUUM_LOG_BLOCKID last_blockid = vacuum_Data.get_last_blockid ();
+  LOG_PAGEID nxio_pageid = log_Gl.append.get_nxio_lsa ().pageid;
+
+  *oldest_blockid = VACUUM_NULL_LOG_BLOCKID;
+  *num_pending_blocks = 0;
+  *age_log_pages = 0;
+
+  if (keep_from_log_pageid == NULL_PAGEID || vacuum_Data.log_block_npages == 0)
+    {
+      /* not loaded yet */
+      return;
+    }
+
+  *oldest_blockid = vacuum_get_log_blockid (keep_from_log_pageid);
+  if (last_blockid != VACUUM_NULL_LOG_BLOCKID && last_blockid >= *oldest_blockid)
+    {
+      *num_pending_blocks = last_blockid - *oldest_blockid + 1;
+    }
+  if (nxio_pageid > keep_from_log_pageid)
+    {
+      *age_log_pages = nxio_pageid - keep_from_log_pageid;
+    }
+}
+
+/*
+ * vacuum_status_start_scan () - start scan function for show vacuum status
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type(in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ */
+int
+vacuum_status_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  DB_VALUE *vals = NULL;
+  VACUUM_LOG_BLOCKID oldest_blockid;
+  INT64 num_pending_blocks, age_log_pages;
+  UINT64 num_log_records, job_usecs;
+  int num_active_workers = 0;
+  int i, idx = 0;
+  const int num_cols = 13;
+
+  *ptr = NULL;
+
+  ctx = showstmt_alloc_array_context (thread_p, 1, num_cols);
+  if (ctx == NULL)
+    {
+      return er_errid ();
+    }
+
+  vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+  if (vals == NULL)
+    {
+      showstmt_free_array_context (thread_p, ctx);
+      return er_errid ();
+    }
+
+  for (i = 0; i < VACUUM_MAX_WORKER_COUNT; i++)
+    {
+      if (vacuum_Workers[i].state != VACUUM_WORKER_STATE_INACTIVE)
+	{
+	  num_active_workers++;
+	}
+    }
+  vacuum_get_lag (&oldest_blockid, &num_pending_blocks, &age_log_pages);
+  num_log_records = vacuum_Stats.num_log_records;
+  job_usecs = vacuum_Stats.job_usecs;
+
+  /* Num_workers */
+  db_make_int (&vals[idx++], prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT));
+  /* Num_active_workers */
+  db_make_int (&vals[idx++], num_active_workers);
+  /* Last_blockid */
+  db_make_bigint (&vals[idx++], vacuum_Data.get_last_blockid ());
+  /* Oldest_unvacuumed_blockid */
+  db_make_bigint (&vals[idx++], oldest_blockid);
+  /* Num_blocks_pending */
+  db_make_bigint (&vals[idx++], num_pending_blocks);
+  /* Oldest_block_age_log_pages */
+  db_make_bigint (&vals[idx++], age_log_pages);
+  /* Keep_from_log_pageid */
+  db_make_bigint (&vals[idx++], vacuum_Data.keep_from_log_pageid);
+  /* Oldest_unvacuumed_mvccid */
+  db_make_bigint (&vals[idx++], (DB_BIGINT) vacuum_Data.oldest_unvacuumed_mvccid);
+  /* Num_log_records */
+  db_make_bigint (&vals[idx++], (DB_BIGINT) num_log_records);
+  /* Worker_records_per_sec: records processed by a worker in a second of work */
+  db_make_double (&vals[idx++], job_usecs > 0 ? (double) num_log_records * 1000000 / job_usecs : 0);
+  /* Heap_time_msecs */
+  db_make_bigint (&vals[idx++], (DB_BIGINT) (vacuum_Stats.heap_usecs / 1000));
+  /* Btree_time_msecs */
+  db_make_bigint (&vals[idx++], (DB_BIGINT) (vacuum_Stats.btree_usecs / 1000));
+  /* Num_archive_log_pages */
+  db_make_bigint (&vals[idx++], (DB_BIGINT) vacuum_Stats.num_archive_log_pages);
+
+  assert (idx == num_cols);
+
+  *ptr = ctx;
+  return NO_ERROR;
+}
+
 /*
  * vacuum_rv_redo_start_job () - Redo start vacuum job.
  *
@@ -7025,6 +7582,12 @@ vacuum_log_prefetch_vacuum_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * e
        log_pageid <= worker->prefetch_last_pageid;
        log_pageid++, log_page = (LOG_PAGE *) (((char *) log_page) + LOG_PAGESIZE))
     {
+      if (logpb_is_page_in_archive (log_pageid))
+	{
+	  /* vacuum is behind archiving */
+	  vacuum_Stats.num_archive_log_pages++;
+	  perfmon_inc_stat (thread_p, PSTAT_VAC_NUM_ARCHIVE_LOG_PAGES);
+	}
       req_lsa.pageid = log_pageid;
       error = logpb_fetch_page (thread_p, &req_lsa, LOG_CS_SAFE_READER, log_page);
       if (error != NO_ERROR)
@@ -25,9 +25,12 @@
 
 #include "xasl_cache.h"
 
-#include "binaryheap.h"
 #include "compile_context.h"
 #include "config.h"
+#include "file_io.h"
+#include "heap_file.h"
+#include "log_impl.h"
+#include "release_string.h"
 #include "system_parameter.h"
 #include "list_file.h"
 #include "perf_monitor.h"
@@ -42,6 +45,7 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <new>
 
 #define XCACHE_ENTRY_MARK_DELETED	    ((INT32) 0x80000000)
 #define XCACHE_ENTRY_TO_BE_RECOMPILED	    ((INT32) 0x40000000)
@@ -82,8 +86,17 @@ struct xcache_stats
   INT64 rt_checks;
   INT64 rt_true;
 };
-#define XCACHE_STATS_INITIALIZER { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
 
+/* xcache statistics are striped by thread index, so concurrent threads do not increment the same cache lines. */
+#define XCACHE_STATS_STRIPE_COUNT 32
+#define XCACHE_STATS_STRIPE_SIZE 128
+
+typedef struct xcache_stats_stripe XCACHE_STATS_STRIPE;
+struct xcache_stats_stripe
+{
+  XCACHE_STATS stats;
+  char padding[XCACHE_STATS_STRIPE_SIZE - sizeof (XCACHE_STATS)];
+};
 
 typedef struct xcache_cleanup_candidate XCACHE_CLEANUP_CANDIDATE;
 struct xcache_cleanup_candidate
@@ -92,6 +105,45 @@ struct xcache_cleanup_candidate
   struct timeval time_last_used;
 };
 
+// *INDENT-OFF*
+using xcache_clone_stack_type = lockfree::stack<XASL_CLONE>;
+using xcache_clone_freelist_type = xcache_clone_stack_type::freelist_type;
+// *INDENT-ON*
+
+/* Saved XASL cache file. The file is only meant to be read back by the same server build on the same database, so
+ * everything is written in host format. Each entry is followed by its related objects, its SQL texts and its XASL
+ * stream. Related classes are saved with a fingerprint of their class record; an entry whose classes were changed
+ * since it was saved is not loaded back.
+ */
+#define XCACHE_FILE_MAGIC "CUBRID XASL cache"
+#define XCACHE_FILE_MAX_TEXT_LENGTH (64 * ONE_M)
+
+typedef struct xcache_file_header XCACHE_FILE_HEADER;
+struct xcache_file_header
+{
+  char magic[32];
+  char build_number[REL_MAX_VERSION_LENGTH];
+  INT64 db_creation;
+};
+
+typedef struct xcache_file_entry XCACHE_FILE_ENTRY;
+struct xcache_file_entry
+{
+  SHA1Hash sha1;
+  int n_related_objects;
+  int sql_hash_text_len;	/* text lengths include the terminating null; 0 if there is no text */
+  int sql_user_text_len;
+  int sql_plan_text_len;
+  int stream_size;
+};
+
+typedef struct xcache_file_related_object XCACHE_FILE_RELATED_OBJECT;
+struct xcache_file_related_object
+{
+  XCACHE_RELATED_OBJECT object;
+  SHA1Hash fingerprint;		/* class record fingerprint; zero for serials */
+};
+
 // *INDENT-OFF*
 using xcache_hashmap_type = cubthread::lockfree_hashmap<xasl_id, xasl_cache_ent>;
 using xcache_hashmap_iterator = xcache_hashmap_type::iterator;
@@ -110,10 +162,11 @@ struct xcache
   bool logging_enabled;
   int max_clones;
   INT32 cleanup_flag;
-  BINARY_HEAP *cleanup_bh;
   XCACHE_CLEANUP_CANDIDATE *cleanup_array;
+  INT64 *cleanup_sample;
+  xcache_clone_freelist_type *clone_freelist;
 
-  XCACHE_STATS stats;
+  XCACHE_STATS_STRIPE stats[XCACHE_STATS_STRIPE_COUNT];
 
   // *INDENT-OFF*
   xcache ()
@@ -126,9 +179,10 @@ struct xcache
     , logging_enabled (false)
     , max_clones (0)
     , cleanup_flag (0)
-    , cleanup_bh (NULL)
     , cleanup_array (NULL)
-    , stats XCACHE_STATS_INITIALIZER
+    , cleanup_sample (NULL)
+    , clone_freelist (NULL)
+    , stats ()
   {
   }
   // *INDENT-ON*
@@ -146,12 +200,14 @@ XCACHE xcache_Global;
 #define xcache_Log xcache_Global.logging_enabled
 #define xcache_Max_clones xcache_Global.max_clones
 #define xcache_Cleanup_flag xcache_Global.cleanup_flag
-#define xcache_Cleanup_bh xcache_Global.cleanup_bh
 #define xcache_Cleanup_array xcache_Global.cleanup_array
+#define xcache_Cleanup_sample xcache_Global.cleanup_sample
+#define xcache_Clone_freelist xcache_Global.clone_freelist
 
 /* Statistics */
-#define XCACHE_STAT_GET(name) ATOMIC_LOAD_64 (&xcache_Global.stats.name)
-#define XCACHE_STAT_INC(name) ATOMIC_INC_64 (&xcache_Global.stats.name, 1)
+#define XCACHE_STAT_GET(name) xcache_stat_get (&XCACHE_STATS::name)
+#define XCACHE_STAT_INC(name) \
+  ATOMIC_INC_64 (&xcache_Global.stats[thread_get_current_entry_index () % XCACHE_STATS_STRIPE_COUNT].stats.name, 1)
 
 #define TIME_DIFF_SEC(t1, t2) (t1.tv_sec - t2.tv_sec)
 
@@ -190,9 +246,11 @@ static LF_ENTRY_DESCRIPTOR xcache_Entry_descriptor = {
 
 /* Cleanup */
 #define XCACHE_CLEANUP_RATIO 0.2
-#define XCACHE_CLEANUP_MIN_NUM_ENTRIES 20
-#define XCACHE_CLEANUP_NUM_ENTRIES(capacity) \
-  (MAX ((int) (2 * XCACHE_CLEANUP_RATIO * (capacity)), XCACHE_CLEANUP_MIN_NUM_ENTRIES))
+/* Full cleanup does not sort all entries; it estimates the age of the entries to remove from a random sample. */
+#define XCACHE_CLEANUP_SAMPLE_SIZE 1024
+
+/* Clone freelist */
+#define XCACHE_CLONE_FREELIST_BLOCK_SIZE 256
 
 
 /* Recompile threshold */
@@ -263,12 +321,18 @@ static bool xcache_entry_set_request_recompile_flag (THREAD_ENTRY * thread_p, XA
 						     bool set_flag);
 static void xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone);
 static void xcache_cleanup (THREAD_ENTRY * thread_p);
-static BH_CMP_RESULT xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg);
+static INT64 xcache_cleanup_sample_cutoff (THREAD_ENTRY * thread_p, int cleanup_count);
+static void xcache_entry_decache_clones (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
+// *INDENT-OFF*
+static INT64 xcache_stat_get (INT64 XCACHE_STATS::*member);
+// *INDENT-ON*
 static bool xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
 static void xcache_invalidate_entries (THREAD_ENTRY * thread_p,
 				       bool (*invalidate_check) (XASL_CACHE_ENTRY *, const OID *), const OID * arg);
 static bool xcache_entry_is_related_to_oid (XASL_CACHE_ENTRY * xcache_entry, const OID * related_to_oid);
 static XCACHE_CLEANUP_REASON xcache_need_cleanup (void);
+static int xcache_get_object_fingerprint (THREAD_ENTRY * thread_p, const OID * oid, SHA1Hash * fingerprint);
+static void xcache_make_file_header (XCACHE_FILE_HEADER * header);
 
 /*
  * xcache_initialize () - Initialize XASL cache.
@@ -280,7 +344,6 @@ int
 xcache_initialize (THREAD_ENTRY * thread_p)
 {
   int error_code = NO_ERROR;
-  HL_HEAPID save_heapid;
 
   xcache_Enabled = false;
 
@@ -302,29 +365,35 @@ xcache_initialize (THREAD_ENTRY * thread_p)
   xcache_Hashmap.init (xcache_Ts, THREAD_TS_XCACHE, xcache_Soft_capacity, freelist_block_size, freelist_block_count,
 		       xcache_Entry_descriptor);
 
-  /* Use global heap */
-  save_heapid = db_change_private_heap (thread_p, 0);
   xcache_Cleanup_flag = 0;
-  xcache_Cleanup_bh = bh_create (thread_p, XCACHE_CLEANUP_NUM_ENTRIES (xcache_Soft_capacity),
-				 sizeof (XCACHE_CLEANUP_CANDIDATE), xcache_compare_cleanup_candidates, NULL);
-  (void) db_change_private_heap (thread_p, save_heapid);
-  if (xcache_Cleanup_bh == NULL)
+  xcache_Cleanup_array = (XCACHE_CLEANUP_CANDIDATE *) malloc (xcache_Soft_capacity * sizeof (XCACHE_CLEANUP_CANDIDATE));
+  if (xcache_Cleanup_array == NULL)
     {
       xcache_Hashmap.destroy ();
-      xcache_log_error ("could not init hash table.\n");
-      ASSERT_ERROR_AND_SET (error_code);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      xcache_Soft_capacity * sizeof (XCACHE_CLEANUP_CANDIDATE));
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
       return error_code;
     }
-
-  xcache_Cleanup_array = (XCACHE_CLEANUP_CANDIDATE *) malloc (xcache_Soft_capacity * sizeof (XCACHE_CLEANUP_CANDIDATE));
-  if (xcache_Cleanup_array == NULL)
+  xcache_Cleanup_sample = (INT64 *) malloc (XCACHE_CLEANUP_SAMPLE_SIZE * sizeof (INT64));
+  if (xcache_Cleanup_sample == NULL)
     {
+      xcache_Hashmap.destroy ();
+      free_and_init (xcache_Cleanup_array);
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-	      xcache_Soft_capacity * sizeof (XCACHE_CLEANUP_CANDIDATE));
+	      XCACHE_CLEANUP_SAMPLE_SIZE * sizeof (INT64));
       error_code = ER_OUT_OF_VIRTUAL_MEMORY;
       return error_code;
     }
 
+  if (xcache_uses_clones ())
+    {
+      // *INDENT-OFF*
+      xcache_Clone_freelist = new xcache_clone_freelist_type (cubthread::get_thread_entry_lftransys (),
+							      XCACHE_CLONE_FREELIST_BLOCK_SIZE);
+      // *INDENT-ON*
+    }
+
   /* set last_cleaned_time as current */
   gettimeofday (&xcache_Last_cleaned_time, NULL);
 
@@ -343,8 +412,6 @@ xcache_initialize (THREAD_ENTRY * thread_p)
 void
 xcache_finalize (THREAD_ENTRY * thread_p)
 {
-  HL_HEAPID save_heapid;
-
   if (!xcache_Enabled)
     {
       return;
@@ -353,41 +420,36 @@ xcache_finalize (THREAD_ENTRY * thread_p)
   xcache_check_logging ();
   xcache_log ("finalize.\n");
 
+  /* Entries release their cached clones on uninit; destroy clone freelist after hash map. */
   xcache_Hashmap.destroy ();
 
-  /* Use global heap */
-  save_heapid = db_change_private_heap (thread_p, 0);
-  if (xcache_Cleanup_bh != NULL)
+  if (xcache_Clone_freelist != NULL)
     {
-      bh_destroy (thread_p, xcache_Cleanup_bh);
-      xcache_Cleanup_bh = NULL;
+      delete xcache_Clone_freelist;
+      xcache_Clone_freelist = NULL;
+    }
+  if (xcache_Cleanup_array != NULL)
+    {
+      free_and_init (xcache_Cleanup_array);
+    }
+  if (xcache_Cleanup_sample != NULL)
+    {
+      free_and_init (xcache_Cleanup_sample);
     }
-  (void) db_change_private_heap (thread_p, save_heapid);
 
   xcache_Enabled = false;
 }
 
 // *INDENT-OFF*
 xasl_cache_ent::xasl_cache_ent ()
+  : cache_clones ()
+  , n_cache_clones (0)
 {
-  pthread_mutex_init (&cache_clones_mutex, NULL);
-  init_clone_cache ();
 }
 
 xasl_cache_ent::~xasl_cache_ent ()
 {
-  assert (cache_clones == NULL || cache_clones == &one_clone);
-  pthread_mutex_destroy (&cache_clones_mutex);
-}
-
-void
-xasl_cache_ent::init_clone_cache ()
-{
-  cache_clones = &one_clone;
-  one_clone.xasl = NULL;
-  one_clone.xasl_buf = NULL;
-  cache_clones_capacity = 1;
-  n_cache_clones = 0;
+  assert (n_cache_clones == 0 && cache_clones.is_empty ());
 }
 // *INDENT-ON*
 
@@ -399,14 +461,14 @@ xasl_cache_ent::init_clone_cache ()
 static void *
 xcache_entry_alloc (void)
 {
-  XASL_CACHE_ENTRY *xcache_entry = (XASL_CACHE_ENTRY *) malloc (sizeof (XASL_CACHE_ENTRY));
-  if (xcache_entry == NULL)
+  void *ptr = malloc (sizeof (XASL_CACHE_ENTRY));
+  if (ptr == NULL)
     {
       return NULL;
     }
-  xcache_entry->init_clone_cache ();
-  pthread_mutex_init (&xcache_entry->cache_clones_mutex, NULL);
-  return xcache_entry;
+  // *INDENT-OFF*
+  return new (ptr) xasl_cache_ent ();
+  // *INDENT-ON*
 }
 
 /*
@@ -420,13 +482,9 @@ xcache_entry_free (void *entry)
 {
   XASL_CACHE_ENTRY *xcache_entry = (XASL_CACHE_ENTRY *) entry;
 
-  if (xcache_entry->cache_clones != &xcache_entry->one_clone)
-    {
-      /* Should be already freed? */
-      assert (false);
-      free (xcache_entry->cache_clones);
-    }
-  pthread_mutex_destroy (&xcache_entry->cache_clones_mutex);
+  // *INDENT-OFF*
+  xcache_entry->~xasl_cache_ent ();
+  // *INDENT-ON*
   free (entry);
   return NO_ERROR;
 }
@@ -444,6 +502,7 @@ xcache_entry_init (void *entry)
   /* Add here if anything should be initialized. */
   xcache_entry->related_objects = NULL;
   xcache_entry->ref_count = 0;
+  xcache_entry->list_ht_no = -1;
 
   xcache_entry->sql_info.sql_hash_text = NULL;
   xcache_entry->sql_info.sql_user_text = NULL;
@@ -454,6 +513,7 @@ xcache_entry_init (void *entry)
   xcache_entry->stream.buffer = NULL;
 
   xcache_entry->free_data_on_uninit = false;
+  xcache_entry->warm_loaded = 0;
   xcache_entry->initialized = true;
 
   assert (xcache_entry->n_cache_clones == 0);
@@ -503,26 +563,19 @@ xcache_entry_uninit (void *entry)
 	  free_and_init (xcache_entry->sql_info.sql_hash_text);
 	}
 
+      if (xcache_entry->list_ht_no >= 0)
+	{
+	  /* Release the results cached for this query. */
+	  (void) qfile_clear_list_cache (thread_p, xcache_entry->list_ht_no, true);
+	  xcache_entry->list_ht_no = -1;
+	}
+
       XASL_ID_SET_NULL (&xcache_entry->xasl_id);
 
       /* Free XASL clones. */
       assert (xcache_entry->n_cache_clones == 0
 	      || (xcache_Max_clones > 0 && xcache_entry->n_cache_clones <= xcache_Max_clones));
-      assert (xcache_entry->n_cache_clones == 0 || xcache_entry->cache_clones != NULL);
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
-      if (xcache_entry->cache_clones != &xcache_entry->one_clone)
-	{
-	  /* Free cache clones. */
-	  assert (xcache_entry->cache_clones_capacity > 0);
-	  free (xcache_entry->cache_clones);
-	  xcache_entry->cache_clones = &xcache_entry->one_clone;
-	  xcache_entry->one_clone.xasl = NULL;
-	  xcache_entry->one_clone.xasl_buf = NULL;
-	  xcache_entry->cache_clones_capacity = 1;
-	}
+      xcache_entry_decache_clones (thread_p, xcache_entry);
       if (xcache_entry->stream.buffer != NULL)
 	{
 	  free_and_init (xcache_entry->stream.buffer);
@@ -860,6 +913,13 @@ xcache_find_sha1 (THREAD_ENTRY * thread_p, const SHA1Hash * sha1, const XASL_CAC
     }
 
   assert (*xcache_entry != NULL);
+  if (search_mode == XASL_CACHE_SEARCH_FOR_PREPARE && (*xcache_entry)->warm_loaded != 0
+      && ATOMIC_CAS_32 (&(*xcache_entry)->warm_loaded, 1, 0))
+    {
+      /* First prepare served by an entry loaded at server restart; that is one compilation saved. */
+      perfmon_inc_stat (thread_p, PSTAT_PC_NUM_WARM_HIT);
+    }
+
   xcache_log ("found cache entry by sha1: \n"
 	      XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
 	      XCACHE_LOG_ENTRY_ARGS (*xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
@@ -996,34 +1056,22 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
     {
       use_xasl_clone = true;
       /* Try to fetch a cached clone. */
-      if ((*xcache_entry)->cache_clones == NULL)
+      if (!(*xcache_entry)->cache_clones.is_empty ()
+	  && (*xcache_entry)->cache_clones.pop (*xcache_Clone_freelist, thread_p->get_lf_tran_index (), *xclone))
 	{
-	  assert_release (false);
-	  /* Fall through. */
-	}
-      else
-	{
-	  (void) pthread_mutex_lock (&(*xcache_entry)->cache_clones_mutex);
-	  assert ((*xcache_entry)->n_cache_clones <= xcache_Max_clones);
-	  if ((*xcache_entry)->n_cache_clones > 0)
-	    {
-	      /* A clone is available. */
-	      *xclone = (*xcache_entry)->cache_clones[--(*xcache_entry)->n_cache_clones];
-	      (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
-
-	      assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
-
-	      xcache_log ("found cached clone: \n"
-			  XCACHE_LOG_ENTRY_TEXT ("entry")
-			  XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
-			  XCACHE_LOG_CLONE
-			  XCACHE_LOG_TRAN_TEXT,
-			  XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
-			  XCACHE_LOG_XASL_ID_ARGS (xid),
-			  XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
-	      return NO_ERROR;
-	    }
-	  (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
+	  /* A clone is available. */
+	  ATOMIC_INC_32 (&(*xcache_entry)->n_cache_clones, -1);
+
+	  assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
+
+	  xcache_log ("found cached clone: \n"
+		      XCACHE_LOG_ENTRY_TEXT ("entry")
+		      XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
+		      XCACHE_LOG_CLONE
+		      XCACHE_LOG_TRAN_TEXT,
+		      XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
+		      XCACHE_LOG_XASL_ID_ARGS (xid), XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
+	  return NO_ERROR;
 	}
       /* Clone not found. */
       /* When clones are activated, we use global heap to generate the XASL's; this way, other threads can use the
@@ -1143,11 +1191,8 @@ xcache_unfix (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
       xcache_log ("delete entry from hash after unfix: \n"
 		  XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
 		  XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
-      /* No need to acquire the clone mutex, since I'm the unique user. */
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
+      /* I'm the unique user. */
+      xcache_entry_decache_clones (thread_p, xcache_entry);
 
       if (!xcache_Hashmap.erase (thread_p, xcache_entry->xasl_id))
 	{
@@ -1719,12 +1764,9 @@ xcache_invalidate_entries (THREAD_ENTRY * thread_p, bool (*invalidate_check) (XA
 		{
 		  /*
 		   * Successfully marked for delete. Save it to delete after the iteration.
-		   * No need to acquire the clone mutex, since I'm the unique user.
+		   * I'm the unique user.
 		   */
-		  while (xcache_entry->n_cache_clones > 0)
-		    {
-		      xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-		    }
+		  xcache_entry_decache_clones (thread_p, xcache_entry);
 		  delete_xids[n_delete_xids++] = xcache_entry->xasl_id;
 		}
 	    }
@@ -1804,6 +1846,41 @@ xcache_remove_by_oid (THREAD_ENTRY * thread_p, const OID * oid)
   xcache_invalidate_entries (thread_p, xcache_entry_is_related_to_oid, oid);
 }
 
+/*
+ * xcache_clear_list_cache_by_oid () - Clear the results cached for the XASL cache entries related to given object.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * oid (in)	 : Object ID.
+ *
+ * NOTE: Unlike xcache_remove_by_oid, the XASL cache entries are kept. Only their list caches are cleared.
+ */
+void
+xcache_clear_list_cache_by_oid (THREAD_ENTRY * thread_p, const OID * oid)
+{
+  XASL_CACHE_ENTRY *xcache_entry = NULL;
+
+  if (!xcache_Enabled)
+    {
+      return;
+    }
+
+  xcache_check_logging ();
+
+  xcache_log ("clear list caches: \n"
+	      "\t OID = %d|%d|%d \n" XCACHE_LOG_TRAN_TEXT, OID_AS_ARGS (oid), XCACHE_LOG_TRAN_ARGS (thread_p));
+
+  xcache_hashmap_iterator iter = { thread_p, xcache_Hashmap };
+
+  while ((xcache_entry = iter.iterate ()) != NULL)
+    {
+      if (xcache_entry->list_ht_no >= 0 && xcache_entry_is_related_to_oid (xcache_entry, oid))
+	{
+	  (void) qfile_clear_list_cache (thread_p, xcache_entry->list_ht_no, false);
+	}
+    }
+}
+
 /*
  * xcache_drop_all () - Remove all entries from XASL cache.
  *
@@ -1918,6 +1995,376 @@ xcache_dump (THREAD_ENTRY * thread_p, FILE * fp)
   /* TODO: add more */
 }
 
+/*
+ * xcache_get_object_fingerprint () - Get fingerprint of XASL cache related object. For classes, the fingerprint is
+ *				      SHA-1 of the class record, so any schema change will change it. For other
+ *				      objects (serials) only their existence is checked and fingerprint is zero.
+ *
+ * return	    : Error code.
+ * thread_p (in)    : Thread entry.
+ * oid (in)	    : Related object OID.
+ * fingerprint (out): Object fingerprint.
+ */
+static int
+xcache_get_object_fingerprint (THREAD_ENTRY * thread_p, const OID * oid, SHA1Hash * fingerprint)
+{
+  HEAP_SCANCACHE scan_cache;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID class_oid;
+  int error_code = NO_ERROR;
+
+  memset (fingerprint, 0, sizeof (SHA1Hash));
+
+  if (heap_get_class_oid (thread_p, oid, &class_oid) != S_SUCCESS)
+    {
+      return ER_FAILED;
+    }
+  if (!OID_IS_ROOTOID (&class_oid))
+    {
+      /* Not a class. */
+      return NO_ERROR;
+    }
+
+  (void) heap_scancache_quick_start_root_hfid (thread_p, &scan_cache);
+  if (heap_get_class_record (thread_p, oid, &recdes, &scan_cache, PEEK) != S_SUCCESS)
+    {
+      error_code = ER_FAILED;
+    }
+  else
+    {
+      error_code = SHA1Compute ((unsigned char *) recdes.data, (size_t) recdes.length, fingerprint);
+    }
+  (void) heap_scancache_end (thread_p, &scan_cache);
+
+  return error_code;
+}
+
+/*
+ * xcache_make_file_header () - Make the header of saved XASL cache file for this server and database.
+ *
+ * return      : Void.
+ * header (out) : File header.
+ */
+static void
+xcache_make_file_header (XCACHE_FILE_HEADER * header)
+{
+  memset (header, 0, sizeof (XCACHE_FILE_HEADER));
+  strncpy (header->magic, XCACHE_FILE_MAGIC, sizeof (header->magic) - 1);
+  strncpy (header->build_number, rel_build_number (), sizeof (header->build_number) - 1);
+  header->db_creation = log_Gl.hdr.db_creation;
+}
+
+/*
+ * xcache_save () - Save XASL cache entries to file, to be loaded back on next server restart.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ *
+ * NOTE: Must be called when no transaction can change the schema anymore (at shutdown, after all transactions were
+ *	 aborted); otherwise we could save the fingerprint of an uncommitted class record.
+ */
+void
+xcache_save (THREAD_ENTRY * thread_p)
+{
+  char xcache_name[PATH_MAX];
+  char xcache_temp_name[PATH_MAX];
+  FILE *fp = NULL;
+  XASL_CACHE_ENTRY *xcache_entry = NULL;
+  XCACHE_FILE_HEADER header;
+  XCACHE_FILE_ENTRY file_entry;
+  XCACHE_FILE_RELATED_OBJECT file_object;
+  int oid_index;
+  int n_saved = 0;
+  bool write_error = false;
+
+  if (!xcache_Enabled || !prm_get_bool_value (PRM_ID_XASL_CACHE_PERSIST))
+    {
+      return;
+    }
+
+  xcache_check_logging ();
+
+  fileio_make_xcache_name (xcache_name, log_Path, log_Prefix);
+  snprintf (xcache_temp_name, sizeof (xcache_temp_name), "%s%s", xcache_name, FILEIO_VOLTMP_PREFIX);
+
+  fp = fopen (xcache_temp_name, "wb");
+  if (fp == NULL)
+    {
+      er_log_debug (ARG_FILE_LINE, "xcache_save: cannot create %s (errno = %d).\n", xcache_temp_name, errno);
+      return;
+    }
+
+  xcache_make_file_header (&header);
+  write_error = fwrite (&header, sizeof (header), 1, fp) != 1;
+
+  xcache_hashmap_iterator iter = { thread_p, xcache_Hashmap };
+  while (!write_error && (xcache_entry = iter.iterate ()) != NULL)
+    {
+      if ((xcache_entry->xasl_id.cache_flag & XCACHE_ENTRY_FLAGS_MASK) != 0 || xcache_entry->stream.buffer == NULL
+	  || xcache_entry->sql_info.sql_hash_text == NULL)
+	{
+	  /* Deleted or recompiled entries are not worth saving. */
+	  continue;
+	}
+
+      file_entry.sha1 = xcache_entry->xasl_id.sha1;
+      file_entry.n_related_objects = xcache_entry->n_related_objects;
+      file_entry.sql_hash_text_len = (int) strlen (xcache_entry->sql_info.sql_hash_text) + 1;
+      file_entry.sql_user_text_len =
+	xcache_entry->sql_info.sql_user_text != NULL ? (int) strlen (xcache_entry->sql_info.sql_user_text) + 1 : 0;
+      file_entry.sql_plan_text_len =
+	xcache_entry->sql_info.sql_plan_text != NULL ? (int) strlen (xcache_entry->sql_info.sql_plan_text) + 1 : 0;
+      file_entry.stream_size = xcache_entry->stream.buffer_size;
+
+      if (fwrite (&file_entry, sizeof (file_entry), 1, fp) != 1)
+	{
+	  write_error = true;
+	  break;
+	}
+      for (oid_index = 0; oid_index < xcache_entry->n_related_objects; oid_index++)
+	{
+	  file_object.object = xcache_entry->related_objects[oid_index];
+	  if (xcache_get_object_fingerprint (thread_p, &file_object.object.oid, &file_object.fingerprint) != NO_ERROR)
+	    {
+	      /* Object is gone; entry is saved anyway, and it will be rejected at load. */
+	      er_clear ();
+	    }
+	  if (fwrite (&file_object, sizeof (file_object), 1, fp) != 1)
+	    {
+	      write_error = true;
+	      break;
+	    }
+	}
+      if (write_error
+	  || fwrite (xcache_entry->sql_info.sql_hash_text, 1, file_entry.sql_hash_text_len, fp)
+	  != (size_t) file_entry.sql_hash_text_len
+	  || fwrite (xcache_entry->sql_info.sql_user_text, 1, file_entry.sql_user_text_len, fp)
+	  != (size_t) file_entry.sql_user_text_len
+	  || fwrite (xcache_entry->sql_info.sql_plan_text, 1, file_entry.sql_plan_text_len, fp)
+	  != (size_t) file_entry.sql_plan_text_len
+	  || fwrite (xcache_entry->stream.buffer, 1, file_entry.stream_size, fp) != (size_t) file_entry.stream_size)
+	{
+	  write_error = true;
+	  break;
+	}
+      n_saved++;
+    }
+  if (xcache_entry != NULL)
+    {
+      /* Interrupted iteration. */
+      xcache_Hashmap.end_tran (thread_p);
+    }
+
+  if (fclose (fp) != 0)
+    {
+      write_error = true;
+    }
+  if (write_error || rename (xcache_temp_name, xcache_name) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "xcache_save: cannot write %s (errno = %d).\n", xcache_name, errno);
+      (void) remove (xcache_temp_name);
+      return;
+    }
+
+  xcache_log ("saved %d entries to %s.\n", n_saved, xcache_name);
+}
+
+/*
+ * xcache_load () - Load XASL cache entries saved by last server shutdown. Entries whose related objects were changed
+ *		    or removed meanwhile are rejected.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ *
+ * NOTE: Failing to load the saved entries is not an error; the cache is just filled again by clients.
+ */
+void
+xcache_load (THREAD_ENTRY * thread_p)
+{
+  char xcache_name[PATH_MAX];
+  FILE *fp = NULL;
+  XCACHE_FILE_HEADER header;
+  XCACHE_FILE_HEADER saved_header;
+  XCACHE_FILE_ENTRY file_entry;
+  XCACHE_FILE_RELATED_OBJECT *file_objects = NULL;
+  OID *class_oids = NULL;
+  int *class_locks = NULL;
+  int *tcards = NULL;
+  char *texts = NULL;
+  char *stream_buffer = NULL;
+  XASL_CACHE_ENTRY *xcache_entry = NULL;
+  XASL_ID xid;
+  XASL_STREAM stream;
+  COMPILE_CONTEXT context;
+  SHA1Hash fingerprint;
+  int oid_index;
+  int texts_len;
+  bool is_valid;
+  int n_loaded = 0, n_rejected = 0;
+
+  if (!xcache_Enabled || !prm_get_bool_value (PRM_ID_XASL_CACHE_PERSIST))
+    {
+      return;
+    }
+
+  xcache_check_logging ();
+
+  fileio_make_xcache_name (xcache_name, log_Path, log_Prefix);
+  fp = fopen (xcache_name, "rb");
+  if (fp == NULL)
+    {
+      /* Nothing saved. */
+      return;
+    }
+
+  xcache_make_file_header (&header);
+  if (fread (&saved_header, sizeof (saved_header), 1, fp) != 1
+      || memcmp (saved_header.magic, header.magic, sizeof (header.magic)) != 0
+      || memcmp (saved_header.build_number, header.build_number, sizeof (header.build_number)) != 0
+      || saved_header.db_creation != header.db_creation)
+    {
+      xcache_log ("ignore %s saved for another server or database.\n", xcache_name);
+      fclose (fp);
+      return;
+    }
+
+  while (xcache_Entry_count < xcache_Soft_capacity && fread (&file_entry, sizeof (file_entry), 1, fp) == 1)
+    {
+      if (file_entry.n_related_objects < 0 || file_entry.sql_hash_text_len <= 0
+	  || file_entry.sql_user_text_len < 0 || file_entry.sql_plan_text_len < 0
+	  || file_entry.sql_hash_text_len + file_entry.sql_user_text_len + file_entry.sql_plan_text_len
+	  > XCACHE_FILE_MAX_TEXT_LENGTH || file_entry.stream_size <= 0)
+	{
+	  /* Corrupted file. */
+	  break;
+	}
+
+      texts_len = file_entry.sql_hash_text_len + file_entry.sql_user_text_len + file_entry.sql_plan_text_len;
+      if (file_entry.n_related_objects > 0)
+	{
+	  file_objects =
+	    (XCACHE_FILE_RELATED_OBJECT *) malloc (file_entry.n_related_objects * sizeof (XCACHE_FILE_RELATED_OBJECT));
+	  class_oids = (OID *) malloc (file_entry.n_related_objects * sizeof (OID));
+	  class_locks = (int *) malloc (file_entry.n_related_objects * sizeof (int));
+	  tcards = (int *) malloc (file_entry.n_related_objects * sizeof (int));
+	}
+      texts = (char *) malloc (texts_len);
+      stream_buffer = (char *) malloc (file_entry.stream_size);
+      if (texts == NULL || stream_buffer == NULL
+	  || (file_entry.n_related_objects > 0
+	      && (file_objects == NULL || class_oids == NULL || class_locks == NULL || tcards == NULL)))
+	{
+	  break;
+	}
+
+      if (fread (file_objects, sizeof (XCACHE_FILE_RELATED_OBJECT), file_entry.n_related_objects, fp)
+	  != (size_t) file_entry.n_related_objects
+	  || fread (texts, 1, texts_len, fp) != (size_t) texts_len
+	  || fread (stream_buffer, 1, file_entry.stream_size, fp) != (size_t) file_entry.stream_size)
+	{
+	  /* Corrupted file. */
+	  break;
+	}
+
+      /* Check related objects did not change since entry was saved. */
+      is_valid = true;
+      for (oid_index = 0; oid_index < file_entry.n_related_objects; oid_index++)
+	{
+	  if (xcache_get_object_fingerprint (thread_p, &file_objects[oid_index].object.oid, &fingerprint) != NO_ERROR
+	      || SHA1Compare (&fingerprint, &file_objects[oid_index].fingerprint) != 0)
+	    {
+	      er_clear ();
+	      is_valid = false;
+	      break;
+	    }
+	  class_oids[oid_index] = file_objects[oid_index].object.oid;
+	  class_locks[oid_index] = (int) file_objects[oid_index].object.lock;
+	  tcards[oid_index] = file_objects[oid_index].object.tcard;
+	}
+
+      if (is_valid)
+	{
+	  memset (&context, 0, sizeof (context));
+	  context.sha1 = file_entry.sha1;
+	  context.sql_hash_text = texts;
+	  context.sql_user_text = file_entry.sql_user_text_len > 0 ? texts + file_entry.sql_hash_text_len : NULL;
+	  context.sql_plan_text = (file_entry.sql_plan_text_len > 0
+				   ? texts + file_entry.sql_hash_text_len + file_entry.sql_user_text_len : NULL);
+
+	  XASL_ID_SET_NULL (&xid);
+	  stream.xasl_id = &xid;
+	  stream.xasl_header = NULL;
+	  stream.buffer = stream_buffer;
+	  stream.buffer_size = file_entry.stream_size;
+
+	  if (xcache_insert (thread_p, &context, &stream, file_entry.n_related_objects, class_oids, class_locks,
+			     tcards, &xcache_entry) != NO_ERROR)
+	    {
+	      /* Stop loading, but keep what was loaded so far. */
+	      er_clear ();
+	      stream_buffer = stream.buffer;
+	      break;
+	    }
+	  /* xcache_insert either consumed or freed the stream. */
+	  stream_buffer = NULL;
+	  if (xcache_entry != NULL)
+	    {
+	      xcache_entry->warm_loaded = 1;
+	      xcache_unfix (thread_p, xcache_entry);
+	      xcache_entry = NULL;
+	    }
+	  n_loaded++;
+	  perfmon_inc_stat (thread_p, PSTAT_PC_NUM_WARM_LOAD);
+	}
+      else
+	{
+	  n_rejected++;
+	  perfmon_inc_stat (thread_p, PSTAT_PC_NUM_WARM_REJECT);
+	}
+
+      if (file_objects != NULL)
+	{
+	  free_and_init (file_objects);
+	  free_and_init (class_oids);
+	  free_and_init (class_locks);
+	  free_and_init (tcards);
+	}
+      free_and_init (texts);
+      if (stream_buffer != NULL)
+	{
+	  free_and_init (stream_buffer);
+	}
+    }
+
+  if (file_objects != NULL)
+    {
+      free_and_init (file_objects);
+    }
+  if (class_oids != NULL)
+    {
+      free_and_init (class_oids);
+    }
+  if (class_locks != NULL)
+    {
+      free_and_init (class_locks);
+    }
+  if (tcards != NULL)
+    {
+      free_and_init (tcards);
+    }
+  if (texts != NULL)
+    {
+      free_and_init (texts);
+    }
+  if (stream_buffer != NULL)
+    {
+      free_and_init (stream_buffer);
+    }
+  fclose (fp);
+
+  xcache_log ("loaded %d entries from %s, rejected %d.\n", n_loaded, xcache_name, n_rejected);
+}
+
 /*
  * xcache_can_entry_cache_list () - Can entry cache list files?
  *
@@ -1952,6 +2399,31 @@ xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone)
   (void) db_change_private_heap (thread_p, save_heapid);
 }
 
+/*
+ * xcache_entry_decache_clones () - Free all XASL clones cached by entry.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ */
+static void
+xcache_entry_decache_clones (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
+{
+  XASL_CLONE xclone = XASL_CLONE_INITIALIZER;
+
+  if (xcache_entry->cache_clones.is_empty ())
+    {
+      return;
+    }
+
+  assert (xcache_Clone_freelist != NULL);
+  while (xcache_entry->cache_clones.pop (*xcache_Clone_freelist, thread_p->get_lf_tran_index (), xclone))
+    {
+      ATOMIC_INC_32 (&xcache_entry->n_cache_clones, -1);
+      xcache_clone_decache (thread_p, &xclone);
+    }
+}
+
 /*
  * xcache_retire_clone () - Retire XASL clone. If clones caches are enabled, first try to cache it in xcache_entry.
  *
@@ -1968,53 +2440,15 @@ xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, X
 
   if (xcache_uses_clones ())
     {
-      pthread_mutex_lock (&xcache_entry->cache_clones_mutex);
-      if (xcache_entry->n_cache_clones < xcache_Max_clones)
+      if (ATOMIC_INC_32 (&xcache_entry->n_cache_clones, 1) <= xcache_Max_clones)
 	{
-	  if (xcache_entry->n_cache_clones == xcache_entry->cache_clones_capacity
-	      && xcache_entry->cache_clones_capacity < xcache_Max_clones)
-	    {
-	      /* Extend cache clone buffer. */
-	      XASL_CLONE *new_clones = NULL;
-	      int new_capacity = MIN (xcache_Max_clones, xcache_entry->cache_clones_capacity * 2);
-	      if (xcache_entry->cache_clones == &xcache_entry->one_clone)
-		{
-		  assert (xcache_entry->cache_clones_capacity == 1);
-		  new_clones = (XASL_CLONE *) malloc (new_capacity * sizeof (XASL_CLONE));
-		  if (new_clones != NULL)
-		    {
-		      new_clones[0].xasl = xcache_entry->cache_clones[0].xasl;
-		      new_clones[0].xasl_buf = xcache_entry->cache_clones[0].xasl_buf;
-		    }
-		}
-	      else
-		{
-		  new_clones = (XASL_CLONE *) realloc (xcache_entry->cache_clones, new_capacity * sizeof (XASL_CLONE));
-		}
-	      if (new_clones == NULL)
-		{
-		  /* Out of memory? */
-		  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-			  new_capacity * sizeof (XASL_CLONE));
-		  assert (false);
-		  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
-
-		  /* Free the clone. */
-		  xcache_clone_decache (thread_p, xclone);
-		  return;
-		}
-	      xcache_entry->cache_clones = new_clones;
-	      xcache_entry->cache_clones_capacity = new_capacity;
-	    }
-	  assert (xcache_entry->cache_clones_capacity > xcache_entry->n_cache_clones);
-	  xcache_entry->cache_clones[xcache_entry->n_cache_clones++] = *xclone;
-	  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
+	  xcache_entry->cache_clones.push (*xcache_Clone_freelist, thread_p->get_lf_tran_index (), *xclone);
 
 	  xclone->xasl = NULL;
 	  xclone->xasl_buf = NULL;
 	  return;
 	}
-      pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
+      ATOMIC_INC_32 (&xcache_entry->n_cache_clones, -1);
 
       /* No more room. */
       xcache_clone_decache (thread_p, xclone);
@@ -2044,8 +2478,7 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
   int candidate_index;
   int count;
   int cleanup_count;
-  BINARY_HEAP *bh = NULL;
-  int save_max_capacity = 0;
+  INT64 cutoff_time;
 
   /* We can allow only one cleanup process at a time. There is no point in duplicating this work. Therefore, anyone
    * trying to do the cleanup should first try to set xcache_Cleanup_flag. */
@@ -2084,59 +2517,37 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 	    }
 	  return;
 	}
-      /* Can we use preallocated binary heap? */
-      if (cleanup_count <= xcache_Cleanup_bh->max_capacity)
-	{
-	  bh = xcache_Cleanup_bh;
-	  /* Hack binary heap max capacity to the desired cleanup count. */
-	  save_max_capacity = bh->max_capacity;
-	  bh->max_capacity = cleanup_count;
-	}
-      else
-	{
-	  /* We need a larger binary heap. */
-	  bh =
-	    bh_create (thread_p, cleanup_count, sizeof (XCACHE_CLEANUP_CANDIDATE), xcache_compare_cleanup_candidates,
-		       NULL);
-	  if (bh == NULL)
-	    {
-	      /* Not really expected */
-	      assert (false);
-	      if (!ATOMIC_CAS_32 (&xcache_Cleanup_flag, 1, 0))
-		{
-		  assert_release (false);
-		}
-	      return;
-	    }
-	}
+      cleanup_count = MIN (cleanup_count, xcache_Soft_capacity);
 
       /* The cleanup is a two-step process:
-       * 1. Iterate through hash and select candidates for cleanup. The least recently used entries are sorted into a binary
-       *    heap.
-       *    NOTE: the binary heap does not story references to hash entries; it stores copies from the candidate keys and
-       *    last used timer of course to sort the candidates.
-       * 2. Remove collected candidates from hash. Entries must be unfix and no flags must be set.
+       * 1. Estimate the last used time of the cleanup_count-th oldest entry from a random sample of entries. This
+       *    replaces sorting all entries, which is too expensive for large caches.
+       * 2. Iterate through hash and collect up to cleanup_count entries not used since that time.
+       * The collected candidates are copies of entry keys; they are removed from hash afterwards.
        */
-
-      assert (bh->element_count == 0);
-      bh->element_count = 0;
+      cutoff_time = xcache_cleanup_sample_cutoff (thread_p, cleanup_count);
 
       /* Collect candidates for cleanup. */
+      count = 0;
       while ((xcache_entry = iter.iterate ()) != NULL)
 	{
 	  candidate.xid = xcache_entry->xasl_id;
 	  candidate.time_last_used = xcache_entry->time_last_used;
 
-	  if (candidate.xid.cache_flag & XCACHE_ENTRY_FLAGS_MASK)
+	  if (candidate.xid.cache_flag & XCACHE_ENTRY_FLAGS_MASK || candidate.time_last_used.tv_sec > cutoff_time)
 	    {
-	      /* Either marked for delete or recompile, or already recompiled. Not a valid candidate. */
+	      /* Either marked for delete or recompile, already recompiled or recently used. Not a valid candidate. */
 	      continue;
 	    }
 
-	  (void) bh_try_insert (bh, &candidate, NULL);
+	  xcache_Cleanup_array[count++] = candidate;
+	  if (count == cleanup_count)
+	    {
+	      /* Interrupt iteration. */
+	      xcache_Hashmap.end_tran (thread_p);
+	      break;
+	    }
 	}
-
-      count = bh->element_count;
     }
   else
     {
@@ -2164,15 +2575,7 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
   /* Remove candidates from cache. */
   for (candidate_index = 0; candidate_index < count; candidate_index++)
     {
-      if (need_cleanup == XCACHE_CLEANUP_FULL)	/* binary heap for candidates */
-	{
-	  /* Get candidate at candidate_index. */
-	  bh_element_at (bh, candidate_index, &candidate);
-	}
-      else
-	{
-	  candidate = xcache_Cleanup_array[candidate_index];
-	}
+      candidate = xcache_Cleanup_array[candidate_index];
       /* Set intention to cleanup the entry. */
       candidate.xid.cache_flag = XCACHE_ENTRY_CLEANUP;
 
@@ -2196,23 +2599,6 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 		      XCACHE_LOG_XASL_ID_ARGS (&candidate.xid), XCACHE_LOG_TRAN_ARGS (thread_p));
 	}
     }
-  if (need_cleanup == XCACHE_CLEANUP_FULL)
-    {
-      /* Reset binary heap. */
-      bh->element_count = 0;
-
-      if (bh != xcache_Cleanup_bh)
-	{
-	  /* Destroy bh */
-	  bh_destroy (thread_p, bh);
-	}
-      else
-	{
-	  /* Reset binary heap max capacity. */
-	  xcache_Cleanup_bh->max_capacity = save_max_capacity;
-	}
-    }
-
   xcache_log ("cleanup finished: entries = %d \n"
 	      XCACHE_LOG_TRAN_TEXT, xcache_Entry_count, XCACHE_LOG_TRAN_ARGS (thread_p));
 
@@ -2226,36 +2612,64 @@ xcache_cleanup (THREAD_ENTRY * thread_p)
 }
 
 /*
- * xcache_compare_cleanup_candidates () - Compare cleanup candidates by their time_last_used. Oldest candidates are
- *					  considered "greater".
+ * xcache_cleanup_sample_cutoff () - Estimate the last used time of the oldest entries that should be cleaned up, by
+ *				     sampling the cache.
  *
- * return	   : BH_CMP_RESULT:
- *		     BH_GT if left is older.
- *		     BH_LT if right is older.
- *		     BH_EQ if left and right are equal.
- * left (in)	   : Left XCACHE cleanup candidate.
- * right (in)	   : Right XCACHE cleanup candidate.
- * ignore_arg (in) : Ignored.
+ * return	      : Entries last used at or before this time (seconds) are cleanup candidates.
+ * thread_p (in)      : Thread entry.
+ * cleanup_count (in) : Number of entries to cleanup.
+ *
+ * NOTE: Sampling is done with a reservoir of XCACHE_CLEANUP_SAMPLE_SIZE entries, so every entry has the same chance to
+ *	 be sampled regardless of its position in hash. Only the sample is sorted.
  */
-static BH_CMP_RESULT
-xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg)
+static INT64
+xcache_cleanup_sample_cutoff (THREAD_ENTRY * thread_p, int cleanup_count)
 {
-  struct timeval left_timeval = ((XCACHE_CLEANUP_CANDIDATE *) left)->time_last_used;
-  struct timeval right_timeval = ((XCACHE_CLEANUP_CANDIDATE *) right)->time_last_used;
+  xcache_hashmap_iterator iter = { thread_p, xcache_Hashmap };
+  XASL_CACHE_ENTRY *xcache_entry = NULL;
+  struct timeval now;
+  unsigned int seed;
+  int n_sample = 0;
+  int n_seen = 0;
+  int slot;
+  int cutoff_index;
 
-  /* Lesser means placed in binary heap. So return BH_LT for older timeval. */
-  if (left_timeval.tv_sec < right_timeval.tv_sec)
-    {
-      return BH_LT;
-    }
-  else if (left_timeval.tv_sec == right_timeval.tv_sec)
+  gettimeofday (&now, NULL);
+  seed = (unsigned int) now.tv_usec;
+
+  while ((xcache_entry = iter.iterate ()) != NULL)
     {
-      return BH_EQ;
+      if (xcache_entry->xasl_id.cache_flag & XCACHE_ENTRY_FLAGS_MASK)
+	{
+	  continue;
+	}
+
+      n_seen++;
+      if (n_sample < XCACHE_CLEANUP_SAMPLE_SIZE)
+	{
+	  xcache_Cleanup_sample[n_sample++] = (INT64) xcache_entry->time_last_used.tv_sec;
+	}
+      else
+	{
+	  slot = rand_r (&seed) % n_seen;
+	  if (slot < XCACHE_CLEANUP_SAMPLE_SIZE)
+	    {
+	      xcache_Cleanup_sample[slot] = (INT64) xcache_entry->time_last_used.tv_sec;
+	    }
+	}
     }
-  else
+
+  if (n_sample == 0)
     {
-      return BH_GT;
+      return 0;
     }
+
+  /* The cleanup_count oldest out of n_seen entries are approximated by the same proportion of the sample. */
+  cutoff_index = (int) ((INT64) cleanup_count * n_sample / n_seen);
+  cutoff_index = MIN (MAX (cutoff_index, 0), n_sample - 1);
+  std::nth_element (xcache_Cleanup_sample, xcache_Cleanup_sample + cutoff_index, xcache_Cleanup_sample + n_sample);
+
+  return xcache_Cleanup_sample[cutoff_index];
 }
 
 /*
@@ -2360,6 +2774,26 @@ xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY
   return recompile;
 }
 
+/*
+ * xcache_stat_get () - Sum statistic over all stripes.
+ *
+ * return      : Statistic value.
+ * member (in) : Statistic member of XCACHE_STATS.
+ */
+// *INDENT-OFF*
+static INT64
+xcache_stat_get (INT64 XCACHE_STATS::*member)
+{
+  INT64 value = 0;
+
+  for (int stripe = 0; stripe < XCACHE_STATS_STRIPE_COUNT; stripe++)
+    {
+      value += ATOMIC_LOAD_64 (&(xcache_Global.stats[stripe].stats.*member));
+    }
+  return value;
+}
+// *INDENT-ON*
+
 /*
  * xcache_get_entry_count () - Returns the number of xasl cache entries
  *
@@ -30,6 +30,7 @@
 #error Belongs to server module
 #endif /* !defined (SERVER_MODE) && !defined (SA_MODE) */
 
+#include "lockfree_stack.hpp"
 #include "xasl.h"
 
 // forward definitions
@@ -114,13 +115,13 @@ struct xasl_cache_ent
   int list_ht_no;		/* memory hash table for query result(list file) cache generated by this XASL
 				 * referencing by DB_VALUE parameters bound to the result */
   bool free_data_on_uninit;	/* set to free entry data on uninit. */
+  volatile INT32 warm_loaded;	/* set when entry was loaded from saved XASL cache and was not prepared since */
 
-  /* Cache clones */
-  XASL_CLONE *cache_clones;
-  XASL_CLONE one_clone;
-  int n_cache_clones;
-  int cache_clones_capacity;
-  pthread_mutex_t cache_clones_mutex;
+  /* Cache clones; lock-free stack with nodes from a freelist shared by all entries. */
+  // *INDENT-OFF*
+  lockfree::stack<XASL_CLONE> cache_clones;
+  // *INDENT-ON*
+  volatile INT32 n_cache_clones;
 
   /* RT check */
   INT64 time_last_rt_check;
@@ -130,8 +131,6 @@ struct xasl_cache_ent
   // *INDENT-OFF*
   xasl_cache_ent ();
   ~xasl_cache_ent ();
-
-  void init_clone_cache ();
   // *INDENT-ON*
 };
 
@@ -163,8 +162,11 @@ extern int xcache_insert (THREAD_ENTRY * thread_p, const compile_context * conte
 			  int n_oid, const OID * class_oids, const int *class_locks,
 			  const int *tcards, XASL_CACHE_ENTRY ** xcache_entry);
 extern void xcache_remove_by_oid (THREAD_ENTRY * thread_p, const OID * oid);
+extern void xcache_clear_list_cache_by_oid (THREAD_ENTRY * thread_p, const OID * oid);
 extern void xcache_drop_all (THREAD_ENTRY * thread_p);
 extern void xcache_dump (THREAD_ENTRY * thread_p, FILE * fp);
+extern void xcache_save (THREAD_ENTRY * thread_p);
+extern void xcache_load (THREAD_ENTRY * thread_p);
 
 extern bool xcache_can_entry_cache_list (XASL_CACHE_ENTRY * xcache_entry);
 
@@ -1542,6 +1542,7 @@ static int btree_record_satisfies_snapshot (THREAD_ENTRY * thread_p, BTID_INT *
 
 static int btree_range_scan_read_record (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
+static bool btree_read_ahead_next_leaf (THREAD_ENTRY * thread_p, PAGE_PTR page, const OID * owner, VPID * next_vpid);
 static int btree_range_scan_descending_fix_prev_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, int *key_count,
 						      BTREE_NODE_HEADER ** node_header_ptr, VPID * next_vpid);
 static int btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
@@ -1576,6 +1577,12 @@ static int btree_get_max_new_data_size (THREAD_ENTRY * thread_p, BTID_INT * btid
 static int btree_key_insert_new_object (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
 					void *other_args);
+static int btree_key_insert_new_object_list (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+					     PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
+					     void *other_args);
+static int btree_insert_list_is_key_in_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid_int,
+					     BTREE_INSERT_HELPER * insert_helper, PAGE_PTR leaf_page, DB_VALUE * key,
+					     BTREE_SEARCH_KEY_HELPER * search_key, bool * is_key_in_leaf);
 static int btree_key_online_index_IB_insert_list (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 						  PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key,
 						  bool * restart, void *other_args);
@@ -12302,6 +12309,16 @@ btree_split_next_pivot (BTREE_NODE_SPLIT_INFO * split_info, float new_value, int
   return NO_ERROR;
 }
 
+/*
+ * btree_node_is_compressed () - check whether the records of leaf node are compressed by the prefix of its fence keys
+ *   return: true if node is compressed
+ *   btid(in): B+tree index identifier
+ *   page_ptr(in): node page
+ *
+ * Note: Only multi-column keys are compressed, by removing the key columns shared by both fence keys. Keys of a single
+ *       column, strings included, are always stored whole: a common byte prefix of the fence keys is not shared by all
+ *       keys between them under case or accent insensitive collations, or when trailing spaces are ignored.
+ */
 static bool
 btree_node_is_compressed (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr)
 {
@@ -12603,6 +12620,122 @@ btree_compress_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr
   return error;
 }
 
+/*
+ * btree_leaf_record_is_fence () - Is leaf record a fence key?
+ *
+ * return      : True if record is a lower or upper fence key.
+ * record (in) : B-tree leaf record.
+ */
+bool
+btree_leaf_record_is_fence (RECDES * record)
+{
+  return btree_leaf_is_flaged (record, BTREE_LEAF_RECORD_FENCE);
+}
+
+/*
+ * btree_make_fence_record () - Make the fence record of a leaf node.
+ *
+ * return	  : Error code.
+ * thread_p (in)  : Thread entry.
+ * btid_int (in)  : B-tree info.
+ * fence_key (in) : Separator key of the leaf and its neighbor.
+ * record (out)	  : Fence record.
+ *
+ * Note: Caller must make sure the separator is not an overflow key.
+ */
+int
+btree_make_fence_record (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * fence_key, RECDES * record)
+{
+  OID dummy_oid = { NULL_PAGEID, 0, 0 };
+  int key_len;
+  int error_code;
+
+  key_len = btid_int->key_type->type->get_index_size_of_value (fence_key);
+  assert (key_len < BTREE_MAX_KEYLEN_INPAGE);
+
+  error_code =
+    btree_write_record (thread_p, btid_int, NULL, fence_key, BTREE_LEAF_NODE, BTREE_NORMAL_KEY, key_len, true,
+			&btid_int->topclass_oid, &dummy_oid, NULL, record);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  btree_leaf_set_flag (record, BTREE_LEAF_RECORD_FENCE);
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_leaf_record_change_prefix () - Re-compress leaf record key from one common prefix to another.
+ *
+ * return	    : Error code.
+ * thread_p (in)    : Thread entry.
+ * btid_int (in)    : B-tree info.
+ * record (in/out)  : B-tree leaf record. Its area must fit the uncompressed record.
+ * lower_fence (in) : Lower fence key of the leaf node (can be NULL if old_prefix is 0).
+ * old_prefix (in)  : Number of columns currently removed from key.
+ * new_prefix (in)  : Number of columns to be removed from key.
+ *
+ * Note: Fence records and overflow keys are never compressed and are left unchanged.
+ */
+int
+btree_leaf_record_change_prefix (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * record,
+				 DB_VALUE * lower_fence, int old_prefix, int new_prefix)
+{
+  if (btree_leaf_is_flaged (record, BTREE_LEAF_RECORD_FENCE)
+      || btree_leaf_is_flaged (record, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      return NO_ERROR;
+    }
+
+  return btree_recompress_record (thread_p, btid_int, record, lower_fence, old_prefix, new_prefix);
+}
+
+/*
+ * btree_leaf_record_get_key () - Get a copy of the uncompressed key of leaf record.
+ *
+ * return	    : Error code.
+ * thread_p (in)    : Thread entry.
+ * btid_int (in)    : B-tree info.
+ * record (in)	    : B-tree leaf record.
+ * lower_fence (in) : Lower fence key of the leaf node (can be NULL if n_prefix is 0).
+ * n_prefix (in)    : Number of columns removed from record key.
+ * key (out)	    : Key value. Caller must clear it.
+ */
+int
+btree_leaf_record_get_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * record, DB_VALUE * lower_fence,
+			   int n_prefix, DB_VALUE * key)
+{
+  LEAF_REC leaf_pnt;
+  DB_VALUE result;
+  bool clear_key = false;
+  int offset;
+  int error_code;
+
+  error_code =
+    btree_read_record_without_decompression (thread_p, btid_int, record, key, &leaf_pnt, BTREE_LEAF_NODE, &clear_key,
+					     &offset, COPY_KEY_VALUE);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  if (n_prefix > 0 && !btree_leaf_is_flaged (record, BTREE_LEAF_RECORD_FENCE)
+      && !btree_leaf_is_flaged (record, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+    {
+      assert (lower_fence != NULL && DB_VALUE_TYPE (lower_fence) == DB_TYPE_MIDXKEY);
+
+      pr_midxkey_add_prefix (&result, lower_fence, key, n_prefix);
+      pr_clear_value (key);
+      *key = result;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * btree_split_node () -
  *   return: NO_ERROR
@@ -24436,6 +24569,28 @@ btree_range_scan_read_record (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
 			    bts->node_type, &bts->clear_cur_key, &bts->offset, COPY_KEY_VALUE, bts);
 }
 
+/*
+ * btree_read_ahead_next_leaf () - Get next leaf of b-tree for page buffer read-ahead.
+ *
+ * return	  : True if page is a valid leaf, false otherwise.
+ * thread_p (in)  : Thread entry.
+ * page (in)	  : Page fixed by read-ahead worker.
+ * owner (in)	  : Unused.
+ * next_vpid (out): Next leaf VPID.
+ */
+static bool
+btree_read_ahead_next_leaf (THREAD_ENTRY * thread_p, PAGE_PTR page, const OID * owner, VPID * next_vpid)
+{
+  /* page is fixed without holding the previous leaf; it may have been deallocated and reused meanwhile. */
+  if (!BTREE_IS_PAGE_VALID_LEAF (thread_p, page))
+    {
+      return false;
+    }
+
+  *next_vpid = btree_get_node_header (thread_p, page)->next_vpid;
+  return true;
+}
+
 /*
  * btree_range_scan_advance_over_filtered_keys () - Find a key to pass all all filters.
  *
@@ -24563,6 +24718,7 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
 	  else
 	    {
 	      /* Fix next leaf page. */
+	      pgbuf_read_ahead_next (thread_p, &bts->read_ahead, &next_vpid, btree_read_ahead_next_leaf, NULL);
 	      next_node_page = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
 	      if (next_node_page == NULL)
 		{
@@ -26194,6 +26350,173 @@ btree_insert_internal (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
   return NO_ERROR;
 }
 
+/*
+ * btree_insert_sorted_list () - Insert the objects of an insert list into a non-unique b-tree. The keys are sorted and
+ *				 each traversal of the tree inserts all following keys that belong to the same leaf.
+ *
+ * return		  : Error code.
+ * thread_p (in)	  : Thread entry.
+ * btid (in)		  : B-tree identifier.
+ * class_oid (in)	  : Class OID.
+ * insert_list (in)	  : List of pairs key, OID (no NULL keys).
+ * op_type (in)		  : Single-multi row operations.
+ * p_mvcc_rec_header (in) : Heap MVCC record header (same for all objects).
+ */
+int
+btree_insert_sorted_list (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid, btree_insert_list * insert_list,
+			  int op_type, MVCC_REC_HEADER * p_mvcc_rec_header)
+{
+  int error_code = NO_ERROR;
+  BTREE_MVCC_INFO mvcc_info = BTREE_MVCC_INFO_INITIALIZER;
+
+  assert (btid != NULL);
+  assert (class_oid != NULL && !OID_ISNULL (class_oid));
+  assert (insert_list != NULL && !insert_list->m_keys_oids.empty ());
+
+  if (p_mvcc_rec_header != NULL)
+    {
+#if !defined (SERVER_MODE)
+      assert_release (false);
+#endif /* SERVER_MODE */
+      btree_mvcc_info_from_heap_mvcc_header (p_mvcc_rec_header, &mvcc_info);
+    }
+
+  insert_list->prepare_list ();
+
+  while (insert_list->m_curr_pos < (int) insert_list->m_sorted_keys_oids.size ())
+    {
+      BTID_INT btid_int;
+      BTREE_SEARCH_KEY_HELPER search_key = BTREE_SEARCH_KEY_HELPER_INITIALIZER;
+      BTREE_INSERT_HELPER insert_helper;
+
+      PERF_UTIME_TRACKER_START (thread_p, &insert_helper.time_track);
+
+      COPY_OID (BTREE_INSERT_OID (&insert_helper), insert_list->get_oid ());
+      COPY_OID (BTREE_INSERT_CLASS_OID (&insert_helper), class_oid);
+      *BTREE_INSERT_MVCC_INFO (&insert_helper) = mvcc_info;
+
+      insert_helper.is_null = false;
+      insert_helper.purpose = BTREE_OP_INSERT_NEW_OBJECT;
+      insert_helper.op_type = op_type;
+      insert_helper.log_operations = prm_get_bool_value (PRM_ID_LOG_BTREE_OPS);
+      insert_helper.is_ha_enabled = !HA_DISABLED ();
+      insert_helper.insert_list = insert_list;
+
+      /* Search for leaf page of first key and insert it along with all following keys of the same leaf. */
+      error_code =
+	btree_search_key_and_apply_functions (thread_p, btid, &btid_int, insert_list->get_key (),
+					      btree_fix_root_for_insert, &insert_helper, btree_split_node_and_advance,
+					      &insert_helper, btree_key_insert_new_object_list, &insert_helper,
+					      &search_key, NULL);
+
+      if (insert_helper.printed_key != NULL)
+	{
+	  db_private_free (thread_p, insert_helper.printed_key);
+	}
+
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_key_insert_new_object_list () - BTREE_PROCESS_KEY_FUNCTION used for inserting the objects of a sorted insert
+ *					 list. After the first key, the keys are inserted as long as they belong to
+ *					 the same leaf page.
+ *
+ * return	   : Error code.
+ * thread_p (in)   : Thread entry.
+ * btid_int (in)   : B-tree info.
+ * key (in)	   : First key.
+ * leaf_page (in)  : Pointer to the leaf page.
+ * search_key (in) : Search helper.
+ * restart (out)   : Restart (never for non-unique indexes).
+ * other_args (in) : BTREE_INSERT_HELPER *.
+ */
+static int
+btree_key_insert_new_object_list (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+				  PAGE_PTR * leaf_page, BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
+				  void *other_args)
+{
+  BTREE_INSERT_HELPER *insert_helper = (BTREE_INSERT_HELPER *) other_args;
+  btree_insert_list *insert_list = insert_helper->insert_list;
+  DB_VALUE *curr_key = key;
+  int error_code = NO_ERROR;
+  bool first_insert = true;
+  bool is_key_in_leaf = false;
+
+  assert (insert_list != NULL && insert_list->m_key_type == btid_int->key_type);
+  /* unique indexes may restart the traversal and cannot be batched */
+  assert (!BTREE_IS_UNIQUE (btid_int->unique_pk));
+
+  insert_list->m_keep_page_iterations = 0;
+  insert_list->m_ovf_appends = 0;
+  insert_list->m_ovf_appends_new_page = 0;
+
+  while (true)
+    {
+      error_code = btree_key_insert_new_object (thread_p, btid_int, curr_key, leaf_page, search_key, restart,
+						insert_helper);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+      assert (!*restart);
+
+      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_INSERTS);
+      if (!first_insert)
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_INSERTS_SAME_PAGE_HOLD);
+	}
+
+      if (insert_list->next_key () != btree_insert_list::KEY_AVAILABLE)
+	{
+	  /* no more keys in list */
+	  break;
+	}
+
+      /* prepare next pair (key, oid) */
+      COPY_OID (BTREE_INSERT_OID (insert_helper), insert_list->get_oid ());
+      curr_key = insert_list->get_key ();
+      if (DB_VALUE_DOMAIN_TYPE (curr_key) == DB_TYPE_MIDXKEY)
+	{
+	  curr_key->data.midxkey.domain = btid_int->key_type;
+	}
+
+      error_code = btree_insert_list_is_key_in_leaf (thread_p, btid_int, insert_helper, *leaf_page, curr_key,
+						     search_key, &is_key_in_leaf);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+      if (!is_key_in_leaf)
+	{
+	  /* next traversal starts from root with this key */
+	  break;
+	}
+      insert_helper->key_len_in_page = BTREE_GET_KEY_LEN_IN_PAGE (btree_get_disk_size_of_key (curr_key));
+
+      first_insert = false;
+      insert_list->m_keep_page_iterations++;
+
+      if (insert_list->check_release_latch (thread_p, insert_helper, *leaf_page) == true)
+	{
+	  break;
+	}
+    }
+
+  insert_list->reset_boundary_keys ();
+
+  return error_code;
+}
+
 /*
  * btree_fix_root_for_insert () - BTREE_ROOT_WITH_KEY_FUNCTION - fix root before inserting data in b-tree.
  *
@@ -33388,6 +33711,134 @@ end:
   return error_code;
 }
 
+/*
+ * btree_insert_list_is_key_in_leaf () - Check whether the next key of an insert list can be inserted into the leaf
+ *					 that is already latched, without going through the tree again.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid_int (in)       : B-tree info.
+ * insert_helper (in)  : Insert helper (with the insert list).
+ * leaf_page (in)      : Latched leaf page.
+ * key (in)	       : Next key of the list.
+ * search_key (out)    : Where the key is inserted in leaf, when it belongs to it.
+ * is_key_in_leaf (out): True if key can be inserted in leaf page.
+ */
+static int
+btree_insert_list_is_key_in_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid_int, BTREE_INSERT_HELPER * insert_helper,
+				  PAGE_PTR leaf_page, DB_VALUE * key, BTREE_SEARCH_KEY_HELPER * search_key,
+				  bool * is_key_in_leaf)
+{
+  btree_insert_list *insert_list = insert_helper->insert_list;
+  int error_code = NO_ERROR;
+
+  assert (insert_list != NULL);
+
+  *is_key_in_leaf = false;
+
+  int key_len = btree_get_disk_size_of_key (key);
+  BTREE_NODE_HEADER *node_header = btree_get_node_header (thread_p, leaf_page);
+
+  if (key_len > node_header->max_key_len)
+    {
+      /* cannot insert a key having len > max key len : abort and let advance/split algorithm to deal with this */
+      return NO_ERROR;
+    }
+
+  /* assuming the key does not exist in page (an existing key requires less space,
+   * we may miss adding one more record; this is a less expensive check, we accept the 'loss' */
+  bool key_already_in_page = false;
+  int new_ent_size = btree_get_max_new_data_size (thread_p, btid_int, leaf_page, BTREE_LEAF_NODE, key_len,
+						  insert_helper, key_already_in_page);
+  if (new_ent_size > spage_get_free_space_without_saving (thread_p, leaf_page, NULL))
+    {
+      /* no more space in page */
+      return NO_ERROR;
+    }
+
+  /* compare with boundary keys : NULL keys means INF bound, no check is required */
+  if (!insert_list->m_boundaries.m_is_inf_left_key)
+    {
+      DB_VALUE_COMPARE_RESULT c;
+      c = btree_compare_key (&insert_list->m_boundaries.m_left_key, key, btid_int->key_type, 1, 1, NULL);
+      if (c != DB_LT && c != DB_EQ)
+	{
+	  return NO_ERROR;
+	}
+    }
+
+  if (!insert_list->m_boundaries.m_is_inf_right_key)
+    {
+      DB_VALUE_COMPARE_RESULT c;
+      c = btree_compare_key (key, &insert_list->m_boundaries.m_right_key, btid_int->key_type, 1, 1, NULL);
+      if (c != DB_LT)
+	{
+	  return NO_ERROR;
+	}
+    }
+
+  /* early filter-out of out-page-range key : compare with min/max of page
+   * it also has the purpose of silencing the debug assertion of btree_search_leaf_page;
+   * after this, the 'search_key' structure is incomplete (slot id will be computed by btree_search_leaf_page) */
+  if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
+    {
+      error_code = btree_leaf_is_key_between_min_max (thread_p, btid_int, leaf_page, key, search_key);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+
+      if (search_key->result == BTREE_ERROR_OCCURRED || search_key->result == BTREE_KEY_SMALLER
+	  || search_key->result == BTREE_KEY_BIGGER)
+	{
+	  if (search_key->result == BTREE_KEY_SMALLER && VPID_ISNULL (&node_header->prev_vpid))
+	    {
+	      /* key is out of range (smaller), but since there is no leaf page to the left, we may continue */
+	      ;
+	    }
+	  else if (search_key->result == BTREE_KEY_BIGGER && VPID_ISNULL (&node_header->next_vpid))
+	    {
+	      /* key is out of range (bigger), but since there is no leaf page to the right, we may continue */
+	      ;
+	    }
+	  else
+	    {
+	      /* key is out of range (smaller or bigger) and the current leaf page has neighbours :
+	       * abort and search from root */
+	      return NO_ERROR;
+	    }
+	}
+    }
+
+  /* resolution of where to insert : slot, position relative to this slot and if page has fence keys */
+  error_code = btree_search_leaf_page (thread_p, btid_int, leaf_page, key, search_key);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  if ((search_key->result == BTREE_KEY_BIGGER || search_key->result == BTREE_KEY_SMALLER)
+      && search_key->has_fence_key == btree_search_key_helper::HAS_FENCE_KEY)
+    {
+      /* key is out of range and presence of fence key suggests that next/prev leaf page should be
+       * a better place; no fence means current key is bigger/lesser than all index keys and we can insert here
+       * (this is backed-up by key page boundaries checked before) */
+      return NO_ERROR;
+    }
+  else if (search_key->result != BTREE_KEY_BETWEEN && search_key->result != BTREE_KEY_FOUND
+	   && search_key->result != BTREE_KEY_BIGGER && search_key->result != BTREE_KEY_SMALLER)
+    {
+      /* unexpected, abort insert and retry from root page */
+      assert (false);
+      return NO_ERROR;
+    }
+
+  *is_key_in_leaf = true;
+  return NO_ERROR;
+}
+
 /*
  * btree_key_online_index_IB_insert_list () - BTREE_PROCESS_KEY_FUNCTION used for inserting a new object in b-tree during
  *                                       online index loading.
@@ -33411,6 +33862,7 @@ btree_key_online_index_IB_insert_list (THREAD_ENTRY * thread_p, BTID_INT * btid_
   DB_VALUE *curr_key;
   int error_code = NO_ERROR;
   bool first_insert = true;
+  bool is_key_in_leaf = false;
 
   curr_key = key;
 
@@ -33454,110 +33906,18 @@ btree_key_online_index_IB_insert_list (THREAD_ENTRY * thread_p, BTID_INT * btid_
       COPY_OID (BTREE_INSERT_OID (&helper->insert_helper), insert_list->get_oid ());
       curr_key = insert_list->get_key ();
 
-      int key_len = btree_get_disk_size_of_key (curr_key);
-      BTREE_NODE_HEADER *node_header = btree_get_node_header (thread_p, *leaf_page);
-
-      if (key_len > node_header->max_key_len)
-	{
-	  /* cannot insert a key having len > max key len : abort and let advance/split algorithm to deal with this */
-	  perfmon_inc_stat (thread_p, PSTAT_BT_ONLINE_NUM_RETRY);
-	  break;
-	}
-
-      /* assuming the key does not exist in page (an existing key requires less space,
-       * we may miss adding one more record; this is a less expensive check, we accept the 'loss' */
-      bool key_already_in_page = false;
-      int new_ent_size = btree_get_max_new_data_size (thread_p, btid_int, *leaf_page, BTREE_LEAF_NODE, key_len,
-						      &helper->insert_helper, key_already_in_page);
-      if (new_ent_size > spage_get_free_space_without_saving (thread_p, *leaf_page, NULL))
-	{
-	  /* no more space in page */
-	  perfmon_inc_stat (thread_p, PSTAT_BT_ONLINE_NUM_RETRY);
-	  break;
-	}
-
-      /* compare with boundary keys : NULL keys means INF bound, no check is required */
-      if (!insert_list->m_boundaries.m_is_inf_left_key)
-	{
-	  DB_VALUE_COMPARE_RESULT c;
-	  c = btree_compare_key (&insert_list->m_boundaries.m_left_key, curr_key, btid_int->key_type, 1, 1, NULL);
-	  if (c != DB_LT && c != DB_EQ)
-	    {
-	      perfmon_inc_stat (thread_p, PSTAT_BT_ONLINE_NUM_RETRY);
-	      break;
-	    }
-	}
-
-      if (!insert_list->m_boundaries.m_is_inf_right_key)
-	{
-	  DB_VALUE_COMPARE_RESULT c;
-	  c = btree_compare_key (curr_key, &insert_list->m_boundaries.m_right_key, btid_int->key_type, 1, 1, NULL);
-	  if (c != DB_LT)
-	    {
-	      perfmon_inc_stat (thread_p, PSTAT_BT_ONLINE_NUM_RETRY);
-	      break;
-	    }
-	}
-
-      /* early filter-out of out-page-range key : compare with min/max of page
-       * it also has the purpose of silencing the debug assertion of btree_search_leaf_page;
-       * after this, the 'search_key' structure is incomplete (slot id will be computed by btree_search_leaf_page) */
-      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
-	{
-	  error_code = btree_leaf_is_key_between_min_max (thread_p, btid_int, *leaf_page, curr_key, search_key);
-	  if (error_code != NO_ERROR)
-	    {
-	      ASSERT_ERROR ();
-	      break;
-	    }
-
-	  if (search_key->result == BTREE_ERROR_OCCURRED || search_key->result == BTREE_KEY_SMALLER
-	      || search_key->result == BTREE_KEY_BIGGER)
-	    {
-	      if (search_key->result == BTREE_KEY_SMALLER && VPID_ISNULL (&node_header->prev_vpid))
-		{
-		  /* key is out of range (smaller), but since there is no leaf page to the left, we may continue */
-		  ;
-		}
-	      else if (search_key->result == BTREE_KEY_BIGGER && VPID_ISNULL (&node_header->next_vpid))
-		{
-		  /* key is out of range (bigger), but since there is no leaf page to the right, we may continue */
-		  ;
-		}
-	      else
-		{
-		  /* key is out of range (smaller or bigger) and the current leaf page has neighbours :
-		   * abort and search from root */
-		  perfmon_inc_stat (thread_p, PSTAT_BT_ONLINE_NUM_RETRY);
-		  break;
-		}
-	    }
-	}
-
-      /* resolution of where to insert : slot, position relative to this slot and if page has fence keys */
-      error_code = btree_search_leaf_page (thread_p, btid_int, *leaf_page, curr_key, search_key);
+      error_code = btree_insert_list_is_key_in_leaf (thread_p, btid_int, &helper->insert_helper, *leaf_page,
+						     curr_key, search_key, &is_key_in_leaf);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
 	  break;
 	}
-
-      if ((search_key->result == BTREE_KEY_BIGGER || search_key->result == BTREE_KEY_SMALLER)
-	  && search_key->has_fence_key == btree_search_key_helper::HAS_FENCE_KEY)
+      if (!is_key_in_leaf)
 	{
-	  /* key is out of range and presence of fence key suggests that next/prev leaf page should be
-	   * a better place; no fence means current key is bigger/lesser than all index keys and we can insert here
-	   * (this is backed-up by key page boundaries checked before) */
 	  perfmon_inc_stat (thread_p, PSTAT_BT_ONLINE_NUM_RETRY);
 	  break;
 	}
-      else if (search_key->result != BTREE_KEY_BETWEEN && search_key->result != BTREE_KEY_FOUND
-	       && search_key->result != BTREE_KEY_BIGGER && search_key->result != BTREE_KEY_SMALLER)
-	{
-	  /* unexpected, abort insert and retry from root page */
-	  assert (false);
-	  break;
-	}
 
       first_insert = false;
       insert_list->m_keep_page_iterations++;
@@ -35702,4 +36062,170 @@ bool btree_insert_list::check_release_latch (THREAD_ENTRY * thread_p, void *arg,
 
   return false;
 }
+
+btree_insert_batch::btree_insert_batch ()
+  : m_indexes ()
+  , m_memsize (0)
+{
+}
+
+btree_insert_batch::~btree_insert_batch ()
+{
+  clear ();
+}
+
+bool
+btree_insert_batch::is_enabled ()
+{
+  return prm_get_bigint_value (PRM_ID_INDEX_INSERT_BATCH_MEMSIZE) > 0;
+}
+
+int
+btree_insert_batch::add_key (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid, DB_VALUE * key, OID * oid,
+                             int op_type, MVCC_REC_HEADER * p_mvcc_rec_header)
+{
+  int error_code = NO_ERROR;
+  index_keys *index = NULL;
+
+  if (DB_IS_NULL (key) || btree_multicol_key_is_null (key))
+    {
+      /* NULL keys are not stored; nothing to gain from batching them */
+      return btree_insert (thread_p, btid, key, class_oid, oid, op_type, NULL, NULL, p_mvcc_rec_header);
+    }
+
+  for (index_keys &it : m_indexes)
+    {
+      if (BTID_IS_EQUAL (&it.m_btid, btid))
+        {
+          index = &it;
+          break;
+        }
+    }
+
+  if (index == NULL)
+    {
+      TP_DOMAIN *key_type = btree_read_key_type (thread_p, btid);
+      if (key_type == NULL)
+        {
+          ASSERT_ERROR_AND_SET (error_code);
+          return error_code;
+        }
+
+      m_indexes.emplace_back ();
+      index = &m_indexes.back ();
+      BTID_COPY (&index->m_btid, btid);
+      index->m_key_type = key_type;
+      index->m_insert_list = NULL;
+      index->m_memsize = 0;
+    }
+  else if (index->m_insert_list != NULL && !can_append (*index, class_oid, op_type, p_mvcc_rec_header))
+    {
+      /* all objects of a list are inserted with the same class and MVCC info */
+      error_code = flush_index (thread_p, *index);
+      if (error_code != NO_ERROR)
+        {
+          ASSERT_ERROR ();
+          return error_code;
+        }
+    }
+
+  if (index->m_insert_list == NULL)
+    {
+      COPY_OID (&index->m_class_oid, class_oid);
+      index->m_op_type = op_type;
+      index->m_has_mvcc_header = p_mvcc_rec_header != NULL;
+      if (p_mvcc_rec_header != NULL)
+        {
+          index->m_mvcc_header = *p_mvcc_rec_header;
+        }
+      index->m_insert_list = new btree_insert_list (index->m_key_type);
+      index->m_memsize = 0;
+    }
+
+  size_t key_memsize = index->m_insert_list->add_key (key, *oid);
+  index->m_memsize += key_memsize;
+  m_memsize += key_memsize;
+
+  if (m_memsize >= (size_t) prm_get_bigint_value (PRM_ID_INDEX_INSERT_BATCH_MEMSIZE))
+    {
+      return flush (thread_p);
+    }
+
+  return NO_ERROR;
+}
+
+bool
+btree_insert_batch::can_append (const index_keys &index, OID * class_oid, int op_type,
+                                MVCC_REC_HEADER * p_mvcc_rec_header)
+{
+  if (!OID_EQ (&index.m_class_oid, class_oid) || index.m_op_type != op_type)
+    {
+      return false;
+    }
+
+  if (p_mvcc_rec_header == NULL)
+    {
+      return !index.m_has_mvcc_header;
+    }
+
+  return (index.m_has_mvcc_header && MVCC_GET_FLAG (&index.m_mvcc_header) == MVCC_GET_FLAG (p_mvcc_rec_header)
+          && MVCC_GET_INSID (&index.m_mvcc_header) == MVCC_GET_INSID (p_mvcc_rec_header));
+}
+
+int
+btree_insert_batch::flush_index (THREAD_ENTRY * thread_p, index_keys &index)
+{
+  int error_code;
+
+  assert (index.m_insert_list != NULL && !index.m_insert_list->m_keys_oids.empty ());
+
+  error_code = btree_insert_sorted_list (thread_p, &index.m_btid, &index.m_class_oid, index.m_insert_list,
+                                         index.m_op_type, index.m_has_mvcc_header ? &index.m_mvcc_header : NULL);
+
+  delete index.m_insert_list;
+  index.m_insert_list = NULL;
+
+  assert (m_memsize >= index.m_memsize);
+  m_memsize -= index.m_memsize;
+  index.m_memsize = 0;
+
+  return error_code;
+}
+
+int
+btree_insert_batch::flush (THREAD_ENTRY * thread_p)
+{
+  int error_code = NO_ERROR;
+
+  for (index_keys &index : m_indexes)
+    {
+      if (index.m_insert_list == NULL)
+        {
+          continue;
+        }
+
+      error_code = flush_index (thread_p, index);
+      if (error_code != NO_ERROR)
+        {
+          ASSERT_ERROR ();
+          break;
+        }
+    }
+
+  /* on error, the remaining keys are discarded; the caller aborts the operation */
+  clear ();
+
+  return error_code;
+}
+
+void
+btree_insert_batch::clear ()
+{
+  for (index_keys &index : m_indexes)
+    {
+      delete index.m_insert_list;
+    }
+  m_indexes.clear ();
+  m_memsize = 0;
+}
 // *INDENT-ON*
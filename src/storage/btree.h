@@ -36,6 +36,7 @@
 #include "disk_manager.h"
 #include "object_domain.h"
 #include "oid.h"
+#include "page_buffer.h"
 #include "lock_manager.h"
 #include "log_lsa.hpp"
 #include "mvcc.h"
@@ -245,6 +246,7 @@ struct btree_scan
   bool force_restart_from_root;
 
   PERF_UTIME_TRACKER time_track;
+  PGBUF_READ_AHEAD read_ahead;	/* read-ahead of the leaves following the current leaf */
 
   void *bts_other;
 };
@@ -294,6 +296,7 @@ struct btree_scan
     (bts)->force_restart_from_root = false;		\
     OID_SET_NULL (&(bts)->match_class_oid);		\
     (bts)->time_track.is_perf_tracking = false;		\
+    pgbuf_read_ahead_init (&(bts)->read_ahead);		\
     (bts)->bts_other = NULL;				\
   } while (0)
 
@@ -632,6 +635,42 @@ struct btree_insert_list
 
   bool check_release_latch (THREAD_ENTRY * thread_p, void *arg, PAGE_PTR leaf_page);
 };
+
+// btree_insert_batch - keys of a multi-row insert collected per index and inserted sorted, each run of keys that
+//                      falls into the same leaf under one latch. Only plain non-unique indexes are batched; the keys
+//                      must be flushed before the statement (or loaddb batch) ends.
+class btree_insert_batch
+{
+  public:
+    btree_insert_batch ();
+    ~btree_insert_batch ();
+
+    static bool is_enabled ();
+
+    int add_key (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid, DB_VALUE * key, OID * oid, int op_type,
+		 MVCC_REC_HEADER * p_mvcc_rec_header);
+    int flush (THREAD_ENTRY * thread_p);
+    void clear ();
+
+  private:
+    struct index_keys
+    {
+      BTID m_btid;
+      const TP_DOMAIN *m_key_type;
+      OID m_class_oid;
+      int m_op_type;
+      bool m_has_mvcc_header;
+      MVCC_REC_HEADER m_mvcc_header;
+      btree_insert_list *m_insert_list;
+      size_t m_memsize;		// memory of m_insert_list keys, part of batch m_memsize
+    };
+
+    bool can_append (const index_keys &index, OID * class_oid, int op_type, MVCC_REC_HEADER * p_mvcc_rec_header);
+    int flush_index (THREAD_ENTRY * thread_p, index_keys &index);
+
+    std::vector<index_keys> m_indexes;
+    size_t m_memsize;
+};
 // *INDENT-ON*
 
 /* BTREE_RANGE_SCAN_PROCESS_KEY_FUNC -
@@ -773,6 +812,8 @@ extern int btree_insert (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, O
 extern int btree_mvcc_delete (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID * class_oid, OID * oid,
 			      int op_type, btree_unique_stats * unique_stat_info, int *unique,
 			      MVCC_REC_HEADER * p_mvcc_rec_header);
+extern int btree_insert_sorted_list (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid,
+				     btree_insert_list * insert_list, int op_type, MVCC_REC_HEADER * p_mvcc_rec_header);
 
 extern void btree_set_mvcc_header_ids_for_update (THREAD_ENTRY * thread_p, bool do_delete_only, bool do_insert_only,
 						  MVCCID * mvccid, MVCC_REC_HEADER * mvcc_rec_header);
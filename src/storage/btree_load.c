@@ -51,10 +51,18 @@
 #include "stream_to_xasl.h"
 #include "thread_manager.hpp"
 #include "thread_entry_task.hpp"
+#if defined (SERVER_MODE)
+#include "parallel_query_worker_pool.hpp"
+#endif /* SERVER_MODE */
 #include "xserver_interface.h"
 #include "xasl.h"
 #include "xasl_unpack_info.hpp"
 
+#include <functional>
+#include <mutex>
+
+typedef struct btree_px_load BTREE_PX_LOAD;
+
 typedef struct sort_args SORT_ARGS;
 struct sort_args
 {				/* Collection of information required for "sr_index_sort" */
@@ -87,7 +95,74 @@ struct sort_args
   FUNCTION_INDEX_INFO *func_index_info;
 
   MVCCID oldest_visible_mvccid;
+
+  BTREE_PX_LOAD *px_load;	/* keys extracted by parallel workers, or NULL */
+  bool is_px_worker;		/* true for the copy of sort arguments used by a worker of px_load */
+};
+
+/* minimum number of heap pages each worker of a parallel key extraction should get */
+#define BTREE_PX_LOAD_MIN_PAGES_PER_WORKER 64
+
+/* space kept free in a loaded leaf for its upper fence record; the separator is not longer than the neighbor keys */
+#define LOAD_FENCE_RESERVE_FOR_LEAF(key_len) \
+  ((int) DB_ALIGN (MIN ((key_len), BTREE_MAX_KEYLEN_INPAGE), BTREE_MAX_ALIGN) + 2 * OR_OID_SIZE)
+
+#if defined (SERVER_MODE)
+/* size of the batches of sort items handed by workers to the sorting thread */
+#define BTREE_PX_LOAD_BATCH_SIZE (256 * 1024)
+/* number of batches each worker may have queued before it waits for the sorting thread */
+#define BTREE_PX_LOAD_MAX_QUEUED_BATCHES_PER_WORKER 4
+/* space taken in a batch by a sort item of length len; the length is saved in front of the item */
+#define BTREE_PX_LOAD_ITEM_SIZE(len) ((int) MAX_ALIGNMENT + DB_ALIGN ((len), MAX_ALIGNMENT))
+
+typedef struct btree_px_load_batch BTREE_PX_LOAD_BATCH;
+struct btree_px_load_batch
+{				/* sort items produced by a worker; allocated together with its area */
+  BTREE_PX_LOAD_BATCH *next;
+  char *area;
+  int area_size;
+  int length;			/* bytes of area filled by the worker */
+  int read_pos;			/* bytes of area consumed by the sorting thread */
+};
+
+typedef struct btree_px_load_worker BTREE_PX_LOAD_WORKER;
+struct btree_px_load_worker
+{
+  SORT_ARGS sort_args;		/* copy of sort arguments with own heap scan cache and attribute info */
+  int error_code;		/* error of worker; set with mutex of px_load */
+  void *error;			/* error of worker detached from its thread, to be reported by the sorting thread */
+};
+
+/* the sorting thread is one of the workers; it extracts keys itself when no batch is queued, so all pages are
+ * scanned even if no task starts. it waits only for the tasks that started before all pages were claimed; tasks
+ * starting later see is_closed and end without touching anything but px_load, which the last of its holders frees. */
+struct btree_px_load
+{				/* keys extracted by workers from heap pages; the sort is fed by one thread */
+  VPID *vpids;			/* user pages of all heaps */
+  int *page_classes;		/* index of class of each page in hfids and class_ids of sort arguments */
+  int n_vpids;
+  volatile int next_page;	/* index of next page to be claimed by a worker */
+  int tran_index;		/* transaction the workers work on behalf of */
+
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;		/* signaled with mutex when the queue changes, a worker is done or the load stops */
+  BTREE_PX_LOAD_BATCH *queue_head;	/* batches handed to the sorting thread */
+  BTREE_PX_LOAD_BATCH *queue_tail;
+  int n_queued;
+  int max_queued;
+  int n_started;			/* number of workers started, sorting thread included; others may be queued */
+  int n_done;			/* number of workers done */
+  bool has_error;		/* a worker failed */
+  bool is_stopped;		/* sort no longer consumes batches */
+  bool is_closed;		/* pages are all claimed or the load is stopped; tasks that start now end immediately */
+  volatile int ref_count;	/* sorting thread and tasks not ended yet */
+
+  BTREE_PX_LOAD_BATCH *cur_batch;	/* batch being consumed by the sorting thread */
+
+  BTREE_PX_LOAD_WORKER *workers;	/* first one is of the sorting thread; used only by started workers */
+  int n_workers;		/* number of workers, sorting thread included */
 };
+#endif /* SERVER_MODE */
 
 typedef struct btree_page BTREE_PAGE;
 struct btree_page
@@ -139,6 +214,17 @@ struct load_args
   PGSLOTID last_leaf_insert_slotid;	/* Slotid of last inserted leaf record. */
 
   VPID vpid_first_leaf;
+
+  /* Multi-column keys are loaded in fence key compressed leaves. The compression removes whole key columns; keys of a
+   * single column, strings too, are loaded uncompressed, as leaves of a single column index are never compressed (see
+   * btree_node_is_compressed). */
+  bool use_fence_key;		/* Leaves are separated by fence keys */
+  DB_VALUE leaf_lower_fence;	/* Lower fence key of current leaf page; null for the first leaf or when the separator
+				 * could not be stored as a fence */
+  int leaf_prefix;		/* Number of key columns removed from the records of current leaf page */
+  RECDES leaf_compress_recdes;	/* Record descriptor used for the compressed copy of a new leaf record. */
+  RECDES leaf_fence_recdes;	/* Record descriptor used for upper fence records. */
+  RECDES leaf_change_recdes;	/* Record descriptor used for leaf records changing their prefix. */
 };
 
 typedef struct btree_scan_partition_info BTREE_SCAN_PART;
@@ -217,6 +303,63 @@ class index_builder_loader_task: public cubthread::entry_task
     void clear_keys ();
 };
 
+// context shared by the tasks scanning the heap pages of an online index build in parallel; the builder thread is
+// one of the scanners and waits only for the tasks that started before all pages were claimed. tasks starting later
+// see m_is_closed and end without touching anything else; the context is freed by the last of its holders.
+class index_builder_scan_context
+{
+  public:
+    BTID_INT *m_btid_int;
+    HFID *m_hfid;
+    OID *m_class_oid;
+    int *m_attrids;
+    int m_n_attrs;
+    int *m_attrs_prefix_length;
+    int m_unique_pk;
+    TP_DOMAIN *m_key_type;
+    MVCC_SNAPSHOT *m_mvcc_snapshot;
+    int m_tran_index;                               // transaction the scanners work on behalf of
+
+    VPID *m_vpids;                                  // heap pages claimed one by one by the scanners
+    int m_n_vpids;
+    std::atomic<int> m_next_page;
+
+    index_builder_loader_context *m_load_context;   // scanners push their loader tasks into m_ib_workpool
+    cubthread::entry_workpool *m_ib_workpool;
+    std::atomic<int> *m_num_keys;
+    std::atomic<int> *m_num_oids;
+    std::atomic<int> *m_num_nulls;
+    std::atomic<std::uint64_t> m_tasks_started;     // loader tasks pushed by scanners
+
+    std::mutex m_mutex;                             // protects m_is_closed and the start of scanners
+    bool m_is_closed;                               // all pages are claimed; scanners starting now end immediately
+    std::atomic<int> m_scanners_started;            // builder thread included
+    std::atomic<int> m_scanners_done;
+    std::atomic<int> m_ref_count;                   // builder thread and scanner tasks not ended yet
+
+    index_builder_scan_context () = default;
+
+    int scan (cubthread::entry &thread_ref);
+    void close ();
+    void release ();
+
+  private:
+    int scan_pages (cubthread::entry &thread_ref, HEAP_SCANCACHE &scancache, HEAP_CACHE_ATTRINFO &attr_info);
+};
+
+class index_builder_scanner_task : public cubthread::entry_task
+{
+  private:
+    index_builder_scan_context &m_scan_context;
+
+  public:
+    index_builder_scanner_task () = delete;
+
+    index_builder_scanner_task (index_builder_scan_context &scan_context);
+
+    void execute (cubthread::entry &thread_ref);
+};
+
 // *INDENT-ON*
 
 
@@ -229,6 +372,16 @@ static void btree_log_page (THREAD_ENTRY * thread_p, VFID * vfid, PAGE_PTR page_
 static int btree_load_new_page (THREAD_ENTRY * thread_p, const BTID * btid, BTREE_NODE_HEADER * header, int node_level,
 				VPID * vpid_new, PAGE_PTR * page_new);
 static PAGE_PTR btree_proceed_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args);
+static int btree_load_add_leaf_record (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, RECDES * rec, DB_VALUE * key,
+				       int key_len);
+static int btree_load_change_leaf_prefix (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, int new_prefix, bool apply,
+					  int *growth);
+static int btree_load_close_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, DB_VALUE * next_key);
+static int btree_load_uncompress_last_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args);
+static int btree_load_leaf_record_count (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args);
+static void btree_load_update_leaf_max_key_len (LOAD_ARGS * load_args, int key_len);
+static int btree_load_alloc_leaf_recdes (RECDES * recdes);
+static void btree_load_free_leaf_recdes (LOAD_ARGS * load_args);
 static int btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid, OID * first_oid,
 			    MVCC_REC_HEADER * p_mvcc_rec_header, LOAD_ARGS * load_args);
 static int btree_construct_leafs (THREAD_ENTRY * thread_p, const RECDES * in_recdes, void *arg);
@@ -239,6 +392,19 @@ static int btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args)
 #endif /* defined(CUBRID_DEBUG) */
 static int btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args);
 static SORT_STATUS btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg);
+#if defined (SERVER_MODE)
+static int btree_px_load_start (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static int btree_px_load_collect_pages (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, BTREE_PX_LOAD * px_load);
+static void btree_px_load_end (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static void btree_px_load_release (BTREE_PX_LOAD * px_load);
+static void btree_px_load_execute (cubthread::entry & thread_ref, BTREE_PX_LOAD * px_load);
+static SCAN_CODE btree_px_load_next_object (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static void btree_px_load_end_class_scan (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args);
+static BTREE_PX_LOAD_BATCH *btree_px_load_alloc_batch (int area_size);
+static bool btree_px_load_push_batch (BTREE_PX_LOAD * px_load, BTREE_PX_LOAD_BATCH * batch);
+static int btree_px_load_pop_batch (BTREE_PX_LOAD * px_load, bool wait, BTREE_PX_LOAD_BATCH ** batch);
+static SORT_STATUS btree_px_load_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, BTREE_PX_LOAD * px_load);
+#endif /* SERVER_MODE */
 static int compare_driver (const void *first, const void *second, void *arg);
 static int list_add (BTREE_NODE ** list, VPID * pageid);
 static void list_remove_first (BTREE_NODE ** list);
@@ -751,6 +917,10 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
   load_args->ovf.pgptr = NULL;
   load_args->leaf_nleaf_recdes.data = NULL;
   load_args->ovf_recdes.data = NULL;
+  db_make_null (&load_args->leaf_lower_fence);
+  load_args->leaf_compress_recdes.data = NULL;
+  load_args->leaf_fence_recdes.data = NULL;
+  load_args->leaf_change_recdes.data = NULL;
   load_args->out_recdes = NULL;
   load_args->push_list = NULL;
   load_args->pop_list = NULL;
@@ -813,6 +983,8 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
   sort_args->fk_refcls_oid = fk_refcls_oid;
   sort_args->fk_refcls_pk_btid = fk_refcls_pk_btid;
   sort_args->fk_name = fk_name;
+  sort_args->px_load = NULL;
+  sort_args->is_px_worker = false;
   if (pred_stream && pred_stream_size > 0)
     {
       if (stx_map_stream_to_filter_pred (thread_p, &filter_pred, pred_stream, pred_stream_size) != NO_ERROR)
@@ -913,6 +1085,9 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
   load_args->ovf.pgptr = NULL;
   load_args->n_keys = 0;
   load_args->curr_non_del_obj_count = 0;
+  load_args->use_fence_key = (TP_DOMAIN_TYPE (btid_int.key_type) == DB_TYPE_MIDXKEY
+			      && prm_get_bool_value (PRM_ID_USE_BTREE_FENCE_KEY));
+  load_args->leaf_prefix = 0;
 
   load_args->leaf_nleaf_recdes.area_size = BTREE_MAX_KEYLEN_INPAGE + BTREE_MAX_OIDLEN_INPAGE;
   load_args->leaf_nleaf_recdes.length = 0;
@@ -932,6 +1107,16 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, load_args->ovf_recdes.area_size);
       goto error;
     }
+  if (load_args->use_fence_key)
+    {
+      /* the leaf records are re-compressed in these areas; the functions doing it may recurse while loading a leaf */
+      if (btree_load_alloc_leaf_recdes (&load_args->leaf_compress_recdes) != NO_ERROR
+	  || btree_load_alloc_leaf_recdes (&load_args->leaf_fence_recdes) != NO_ERROR
+	  || btree_load_alloc_leaf_recdes (&load_args->leaf_change_recdes) != NO_ERROR)
+	{
+	  goto error;
+	}
+    }
   load_args->out_recdes = NULL;
 
   /* Allocate a root page and save the page_id */
@@ -1016,7 +1201,9 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
       /* Release the memory area */
       os_free_and_init (load_args->leaf_nleaf_recdes.data);
       os_free_and_init (load_args->ovf_recdes.data);
+      btree_load_free_leaf_recdes (load_args);
       pr_clear_value (&load_args->current_key);
+      pr_clear_value (&load_args->leaf_lower_fence);
 
       if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
 	{
@@ -1041,7 +1228,9 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
 
       os_free_and_init (load_args->leaf_nleaf_recdes.data);
       os_free_and_init (load_args->ovf_recdes.data);
+      btree_load_free_leaf_recdes (load_args);
       pr_clear_value (&load_args->current_key);
+      pr_clear_value (&load_args->leaf_lower_fence);
 
       BTID_SET_NULL (btid);
       if (xbtree_add_index (thread_p, btid, key_type, &class_oids[0], attr_ids[0], unique_pk, sort_args->n_oids,
@@ -1153,7 +1342,9 @@ error:
     {
       os_free_and_init (load_args->ovf_recdes.data);
     }
+  btree_load_free_leaf_recdes (load_args);
   pr_clear_value (&load_args->current_key);
+  pr_clear_value (&load_args->leaf_lower_fence);
 
   if (load_args->leaf.pgptr)
     {
@@ -1225,7 +1416,6 @@ btree_save_last_leafrec (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
 {
   INT16 slotid;
   int sp_success;
-  int cur_maxspace;
   int ret = NO_ERROR;
   BTREE_NODE_HEADER *header = NULL;
 
@@ -1246,40 +1436,21 @@ btree_save_last_leafrec (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
     }
 
   /* Insert leaf record too */
-  cur_maxspace = spage_max_space_for_new_record (thread_p, load_args->leaf.pgptr);
-  if (((cur_maxspace - load_args->leaf_nleaf_recdes.length) < LOAD_FIXED_EMPTY_FOR_LEAF)
-      && (spage_number_of_records (load_args->leaf.pgptr) > 1))
-    {
-      /* New record does not fit into the current leaf page (within the threshold value); so allocate a new leaf page
-       * and dump the current leaf page. */
-      if (btree_proceed_leaf (thread_p, load_args) == NULL)
-	{
-	  goto exit_on_error;
-	}
-    }
-
-  /* Insert the record to the current leaf page */
-  sp_success = spage_insert (thread_p, load_args->leaf.pgptr, &load_args->leaf_nleaf_recdes, &slotid);
-  if (sp_success != SP_SUCCESS)
+  ret =
+    btree_load_add_leaf_record (thread_p, load_args, &load_args->leaf_nleaf_recdes, &load_args->current_key,
+				load_args->cur_key_len);
+  if (ret != NO_ERROR)
     {
       goto exit_on_error;
     }
 
-  assert (slotid > 0);
-
-  /* Update the node header information for this record */
-  if (load_args->cur_key_len >= BTREE_MAX_KEYLEN_INPAGE)
-    {
-      if (load_args->leaf.hdr.max_key_len < DISK_VPID_SIZE)
-	{
-	  load_args->leaf.hdr.max_key_len = DISK_VPID_SIZE;
-	}
-    }
-  else
+  if (load_args->use_fence_key)
     {
-      if (load_args->leaf.hdr.max_key_len < load_args->cur_key_len)
+      /* The last leaf page has no upper fence key; its records cannot be kept compressed. */
+      ret = btree_load_uncompress_last_leaf (thread_p, load_args);
+      if (ret != NO_ERROR)
 	{
-	  load_args->leaf.hdr.max_key_len = load_args->cur_key_len;
+	  goto exit_on_error;
 	}
     }
 
@@ -1470,6 +1641,7 @@ btree_build_nleafs (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, int n_nulls,
 				 * types */
   int last_key_offset, first_key_offset;
   bool clear_last_key = false, clear_first_key = false;
+  bool has_lower_fence;
 
   int ret = NO_ERROR;
   int node_level = 2;		/* leaf level = 1, lowest non-leaf level = 2 */
@@ -1572,6 +1744,7 @@ btree_build_nleafs (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, int n_nulls,
 	  ASSERT_ERROR ();
 	  goto end;
 	}
+      has_lower_fence = btree_leaf_record_is_fence (&temp_recdes);
 
       if (pr_is_prefix_key_type (TP_DOMAIN_TYPE (load_args->btid->key_type)))
 	{
@@ -1579,11 +1752,12 @@ btree_build_nleafs (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, int n_nulls,
 	   * Key type is string or midxkey.
 	   * Should insert the prefix key to the parent level
 	   */
-	  if (DB_IS_NULL (&last_key))
+	  if (DB_IS_NULL (&last_key) || has_lower_fence)
 	    {
 	      /* is the first leaf When the types of leaf node are char, nchar, bit, the type that is saved on non-leaf
 	       * node is different. non-leaf spec (char -> varchar, nchar -> varnchar, bit -> varbit) hence it should
-	       * be configured by using setval of nonleaf_key_type. */
+	       * be configured by using setval of nonleaf_key_type.
+	       * The lower fence key of a leaf is already the separator from the previous leaf. */
 	      ret = load_args->btid->nonleaf_key_type->type->setval (&prefix_key, &first_key, true);
 	      if (ret != NO_ERROR)
 		{
@@ -2138,800 +2312,2057 @@ btree_proceed_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
 }
 
 /*
- * btree_first_oid () - Prepare record for the key and its first oid
- *   return: int
- *   this_key(in): Key
- *   class_oid(in):
- *   first_oid(in): First OID associated with this key; inserted into the
- *                  record.
- *   load_args(in): Contains fields specifying where & how to create the record
- *
- * Note: This function prepares the leaf record for the given key and
- * its first OID at the storage location specified by
- * load_args->out_recdes field.
+ * btree_load_alloc_leaf_recdes () - Allocate the area of a record descriptor used for fence key compressed leaves
+ *   return: NO_ERROR or error code
+ *   recdes(out): Record descriptor
  */
 static int
-btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid, OID * first_oid,
-		 MVCC_REC_HEADER * p_mvcc_rec_header, LOAD_ARGS * load_args)
+btree_load_alloc_leaf_recdes (RECDES * recdes)
 {
-  int key_len;
-  int key_type;
-  int error;
-  BTREE_MVCC_INFO mvcc_info;
+  recdes->area_size = DB_PAGESIZE;
+  recdes->length = 0;
+  recdes->type = REC_HOME;
+  recdes->data = (char *) os_malloc (recdes->area_size);
+  if (recdes->data == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) recdes->area_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
 
-  assert (load_args->out_recdes == &load_args->leaf_nleaf_recdes);
+  return NO_ERROR;
+}
 
-  /* form the leaf record (create the header & insert the key) */
-  key_len = load_args->cur_key_len = btree_get_disk_size_of_key (this_key);
-  if (key_len < BTREE_MAX_KEYLEN_INPAGE)
+/*
+ * btree_load_free_leaf_recdes () - Free the record descriptor areas used for fence key compressed leaves
+ *   return: void
+ *   load_args(in): Collection of info. for btree load operation
+ */
+static void
+btree_load_free_leaf_recdes (LOAD_ARGS * load_args)
+{
+  if (load_args->leaf_compress_recdes.data != NULL)
     {
-      key_type = BTREE_NORMAL_KEY;
+      os_free_and_init (load_args->leaf_compress_recdes.data);
     }
-  else
+  if (load_args->leaf_fence_recdes.data != NULL)
     {
-      key_type = BTREE_OVERFLOW_KEY;
-      if (VFID_ISNULL (&load_args->btid->ovfid))
+      os_free_and_init (load_args->leaf_fence_recdes.data);
+    }
+  if (load_args->leaf_change_recdes.data != NULL)
+    {
+      os_free_and_init (load_args->leaf_change_recdes.data);
+    }
+}
+
+/*
+ * btree_load_update_leaf_max_key_len () - Update the maximum key length of current leaf page
+ *   return: void
+ *   load_args(in): Collection of info. for btree load operation
+ *   key_len(in): Disk size of a key inserted in current leaf page
+ */
+static void
+btree_load_update_leaf_max_key_len (LOAD_ARGS * load_args, int key_len)
+{
+  if (key_len >= BTREE_MAX_KEYLEN_INPAGE)
+    {
+      if (load_args->leaf.hdr.max_key_len < DISK_VPID_SIZE)
 	{
-	  error = btree_create_overflow_key_file (thread_p, load_args->btid);
-	  if (error != NO_ERROR)
-	    {
-	      return error;
-	    }
+	  load_args->leaf.hdr.max_key_len = DISK_VPID_SIZE;
 	}
     }
-  btree_mvcc_info_from_heap_mvcc_header (p_mvcc_rec_header, &mvcc_info);
-  error =
-    btree_write_record (thread_p, load_args->btid, NULL, this_key, BTREE_LEAF_NODE, key_type, key_len, true, class_oid,
-			first_oid, &mvcc_info, load_args->out_recdes);
-  if (error != NO_ERROR)
+  else
     {
-      /* this must be an overflow key insertion failure, we assume the overflow manager has logged an error. */
-      return error;
+      if (load_args->leaf.hdr.max_key_len < key_len)
+	{
+	  load_args->leaf.hdr.max_key_len = key_len;
+	}
     }
+}
 
-  /* Set the location where the new oid should be inserted */
-  load_args->new_pos = (load_args->out_recdes->data + load_args->out_recdes->length);
-  assert (load_args->out_recdes->length <= load_args->out_recdes->area_size);
-
-  /* Set the current key value to this_key */
-  pr_clear_value (&load_args->current_key);	/* clear previous value */
-  load_args->cur_key_len = key_len;
+/*
+ * btree_load_leaf_record_count () - Number of records in current leaf page, not counting its lower fence key
+ *   return: number of records
+ *   load_args(in): Collection of info. for btree load operation
+ */
+static int
+btree_load_leaf_record_count (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
+{
+  int key_cnt = btree_node_number_of_keys (thread_p, load_args->leaf.pgptr);
 
-  return pr_clone_value (this_key, &load_args->current_key);
+  return DB_IS_NULL (&load_args->leaf_lower_fence) ? key_cnt : key_cnt - 1;
 }
 
 /*
- * btree_construct_leafs () - Output function for index sorting;constructs leaf
- *                         nodes
- *   return: int
- *   in_recdes(in): specifies the next sort item in the sorting order.
- *   arg(in): output arguments; provides information about how to use the
- *            next item in the sorted list to construct the leaf nodes of
- *            the Btree.
+ * btree_load_add_leaf_record () - Insert a finished leaf record into current leaf page
+ *   return: NO_ERROR or error code
+ *   load_args(in): Collection of info. for btree load operation
+ *   rec(in): Uncompressed leaf record
+ *   key(in): Key of the record
+ *   key_len(in): Disk size of the key
  *
- * Note: This function creates the btree leaf nodes. It is passed
- * by the "btree_index_sort" function to the "sort_listfile" function
- * to use the sort items to build the records and pages of the btree.
+ * Note: If the record does not fit into current leaf page (within the threshold value), current leaf page is dumped
+ * and the record is inserted into a new leaf page.
+ *
+ * Leaves of multi-column keys are separated by fence keys, like the leaves split by b-tree inserts. The key columns
+ * shared by the lower fence key and the keys of the leaf are removed from the records as they are inserted, so more
+ * keys fit into a leaf. A key sharing fewer columns with the lower fence makes all the records of the leaf give back
+ * the columns it does not share; the leaf is dumped instead if there is no room for it.
  */
 static int
-btree_construct_leafs (THREAD_ENTRY * thread_p, const RECDES * in_recdes, void *arg)
+btree_load_add_leaf_record (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, RECDES * rec, DB_VALUE * key, int key_len)
 {
-  int ret = NO_ERROR;
-  LOAD_ARGS *load_args;
-  DB_VALUE this_key;		/* Key value in this sorted item (specified with in_recdes) */
-  OID this_class_oid = oid_Null_oid;	/* Class OID value in this sorted item */
-  OID this_oid = oid_Null_oid;	/* OID value in this sorted item */
-  OID original_oid = oid_Null_oid;
-  OID original_class_oid = oid_Null_oid;
-  int sp_success;
+  RECDES *compressed_rec = &load_args->leaf_compress_recdes;
   int cur_maxspace;
-  INT16 slotid;
-  bool same_key = true;
-  VPID new_ovfpgid;
-  PAGE_PTR new_ovfpgptr = NULL;
-  OR_BUF buf;
-  bool copy = false;
-  RECDES sort_key_recdes, *recdes;
-  char *next;
-  int next_size;
-  int key_size = -1;
-  BTREE_OVERFLOW_HEADER *ovf_header = NULL;
-
-  int oid_size = OR_OID_SIZE;
-  int fixed_mvccid_size = 0;
-  BTREE_MVCC_INFO mvcc_info;
-  /* TODO: What about using only MVCC info here? */
-  MVCC_REC_HEADER mvcc_header;
-  MVCC_REC_HEADER original_mvcc_header;
-
-  char notify_vacuum_rv_data_buffer[IO_MAX_PAGE_SIZE + BTREE_MAX_ALIGN];
-  char *notify_vacuum_rv_data_bufalign = PTR_ALIGN (notify_vacuum_rv_data_buffer, BTREE_MAX_ALIGN);
-  char *notify_vacuum_rv_data = notify_vacuum_rv_data_bufalign;
-  int notify_vacuum_rv_data_capacity = IO_MAX_PAGE_SIZE;
-  int notify_vacuum_rv_data_length = 0;
-
-  load_args = (LOAD_ARGS *) arg;
-
-#if defined (SERVER_MODE)
-  /* Make sure MVCCID for current transaction is generated. */
-  (void) logtb_get_current_mvccid (thread_p);
-#endif /* SERVER_MODE */
+  int n_records;
+  int prefix;
+  int growth;
+  int error_code = NO_ERROR;
 
-  fixed_mvccid_size = 2 * OR_MVCCID_SIZE;
-  if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+  if (!load_args->use_fence_key)
     {
-      oid_size = 2 * OR_OID_SIZE;
-    }
-
-  sort_key_recdes = *in_recdes;
-  recdes = &sort_key_recdes;
-
-  next_size = sizeof (char *);
-
-  for (;;)
-    {				/* Infinite loop; will exit with break statement */
-
-      next = *(char **) recdes->data;	/* save forward link */
-
-      /* First decompose the input record into the key and oid components */
-      or_init (&buf, recdes->data, recdes->length);
-      assert (buf.ptr == PTR_ALIGN (buf.ptr, MAX_ALIGNMENT));
-
-      /* Skip forward link, value_has_null */
-      or_advance (&buf, next_size + OR_INT_SIZE);
-
-      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
-
-      /* Instance level uniqueness checking */
-      if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
-	{			/* unique index */
-	  /* extract class OID */
-	  ret = or_get_oid (&buf, &this_class_oid);
-	  if (ret != NO_ERROR)
+      cur_maxspace = spage_max_space_for_new_record (thread_p, load_args->leaf.pgptr);
+      if (((cur_maxspace - rec->length) < LOAD_FIXED_EMPTY_FOR_LEAF)
+	  && (spage_number_of_records (load_args->leaf.pgptr) > 1))
+	{
+	  /* New record does not fit into the current leaf page (within the threshold value); so allocate a new leaf page
+	   * and dump the current leaf page. */
+	  if (btree_proceed_leaf (thread_p, load_args) == NULL)
 	    {
-	      goto error;
+	      ASSERT_ERROR_AND_SET (error_code);
+	      return error_code;
 	    }
 	}
 
-      /* Get OID */
-      ret = or_get_oid (&buf, &this_oid);
-      if (ret != NO_ERROR)
+      /* Insert the record to the current leaf page */
+      if (spage_insert (thread_p, load_args->leaf.pgptr, rec, &load_args->last_leaf_insert_slotid) != SP_SUCCESS)
 	{
-	  goto error;
+	  assert_release (false);
+	  return ER_FAILED;
 	}
+      assert (load_args->last_leaf_insert_slotid > 0);
 
-      /* Create MVCC header */
-      BTREE_INIT_MVCC_HEADER (&mvcc_header);
+      btree_load_update_leaf_max_key_len (load_args, key_len);
+      return NO_ERROR;
+    }
 
-      ret = or_get_mvccid (&buf, &MVCC_GET_INSID (&mvcc_header));
-      if (ret != NO_ERROR)
+  while (true)
+    {
+      n_records = btree_load_leaf_record_count (thread_p, load_args);
+
+      prefix = 0;
+      growth = 0;
+      if (!DB_IS_NULL (&load_args->leaf_lower_fence))
 	{
-	  goto error;
+	  prefix = pr_midxkey_common_prefix (&load_args->leaf_lower_fence, key);
+	  if (n_records > 0 && prefix < load_args->leaf_prefix)
+	    {
+	      /* records of the leaf must give back the columns not shared by this key */
+	      error_code = btree_load_change_leaf_prefix (thread_p, load_args, prefix, false, &growth);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
+	    }
+	  else if (n_records > 0)
+	    {
+	      prefix = load_args->leaf_prefix;
+	    }
 	}
 
-      ret = or_get_mvccid (&buf, &MVCC_GET_DELID (&mvcc_header));
-      if (ret != NO_ERROR)
+      memcpy (compressed_rec->data, rec->data, rec->length);
+      compressed_rec->length = rec->length;
+      error_code = btree_leaf_record_change_prefix (thread_p, load_args->btid, compressed_rec, NULL, 0, prefix);
+      if (error_code != NO_ERROR)
 	{
-	  goto error;
+	  return error_code;
 	}
 
-#if defined(SERVER_MODE)
-      if (MVCC_GET_INSID (&mvcc_header) != MVCCID_ALL_VISIBLE)
+      /* keep room for the upper fence key too */
+      cur_maxspace = spage_max_space_for_new_record (thread_p, load_args->leaf.pgptr);
+      if (n_records == 0
+	  || ((cur_maxspace - growth - compressed_rec->length - LOAD_FENCE_RESERVE_FOR_LEAF (key_len))
+	      >= LOAD_FIXED_EMPTY_FOR_LEAF))
 	{
-	  /* Set valid insert MVCCID flag */
-	  MVCC_SET_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+	  break;
 	}
-#else
-      /* all inserted OIDs are created as visible in stand-alone */
-      MVCC_SET_INSID (&mvcc_header, MVCCID_ALL_VISIBLE);
-#endif /* SERVER_MODE */
 
-      if (MVCC_GET_DELID (&mvcc_header) != MVCCID_NULL)
+      /* New record does not fit into the current leaf page (within the threshold value); so close the current leaf
+       * page and insert the record to a new one. */
+      error_code = btree_load_close_leaf (thread_p, load_args, key);
+      if (error_code != NO_ERROR)
 	{
-#if defined(SERVER_MODE)
-	  /* Set valid delete MVCCID */
-	  MVCC_SET_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_DELID);
-#else
-	  /* standalone : ignore deleted OID */
-	  continue;
-#endif /* SERVER_MODE */
+	  return error_code;
 	}
+    }
 
-      /* Save OID, class OID and MVCC header since they may be replaced. */
-      COPY_OID (&original_oid, &this_oid);
-      COPY_OID (&original_class_oid, &this_class_oid);
-      original_mvcc_header = mvcc_header;
+  if (n_records > 0 && prefix != load_args->leaf_prefix)
+    {
+      error_code = btree_load_change_leaf_prefix (thread_p, load_args, prefix, true, &growth);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+  load_args->leaf_prefix = prefix;
 
-      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+  /* Insert the record to the current leaf page */
+  if (spage_insert (thread_p, load_args->leaf.pgptr, compressed_rec, &load_args->last_leaf_insert_slotid)
+      != SP_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  assert (load_args->last_leaf_insert_slotid > 0);
 
-      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+  btree_load_update_leaf_max_key_len (load_args, key_len);
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_load_change_leaf_prefix () - Change the number of key columns removed from the records of current leaf page
+ *   return: NO_ERROR or error code
+ *   load_args(in): Collection of info. for btree load operation
+ *   new_prefix(in): Number of key columns to be removed from the records
+ *   apply(in): False to only compute the growth of the records
+ *   growth(out): Growth of the space used by records; negative if they shrink
+ */
+static int
+btree_load_change_leaf_prefix (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, int new_prefix, bool apply,
+			       int *growth)
+{
+  RECDES *rec = &load_args->leaf_change_recdes;
+  int key_cnt;
+  int old_len;
+  PGSLOTID slotid;
+  int error_code = NO_ERROR;
+
+  *growth = 0;
+  if (new_prefix == load_args->leaf_prefix)
+    {
+      return NO_ERROR;
+    }
+
+  assert (!DB_IS_NULL (&load_args->leaf_lower_fence));
+
+  /* slot 1 is the lower fence key */
+  key_cnt = btree_node_number_of_keys (thread_p, load_args->leaf.pgptr);
+  for (slotid = 2; slotid <= key_cnt; slotid++)
+    {
+      if (spage_get_record (thread_p, load_args->leaf.pgptr, slotid, rec, COPY) != S_SUCCESS)
 	{
-	  _er_log_debug (ARG_FILE_LINE,
-			 "DEBUG_BTREE: load new object(%d, %d, %d) class(%d, %d, %d) and btid(%d, (%d, %d)) with "
-			 "mvccinfo=%llu| %llu", this_oid.volid, this_oid.pageid, this_oid.slotid, this_class_oid.volid,
-			 this_class_oid.pageid, this_class_oid.slotid, load_args->btid->sys_btid->root_pageid,
-			 load_args->btid->sys_btid->vfid.volid, load_args->btid->sys_btid->vfid.fileid,
-			 MVCC_GET_INSID (&mvcc_header), MVCC_GET_DELID (&mvcc_header));
+	  assert_release (false);
+	  return ER_FAILED;
 	}
 
-      /* Do not copy the string--just use the pointer.  The pr_ routines for strings and sets have different semantics
-       * for length. */
-      if (TP_DOMAIN_TYPE (load_args->btid->key_type) == DB_TYPE_MIDXKEY)
+      old_len = (int) DB_ALIGN (rec->length, BTREE_MAX_ALIGN);
+      error_code =
+	btree_leaf_record_change_prefix (thread_p, load_args->btid, rec, &load_args->leaf_lower_fence,
+					 load_args->leaf_prefix, new_prefix);
+      if (error_code != NO_ERROR)
 	{
-	  key_size = CAST_STRLEN (buf.endptr - buf.ptr);
+	  return error_code;
 	}
+      *growth += (int) DB_ALIGN (rec->length, BTREE_MAX_ALIGN) - old_len;
 
-      ret = load_args->btid->key_type->type->data_readval (&buf, &this_key, load_args->btid->key_type, key_size, copy,
-							   NULL, 0);
-      if (ret != NO_ERROR)
+      if (apply && spage_update (thread_p, load_args->leaf.pgptr, slotid, rec) != SP_SUCCESS)
 	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_CORRUPTED, 0);
-	  goto error;
+	  assert_release (false);
+	  return ER_FAILED;
 	}
+    }
 
-      /* Find out if this is the first call to this function */
-      if (VPID_ISNULL (&(load_args->leaf.vpid)))
+  if (apply)
+    {
+      load_args->leaf_prefix = new_prefix;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_load_close_leaf () - Close current leaf page with an upper fence key and proceed to a new leaf page
+ *   return: NO_ERROR or error code
+ *   load_args(in): Collection of info. for btree load operation
+ *   next_key(in): First key of the new leaf page; NULL to move the last record of current leaf page to the new one
+ *
+ * Note: The upper fence key is the separator of the last key of current leaf and next key. It is also the lower
+ * fence key of the new leaf and their separator in the parent page. The records of current leaf are re-compressed
+ * to the columns shared by its fence keys. When there is no room for them and the fence key, records are moved from
+ * the end of current leaf to the new leaf. A leaf that cannot get an upper fence key is left uncompressed.
+ */
+static int
+btree_load_close_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args, DB_VALUE * next_key)
+{
+  RECDES *fence_rec = &load_args->leaf_fence_recdes;
+  RECDES peek_rec;
+  RECDES *moved_recs = NULL;	/* records moved to the new leaf, in descending order of keys */
+  DB_VALUE *moved_keys = NULL;
+  int n_moved = 0;
+  DB_VALUE last_key, sep_key;
+  int key_cnt, sep_len, new_prefix, growth, i;
+  bool has_fence = false;
+  void *ptr;
+  int error_code = NO_ERROR;
+
+  db_make_null (&last_key);
+  db_make_null (&sep_key);
+
+  while (true)
+    {
+      key_cnt = btree_node_number_of_keys (thread_p, load_args->leaf.pgptr);
+
+      if (next_key == NULL)
 	{
-	  /* This is the first call to this function; so, initialize some fields in the LOAD_ARGS structure */
+	  /* move the last record of the leaf; it is uncompressed for the new leaf */
+	  assert (btree_load_leaf_record_count (thread_p, load_args) > 1);
 
-	  /* Allocate the first page for the index */
-	  ret =
-	    btree_load_new_page (thread_p, load_args->btid->sys_btid, &load_args->leaf.hdr, 1, &load_args->leaf.vpid,
-				 &load_args->leaf.pgptr);
-	  if (ret != NO_ERROR)
+	  ptr = os_realloc (moved_recs, (n_moved + 1) * sizeof (RECDES));
+	  if (ptr == NULL)
 	    {
-	      ASSERT_ERROR ();
-	      goto error;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (n_moved + 1) * sizeof (RECDES));
+	      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	      goto end;
 	    }
-	  if (load_args->leaf.pgptr == NULL || VPID_ISNULL (&load_args->leaf.vpid))
+	  moved_recs = (RECDES *) ptr;
+
+	  ptr = os_realloc (moved_keys, (n_moved + 1) * sizeof (DB_VALUE));
+	  if (ptr == NULL)
 	    {
-	      assert_release (false);
-	      goto error;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (n_moved + 1) * sizeof (DB_VALUE));
+	      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	      goto end;
 	    }
-	  /* Save first leaf VPID. */
-	  load_args->vpid_first_leaf = load_args->leaf.vpid;
-
-#if 0				/* TODO: currently not used */
-	  load_args->first_leafpgid = load_args->leaf.vpid;
-#endif
-	  load_args->overflowing = false;
-	  assert (load_args->ovf.pgptr == NULL);
+	  moved_keys = (DB_VALUE *) ptr;
 
-	  /* Create the first record of the current page in main memory */
-	  load_args->out_recdes = &load_args->leaf_nleaf_recdes;
-	  ret = btree_first_oid (thread_p, &this_key, &this_class_oid, &this_oid, &mvcc_header, load_args);
-	  if (ret != NO_ERROR)
+	  moved_recs[n_moved].area_size = DB_PAGESIZE;
+	  moved_recs[n_moved].data = (char *) os_malloc (DB_PAGESIZE);
+	  db_make_null (&moved_keys[n_moved]);
+	  n_moved++;
+	  if (moved_recs[n_moved - 1].data == NULL)
 	    {
-	      goto error;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) DB_PAGESIZE);
+	      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	      goto end;
 	    }
 
-	  if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	  if (spage_get_record (thread_p, load_args->leaf.pgptr, key_cnt, &moved_recs[n_moved - 1], COPY)
+	      != S_SUCCESS)
 	    {
-	      /* Object was not deleted, increment curr_non_del_obj_count */
-	      load_args->curr_non_del_obj_count = 1;
-
-	      /* Increment the key counter if object is not deleted */
-	      (load_args->n_keys)++;
+	      assert_release (false);
+	      error_code = ER_FAILED;
+	      goto end;
 	    }
-	  else
+	  error_code =
+	    btree_leaf_record_change_prefix (thread_p, load_args->btid, &moved_recs[n_moved - 1],
+					     &load_args->leaf_lower_fence, load_args->leaf_prefix, 0);
+	  if (error_code != NO_ERROR)
 	    {
-	      /* Object is deleted, initialize curr_non_del_obj_count as 0 */
-	      load_args->curr_non_del_obj_count = 0;
+	      goto end;
+	    }
+	  error_code =
+	    btree_leaf_record_get_key (thread_p, load_args->btid, &moved_recs[n_moved - 1], NULL, 0,
+				       &moved_keys[n_moved - 1]);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	  if (spage_delete (thread_p, load_args->leaf.pgptr, key_cnt) != key_cnt)
+	    {
+	      assert_release (false);
+	      error_code = ER_FAILED;
+	      goto end;
 	    }
 
-	  load_args->curr_rec_max_obj_count = BTREE_MAX_OIDCOUNT_IN_LEAF_RECORD (load_args->btid);
-	  load_args->curr_rec_obj_count = 1;
-
-#if !defined (NDEBUG)
-	  btree_check_valid_record (thread_p, load_args->btid, load_args->out_recdes, BTREE_LEAF_NODE, NULL);
-#endif
+	  next_key = &moved_keys[n_moved - 1];
+	  key_cnt--;
 	}
-      else
-	{			/* This is not the first call to this function */
-	  int c = DB_UNK;
 
-	  /*
-	   * Compare the received key with the current one.
-	   * If different, then dump the current record and create a new record.
-	   */
+      /* separator of the last key of the leaf and next key */
+      if (spage_get_record (thread_p, load_args->leaf.pgptr, key_cnt, &peek_rec, PEEK) != S_SUCCESS)
+	{
+	  assert_release (false);
+	  error_code = ER_FAILED;
+	  goto end;
+	}
+      error_code =
+	btree_leaf_record_get_key (thread_p, load_args->btid, &peek_rec, &load_args->leaf_lower_fence,
+				   load_args->leaf_prefix, &last_key);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+      error_code = btree_get_prefix_separator (&last_key, next_key, &sep_key, load_args->btid->key_type);
+      pr_clear_value (&last_key);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
 
-	  c = btree_compare_key (&this_key, &load_args->current_key, load_args->btid->key_type, 0, 1, NULL);
-	  if (c == DB_EQ || c == DB_GT)
+      sep_len = btree_get_disk_size_of_key (&sep_key);
+      if (sep_len < BTREE_MAX_KEYLEN_INPAGE)
+	{
+	  new_prefix = 0;
+	  if (!DB_IS_NULL (&load_args->leaf_lower_fence))
 	    {
-	      ;			/* ok */
+	      new_prefix = pr_midxkey_common_prefix (&load_args->leaf_lower_fence, &sep_key);
 	    }
-	  else
+	  error_code = btree_load_change_leaf_prefix (thread_p, load_args, new_prefix, false, &growth);
+	  if (error_code != NO_ERROR)
 	    {
-	      assert_release (false);
-	      goto error;
+	      goto end;
+	    }
+	  error_code = btree_make_fence_record (thread_p, load_args->btid, &sep_key, fence_rec);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
 	    }
 
-	  same_key = (c == DB_EQ) ? true : false;
-
-	  /* EQUALITY test only - doesn't care the reverse index */
-
-	  if (same_key)
+	  if (growth + (int) DB_ALIGN (fence_rec->length, BTREE_MAX_ALIGN)
+	      <= spage_max_space_for_new_record (thread_p, load_args->leaf.pgptr))
 	    {
-	      /* This key (retrieved key) is the same with the current one. */
-	      load_args->curr_rec_obj_count++;
-	      if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	      error_code = btree_load_change_leaf_prefix (thread_p, load_args, new_prefix, true, &growth);
+	      if (error_code != NO_ERROR)
 		{
-		  /* TODO: Rewrite btree_construct_leafs. It's almost impossible to follow. */
-		  load_args->curr_non_del_obj_count++;
-		  if (load_args->curr_non_del_obj_count > 1 && BTREE_IS_UNIQUE (load_args->btid->unique_pk))
-		    {
-		      /* Unique constrain violation - more than one visible records for this key. */
-		      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, &this_key, &this_oid, &this_class_oid,
-							load_args->btid->sys_btid, load_args->bt_name);
-		      ret = ER_BTREE_UNIQUE_FAILED;
-		      goto error;
-		    }
-		  if (load_args->curr_non_del_obj_count == 1)
-		    {
-		      /* When first non-deleted object is found, we must increment that number of keys for statistics. */
-		      (load_args->n_keys)++;
+		  goto end;
+		}
+	      if (spage_insert_at (thread_p, load_args->leaf.pgptr, key_cnt + 1, fence_rec) != SP_SUCCESS)
+		{
+		  assert_release (false);
+		  error_code = ER_FAILED;
+		  goto end;
+		}
+	      btree_load_update_leaf_max_key_len (load_args, sep_len);
+	      has_fence = true;
+	      break;
+	    }
+	}
+      pr_clear_value (&sep_key);
 
-		      if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
-			{
-			  /* this is the first non-deleted OID of the key; it must be placed as the first OID */
-			  BTREE_MVCC_INFO first_mvcc_info;
-			  OID first_oid, first_class_oid;
-			  int offset = 0;
+      if (btree_load_leaf_record_count (thread_p, load_args) > 1)
+	{
+	  /* try again without the last record */
+	  next_key = NULL;
+	  continue;
+	}
 
-			  /* Retrieve the first OID from leaf record */
-			  ret =
-			    btree_leaf_get_first_object (load_args->btid, &load_args->leaf_nleaf_recdes, &first_oid,
-							 &first_class_oid, &first_mvcc_info);
-			  if (ret != NO_ERROR)
-			    {
-			      goto error;
-			    }
+      /* no upper fence key; the leaf is left uncompressed and the next leaf has no lower fence key */
+      error_code = btree_load_change_leaf_prefix (thread_p, load_args, 0, true, &growth);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+      break;
+    }
 
-			  /* replace with current OID (might move memory in record) */
-			  btree_mvcc_info_from_heap_mvcc_header (&mvcc_header, &mvcc_info);
-			  btree_leaf_change_first_object (thread_p, &load_args->leaf_nleaf_recdes, load_args->btid,
-							  &this_oid, &this_class_oid, &mvcc_info, &offset, NULL, NULL);
-			  if (ret != NO_ERROR)
-			    {
-			      goto error;
-			    }
+  if (btree_proceed_leaf (thread_p, load_args) == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
 
-			  if (!load_args->overflowing)
-			    {
-			      /* Update load_args->new_pos in case record has grown after replace */
-			      load_args->new_pos += offset;
-			    }
+  pr_clear_value (&load_args->leaf_lower_fence);
+  load_args->leaf_prefix = 0;
+  if (has_fence)
+    {
+      if (spage_insert_at (thread_p, load_args->leaf.pgptr, 1, fence_rec) != SP_SUCCESS)
+	{
+	  assert_release (false);
+	  error_code = ER_FAILED;
+	  goto end;
+	}
+      btree_load_update_leaf_max_key_len (load_args, sep_len);
 
-			  assert (load_args->leaf_nleaf_recdes.length <= load_args->leaf_nleaf_recdes.area_size);
-#if !defined (NDEBUG)
-			  btree_check_valid_record (thread_p, load_args->btid, &load_args->leaf_nleaf_recdes,
-						    BTREE_LEAF_NODE, NULL);
+      load_args->leaf_lower_fence = sep_key;
+      db_make_null (&sep_key);
+    }
+
+  for (i = n_moved - 1; i >= 0; i--)
+    {
+      error_code =
+	btree_load_add_leaf_record (thread_p, load_args, &moved_recs[i], &moved_keys[i],
+				    btree_get_disk_size_of_key (&moved_keys[i]));
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+end:
+  pr_clear_value (&sep_key);
+  for (i = 0; i < n_moved; i++)
+    {
+      if (moved_recs[i].data != NULL)
+	{
+	  os_free (moved_recs[i].data);
+	}
+      pr_clear_value (&moved_keys[i]);
+    }
+  if (moved_recs != NULL)
+    {
+      os_free (moved_recs);
+    }
+  if (moved_keys != NULL)
+    {
+      os_free (moved_keys);
+    }
+
+  return error_code;
+}
+
+/*
+ * btree_load_uncompress_last_leaf () - Remove the compression of the last leaf page
+ *   return: NO_ERROR or error code
+ *   load_args(in): Collection of info. for btree load operation
+ *
+ * Note: Only leaves having both fence keys keep compressed records. If there is no room for the uncompressed records
+ * in the last leaf, its last records are moved to a new last leaf.
+ */
+static int
+btree_load_uncompress_last_leaf (THREAD_ENTRY * thread_p, LOAD_ARGS * load_args)
+{
+  int growth;
+  int error_code = NO_ERROR;
+
+  while (load_args->leaf_prefix > 0)
+    {
+      error_code = btree_load_change_leaf_prefix (thread_p, load_args, 0, false, &growth);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+
+      if (growth <= spage_max_space_for_new_record (thread_p, load_args->leaf.pgptr)
+	  || btree_load_leaf_record_count (thread_p, load_args) < 2)
+	{
+	  return btree_load_change_leaf_prefix (thread_p, load_args, 0, true, &growth);
+	}
+
+      error_code = btree_load_close_leaf (thread_p, load_args, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_first_oid () - Prepare record for the key and its first oid
+ *   return: int
+ *   this_key(in): Key
+ *   class_oid(in):
+ *   first_oid(in): First OID associated with this key; inserted into the
+ *                  record.
+ *   load_args(in): Contains fields specifying where & how to create the record
+ *
+ * Note: This function prepares the leaf record for the given key and
+ * its first OID at the storage location specified by
+ * load_args->out_recdes field.
+ */
+static int
+btree_first_oid (THREAD_ENTRY * thread_p, DB_VALUE * this_key, OID * class_oid, OID * first_oid,
+		 MVCC_REC_HEADER * p_mvcc_rec_header, LOAD_ARGS * load_args)
+{
+  int key_len;
+  int key_type;
+  int error;
+  BTREE_MVCC_INFO mvcc_info;
+
+  assert (load_args->out_recdes == &load_args->leaf_nleaf_recdes);
+
+  /* form the leaf record (create the header & insert the key) */
+  key_len = load_args->cur_key_len = btree_get_disk_size_of_key (this_key);
+  if (key_len < BTREE_MAX_KEYLEN_INPAGE)
+    {
+      key_type = BTREE_NORMAL_KEY;
+    }
+  else
+    {
+      key_type = BTREE_OVERFLOW_KEY;
+      if (VFID_ISNULL (&load_args->btid->ovfid))
+	{
+	  error = btree_create_overflow_key_file (thread_p, load_args->btid);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+  btree_mvcc_info_from_heap_mvcc_header (p_mvcc_rec_header, &mvcc_info);
+  error =
+    btree_write_record (thread_p, load_args->btid, NULL, this_key, BTREE_LEAF_NODE, key_type, key_len, true, class_oid,
+			first_oid, &mvcc_info, load_args->out_recdes);
+  if (error != NO_ERROR)
+    {
+      /* this must be an overflow key insertion failure, we assume the overflow manager has logged an error. */
+      return error;
+    }
+
+  /* Set the location where the new oid should be inserted */
+  load_args->new_pos = (load_args->out_recdes->data + load_args->out_recdes->length);
+  assert (load_args->out_recdes->length <= load_args->out_recdes->area_size);
+
+  /* Set the current key value to this_key */
+  pr_clear_value (&load_args->current_key);	/* clear previous value */
+  load_args->cur_key_len = key_len;
+
+  return pr_clone_value (this_key, &load_args->current_key);
+}
+
+/*
+ * btree_construct_leafs () - Output function for index sorting;constructs leaf
+ *                         nodes
+ *   return: int
+ *   in_recdes(in): specifies the next sort item in the sorting order.
+ *   arg(in): output arguments; provides information about how to use the
+ *            next item in the sorted list to construct the leaf nodes of
+ *            the Btree.
+ *
+ * Note: This function creates the btree leaf nodes. It is passed
+ * by the "btree_index_sort" function to the "sort_listfile" function
+ * to use the sort items to build the records and pages of the btree.
+ */
+static int
+btree_construct_leafs (THREAD_ENTRY * thread_p, const RECDES * in_recdes, void *arg)
+{
+  int ret = NO_ERROR;
+  LOAD_ARGS *load_args;
+  DB_VALUE this_key;		/* Key value in this sorted item (specified with in_recdes) */
+  OID this_class_oid = oid_Null_oid;	/* Class OID value in this sorted item */
+  OID this_oid = oid_Null_oid;	/* OID value in this sorted item */
+  OID original_oid = oid_Null_oid;
+  OID original_class_oid = oid_Null_oid;
+  int sp_success;
+  INT16 slotid;
+  bool same_key = true;
+  VPID new_ovfpgid;
+  PAGE_PTR new_ovfpgptr = NULL;
+  OR_BUF buf;
+  bool copy = false;
+  RECDES sort_key_recdes, *recdes;
+  char *next;
+  int next_size;
+  int key_size = -1;
+  BTREE_OVERFLOW_HEADER *ovf_header = NULL;
+
+  int oid_size = OR_OID_SIZE;
+  int fixed_mvccid_size = 0;
+  BTREE_MVCC_INFO mvcc_info;
+  /* TODO: What about using only MVCC info here? */
+  MVCC_REC_HEADER mvcc_header;
+  MVCC_REC_HEADER original_mvcc_header;
+
+  char notify_vacuum_rv_data_buffer[IO_MAX_PAGE_SIZE + BTREE_MAX_ALIGN];
+  char *notify_vacuum_rv_data_bufalign = PTR_ALIGN (notify_vacuum_rv_data_buffer, BTREE_MAX_ALIGN);
+  char *notify_vacuum_rv_data = notify_vacuum_rv_data_bufalign;
+  int notify_vacuum_rv_data_capacity = IO_MAX_PAGE_SIZE;
+  int notify_vacuum_rv_data_length = 0;
+
+  load_args = (LOAD_ARGS *) arg;
+
+#if defined (SERVER_MODE)
+  /* Make sure MVCCID for current transaction is generated. */
+  (void) logtb_get_current_mvccid (thread_p);
+#endif /* SERVER_MODE */
+
+  fixed_mvccid_size = 2 * OR_MVCCID_SIZE;
+  if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+    {
+      oid_size = 2 * OR_OID_SIZE;
+    }
+
+  sort_key_recdes = *in_recdes;
+  recdes = &sort_key_recdes;
+
+  next_size = sizeof (char *);
+
+  for (;;)
+    {				/* Infinite loop; will exit with break statement */
+
+      next = *(char **) recdes->data;	/* save forward link */
+
+      /* First decompose the input record into the key and oid components */
+      or_init (&buf, recdes->data, recdes->length);
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, MAX_ALIGNMENT));
+
+      /* Skip forward link, value_has_null */
+      or_advance (&buf, next_size + OR_INT_SIZE);
+
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      /* Instance level uniqueness checking */
+      if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+	{			/* unique index */
+	  /* extract class OID */
+	  ret = or_get_oid (&buf, &this_class_oid);
+	  if (ret != NO_ERROR)
+	    {
+	      goto error;
+	    }
+	}
+
+      /* Get OID */
+      ret = or_get_oid (&buf, &this_oid);
+      if (ret != NO_ERROR)
+	{
+	  goto error;
+	}
+
+      /* Create MVCC header */
+      BTREE_INIT_MVCC_HEADER (&mvcc_header);
+
+      ret = or_get_mvccid (&buf, &MVCC_GET_INSID (&mvcc_header));
+      if (ret != NO_ERROR)
+	{
+	  goto error;
+	}
+
+      ret = or_get_mvccid (&buf, &MVCC_GET_DELID (&mvcc_header));
+      if (ret != NO_ERROR)
+	{
+	  goto error;
+	}
+
+#if defined(SERVER_MODE)
+      if (MVCC_GET_INSID (&mvcc_header) != MVCCID_ALL_VISIBLE)
+	{
+	  /* Set valid insert MVCCID flag */
+	  MVCC_SET_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_INSID);
+	}
+#else
+      /* all inserted OIDs are created as visible in stand-alone */
+      MVCC_SET_INSID (&mvcc_header, MVCCID_ALL_VISIBLE);
+#endif /* SERVER_MODE */
+
+      if (MVCC_GET_DELID (&mvcc_header) != MVCCID_NULL)
+	{
+#if defined(SERVER_MODE)
+	  /* Set valid delete MVCCID */
+	  MVCC_SET_FLAG_BITS (&mvcc_header, OR_MVCC_FLAG_VALID_DELID);
+#else
+	  /* standalone : ignore deleted OID */
+	  continue;
+#endif /* SERVER_MODE */
+	}
+
+      /* Save OID, class OID and MVCC header since they may be replaced. */
+      COPY_OID (&original_oid, &this_oid);
+      COPY_OID (&original_class_oid, &this_class_oid);
+      original_mvcc_header = mvcc_header;
+
+      assert (buf.ptr == PTR_ALIGN (buf.ptr, INT_ALIGNMENT));
+
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	{
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load new object(%d, %d, %d) class(%d, %d, %d) and btid(%d, (%d, %d)) with "
+			 "mvccinfo=%llu| %llu", this_oid.volid, this_oid.pageid, this_oid.slotid, this_class_oid.volid,
+			 this_class_oid.pageid, this_class_oid.slotid, load_args->btid->sys_btid->root_pageid,
+			 load_args->btid->sys_btid->vfid.volid, load_args->btid->sys_btid->vfid.fileid,
+			 MVCC_GET_INSID (&mvcc_header), MVCC_GET_DELID (&mvcc_header));
+	}
+
+      /* Do not copy the string--just use the pointer.  The pr_ routines for strings and sets have different semantics
+       * for length. */
+      if (TP_DOMAIN_TYPE (load_args->btid->key_type) == DB_TYPE_MIDXKEY)
+	{
+	  key_size = CAST_STRLEN (buf.endptr - buf.ptr);
+	}
+
+      ret = load_args->btid->key_type->type->data_readval (&buf, &this_key, load_args->btid->key_type, key_size, copy,
+							   NULL, 0);
+      if (ret != NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_CORRUPTED, 0);
+	  goto error;
+	}
+
+      /* Find out if this is the first call to this function */
+      if (VPID_ISNULL (&(load_args->leaf.vpid)))
+	{
+	  /* This is the first call to this function; so, initialize some fields in the LOAD_ARGS structure */
+
+	  /* Allocate the first page for the index */
+	  ret =
+	    btree_load_new_page (thread_p, load_args->btid->sys_btid, &load_args->leaf.hdr, 1, &load_args->leaf.vpid,
+				 &load_args->leaf.pgptr);
+	  if (ret != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto error;
+	    }
+	  if (load_args->leaf.pgptr == NULL || VPID_ISNULL (&load_args->leaf.vpid))
+	    {
+	      assert_release (false);
+	      goto error;
+	    }
+	  /* Save first leaf VPID. */
+	  load_args->vpid_first_leaf = load_args->leaf.vpid;
+
+#if 0				/* TODO: currently not used */
+	  load_args->first_leafpgid = load_args->leaf.vpid;
+#endif
+	  load_args->overflowing = false;
+	  assert (load_args->ovf.pgptr == NULL);
+
+	  /* Create the first record of the current page in main memory */
+	  load_args->out_recdes = &load_args->leaf_nleaf_recdes;
+	  ret = btree_first_oid (thread_p, &this_key, &this_class_oid, &this_oid, &mvcc_header, load_args);
+	  if (ret != NO_ERROR)
+	    {
+	      goto error;
+	    }
+
+	  if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	    {
+	      /* Object was not deleted, increment curr_non_del_obj_count */
+	      load_args->curr_non_del_obj_count = 1;
+
+	      /* Increment the key counter if object is not deleted */
+	      (load_args->n_keys)++;
+	    }
+	  else
+	    {
+	      /* Object is deleted, initialize curr_non_del_obj_count as 0 */
+	      load_args->curr_non_del_obj_count = 0;
+	    }
+
+	  load_args->curr_rec_max_obj_count = BTREE_MAX_OIDCOUNT_IN_LEAF_RECORD (load_args->btid);
+	  load_args->curr_rec_obj_count = 1;
+
+#if !defined (NDEBUG)
+	  btree_check_valid_record (thread_p, load_args->btid, load_args->out_recdes, BTREE_LEAF_NODE, NULL);
+#endif
+	}
+      else
+	{			/* This is not the first call to this function */
+	  int c = DB_UNK;
+
+	  /*
+	   * Compare the received key with the current one.
+	   * If different, then dump the current record and create a new record.
+	   */
+
+	  c = btree_compare_key (&this_key, &load_args->current_key, load_args->btid->key_type, 0, 1, NULL);
+	  if (c == DB_EQ || c == DB_GT)
+	    {
+	      ;			/* ok */
+	    }
+	  else
+	    {
+	      assert_release (false);
+	      goto error;
+	    }
+
+	  same_key = (c == DB_EQ) ? true : false;
+
+	  /* EQUALITY test only - doesn't care the reverse index */
+
+	  if (same_key)
+	    {
+	      /* This key (retrieved key) is the same with the current one. */
+	      load_args->curr_rec_obj_count++;
+	      if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+		{
+		  /* TODO: Rewrite btree_construct_leafs. It's almost impossible to follow. */
+		  load_args->curr_non_del_obj_count++;
+		  if (load_args->curr_non_del_obj_count > 1 && BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+		    {
+		      /* Unique constrain violation - more than one visible records for this key. */
+		      BTREE_SET_UNIQUE_VIOLATION_ERROR (thread_p, &this_key, &this_oid, &this_class_oid,
+							load_args->btid->sys_btid, load_args->bt_name);
+		      ret = ER_BTREE_UNIQUE_FAILED;
+		      goto error;
+		    }
+		  if (load_args->curr_non_del_obj_count == 1)
+		    {
+		      /* When first non-deleted object is found, we must increment that number of keys for statistics. */
+		      (load_args->n_keys)++;
+
+		      if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+			{
+			  /* this is the first non-deleted OID of the key; it must be placed as the first OID */
+			  BTREE_MVCC_INFO first_mvcc_info;
+			  OID first_oid, first_class_oid;
+			  int offset = 0;
+
+			  /* Retrieve the first OID from leaf record */
+			  ret =
+			    btree_leaf_get_first_object (load_args->btid, &load_args->leaf_nleaf_recdes, &first_oid,
+							 &first_class_oid, &first_mvcc_info);
+			  if (ret != NO_ERROR)
+			    {
+			      goto error;
+			    }
+
+			  /* replace with current OID (might move memory in record) */
+			  btree_mvcc_info_from_heap_mvcc_header (&mvcc_header, &mvcc_info);
+			  btree_leaf_change_first_object (thread_p, &load_args->leaf_nleaf_recdes, load_args->btid,
+							  &this_oid, &this_class_oid, &mvcc_info, &offset, NULL, NULL);
+			  if (ret != NO_ERROR)
+			    {
+			      goto error;
+			    }
+
+			  if (!load_args->overflowing)
+			    {
+			      /* Update load_args->new_pos in case record has grown after replace */
+			      load_args->new_pos += offset;
+			    }
+
+			  assert (load_args->leaf_nleaf_recdes.length <= load_args->leaf_nleaf_recdes.area_size);
+#if !defined (NDEBUG)
+			  btree_check_valid_record (thread_p, load_args->btid, &load_args->leaf_nleaf_recdes,
+						    BTREE_LEAF_NODE, NULL);
+#endif
+
+			  /* save first OID as current OID, to be written */
+			  COPY_OID (&this_oid, &first_oid);
+			  COPY_OID (&this_class_oid, &first_class_oid);
+			  btree_mvcc_info_to_heap_mvcc_header (&first_mvcc_info, &mvcc_header);
+			}
+		    }
+		}
+
+	      /* Check if there is space in the memory record for the new OID. If not dump the current record and
+	       * create a new record. */
+
+	      if (load_args->curr_rec_obj_count > load_args->curr_rec_max_obj_count)
+		{		/* There is no space for the new oid */
+		  if (load_args->overflowing == true)
+		    {
+		      /* Store the record in current overflow page */
+		      assert (load_args->out_recdes == &load_args->ovf_recdes);
+		      sp_success = spage_insert (thread_p, load_args->ovf.pgptr, &load_args->ovf_recdes, &slotid);
+		      if (sp_success != SP_SUCCESS)
+			{
+			  goto error;
+			}
+
+		      assert (slotid > 0);
+
+		      /* Allocate the new overflow page */
+		      ret =
+			btree_load_new_page (thread_p, load_args->btid->sys_btid, NULL, -1, &new_ovfpgid,
+					     &new_ovfpgptr);
+		      if (ret != NO_ERROR)
+			{
+			  ASSERT_ERROR ();
+			  goto error;
+			}
+		      if (new_ovfpgptr == NULL)
+			{
+			  assert_release (false);
+			  ret = ER_FAILED;
+			  goto error;
+			}
+
+		      /* make the current overflow page point to the new one */
+		      ovf_header = btree_get_overflow_header (thread_p, load_args->ovf.pgptr);
+		      if (ovf_header == NULL)
+			{
+			  goto error;
+			}
+
+		      ovf_header->next_vpid = new_ovfpgid;
+
+		      /* Save the current overflow page */
+		      btree_log_page (thread_p, &load_args->btid->sys_btid->vfid, load_args->ovf.pgptr);
+		      load_args->ovf.pgptr = NULL;
+
+		      /* Make the new overflow page become the current one */
+		      load_args->ovf.vpid = new_ovfpgid;
+		      load_args->ovf.pgptr = new_ovfpgptr;
+		      new_ovfpgptr = NULL;
+		    }
+		  else
+		    {		/* Current page is a leaf page */
+		      assert (load_args->out_recdes == &load_args->leaf_nleaf_recdes);
+		      /* Allocate the new overflow page */
+		      ret =
+			btree_load_new_page (thread_p, load_args->btid->sys_btid, NULL, -1, &load_args->ovf.vpid,
+					     &load_args->ovf.pgptr);
+		      if (ret != NO_ERROR)
+			{
+			  ASSERT_ERROR ();
+			  goto error;
+			}
+		      if (load_args->ovf.pgptr == NULL)
+			{
+			  assert_release (false);
+			  goto error;
+			}
+
+		      /* Connect the new overflow page to the leaf page */
+		      btree_leaf_record_change_overflow_link (thread_p, load_args->btid, &load_args->leaf_nleaf_recdes,
+							      &load_args->ovf.vpid, NULL, NULL);
+
+		      load_args->overflowing = true;
+
+		      /* Set out_recdes to ovf_recdes. */
+		      load_args->out_recdes = &load_args->ovf_recdes;
+		    }		/* Current page is a leaf page */
+
+		  /* Initialize the memory area for the next record */
+		  assert (load_args->out_recdes == &load_args->ovf_recdes);
+		  load_args->out_recdes->length = 0;
+		  load_args->new_pos = load_args->out_recdes->data;
+		  load_args->curr_rec_max_obj_count =
+		    BTREE_MAX_OIDCOUNT_IN_SIZE (load_args->btid,
+						spage_max_space_for_new_record (thread_p, load_args->ovf.pgptr));
+		  load_args->curr_rec_obj_count = 1;
+		}		/* no space for the new OID */
+
+	      if (load_args->overflowing || BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+		{
+		  /* all overflow OIDs have fixed header size; also, all OIDs of a unique index key (except the first
+		   * one) have fixed size */
+		  BTREE_MVCC_SET_HEADER_FIXED_SIZE (&mvcc_header);
+		}
+
+	      /* Insert new OID, class OID (for unique), and MVCCID's. */
+	      /* Insert OID (and MVCC flags) */
+	      btree_set_mvcc_flags_into_oid (&mvcc_header, &this_oid);
+	      OR_PUT_OID (load_args->new_pos, &this_oid);
+	      load_args->out_recdes->length += OR_OID_SIZE;
+	      load_args->new_pos += OR_OID_SIZE;
+
+	      if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
+		{
+		  /* Insert class OID */
+		  OR_PUT_OID (load_args->new_pos, &this_class_oid);
+		  load_args->out_recdes->length += OR_OID_SIZE;
+		  load_args->new_pos += OR_OID_SIZE;
+		}
+
+	      btree_mvcc_info_from_heap_mvcc_header (&mvcc_header, &mvcc_info);
+	      /* Insert MVCCID's */
+	      load_args->out_recdes->length += btree_packed_mvccinfo_size (&mvcc_info);
+	      load_args->new_pos = btree_pack_mvccinfo (load_args->new_pos, &mvcc_info);
+
+	      assert (load_args->out_recdes->length <= load_args->out_recdes->area_size);
+#if !defined (NDEBUG)
+	      btree_check_valid_record (thread_p, load_args->btid, load_args->out_recdes,
+					(load_args->overflowing ? BTREE_OVERFLOW_NODE : BTREE_LEAF_NODE), NULL);
+#endif
+	    }			/* same key */
+	  else
+	    {
+	      /* Current key is finished; dump this output record to the disk page */
+
+	      /* Insert current leaf record */
+	      ret =
+		btree_load_add_leaf_record (thread_p, load_args, &load_args->leaf_nleaf_recdes, &load_args->current_key,
+					    load_args->cur_key_len);
+	      if (ret != NO_ERROR)
+		{
+		  goto error;
+		}
+
+	      if (load_args->overflowing)
+		{
+		  /* Insert the new record to the current overflow page and flush this page */
+
+		  assert (load_args->out_recdes == &load_args->ovf_recdes);
+
+		  /* Store the record in current overflow page */
+		  sp_success = spage_insert (thread_p, load_args->ovf.pgptr, load_args->out_recdes, &slotid);
+		  if (sp_success != SP_SUCCESS)
+		    {
+		      goto error;
+		    }
+
+		  assert (slotid > 0);
+
+		  /* Save the current overflow page */
+		  btree_log_page (thread_p, &load_args->btid->sys_btid->vfid, load_args->ovf.pgptr);
+		  load_args->ovf.pgptr = NULL;
+
+		  /* Turn off the overflowing mode */
+		  load_args->overflowing = false;
+		}		/* Current page is an overflow page */
+	      else
+		{
+		  assert (load_args->out_recdes == &load_args->leaf_nleaf_recdes);
+		}
+
+	      /* Create the first part of the next record in main memory */
+	      load_args->out_recdes = &load_args->leaf_nleaf_recdes;
+	      ret = btree_first_oid (thread_p, &this_key, &this_class_oid, &this_oid, &mvcc_header, load_args);
+	      if (ret != NO_ERROR)
+		{
+		  goto error;
+		}
+
+	      if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+		{
+		  /* Object was not deleted, increment curr_non_del_obj_count. */
+		  load_args->curr_non_del_obj_count = 1;
+		  (load_args->n_keys)++;	/* Increment the key counter */
+		}
+	      else
+		{
+		  /* Object is deleted, initialize curr_non_del_obj_count as 0. */
+		  load_args->curr_non_del_obj_count = 0;
+		}
+
+	      load_args->curr_rec_max_obj_count = BTREE_MAX_OIDCOUNT_IN_LEAF_RECORD (load_args->btid);
+	      load_args->curr_rec_obj_count = 1;
+
+#if !defined (NDEBUG)
+	      btree_check_valid_record (thread_p, load_args->btid, load_args->out_recdes, BTREE_LEAF_NODE, NULL);
 #endif
+	    }			/* different key */
+	}
 
-			  /* save first OID as current OID, to be written */
-			  COPY_OID (&this_oid, &first_oid);
-			  COPY_OID (&this_class_oid, &first_class_oid);
-			  btree_mvcc_info_to_heap_mvcc_header (&first_mvcc_info, &mvcc_header);
-			}
-		    }
-		}
+      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	{
+	  _er_log_debug (ARG_FILE_LINE,
+			 "DEBUG_BTREE: load added object(%d, %d, %d) "
+			 "class(%d, %d, %d) and btid(%d, (%d, %d)) with mvccinfo=%llu | %llu", this_oid.volid,
+			 this_oid.pageid, this_oid.slotid, this_class_oid.volid, this_class_oid.pageid,
+			 this_class_oid.slotid, load_args->btid->sys_btid->root_pageid,
+			 load_args->btid->sys_btid->vfid.volid, load_args->btid->sys_btid->vfid.fileid,
+			 MVCC_GET_INSID (&mvcc_header), MVCC_GET_DELID (&mvcc_header));
+	}
+
+      /* Some objects have been recently deleted and couldn't be filtered (because there may be running transaction
+       * that can still see them. However, they must be vacuumed later. Vacuum can only find them by parsing log,
+       * therefore some log records are required. These are dummy records with the sole purpose of notifying vacuum.
+       * Since this_oid, this_class_oid and mvcc_header could be replaced in case first object of unique index had to
+       * be swapped, we will use original_oid, original_class_oid and original_mvcc_header to log object load for
+       * vacuum. */
+      if (MVCC_IS_HEADER_DELID_VALID (&original_mvcc_header)
+	  || MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&original_mvcc_header))
+	{
+	  /* There is something to vacuum for this object */
+	  char *pgptr;
+
+	  pgptr = (load_args->overflowing ? load_args->ovf.pgptr : load_args->leaf.pgptr);
+
+	  /* clear flags for logging */
+	  btree_clear_mvcc_flags_from_oid (&original_oid);
+
+	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+	    {
+	      _er_log_debug (ARG_FILE_LINE,
+			     "DEBUG_BTREE: load notify vacuum object(%d, %d, %d) "
+			     "class(%d, %d, %d) and btid(%d, (%d, %d)) with mvccinfo=%llu | %llu",
+			     original_oid.volid, original_oid.pageid, original_oid.slotid, original_class_oid.volid,
+			     original_class_oid.pageid, original_class_oid.slotid,
+			     load_args->btid->sys_btid->root_pageid, load_args->btid->sys_btid->vfid.volid,
+			     load_args->btid->sys_btid->vfid.fileid, MVCC_GET_INSID (&original_mvcc_header),
+			     MVCC_GET_DELID (&original_mvcc_header));
+	    }
+
+	  /* append log data */
+	  btree_mvcc_info_from_heap_mvcc_header (&original_mvcc_header, &mvcc_info);
+	  ret =
+	    btree_rv_save_keyval_for_undo (load_args->btid, &this_key, &original_class_oid, &original_oid, &mvcc_info,
+					   BTREE_OP_NOTIFY_VACUUM, notify_vacuum_rv_data_bufalign,
+					   &notify_vacuum_rv_data, &notify_vacuum_rv_data_capacity,
+					   &notify_vacuum_rv_data_length);
+	  if (ret != NO_ERROR)
+	    {
+	      goto error;
+	    }
+	  log_append_undo_data2 (thread_p, RVBT_MVCC_NOTIFY_VACUUM, &load_args->btid->sys_btid->vfid, NULL, -1,
+				 notify_vacuum_rv_data_length, notify_vacuum_rv_data);
+	  pgbuf_set_dirty (thread_p, pgptr, DONT_FREE);
+	}
+
+      /* set level 1 to leaf */
+      load_args->leaf.hdr.node_level = 1;
+
+      if (this_key.need_clear)
+	{
+	  copy = true;
+	}
+
+      btree_clear_key_value (&copy, &this_key);
+
+      if (next)
+	{			/* move to next link */
+	  recdes->data = next;
+	  recdes->length = SORT_RECORD_LENGTH (next);
+	}
+      else
+	{
+	  break;		/* exit infinite loop */
+	}
+
+    }
+
+  if (notify_vacuum_rv_data != NULL && notify_vacuum_rv_data != notify_vacuum_rv_data_bufalign)
+    {
+      db_private_free (thread_p, notify_vacuum_rv_data);
+    }
+
+  assert (ret == NO_ERROR);
+  return ret;
+
+error:
+  if (load_args->leaf.pgptr)
+    {
+      pgbuf_unfix_and_init (thread_p, load_args->leaf.pgptr);
+    }
+  if (load_args->ovf.pgptr)
+    {
+      pgbuf_unfix_and_init (thread_p, load_args->ovf.pgptr);
+    }
+  if (new_ovfpgptr)
+    {
+      pgbuf_unfix_and_init (thread_p, new_ovfpgptr);
+    }
+  btree_clear_key_value (&copy, &this_key);
+
+  if (notify_vacuum_rv_data != NULL && notify_vacuum_rv_data != notify_vacuum_rv_data_bufalign)
+    {
+      db_private_free (thread_p, notify_vacuum_rv_data);
+    }
+
+  assert (er_errid () != NO_ERROR);
+  return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+}
+
+#if defined(CUBRID_DEBUG)
+/*
+ * btree_dump_sort_output () - Sample output function for index sorting
+ *   return: NO_ERROR
+ *   recdes(in):
+ *   load_args(in):
+ *
+ * Note: This function is a debugging function. It is passed by the
+ * btree_index_sort function to the sort_listfile function to print
+ * out the contents of the sort items once they are obtained in
+ * the requested sorting order.
+ *
+ */
+static int
+btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args)
+{
+  OID this_oid;
+  DB_VALUE this_key;
+  OR_BUF buf;
+  bool copy = false;
+  int key_size = -1;
+  int ret = NO_ERROR;
+
+  /* First decompose the input record into the key and oid components */
+  or_init (&buf, recdes->data, recdes->length);
+
+  if (or_get_oid (&buf, &this_oid) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+  buf.ptr = PTR_ALIGN (buf.ptr, MAX_ALIGNMENT);
+
+  /* Do not copy the string--just use the pointer.  The pr_ routines for strings and sets have different semantics for
+   * length. */
+  if (TP_DOMAIN_TYPE (load_args->btid->key_type) == DB_TYPE_MIDXKEY)
+    {
+      key_size = buf.endptr - buf.ptr;
+    }
+
+  if ((*(load_args->btid->key_type->type->readval)) (&buf, &this_key, load_args->btid->key_type, key_size, copy, NULL,
+						     0) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  printf ("Attribute: ");
+  btree_dump_key (stdout, &this_key);
+  printf ("   Volid: %d", this_oid.volid);
+  printf ("   Pageid: %d", this_oid.pageid);
+  printf ("   Slotid: %d\n", this_oid.slotid);
+
+end:
+
+  copy = btree_clear_key_value (copy, &this_key);
+
+  return ret;
+
+exit_on_error:
+
+  return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+}
+#endif /* CUBRID_DEBUG */
+
+/*
+ * btree_index_sort () - Sort for the index file creation
+ *   return: int
+ *   sort_args(in): sort arguments; specifies the sort-attribute as well as
+ *	            the structure of the input objects
+ *   out_func(in): output function to utilize the sorted items as they are
+ *                 produced
+ *   out_args(in): arguments to the out_func.
+ *
+ * Note: This function supports the initial loading phase of B+tree
+ * indices by providing an ordered list of (index-attribute
+ * value, object address) pairs. It uses the general sorting
+ * facility provided in the "sr" module.
+ * When index_load_parallel_degree allows it, the heap pages are scanned
+ * and the keys are extracted by several workers; the sort is still fed
+ * by this thread, which also builds the leaves from the sorted items.
+ */
+static int
+btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args)
+{
+  int est_inp_pg_cnt = 0;
+  int npages, nobjs, avg_length;
+  int i;
+  int error_code;
+
+  /* the heap pages are an upper bound of the pages of sort items */
+  for (i = 0; i < sort_args->n_classes; i++)
+    {
+      if (!HFID_IS_NULL (&sort_args->hfids[i]) && heap_estimate (thread_p, &sort_args->hfids[i], &npages, &nobjs,
+								   &avg_length) > 0)
+	{
+	  est_inp_pg_cnt += npages;
+	}
+    }
+
+#if defined (SERVER_MODE)
+  error_code = btree_px_load_start (thread_p, sort_args);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+#endif /* SERVER_MODE */
+
+  error_code = sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, est_inp_pg_cnt, &btree_sort_get_next,
+			      sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP, NO_SORT_LIMIT);
+
+#if defined (SERVER_MODE)
+  if (sort_args->px_load != NULL)
+    {
+      btree_px_load_end (thread_p, sort_args);
+    }
+#endif /* SERVER_MODE */
+
+  return error_code;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * btree_px_load_start () - start workers to extract the keys of index from heap pages in parallel
+ *   return: error code
+ *   sort_args(in/out): sort arguments; px_load is set if workers are started
+ *
+ * Note: Filter and function indexes are not loaded in parallel; their predicates and expressions are unpacked once,
+ *       for this thread. The sorting thread is one of the workers; px_load is shared with the tasks and may outlive
+ *       the load, so it is not allocated in the private heap.
+ */
+static int
+btree_px_load_start (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  BTREE_PX_LOAD *px_load;
+  BTREE_PX_LOAD_WORKER *worker;
+  int n_workers;
+  int i;
+  int error_code = NO_ERROR;
+
+  assert (sort_args->px_load == NULL && !sort_args->is_px_worker);
+
+  n_workers = MIN (prm_get_integer_value (PRM_ID_INDEX_LOAD_PARALLEL_DEGREE), fileio_os_sysconf ());
+  n_workers = MIN (n_workers, (int) cubthread::parallel_query_worker_pool::get_worker_count () + 1);
+  if (n_workers <= 1 || sort_args->filter != NULL || sort_args->func_index_info != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  px_load = (BTREE_PX_LOAD *) malloc (sizeof (BTREE_PX_LOAD));
+  if (px_load == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (BTREE_PX_LOAD));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  px_load->vpids = NULL;
+  px_load->page_classes = NULL;
+  px_load->n_vpids = 0;
+  px_load->workers = NULL;
+
+  error_code = btree_px_load_collect_pages (thread_p, sort_args, px_load);
+  if (error_code != NO_ERROR)
+    {
+      goto exit;
+    }
+  n_workers = MIN (n_workers, px_load->n_vpids / BTREE_PX_LOAD_MIN_PAGES_PER_WORKER);
+  if (n_workers <= 1)
+    {
+      /* small heaps; not worth it */
+      goto exit;
+    }
+
+  px_load->workers = (BTREE_PX_LOAD_WORKER *) db_private_alloc (thread_p, n_workers * sizeof (BTREE_PX_LOAD_WORKER));
+  if (px_load->workers == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, n_workers * sizeof (BTREE_PX_LOAD_WORKER));
+      goto exit;
+    }
+
+  px_load->next_page = 0;
+  px_load->tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  px_load->queue_head = px_load->queue_tail = NULL;
+  px_load->n_queued = 0;
+  px_load->max_queued = n_workers * BTREE_PX_LOAD_MAX_QUEUED_BATCHES_PER_WORKER;
+  px_load->n_started = 1;	/* the sorting thread takes the first worker */
+  px_load->n_done = 0;
+  px_load->has_error = false;
+  px_load->is_stopped = false;
+  px_load->is_closed = false;
+  px_load->ref_count = n_workers;
+  px_load->cur_batch = NULL;
+  px_load->n_workers = n_workers;
+  (void) pthread_mutex_init (&px_load->mutex, NULL);
+  (void) pthread_cond_init (&px_load->cond, NULL);
+
+  for (i = 0; i < n_workers; i++)
+    {
+      worker = &px_load->workers[i];
+      worker->error_code = NO_ERROR;
+      worker->error = NULL;
+
+      /* workers start their own scan of the class of their first page */
+      worker->sort_args = *sort_args;
+      worker->sort_args.px_load = px_load;
+      worker->sort_args.is_px_worker = true;
+      worker->sort_args.cur_class = -1;
+      OID_SET_NULL (&worker->sort_args.cur_oid);
+      worker->sort_args.scancache_inited = 0;
+      worker->sort_args.attrinfo_inited = 0;
+      worker->sort_args.n_nulls = 0;
+      worker->sort_args.n_oids = 0;
+    }
 
-	      /* Check if there is space in the memory record for the new OID. If not dump the current record and
-	       * create a new record. */
+  sort_args->px_load = px_load;
 
-	      if (load_args->curr_rec_obj_count > load_args->curr_rec_max_obj_count)
-		{		/* There is no space for the new oid */
-		  if (load_args->overflowing == true)
-		    {
-		      /* Store the record in current overflow page */
-		      assert (load_args->out_recdes == &load_args->ovf_recdes);
-		      sp_success = spage_insert (thread_p, load_args->ovf.pgptr, &load_args->ovf_recdes, &slotid);
-		      if (sp_success != SP_SUCCESS)
-			{
-			  goto error;
-			}
+  for (i = 1; i < n_workers; i++)
+    {
+      thread_get_manager ()->push_task (cubthread::parallel_query_worker_pool::get_instance (),
+					new cubthread::entry_callable_task (std::bind (btree_px_load_execute,
+										       std::placeholders::_1, px_load)));
+    }
 
-		      assert (slotid > 0);
+  return NO_ERROR;
 
-		      /* Allocate the new overflow page */
-		      ret =
-			btree_load_new_page (thread_p, load_args->btid->sys_btid, NULL, -1, &new_ovfpgid,
-					     &new_ovfpgptr);
-		      if (ret != NO_ERROR)
-			{
-			  ASSERT_ERROR ();
-			  goto error;
-			}
-		      if (new_ovfpgptr == NULL)
-			{
-			  assert_release (false);
-			  ret = ER_FAILED;
-			  goto error;
-			}
+exit:
+  if (px_load->workers != NULL)
+    {
+      db_private_free_and_init (thread_p, px_load->workers);
+    }
+  if (px_load->vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, px_load->vpids);
+    }
+  if (px_load->page_classes != NULL)
+    {
+      db_private_free_and_init (thread_p, px_load->page_classes);
+    }
+  free_and_init (px_load);
 
-		      /* make the current overflow page point to the new one */
-		      ovf_header = btree_get_overflow_header (thread_p, load_args->ovf.pgptr);
-		      if (ovf_header == NULL)
-			{
-			  goto error;
-			}
+  return error_code;
+}
 
-		      ovf_header->next_vpid = new_ovfpgid;
+/*
+ * btree_px_load_collect_pages () - collect the user pages of all non-null heaps to be distributed among workers
+ *   return: error code
+ *   sort_args(in): sort arguments
+ *   px_load(in/out): parallel load; vpids, page_classes and n_vpids are set
+ */
+static int
+btree_px_load_collect_pages (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, BTREE_PX_LOAD * px_load)
+{
+  VPID *class_vpids = NULL;
+  int n_class_vpids = 0;
+  void *new_area;
+  int i, j;
+  int error_code = NO_ERROR;
 
-		      /* Save the current overflow page */
-		      btree_log_page (thread_p, &load_args->btid->sys_btid->vfid, load_args->ovf.pgptr);
-		      load_args->ovf.pgptr = NULL;
+  for (i = 0; i < sort_args->n_classes; i++)
+    {
+      if (HFID_IS_NULL (&sort_args->hfids[i]))
+	{
+	  continue;
+	}
 
-		      /* Make the new overflow page become the current one */
-		      load_args->ovf.vpid = new_ovfpgid;
-		      load_args->ovf.pgptr = new_ovfpgptr;
-		      new_ovfpgptr = NULL;
-		    }
-		  else
-		    {		/* Current page is a leaf page */
-		      assert (load_args->out_recdes == &load_args->leaf_nleaf_recdes);
-		      /* Allocate the new overflow page */
-		      ret =
-			btree_load_new_page (thread_p, load_args->btid->sys_btid, NULL, -1, &load_args->ovf.vpid,
-					     &load_args->ovf.pgptr);
-		      if (ret != NO_ERROR)
-			{
-			  ASSERT_ERROR ();
-			  goto error;
-			}
-		      if (load_args->ovf.pgptr == NULL)
-			{
-			  assert_release (false);
-			  goto error;
-			}
+      error_code = file_collect_user_pages (thread_p, &sort_args->hfids[i].vfid, &class_vpids, &n_class_vpids);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      if (n_class_vpids == 0)
+	{
+	  continue;
+	}
 
-		      /* Connect the new overflow page to the leaf page */
-		      btree_leaf_record_change_overflow_link (thread_p, load_args->btid, &load_args->leaf_nleaf_recdes,
-							      &load_args->ovf.vpid, NULL, NULL);
+      new_area = db_private_realloc (thread_p, px_load->vpids, (px_load->n_vpids + n_class_vpids) * sizeof (VPID));
+      if (new_area == NULL)
+	{
+	  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, (px_load->n_vpids + n_class_vpids) * sizeof (VPID));
+	  break;
+	}
+      px_load->vpids = (VPID *) new_area;
 
-		      load_args->overflowing = true;
+      new_area = db_private_realloc (thread_p, px_load->page_classes,
+				     (px_load->n_vpids + n_class_vpids) * sizeof (int));
+      if (new_area == NULL)
+	{
+	  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, (px_load->n_vpids + n_class_vpids) * sizeof (int));
+	  break;
+	}
+      px_load->page_classes = (int *) new_area;
 
-		      /* Set out_recdes to ovf_recdes. */
-		      load_args->out_recdes = &load_args->ovf_recdes;
-		    }		/* Current page is a leaf page */
+      memcpy (&px_load->vpids[px_load->n_vpids], class_vpids, n_class_vpids * sizeof (VPID));
+      for (j = 0; j < n_class_vpids; j++)
+	{
+	  px_load->page_classes[px_load->n_vpids + j] = i;
+	}
+      px_load->n_vpids += n_class_vpids;
 
-		  /* Initialize the memory area for the next record */
-		  assert (load_args->out_recdes == &load_args->ovf_recdes);
-		  load_args->out_recdes->length = 0;
-		  load_args->new_pos = load_args->out_recdes->data;
-		  load_args->curr_rec_max_obj_count =
-		    BTREE_MAX_OIDCOUNT_IN_SIZE (load_args->btid,
-						spage_max_space_for_new_record (thread_p, load_args->ovf.pgptr));
-		  load_args->curr_rec_obj_count = 1;
-		}		/* no space for the new OID */
+      db_private_free_and_init (thread_p, class_vpids);
+    }
 
-	      if (load_args->overflowing || BTREE_IS_UNIQUE (load_args->btid->unique_pk))
-		{
-		  /* all overflow OIDs have fixed header size; also, all OIDs of a unique index key (except the first
-		   * one) have fixed size */
-		  BTREE_MVCC_SET_HEADER_FIXED_SIZE (&mvcc_header);
-		}
+  if (class_vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, class_vpids);
+    }
+  return error_code;
+}
 
-	      /* Insert new OID, class OID (for unique), and MVCCID's. */
-	      /* Insert OID (and MVCC flags) */
-	      btree_set_mvcc_flags_into_oid (&mvcc_header, &this_oid);
-	      OR_PUT_OID (load_args->new_pos, &this_oid);
-	      load_args->out_recdes->length += OR_OID_SIZE;
-	      load_args->new_pos += OR_OID_SIZE;
+/*
+ * btree_px_load_end () - stop the workers and release the parallel load; executed by the sorting thread
+ *   return: void
+ *   sort_args(in/out): sort arguments; the counters of workers are added
+ *
+ * Note: Workers are still scanning when the sort is aborted; they stop at next page or when handing a batch. Only the
+ *       workers that started are waited for.
+ */
+static void
+btree_px_load_end (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  BTREE_PX_LOAD *px_load = sort_args->px_load;
+  BTREE_PX_LOAD_BATCH *batch;
+  int i;
+  int rv;
 
-	      if (BTREE_IS_UNIQUE (load_args->btid->unique_pk))
-		{
-		  /* Insert class OID */
-		  OR_PUT_OID (load_args->new_pos, &this_class_oid);
-		  load_args->out_recdes->length += OR_OID_SIZE;
-		  load_args->new_pos += OR_OID_SIZE;
-		}
+  assert (px_load != NULL);
 
-	      btree_mvcc_info_from_heap_mvcc_header (&mvcc_header, &mvcc_info);
-	      /* Insert MVCCID's */
-	      load_args->out_recdes->length += btree_packed_mvccinfo_size (&mvcc_info);
-	      load_args->new_pos = btree_pack_mvccinfo (load_args->new_pos, &mvcc_info);
+  (void) ATOMIC_TAS_32 (&px_load->next_page, px_load->n_vpids);
 
-	      assert (load_args->out_recdes->length <= load_args->out_recdes->area_size);
-#if !defined (NDEBUG)
-	      btree_check_valid_record (thread_p, load_args->btid, load_args->out_recdes,
-					(load_args->overflowing ? BTREE_OVERFLOW_NODE : BTREE_LEAF_NODE), NULL);
-#endif
-	    }			/* same key */
-	  else
-	    {
-	      /* Current key is finished; dump this output record to the disk page */
+  rv = pthread_mutex_lock (&px_load->mutex);
+  assert (rv == NO_ERROR);
+  px_load->is_stopped = true;
+  if (!px_load->is_closed)
+    {
+      /* the sort was aborted while the sorting thread had pages to claim */
+      px_load->is_closed = true;
+      px_load->n_done++;
+    }
+  pthread_cond_broadcast (&px_load->cond);
+  while (px_load->n_done < px_load->n_started)
+    {
+      pthread_cond_wait (&px_load->cond, &px_load->mutex);
+    }
+  pthread_mutex_unlock (&px_load->mutex);
 
-	      /* Insert current leaf record */
-	      cur_maxspace = spage_max_space_for_new_record (thread_p, load_args->leaf.pgptr);
-	      if (((cur_maxspace - load_args->leaf_nleaf_recdes.length) < LOAD_FIXED_EMPTY_FOR_LEAF)
-		  && (spage_number_of_records (load_args->leaf.pgptr) > 1))
-		{
-		  /* New record does not fit into the current leaf page (within the threshold value); so allocate a new
-		   * leaf page and dump the current leaf page. */
-		  if (btree_proceed_leaf (thread_p, load_args) == NULL)
-		    {
-		      goto error;
-		    }
-		}		/* get a new leaf */
+  btree_px_load_end_class_scan (thread_p, &px_load->workers[0].sort_args);
+  for (i = 0; i < px_load->n_started; i++)
+    {
+      sort_args->n_oids += px_load->workers[i].sort_args.n_oids;
+      sort_args->n_nulls += px_load->workers[i].sort_args.n_nulls;
+      /* errors not reported by the sorting thread */
+      er_free_detached_error (px_load->workers[i].error);
+    }
 
-	      /* Insert the record to the current leaf page */
-	      sp_success =
-		spage_insert (thread_p, load_args->leaf.pgptr, &load_args->leaf_nleaf_recdes,
-			      &load_args->last_leaf_insert_slotid);
-	      if (sp_success != SP_SUCCESS)
-		{
-		  goto error;
-		}
+  if (px_load->cur_batch != NULL)
+    {
+      free_and_init (px_load->cur_batch);
+    }
+  while (px_load->queue_head != NULL)
+    {
+      batch = px_load->queue_head;
+      px_load->queue_head = batch->next;
+      free (batch);
+    }
 
-	      assert (load_args->last_leaf_insert_slotid > 0);
+  db_private_free_and_init (thread_p, px_load->workers);
+  db_private_free_and_init (thread_p, px_load->vpids);
+  db_private_free_and_init (thread_p, px_load->page_classes);
+  btree_px_load_release (px_load);
 
-	      /* Update the node header information for this record */
-	      if (load_args->cur_key_len >= BTREE_MAX_KEYLEN_INPAGE)
-		{
-		  if (load_args->leaf.hdr.max_key_len < DISK_VPID_SIZE)
-		    {
-		      load_args->leaf.hdr.max_key_len = DISK_VPID_SIZE;
-		    }
-		}
-	      else
-		{
-		  if (load_args->leaf.hdr.max_key_len < load_args->cur_key_len)
-		    {
-		      load_args->leaf.hdr.max_key_len = load_args->cur_key_len;
-		    }
-		}
+  sort_args->px_load = NULL;
+}
 
-	      if (load_args->overflowing)
-		{
-		  /* Insert the new record to the current overflow page and flush this page */
+/*
+ * btree_px_load_release () - release a reference to the parallel load; the last one frees it
+ *   return: void
+ *   px_load(in): parallel load
+ */
+static void
+btree_px_load_release (BTREE_PX_LOAD * px_load)
+{
+  if (ATOMIC_INC_32 (&px_load->ref_count, -1) > 0)
+    {
+      return;
+    }
 
-		  assert (load_args->out_recdes == &load_args->ovf_recdes);
+  (void) pthread_cond_destroy (&px_load->cond);
+  (void) pthread_mutex_destroy (&px_load->mutex);
+  free (px_load);
+}
 
-		  /* Store the record in current overflow page */
-		  sp_success = spage_insert (thread_p, load_args->ovf.pgptr, load_args->out_recdes, &slotid);
-		  if (sp_success != SP_SUCCESS)
-		    {
-		      goto error;
-		    }
+/*
+ * btree_px_load_execute () - extract the keys of objects of claimed heap pages into batches of sort items; executed
+ *			      by worker threads
+ *   return: void
+ *   thread_ref(in): worker thread
+ *   px_load(in/out): parallel load; the task takes the next of its workers
+ */
+static void
+btree_px_load_execute (cubthread::entry & thread_ref, BTREE_PX_LOAD * px_load)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  BTREE_PX_LOAD_WORKER *worker;
+  SORT_ARGS *sort_args;
+  BTREE_PX_LOAD_BATCH *batch = NULL;
+  RECDES item_recdes;
+  SORT_STATUS status = SORT_SUCCESS;
+  int batch_size = BTREE_PX_LOAD_BATCH_SIZE;
+  int error_code = NO_ERROR;
+  void *error = NULL;
+  int rv;
 
-		  assert (slotid > 0);
+  rv = pthread_mutex_lock (&px_load->mutex);
+  assert (rv == NO_ERROR);
+  if (px_load->is_closed)
+    {
+      /* started too late; pages were scanned by other workers and the load may have ended */
+      pthread_mutex_unlock (&px_load->mutex);
+      btree_px_load_release (px_load);
+      return;
+    }
+  worker = &px_load->workers[px_load->n_started++];
+  pthread_mutex_unlock (&px_load->mutex);
 
-		  /* Save the current overflow page */
-		  btree_log_page (thread_p, &load_args->btid->sys_btid->vfid, load_args->ovf.pgptr);
-		  load_args->ovf.pgptr = NULL;
+  sort_args = &worker->sort_args;
+  thread_p->tran_index = px_load->tran_index;
 
-		  /* Turn off the overflowing mode */
-		  load_args->overflowing = false;
-		}		/* Current page is an overflow page */
-	      else
-		{
-		  assert (load_args->out_recdes == &load_args->leaf_nleaf_recdes);
-		}
+  while (true)
+    {
+      if (batch == NULL)
+	{
+	  batch = btree_px_load_alloc_batch (batch_size);
+	  if (batch == NULL)
+	    {
+	      status = SORT_ERROR_OCCURRED;
+	      break;
+	    }
+	  batch_size = BTREE_PX_LOAD_BATCH_SIZE;
+	}
 
-	      /* Create the first part of the next record in main memory */
-	      load_args->out_recdes = &load_args->leaf_nleaf_recdes;
-	      ret = btree_first_oid (thread_p, &this_key, &this_class_oid, &this_oid, &mvcc_header, load_args);
-	      if (ret != NO_ERROR)
-		{
-		  goto error;
-		}
+      /* the sort item is produced in place, after its length */
+      item_recdes.data = batch->area + batch->length + MAX_ALIGNMENT;
+      item_recdes.area_size = batch->area_size - batch->length - (int) MAX_ALIGNMENT;
+      item_recdes.length = 0;
+      status = SORT_REC_DOESNT_FIT;
+      if (item_recdes.area_size > 0)
+	{
+	  status = btree_sort_get_next (thread_p, &item_recdes, sort_args);
+	}
 
-	      if (!MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
-		{
-		  /* Object was not deleted, increment curr_non_del_obj_count. */
-		  load_args->curr_non_del_obj_count = 1;
-		  (load_args->n_keys)++;	/* Increment the key counter */
-		}
-	      else
+      if (status == SORT_SUCCESS)
+	{
+	  *(int *) (batch->area + batch->length) = item_recdes.length;
+	  batch->length += BTREE_PX_LOAD_ITEM_SIZE (item_recdes.length);
+	}
+      else if (status == SORT_REC_DOESNT_FIT)
+	{
+	  /* hand over the batch and continue with one big enough for the item */
+	  batch_size = MAX (BTREE_PX_LOAD_BATCH_SIZE, BTREE_PX_LOAD_ITEM_SIZE (item_recdes.length));
+	  if (batch->length == 0)
+	    {
+	      if (batch->area_size >= batch_size)
 		{
-		  /* Object is deleted, initialize curr_non_del_obj_count as 0. */
-		  load_args->curr_non_del_obj_count = 0;
+		  /* the item should have fit */
+		  assert_release (false);
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+		  status = SORT_ERROR_OCCURRED;
+		  break;
 		}
+	      free_and_init (batch);
+	    }
+	  else if (!btree_px_load_push_batch (px_load, batch))
+	    {
+	      /* stopped */
+	      batch = NULL;
+	      break;
+	    }
+	  batch = NULL;
+	}
+      else
+	{
+	  break;
+	}
+    }
 
-	      load_args->curr_rec_max_obj_count = BTREE_MAX_OIDCOUNT_IN_LEAF_RECORD (load_args->btid);
-	      load_args->curr_rec_obj_count = 1;
+  if (status == SORT_NOMORE_RECS && batch != NULL && batch->length > 0)
+    {
+      (void) btree_px_load_push_batch (px_load, batch);
+      batch = NULL;
+    }
+  if (batch != NULL)
+    {
+      free_and_init (batch);
+    }
 
-#if !defined (NDEBUG)
-	      btree_check_valid_record (thread_p, load_args->btid, load_args->out_recdes, BTREE_LEAF_NODE, NULL);
-#endif
-	    }			/* different key */
-	}
+  btree_px_load_end_class_scan (thread_p, sort_args);
 
-      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+  if (status == SORT_ERROR_OCCURRED)
+    {
+      error_code = er_errid ();
+      if (error_code == NO_ERROR)
 	{
-	  _er_log_debug (ARG_FILE_LINE,
-			 "DEBUG_BTREE: load added object(%d, %d, %d) "
-			 "class(%d, %d, %d) and btid(%d, (%d, %d)) with mvccinfo=%llu | %llu", this_oid.volid,
-			 this_oid.pageid, this_oid.slotid, this_class_oid.volid, this_class_oid.pageid,
-			 this_class_oid.slotid, load_args->btid->sys_btid->root_pageid,
-			 load_args->btid->sys_btid->vfid.volid, load_args->btid->sys_btid->vfid.fileid,
-			 MVCC_GET_INSID (&mvcc_header), MVCC_GET_DELID (&mvcc_header));
+	  error_code = ER_FAILED;
 	}
+      /* the error with its arguments is set again by the sorting thread */
+      error = er_detach_error ();
+      er_clear ();
 
-      /* Some objects have been recently deleted and couldn't be filtered (because there may be running transaction
-       * that can still see them. However, they must be vacuumed later. Vacuum can only find them by parsing log,
-       * therefore some log records are required. These are dummy records with the sole purpose of notifying vacuum.
-       * Since this_oid, this_class_oid and mvcc_header could be replaced in case first object of unique index had to
-       * be swapped, we will use original_oid, original_class_oid and original_mvcc_header to log object load for
-       * vacuum. */
-      if (MVCC_IS_HEADER_DELID_VALID (&original_mvcc_header)
-	  || MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&original_mvcc_header))
-	{
-	  /* There is something to vacuum for this object */
-	  char *pgptr;
+      /* stop other workers early */
+      (void) ATOMIC_TAS_32 (&px_load->next_page, px_load->n_vpids);
+    }
 
-	  pgptr = (load_args->overflowing ? load_args->ovf.pgptr : load_args->leaf.pgptr);
+  thread_p->tran_index = NULL_TRAN_INDEX;
 
-	  /* clear flags for logging */
-	  btree_clear_mvcc_flags_from_oid (&original_oid);
+  rv = pthread_mutex_lock (&px_load->mutex);
+  assert (rv == NO_ERROR);
+  px_load->n_done++;
+  if (error_code != NO_ERROR)
+    {
+      worker->error_code = error_code;
+      worker->error = error;
+      px_load->has_error = true;
+    }
+  pthread_cond_broadcast (&px_load->cond);
+  pthread_mutex_unlock (&px_load->mutex);
 
-	  if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS))
+  /* the worker may be freed by now */
+  btree_px_load_release (px_load);
+}
+
+/*
+ * btree_px_load_next_object () - get the next object of pages claimed by the worker
+ *   return: SCAN_CODE; S_END if there are no more pages to claim
+ *   sort_args(in/out): sort arguments of worker
+ *
+ * Note: The heap scan and attribute info are restarted when the claimed page belongs to another class. Workers stop
+ *       at the next page when the transaction is interrupted.
+ */
+static SCAN_CODE
+btree_px_load_next_object (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  BTREE_PX_LOAD *px_load = sort_args->px_load;
+  SCAN_CODE scan_code;
+  int page_idx;
+  int cur_class;
+  bool dummy_continue_checking;
+
+  assert (sort_args->is_px_worker);
+
+  while (true)
+    {
+      if (OID_ISNULL (&sort_args->cur_oid))
+	{
+	  /* the interrupt is left set for the sorting thread */
+	  if (logtb_is_interrupted (thread_p, false, &dummy_continue_checking))
 	    {
-	      _er_log_debug (ARG_FILE_LINE,
-			     "DEBUG_BTREE: load notify vacuum object(%d, %d, %d) "
-			     "class(%d, %d, %d) and btid(%d, (%d, %d)) with mvccinfo=%llu | %llu",
-			     original_oid.volid, original_oid.pageid, original_oid.slotid, original_class_oid.volid,
-			     original_class_oid.pageid, original_class_oid.slotid,
-			     load_args->btid->sys_btid->root_pageid, load_args->btid->sys_btid->vfid.volid,
-			     load_args->btid->sys_btid->vfid.fileid, MVCC_GET_INSID (&original_mvcc_header),
-			     MVCC_GET_DELID (&original_mvcc_header));
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	      return S_ERROR;
 	    }
 
-	  /* append log data */
-	  btree_mvcc_info_from_heap_mvcc_header (&original_mvcc_header, &mvcc_info);
-	  ret =
-	    btree_rv_save_keyval_for_undo (load_args->btid, &this_key, &original_class_oid, &original_oid, &mvcc_info,
-					   BTREE_OP_NOTIFY_VACUUM, notify_vacuum_rv_data_bufalign,
-					   &notify_vacuum_rv_data, &notify_vacuum_rv_data_capacity,
-					   &notify_vacuum_rv_data_length);
-	  if (ret != NO_ERROR)
+	  page_idx = ATOMIC_INC_32 (&px_load->next_page, 1) - 1;
+	  if (page_idx >= px_load->n_vpids)
 	    {
-	      goto error;
+	      return S_END;
 	    }
-	  log_append_undo_data2 (thread_p, RVBT_MVCC_NOTIFY_VACUUM, &load_args->btid->sys_btid->vfid, NULL, -1,
-				 notify_vacuum_rv_data_length, notify_vacuum_rv_data);
-	  pgbuf_set_dirty (thread_p, pgptr, DONT_FREE);
-	}
 
-      /* set level 1 to leaf */
-      load_args->leaf.hdr.node_level = 1;
+	  cur_class = px_load->page_classes[page_idx];
+	  if (cur_class != sort_args->cur_class)
+	    {
+	      btree_px_load_end_class_scan (thread_p, sort_args);
+	      sort_args->cur_class = cur_class;
 
-      if (this_key.need_clear)
-	{
-	  copy = true;
-	}
+	      if (heap_scancache_start (thread_p, &sort_args->hfscan_cache, &sort_args->hfids[cur_class],
+					&sort_args->class_ids[cur_class], false, false, NULL) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	      sort_args->scancache_inited = 1;
 
-      btree_clear_key_value (&copy, &this_key);
+	      if (heap_attrinfo_start (thread_p, &sort_args->class_ids[cur_class], sort_args->n_attrs,
+				       &sort_args->attr_ids[cur_class * sort_args->n_attrs],
+				       &sort_args->attr_info) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	      sort_args->attrinfo_inited = 1;
+	    }
 
-      if (next)
-	{			/* move to next link */
-	  recdes->data = next;
-	  recdes->length = SORT_RECORD_LENGTH (next);
+	  sort_args->cur_oid.volid = px_load->vpids[page_idx].volid;
+	  sort_args->cur_oid.pageid = px_load->vpids[page_idx].pageid;
+	  sort_args->cur_oid.slotid = NULL_SLOTID;
 	}
-      else
+
+      cur_class = sort_args->cur_class;
+      sort_args->in_recdes.data = NULL;
+      scan_code = heap_next_in_page (thread_p, &sort_args->hfids[cur_class], &sort_args->class_ids[cur_class],
+				     &sort_args->cur_oid, &sort_args->in_recdes, &sort_args->hfscan_cache, COPY);
+      if (scan_code != S_END)
 	{
-	  break;		/* exit infinite loop */
+	  return scan_code;
 	}
 
+      /* page is done; claim next one */
+      assert (OID_ISNULL (&sort_args->cur_oid));
     }
+}
 
-  if (notify_vacuum_rv_data != NULL && notify_vacuum_rv_data != notify_vacuum_rv_data_bufalign)
+/*
+ * btree_px_load_end_class_scan () - end the heap scan and the attribute info of the class scanned by a worker
+ *   return: void
+ *   sort_args(in/out): sort arguments of worker
+ */
+static void
+btree_px_load_end_class_scan (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args)
+{
+  if (sort_args->attrinfo_inited)
     {
-      db_private_free (thread_p, notify_vacuum_rv_data);
+      heap_attrinfo_end (thread_p, &sort_args->attr_info);
+      sort_args->attrinfo_inited = 0;
     }
+  if (sort_args->scancache_inited)
+    {
+      (void) heap_scancache_end (thread_p, &sort_args->hfscan_cache);
+      sort_args->scancache_inited = 0;
+    }
+}
 
-  assert (ret == NO_ERROR);
-  return ret;
+/*
+ * btree_px_load_alloc_batch () - allocate a batch of sort items
+ *   return: batch or NULL
+ *   area_size(in): size of the area of sort items
+ *
+ * Note: Batches are allocated by workers and freed by the sorting thread; they are not allocated in private heaps.
+ */
+static BTREE_PX_LOAD_BATCH *
+btree_px_load_alloc_batch (int area_size)
+{
+  BTREE_PX_LOAD_BATCH *batch;
+  size_t size = DB_ALIGN (sizeof (BTREE_PX_LOAD_BATCH), MAX_ALIGNMENT) + area_size;
 
-error:
-  if (load_args->leaf.pgptr)
+  batch = (BTREE_PX_LOAD_BATCH *) malloc (size);
+  if (batch == NULL)
     {
-      pgbuf_unfix_and_init (thread_p, load_args->leaf.pgptr);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return NULL;
     }
-  if (load_args->ovf.pgptr)
+
+  batch->next = NULL;
+  batch->area = (char *) batch + DB_ALIGN (sizeof (BTREE_PX_LOAD_BATCH), MAX_ALIGNMENT);
+  batch->area_size = area_size;
+  batch->length = 0;
+  batch->read_pos = 0;
+
+  return batch;
+}
+
+/*
+ * btree_px_load_push_batch () - hand a batch over to the sorting thread; wait while too many batches are queued
+ *   return: false if the load is stopped and the batch is freed, true otherwise
+ *   px_load(in/out): parallel load
+ *   batch(in): batch filled by a worker
+ */
+static bool
+btree_px_load_push_batch (BTREE_PX_LOAD * px_load, BTREE_PX_LOAD_BATCH * batch)
+{
+  int rv;
+
+  rv = pthread_mutex_lock (&px_load->mutex);
+  assert (rv == NO_ERROR);
+
+  while (px_load->n_queued >= px_load->max_queued && !px_load->is_stopped)
     {
-      pgbuf_unfix_and_init (thread_p, load_args->ovf.pgptr);
+      pthread_cond_wait (&px_load->cond, &px_load->mutex);
     }
-  if (new_ovfpgptr)
+  if (px_load->is_stopped)
     {
-      pgbuf_unfix_and_init (thread_p, new_ovfpgptr);
+      pthread_mutex_unlock (&px_load->mutex);
+      free (batch);
+      return false;
     }
-  btree_clear_key_value (&copy, &this_key);
 
-  if (notify_vacuum_rv_data != NULL && notify_vacuum_rv_data != notify_vacuum_rv_data_bufalign)
+  batch->next = NULL;
+  if (px_load->queue_tail == NULL)
     {
-      db_private_free (thread_p, notify_vacuum_rv_data);
+      px_load->queue_head = batch;
     }
+  else
+    {
+      px_load->queue_tail->next = batch;
+    }
+  px_load->queue_tail = batch;
+  px_load->n_queued++;
 
-  assert (er_errid () != NO_ERROR);
-  return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+  pthread_cond_broadcast (&px_load->cond);
+  pthread_mutex_unlock (&px_load->mutex);
+
+  return true;
 }
 
-#if defined(CUBRID_DEBUG)
 /*
- * btree_dump_sort_output () - Sample output function for index sorting
- *   return: NO_ERROR
- *   recdes(in):
- *   load_args(in):
- *
- * Note: This function is a debugging function. It is passed by the
- * btree_index_sort function to the sort_listfile function to print
- * out the contents of the sort items once they are obtained in
- * the requested sorting order.
- *
+ * btree_px_load_pop_batch () - get the next batch handed over by workers
+ *   return: error code of failed worker, or NO_ERROR
+ *   px_load(in/out): parallel load
+ *   wait(in): wait while started workers are scanning
+ *   batch(out): next batch, or NULL if none is queued; when waiting, NULL means all started workers are done
  */
 static int
-btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args)
+btree_px_load_pop_batch (BTREE_PX_LOAD * px_load, bool wait, BTREE_PX_LOAD_BATCH ** batch)
 {
-  OID this_oid;
-  DB_VALUE this_key;
-  OR_BUF buf;
-  bool copy = false;
-  int key_size = -1;
-  int ret = NO_ERROR;
+  int error_code = NO_ERROR;
+  int i;
+  int rv;
 
-  /* First decompose the input record into the key and oid components */
-  or_init (&buf, recdes->data, recdes->length);
+  *batch = NULL;
 
-  if (or_get_oid (&buf, &this_oid) != NO_ERROR)
+  rv = pthread_mutex_lock (&px_load->mutex);
+  assert (rv == NO_ERROR);
+
+  /* never wait for workers that have not started */
+  while (wait && px_load->queue_head == NULL && px_load->n_done < px_load->n_started && !px_load->has_error)
     {
-      goto exit_on_error;
+      pthread_cond_wait (&px_load->cond, &px_load->mutex);
     }
-  buf.ptr = PTR_ALIGN (buf.ptr, MAX_ALIGNMENT);
 
-  /* Do not copy the string--just use the pointer.  The pr_ routines for strings and sets have different semantics for
-   * length. */
-  if (TP_DOMAIN_TYPE (load_args->btid->key_type) == DB_TYPE_MIDXKEY)
+  if (px_load->has_error)
     {
-      key_size = buf.endptr - buf.ptr;
+      /* report the first error of workers as it was set */
+      for (i = 0; i < px_load->n_started && error_code == NO_ERROR; i++)
+	{
+	  error_code = px_load->workers[i].error_code;
+	  if (error_code != NO_ERROR && px_load->workers[i].error != NULL)
+	    {
+	      (void) er_attach_error (px_load->workers[i].error);
+	      px_load->workers[i].error = NULL;
+	    }
+	}
+      pthread_mutex_unlock (&px_load->mutex);
+
+      assert (error_code != NO_ERROR);
+      if (er_errid () == NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	}
+      return error_code;
     }
 
-  if ((*(load_args->btid->key_type->type->readval)) (&buf, &this_key, load_args->btid->key_type, key_size, copy, NULL,
-						     0) != NO_ERROR)
+  if (px_load->queue_head != NULL)
     {
-      goto exit_on_error;
+      *batch = px_load->queue_head;
+      px_load->queue_head = (*batch)->next;
+      if (px_load->queue_head == NULL)
+	{
+	  px_load->queue_tail = NULL;
+	}
+      px_load->n_queued--;
+      pthread_cond_broadcast (&px_load->cond);
     }
 
-  printf ("Attribute: ");
-  btree_dump_key (stdout, &this_key);
-  printf ("   Volid: %d", this_oid.volid);
-  printf ("   Pageid: %d", this_oid.pageid);
-  printf ("   Slotid: %d\n", this_oid.slotid);
-
-end:
-
-  copy = btree_clear_key_value (copy, &this_key);
-
-  return ret;
-
-exit_on_error:
+  pthread_mutex_unlock (&px_load->mutex);
 
-  return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+  return NO_ERROR;
 }
-#endif /* CUBRID_DEBUG */
 
 /*
- * btree_index_sort () - Sort for the index file creation
- *   return: int
- *   sort_args(in): sort arguments; specifies the sort-attribute as well as
- *	            the structure of the input objects
- *   out_func(in): output function to utilize the sorted items as they are
- *                 produced
- *   out_args(in): arguments to the out_func.
+ * btree_px_load_get_next () - get the next sort item extracted by workers; executed by the sorting thread
+ *   return: SORT_STATUS
+ *   temp_recdes(in/out): where to put the next sort item
+ *   px_load(in/out): parallel load
  *
- * Note: This function supports the initial loading phase of B+tree
- * indices by providing an ordered list of (index-attribute
- * value, object address) pairs. It uses the general sorting
- * facility provided in the "sr" module.
+ * Note: While pages are left, the sorting thread extracts the keys of the next page itself when no batch is queued,
+ *       instead of waiting for the workers.
  */
-static int
-btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args)
+static SORT_STATUS
+btree_px_load_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, BTREE_PX_LOAD * px_load)
 {
-  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
-			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
-			NO_SORT_LIMIT);
+  BTREE_PX_LOAD_BATCH *batch;
+  SORT_STATUS status;
+  char *item;
+  int length;
+  int rv;
+
+  while (px_load->cur_batch == NULL || px_load->cur_batch->read_pos >= px_load->cur_batch->length)
+    {
+      if (px_load->cur_batch != NULL)
+	{
+	  free_and_init (px_load->cur_batch);
+	}
+      /* is_closed is changed only by this thread */
+      if (btree_px_load_pop_batch (px_load, px_load->is_closed, &px_load->cur_batch) != NO_ERROR)
+	{
+	  return SORT_ERROR_OCCURRED;
+	}
+      if (px_load->cur_batch != NULL)
+	{
+	  continue;
+	}
+      if (px_load->is_closed)
+	{
+	  /* all started workers are done */
+	  return SORT_NOMORE_RECS;
+	}
+
+      status = btree_sort_get_next (thread_p, temp_recdes, &px_load->workers[0].sort_args);
+      if (status != SORT_NOMORE_RECS)
+	{
+	  return status;
+	}
+
+      /* all pages are claimed; workers starting now are not needed */
+      btree_px_load_end_class_scan (thread_p, &px_load->workers[0].sort_args);
+      rv = pthread_mutex_lock (&px_load->mutex);
+      assert (rv == NO_ERROR);
+      px_load->is_closed = true;
+      px_load->n_done++;
+      pthread_mutex_unlock (&px_load->mutex);
+    }
+
+  batch = px_load->cur_batch;
+  item = batch->area + batch->read_pos;
+  length = *(int *) item;
+
+  if (temp_recdes->area_size < length)
+    {
+      temp_recdes->length = length;
+      return SORT_REC_DOESNT_FIT;
+    }
+
+  assert (PTR_ALIGN (temp_recdes->data, MAX_ALIGNMENT) == temp_recdes->data);
+  memcpy (temp_recdes->data, item + MAX_ALIGNMENT, length);
+  temp_recdes->length = length;
+  batch->read_pos += BTREE_PX_LOAD_ITEM_SIZE (length);
+
+  return SORT_SUCCESS;
 }
+#endif /* SERVER_MODE */
 
 /*
  * btree_sort_get_next () - Get_key function for index sorting
@@ -2972,6 +4403,15 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
   aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
 
   sort_args = (SORT_ARGS *) arg;
+
+#if defined (SERVER_MODE)
+  if (sort_args->px_load != NULL && !sort_args->is_px_worker)
+    {
+      /* keys are extracted by workers */
+      return btree_px_load_get_next (thread_p, temp_recdes, sort_args->px_load);
+    }
+#endif /* SERVER_MODE */
+
   prev_oid = sort_args->cur_oid;
 
   if (BTREE_IS_UNIQUE (sort_args->unique_pk))
@@ -3001,14 +4441,30 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
        * RETRIEVE THE NEXT OBJECT
        */
 
-      cur_class = sort_args->cur_class;
-      attr_offset = cur_class * sort_args->n_attrs;
-      sort_args->in_recdes.data = NULL;
-      scan_result =
-	heap_next (thread_p, &sort_args->hfids[cur_class], &sort_args->class_ids[cur_class], &sort_args->cur_oid,
-		   &sort_args->in_recdes, &sort_args->hfscan_cache,
-		   sort_args->hfscan_cache.cache_last_fix_page ? PEEK : COPY);
-
+#if defined (SERVER_MODE)
+      if (sort_args->is_px_worker)
+	{
+	  /* may move to a page of another class */
+	  scan_result = btree_px_load_next_object (thread_p, sort_args);
+	  if (scan_result == S_END)
+	    {
+	      return SORT_NOMORE_RECS;
+	    }
+	  cur_class = sort_args->cur_class;
+	  attr_offset = cur_class * sort_args->n_attrs;
+	}
+      else
+#endif /* SERVER_MODE */
+	{
+	  cur_class = sort_args->cur_class;
+	  attr_offset = cur_class * sort_args->n_attrs;
+	  sort_args->in_recdes.data = NULL;
+	  scan_result =
+	    heap_next (thread_p, &sort_args->hfids[cur_class], &sort_args->class_ids[cur_class], &sort_args->cur_oid,
+		       &sort_args->in_recdes, &sort_args->hfscan_cache,
+		       sort_args->hfscan_cache.cache_last_fix_page ? PEEK : COPY);
+	}
+
       switch (scan_result)
 	{
 
@@ -3235,7 +4691,15 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	       * Record is too big to fit into temp_recdes area; so
 	       * backtrack this iteration
 	       */
-	      sort_args->cur_oid = prev_oid;
+	      if (sort_args->is_px_worker)
+		{
+		  /* the page of previous object may be released; rescan from the slot before current object */
+		  sort_args->cur_oid.slotid--;
+		}
+	      else
+		{
+		  sort_args->cur_oid = prev_oid;
+		}
 	      temp_recdes->length = record_size;
 	      goto nofit;
 	    }
@@ -4244,6 +5708,7 @@ btree_advance_to_next_slot_and_fix_page (THREAD_ENTRY * thread_p, BTID_INT * bti
   BTREE_NODE_HEADER *local_header = *header;
   bool is_slot_visible = false;
   PAGE_PTR old_page = NULL;
+  RECDES record;
 
   /* Clear current key, if any. */
   if (!DB_IS_NULL (key))
@@ -4324,6 +5789,17 @@ btree_advance_to_next_slot_and_fix_page (THREAD_ENTRY * thread_p, BTID_INT * bti
 	    }
 	}
 
+      if (spage_get_record (thread_p, page, *slot_id, &record, PEEK) != S_SUCCESS)
+	{
+	  assert_release (false);
+	  return ER_FAILED;
+	}
+      if (btree_leaf_record_is_fence (&record))
+	{
+	  /* Fence keys are not index keys. */
+	  continue;
+	}
+
       if (mvcc != NULL)
 	{
 	  ret = btree_is_slot_visible (thread_p, btid, page, mvcc, *slot_id, &is_slot_visible);
@@ -4833,6 +6309,12 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
   index_builder_loader_context load_context;
   bool is_parallel = ib_thread_count > 0;
   std::atomic<int> num_keys = {0}, num_oids = {0}, num_nulls = {0};
+  index_builder_scan_context *scan_context = NULL;
+  cubthread::entry_workpool *scan_workpool = NULL;
+  VPID *vpids = NULL;
+  int n_vpids = 0;
+  int n_scanners = 0;
+  int i;
 
   std::unique_ptr<index_builder_loader_task> load_task = NULL;
 
@@ -4865,113 +6347,181 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
 
   PERF_UTIME_TRACKER_START (thread_p, &time_online_index);
 
-  /* Start extracting from heap. */
-  for (;;)
+#if defined (SERVER_MODE)
+  if (ib_workpool != NULL && filter_pred == NULL && p_func_idx_info == NULL
+      && prm_get_integer_value (PRM_ID_INDEX_LOAD_PARALLEL_DEGREE) > 1)
     {
-      DB_VALUE dbvalue;
-
-      db_make_null (&dbvalue);
-
-      /* Scan from heap and insert into the index. */
-      attr_offset = cur_class * n_attrs;
-
-      cur_record.data = NULL;
-
-      sc = heap_next (thread_p, &hfids[cur_class], &class_oids[cur_class], &cur_oid, &cur_record, scancache, COPY);
-      if (sc == S_ERROR)
+      /* Heap pages may be scanned by several tasks, each pushing its own loader tasks. */
+      ret = file_collect_user_pages (thread_p, &hfids[cur_class].vfid, &vpids, &n_vpids);
+      if (ret != NO_ERROR)
 	{
-	  ASSERT_ERROR_AND_SET (ret);
-	  break;
+	  ASSERT_ERROR ();
+	  goto end;
 	}
-      else if (sc == S_END)
+      /* this thread is one of the scanners */
+      n_scanners = MIN (prm_get_integer_value (PRM_ID_INDEX_LOAD_PARALLEL_DEGREE),
+			n_vpids / BTREE_PX_LOAD_MIN_PAGES_PER_WORKER);
+      n_scanners = MIN (n_scanners, (int) cubthread::parallel_query_worker_pool::get_worker_count () + 1);
+      if (n_scanners > 1)
 	{
-	  break;
+	  scan_workpool = cubthread::parallel_query_worker_pool::get_instance ();
+	}
+      else
+	{
+	  /* small heap or parallel query execution is disabled; scan by this thread */
+	  n_scanners = 0;
 	}
+    }
+#endif /* SERVER_MODE */
 
-      /* Make sure the scan was a success. */
-      assert (sc == S_SUCCESS);
-      assert (!OID_ISNULL (&cur_oid));
+  if (scan_workpool != NULL)
+    {
+      /* the context may outlive this call; it is freed by the last scanner task, which may start much later */
+      scan_context = new index_builder_scan_context ();
+      scan_context->m_btid_int = btid_int;
+      scan_context->m_hfid = &hfids[cur_class];
+      scan_context->m_class_oid = &class_oids[cur_class];
+      scan_context->m_attrids = attrids;
+      scan_context->m_n_attrs = n_attrs;
+      scan_context->m_attrs_prefix_length = attrs_prefix_length;
+      scan_context->m_unique_pk = unique_pk;
+      scan_context->m_key_type = key_type;
+      scan_context->m_mvcc_snapshot = scancache->mvcc_snapshot;
+      scan_context->m_tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+      scan_context->m_vpids = vpids;
+      scan_context->m_n_vpids = n_vpids;
+      scan_context->m_next_page = 0;
+      scan_context->m_load_context = &load_context;
+      scan_context->m_ib_workpool = ib_workpool;
+      scan_context->m_num_keys = &num_keys;
+      scan_context->m_num_oids = &num_oids;
+      scan_context->m_num_nulls = &num_nulls;
+      scan_context->m_tasks_started = 0UL;
+      scan_context->m_is_closed = false;
+      scan_context->m_scanners_started = 1;
+      scan_context->m_scanners_done = 0;
+      scan_context->m_ref_count = n_scanners;
+
+      for (i = 1; i < n_scanners; i++)
+	{
+	  thread_get_manager ()->push_task (scan_workpool, new index_builder_scanner_task (*scan_context));
+	}
+
+      /* scan along with the tasks that start; if none starts, this thread scans all pages */
+      ret = scan_context->scan (*thread_p);
+      scan_context->close ();
+    }
 
-      if (filter_pred)
+  else
+    {
+      /* Start extracting from heap. */
+      for (;;)
 	{
-	  ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, NULL, filter_pred->cache_pred);
-	  if (ret != NO_ERROR)
+	  DB_VALUE dbvalue;
+
+	  db_make_null (&dbvalue);
+
+	  /* Scan from heap and insert into the index. */
+	  attr_offset = cur_class * n_attrs;
+
+	  cur_record.data = NULL;
+
+	  sc = heap_next (thread_p, &hfids[cur_class], &class_oids[cur_class], &cur_oid, &cur_record, scancache, COPY);
+	  if (sc == S_ERROR)
 	    {
+	      ASSERT_ERROR_AND_SET (ret);
 	      break;
 	    }
-
-	  eval_res = (*filter_eval_fnc) (thread_p, filter_pred->pred, NULL, &cur_oid);
-	  if (eval_res == V_ERROR)
+	  else if (sc == S_END)
 	    {
-	      ret = ER_FAILED;
 	      break;
 	    }
-	  else if (eval_res != V_TRUE)
+
+	  /* Make sure the scan was a success. */
+	  assert (sc == S_SUCCESS);
+	  assert (!OID_ISNULL (&cur_oid));
+
+	  if (filter_pred)
 	    {
-	      continue;
+	      ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, NULL, filter_pred->cache_pred);
+	      if (ret != NO_ERROR)
+		{
+		  break;
+		}
+
+	      eval_res = (*filter_eval_fnc) (thread_p, filter_pred->pred, NULL, &cur_oid);
+	      if (eval_res == V_ERROR)
+		{
+		  ret = ER_FAILED;
+		  break;
+		}
+	      else if (eval_res != V_TRUE)
+		{
+		  continue;
+		}
 	    }
-	}
 
-      if (p_func_idx_info && p_func_idx_info->expr)
-	{
-	  ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, NULL,
-					     p_func_idx_info->expr->cache_attrinfo);
-	  if (ret != NO_ERROR)
+	  if (p_func_idx_info && p_func_idx_info->expr)
 	    {
-	      break;
+	      ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, NULL,
+						 p_func_idx_info->expr->cache_attrinfo);
+	      if (ret != NO_ERROR)
+		{
+		  break;
+		}
 	    }
-	}
 
-      if (n_attrs == 1)
-	{
-	  /* Single column index. */
-	  ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, NULL, attr_info);
-	  if (ret != NO_ERROR)
+	  if (n_attrs == 1)
 	    {
-	      break;
+	      /* Single column index. */
+	      ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, NULL, attr_info);
+	      if (ret != NO_ERROR)
+		{
+		  break;
+		}
 	    }
-	}
 
-      p_prefix_length = NULL;
-      if (attrs_prefix_length)
-	{
-	  p_prefix_length = &(attrs_prefix_length[0]);
-	}
+	  p_prefix_length = NULL;
+	  if (attrs_prefix_length)
+	    {
+	      p_prefix_length = &(attrs_prefix_length[0]);
+	    }
 
-      /* Generate the key : provide key_type domain - needed for compares during sort */
-      p_dbvalue = heap_attrinfo_generate_key (thread_p, n_attrs, &attrids[attr_offset], p_prefix_length, attr_info,
-					      &cur_record, &dbvalue, aligned_midxkey_buf, p_func_idx_info, key_type);
-      if (p_dbvalue == NULL)
-	{
-	  ret = ER_FAILED;
-	  break;
-	}
+	  /* Generate the key : provide key_type domain - needed for compares during sort */
+	  p_dbvalue = heap_attrinfo_generate_key (thread_p, n_attrs, &attrids[attr_offset], p_prefix_length, attr_info,
+						  &cur_record, &dbvalue, aligned_midxkey_buf, p_func_idx_info, key_type);
+	  if (p_dbvalue == NULL)
+	    {
+	      ret = ER_FAILED;
+	      break;
+	    }
 
-      /* Dispatch the insert operation */
-      if (load_task == NULL)
-        {
-          // create a new task
-	  load_task.reset (new index_builder_loader_task (btid_int->sys_btid, &class_oids[cur_class], unique_pk,
-							  load_context, num_keys, num_oids, num_nulls));
-        }
-      if (load_task->add_key (p_dbvalue, cur_oid) == index_builder_loader_task::BATCH_FULL)
-        {
-          // send task to worker pool for execution
-	  thread_get_manager ()->push_task (ib_workpool, load_task.release ());
-	  /* Increment tasks started. */
-	  tasks_started++;
-        }
+	  /* Dispatch the insert operation */
+	  if (load_task == NULL)
+	    {
+	      // create a new task
+	      load_task.reset (new index_builder_loader_task (btid_int->sys_btid, &class_oids[cur_class], unique_pk,
+							      load_context, num_keys, num_oids, num_nulls));
+	    }
+	  if (load_task->add_key (p_dbvalue, cur_oid) == index_builder_loader_task::BATCH_FULL)
+	    {
+	      // send task to worker pool for execution
+	      thread_get_manager ()->push_task (ib_workpool, load_task.release ());
+	      /* Increment tasks started. */
+	      tasks_started++;
+	    }
 
-      /* Clear index key. */
-      pr_clear_value (p_dbvalue);
+	  /* Clear index key. */
+	  pr_clear_value (p_dbvalue);
 
-      /* Check for possible errors. */
-      if (load_context.m_has_error)
-	{
-	  /* Also stop all threads. */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IB_ERROR_ABORT, 0);
-	  ret = load_context.m_error_code;
-	  break;
+	  /* Check for possible errors. */
+	  if (load_context.m_has_error)
+	    {
+	      /* Also stop all threads. */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IB_ERROR_ABORT, 0);
+	      ret = load_context.m_error_code;
+	      break;
+	    }
 	}
     }
 
@@ -5008,13 +6558,34 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
 	      break;
 	    }
 	}
-      while (load_context.m_tasks_executed != tasks_started);
+      while ((scan_context != NULL && scan_context->m_scanners_done < scan_context->m_scanners_started)
+             || load_context.m_tasks_executed != tasks_started + (scan_context != NULL
+                                                                  ? scan_context->m_tasks_started.load () : 0));
+    }
+
+  if (scan_context != NULL)
+    {
+      /* stop the scanners still running on error or interrupt; they use pages and load context of this thread. the
+       * scanners that have not started are not waited for. */
+      scan_context->m_next_page = scan_context->m_n_vpids;
+      while (scan_context->m_scanners_done < scan_context->m_scanners_started)
+	{
+	  thread_sleep (10);
+	}
+      scan_context->release ();
     }
 
+end:
+
   PERF_UTIME_TRACKER_TIME (thread_p, &time_online_index, PSTAT_BT_ONLINE_LOAD);
 
   thread_get_manager ()->destroy_worker_pool (ib_workpool);
 
+  if (vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, vpids);
+    }
+
   if (BTREE_IS_UNIQUE (btid_int->unique_pk))
     {
       logtb_tran_update_btid_unique_stats (thread_p, btid_int->sys_btid, num_keys, num_oids, num_nulls);
@@ -5062,7 +6633,6 @@ index_builder_loader_task::index_builder_loader_task (const BTID *btid, const OI
   BTID_COPY (&m_btid, btid);
   COPY_OID (&m_class_oid, class_oid);
   m_unique_pk = unique_pk;
-  m_load_context.m_has_error = false;
   m_memsize = 0;
 }
 
@@ -5171,4 +6741,204 @@ index_builder_loader_task::execute (cubthread::entry &thread_ref)
 
   m_load_context.m_tasks_executed++;
 }
+
+index_builder_scanner_task::index_builder_scanner_task (index_builder_scan_context &scan_context)
+  : m_scan_context (scan_context)
+{
+}
+
+void
+index_builder_scanner_task::execute (cubthread::entry &thread_ref)
+{
+  index_builder_scan_context &ctx = m_scan_context;
+  int ret;
+
+  {
+    std::unique_lock<std::mutex> ulock (ctx.m_mutex);
+    if (ctx.m_is_closed)
+      {
+        // started too late; pages were scanned by others and the builder thread may have returned
+        ulock.unlock ();
+        ctx.release ();
+        return;
+      }
+    ctx.m_scanners_started++;
+  }
+
+  thread_ref.tran_index = ctx.m_tran_index;
+
+  ret = ctx.scan (thread_ref);
+  if (ret != NO_ERROR)
+    {
+      if (!ctx.m_load_context->m_has_error.exchange (true))
+	{
+	  ctx.m_load_context->m_error_code = ret;
+	}
+    }
+
+  thread_ref.tran_index = NULL_TRAN_INDEX;
+  ctx.m_scanners_done++;
+
+  ctx.release ();
+}
+
+//
+// scan () - scan the heap pages left and push the keys to loader tasks; by the builder thread and started scanners
+//
+int
+index_builder_scan_context::scan (cubthread::entry &thread_ref)
+{
+  HEAP_SCANCACHE scancache;
+  HEAP_CACHE_ATTRINFO attr_info;
+  bool scancache_inited = false;
+  bool attr_info_inited = false;
+  int ret;
+
+  ret = heap_scancache_start (&thread_ref, &scancache, m_hfid, m_class_oid, false, false, NULL);
+  if (ret == NO_ERROR)
+    {
+      scancache_inited = true;
+      scancache.mvcc_snapshot = m_mvcc_snapshot;
+
+      ret = heap_attrinfo_start (&thread_ref, m_class_oid, m_n_attrs, m_attrids, &attr_info);
+    }
+  if (ret == NO_ERROR)
+    {
+      attr_info_inited = true;
+      ret = scan_pages (thread_ref, scancache, attr_info);
+    }
+
+  if (attr_info_inited)
+    {
+      heap_attrinfo_end (&thread_ref, &attr_info);
+    }
+  if (scancache_inited)
+    {
+      (void) heap_scancache_end (&thread_ref, &scancache);
+    }
+
+  return ret;
+}
+
+//
+// close () - let scanner tasks that start from now on end immediately; by the builder thread when it scanned its pages
+//
+void
+index_builder_scan_context::close ()
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  m_is_closed = true;
+}
+
+//
+// release () - release a reference to the context; the last one frees it
+//
+void
+index_builder_scan_context::release ()
+{
+  if (--m_ref_count == 0)
+    {
+      delete this;
+    }
+}
+
+int
+index_builder_scan_context::scan_pages (cubthread::entry &thread_ref, HEAP_SCANCACHE &scancache,
+					HEAP_CACHE_ATTRINFO &attr_info)
+{
+  index_builder_scan_context &ctx = *this;
+  std::unique_ptr<index_builder_loader_task> load_task = NULL;
+  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
+  int *p_prefix_length;
+  DB_VALUE dbvalue, *p_dbvalue;
+  OID cur_oid;
+  RECDES cur_record;
+  SCAN_CODE sc;
+  int page_idx;
+  bool dummy_continue_checking;
+  int ret = NO_ERROR;
+
+  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+  p_prefix_length = (ctx.m_attrs_prefix_length != NULL) ? &ctx.m_attrs_prefix_length[0] : NULL;
+  OID_SET_NULL (&cur_oid);
+
+  while (!ctx.m_load_context->m_has_error)
+    {
+      if (OID_ISNULL (&cur_oid))
+	{
+	  /* the interrupt is left set for the builder thread */
+	  if (logtb_is_interrupted (&thread_ref, false, &dummy_continue_checking))
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	      ret = ER_INTERRUPTED;
+	      break;
+	    }
+
+	  page_idx = ctx.m_next_page++;
+	  if (page_idx >= ctx.m_n_vpids)
+	    {
+	      break;
+	    }
+	  cur_oid.volid = ctx.m_vpids[page_idx].volid;
+	  cur_oid.pageid = ctx.m_vpids[page_idx].pageid;
+	  cur_oid.slotid = NULL_SLOTID;
+	}
+
+      cur_record.data = NULL;
+      sc = heap_next_in_page (&thread_ref, ctx.m_hfid, ctx.m_class_oid, &cur_oid, &cur_record, &scancache, COPY);
+      if (sc == S_ERROR)
+	{
+	  ASSERT_ERROR_AND_SET (ret);
+	  break;
+	}
+      else if (sc == S_END)
+	{
+	  /* page is done; claim next one */
+	  continue;
+	}
+      assert (sc == S_SUCCESS);
+
+      if (ctx.m_n_attrs == 1)
+	{
+	  ret = heap_attrinfo_read_dbvalues (&thread_ref, &cur_oid, &cur_record, NULL, &attr_info);
+	  if (ret != NO_ERROR)
+	    {
+	      break;
+	    }
+	}
+
+      db_make_null (&dbvalue);
+      p_dbvalue = heap_attrinfo_generate_key (&thread_ref, ctx.m_n_attrs, ctx.m_attrids, p_prefix_length,
+					      &attr_info, &cur_record, &dbvalue, aligned_midxkey_buf, NULL,
+					      ctx.m_key_type);
+      if (p_dbvalue == NULL)
+	{
+	  ret = ER_FAILED;
+	  break;
+	}
+
+      if (load_task == NULL)
+	{
+	  load_task.reset (new index_builder_loader_task (ctx.m_btid_int->sys_btid, ctx.m_class_oid,
+							  ctx.m_unique_pk, *ctx.m_load_context, *ctx.m_num_keys,
+							  *ctx.m_num_oids, *ctx.m_num_nulls));
+	}
+      if (load_task->add_key (p_dbvalue, cur_oid) == index_builder_loader_task::BATCH_FULL)
+	{
+	  /* count the task before it can be executed */
+	  ctx.m_tasks_started++;
+	  thread_get_manager ()->push_task (ctx.m_ib_workpool, load_task.release ());
+	}
+
+      pr_clear_value (p_dbvalue);
+    }
+
+  if (ret == NO_ERROR && load_task != NULL && load_task->has_keys ())
+    {
+      ctx.m_tasks_started++;
+      thread_get_manager ()->push_task (ctx.m_ib_workpool, load_task.release ());
+    }
+
+  return ret;
+}
 // *INDENT-ON*
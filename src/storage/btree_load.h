@@ -279,6 +279,13 @@ extern DISK_ISVALID btree_verify_tree (THREAD_ENTRY * thread_p, const OID * clas
 				       const char *btname);
 extern int btree_get_prefix_separator (const DB_VALUE * key1, const DB_VALUE * key2, DB_VALUE * prefix_key,
 				       TP_DOMAIN * key_domain);
+extern bool btree_leaf_record_is_fence (RECDES * record);
+extern int btree_make_fence_record (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * fence_key,
+				    RECDES * record);
+extern int btree_leaf_record_change_prefix (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * record,
+					    DB_VALUE * lower_fence, int old_prefix, int new_prefix);
+extern int btree_leaf_record_get_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, RECDES * record,
+				      DB_VALUE * lower_fence, int n_prefix, DB_VALUE * key);
 
 extern int btree_get_asc_desc (THREAD_ENTRY * thread_p, BTID * btid, int col_idx, int *asc_desc);
 
@@ -61,6 +61,9 @@
 /* LOG2 from total number of blocks. */
 #define DWB_LOG2_BLOCK_NUM_PAGES	   (dwb_Global.log2_num_block_pages)
 
+/* The maximum number of pages contiguous on disk written together. */
+#define DWB_WRITE_MAX_RUN_PAGES	   64
+
 
 /* Position mask. */
 #define DWB_POSITION_MASK	    0x000000003fffffff
@@ -2000,13 +2003,15 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   int count_writes = 0, num_pages_to_sync;
   FLUSH_VOLUME_INFO *current_flush_volume_info = NULL;
   bool can_flush_volume = false;
+  void *run_io_pages[DWB_WRITE_MAX_RUN_PAGES];
+  unsigned int run_length;
 
   assert (block != NULL && p_dwb_ordered_slots != NULL);
 
   /*
    * Write the whole slots data first and then remove it from hash. Is better to do in this way. Thus, the fileio_write
-   * may be slow. While the current transaction has delays caused by fileio_write, the concurrent transaction still
-   * can access the data from memory instead disk
+   * may be slow. Pages contiguous on disk are written together, with one vectored write. While the current transaction
+   * has delays caused by fileio_write, the concurrent transaction still can access the data from memory instead disk
    */
 
   assert (block->count_wb_pages < ordered_slots_length);
@@ -2054,18 +2059,31 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 
       assert (last_written_vol_fd != NULL_VOLDES);
 
-      assert (p_dwb_ordered_slots[i].io_page->prv.pflag_reserve_1 == '\0');
-      assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_2 == 0);
-      assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_3 == 0);
-      assert (p_dwb_ordered_slots[i].vpid.pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
-	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
+      /* Collect the run of pages contiguous on disk starting with current page, to write them all at once. */
+      run_length = 0;
+      do
+	{
+	  assert (p_dwb_ordered_slots[i + run_length].io_page->prv.pflag_reserve_1 == '\0');
+	  assert (p_dwb_ordered_slots[i + run_length].io_page->prv.p_reserve_2 == 0);
+	  assert (p_dwb_ordered_slots[i + run_length].io_page->prv.p_reserve_3 == 0);
+	  assert (p_dwb_ordered_slots[i + run_length].vpid.pageid
+		  == p_dwb_ordered_slots[i + run_length].io_page->prv.pageid
+		  && p_dwb_ordered_slots[i + run_length].vpid.volid
+		  == p_dwb_ordered_slots[i + run_length].io_page->prv.volid);
+
+	  run_io_pages[run_length] = p_dwb_ordered_slots[i + run_length].io_page;
+	  run_length++;
+	}
+      while (run_length < DWB_WRITE_MAX_RUN_PAGES && i + run_length < block->count_wb_pages
+	     && p_dwb_ordered_slots[i + run_length].vpid.volid == vpid->volid
+	     && p_dwb_ordered_slots[i + run_length].vpid.pageid == vpid->pageid + (PAGEID) run_length);
 
       /* Write the data. */
-      if (fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
-			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+      if (fileio_write_vectored (thread_p, last_written_vol_fd, run_io_pages, vpid->pageid, run_length, IO_PAGESIZE,
+				 FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
 	{
 	  ASSERT_ERROR ();
-	  dwb_log_error ("DWB write page VPID=(%d, %d) LSA=(%lld,%d) with %d error: \n",
+	  dwb_log_error ("DWB write %u pages from VPID=(%d, %d) LSA=(%lld,%d) with %d error: \n", run_length,
 			 vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
 			 (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset, er_errid ());
 	  assert (false);
@@ -2073,15 +2091,18 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	  return ER_FAILED;
 	}
 
-      dwb_log ("dwb_write_block: written page = (%d,%d) LSA=(%lld,%d)\n",
+      dwb_log ("dwb_write_block: written %u pages from page = (%d,%d) LSA=(%lld,%d)\n", run_length,
 	       vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
 	       (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset);
 
+      /* Continue after the run. */
+      i += run_length - 1;
+
 #if defined (SERVER_MODE)
       assert (current_flush_volume_info != NULL);
 
-      ATOMIC_INC_32 (&current_flush_volume_info->num_pages, 1);
-      count_writes++;
+      ATOMIC_INC_32 (&current_flush_volume_info->num_pages, run_length);
+      count_writes += run_length;
 
       if (file_sync_helper_can_flush && (count_writes >= num_pages_to_sync || can_flush_volume == true)
 	  && dwb_is_file_sync_helper_daemon_available ())
@@ -51,6 +51,9 @@
 #include "server_support.h"
 #include "thread_entry_task.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info and thread_sleep
+#if defined(SERVER_MODE)
+#include "parallel_query_worker_pool.hpp"
+#endif /* SERVER_MODE */
 
 #include <functional>
 
@@ -77,6 +80,9 @@
 /* Expansion Ratio of the dynamic array that keeps the file contents list */
 #define SORT_EXPAND_DYN_ARRAY_RATIO 1.5
 
+/* Minimum number of input pages to sort runs in parallel */
+#define SORT_PX_MIN_INPUT_PAGES 256
+
 #define SORT_MAXREC_LENGTH             \
         ((ssize_t)(DB_PAGESIZE - sizeof(SLOTTED_PAGE_HEADER) - sizeof(SLOT)))
 
@@ -125,6 +131,7 @@ struct px_tree_node
   int px_id;			/* node ID */
 #if defined(SERVER_MODE)
   int px_status;		/* node status; access through px_mtx */
+  bool px_claimed;		/* node is being sorted by a worker or by its parent; access through px_mtx */
 #endif				/* SERVER_MODE */
 
   int px_height;		/* tournament tree: node level */
@@ -142,6 +149,19 @@ struct px_tree_node
   long px_result_size;		/* output */
 };
 
+#if defined(SERVER_MODE)
+/* tasks pushed for the right-side px_nodes; shared with the tasks, which may start long after the sort ended */
+typedef struct px_sort_tasks PX_SORT_TASKS;
+struct px_sort_tasks
+{
+  pthread_mutex_t mtx;
+  pthread_cond_t cond;		/* signaled when a running task ends; waited with mtx */
+  int n_running;		/* tasks started and not ended; access through mtx */
+  bool is_closed;		/* sort resources are returned; tasks that start now end immediately */
+  volatile int ref_count;	/* the sort and the tasks not ended yet */
+};
+#endif /* SERVER_MODE */
+
 typedef struct sort_param SORT_PARAM;
 struct sort_param
 {
@@ -178,6 +198,9 @@ struct sort_param
   /* support parallelism */
 #if defined(SERVER_MODE)
   pthread_mutex_t px_mtx;	/* px_node status mutex */
+  pthread_cond_t px_cond;	/* signaled when a px_node is done; waited with px_mtx */
+  cubthread::entry_workpool *px_worker_pool;	/* shared workers sorting the right-side px_nodes */
+  PX_SORT_TASKS *px_tasks;	/* tasks pushed to px_worker_pool */
 #endif
   int px_height_max;		/* px_node tournament tree max level */
   int px_array_size;		/* px_node array size */
@@ -248,6 +271,8 @@ static PX_TREE_NODE *px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_
 static int px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
 #if defined(SERVER_MODE)
 static int px_sort_communicate (PX_TREE_NODE * px_node);
+static PX_SORT_TASKS *px_sort_create_tasks (void);
+static void px_sort_release_tasks (PX_SORT_TASKS * px_tasks);
 #endif
 
 static int sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FUNC * get_next,
@@ -1343,13 +1368,13 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
+  bool seq_access_started = false;
 #if defined(SERVER_MODE)
-  int num_cpus;
+  int px_degree;
   int rv;
 #endif /* SERVER_MODE */
 
@@ -1378,6 +1403,20 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 
       return error;
     }
+
+  rv = pthread_cond_init (&(sort_param->px_cond), NULL);
+  if (rv != 0)
+    {
+      error = ER_CSS_PTHREAD_COND_INIT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+
+      pthread_mutex_destroy (&(sort_param->px_mtx));
+      free_and_init (sort_param);
+
+      return error;
+    }
+  sort_param->px_worker_pool = NULL;
+  sort_param->px_tasks = NULL;
 #endif /* SERVER_MODE */
 
   sort_param->cmp_fn = cmp_fn;
@@ -1471,21 +1510,31 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->px_height_max = 0;	/* init */
   sort_param->px_array_size = 1;	/* init */
 
-#if 1				/* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-#endif
-
 #if defined(SERVER_MODE)
-  if (prm_enable_sort_parallel == true)
+  /* TODO - fileio_os_sysconf really get #cores instead of #CPUs - NEED MORE CONSIDERATION */
+  px_degree = MIN (prm_get_integer_value (PRM_ID_SORT_PARALLEL_DEGREE), fileio_os_sysconf ());
+  /* the root px_node is sorted by this thread */
+  px_degree = MIN (px_degree, (int) cubthread::parallel_query_worker_pool::get_worker_count () + 1);
+  if (px_degree > 1 && input_pages >= SORT_PX_MIN_INPUT_PAGES)
     {
-      /* TODO - calc n, 2^^n get the number of CPUs TODO - fileio_os_sysconf really get #cores instead of #CPUs -
-       * NEED MORE CONSIDERATION */
-      num_cpus = fileio_os_sysconf ();
+      /* calc n, the largest 2^^n not greater than the degree of parallelism */
+      while ((2 << sort_param->px_height_max) <= px_degree)
+	{
+	  sort_param->px_height_max++;	/* n */
+	}
+      sort_param->px_array_size = 1 << sort_param->px_height_max;	/* 2^^n */
 
-      sort_param->px_height_max = (int) sqrt ((double) num_cpus);	/* n */
-      sort_param->px_array_size = num_cpus;	/* 2^^n */
+      /* workers are shared with other transactions; a px_node waiting for a right child that no worker has started
+       * sorts the child by itself */
+      sort_param->px_worker_pool = cubthread::parallel_query_worker_pool::get_instance ();
+      assert (sort_param->px_worker_pool != NULL);
 
-      assert_release (sort_param->px_array_size == pow ((double) 2, (double) sort_param->px_height_max));
+      sort_param->px_tasks = px_sort_create_tasks ();
+      if (sort_param->px_tasks == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  goto cleanup;
+	}
     }
 #endif /* SERVER_MODE */
 
@@ -1505,6 +1554,9 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
    * space that is going to be needed.
    */
 
+  /* input and runs of a big sort are read through a small recycling set of page buffers */
+  seq_access_started = pgbuf_start_sequential_access (thread_p, input_pages);
+
   error = sort_inphase_sort (thread_p, sort_param, get_fn, get_arg, &total_numrecs);
   if (error != NO_ERROR)
     {
@@ -1543,6 +1595,11 @@ cleanup:
   CUBRID_SORT_END (total_numrecs, error);
 #endif /* ENABLE_SYSTEMTAP */
 
+  if (seq_access_started)
+    {
+      pgbuf_end_sequential_access (thread_p);
+    }
+
   sort_return_used_resources (thread_p, sort_param);
   sort_param = NULL;
   thread_set_sort_stats_active (thread_p, false);
@@ -1648,6 +1705,8 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 #endif
 
   px_node->px_status = 0;
+  /* owned by the assigning thread until it is communicated to workers */
+  px_node->px_claimed = true;
 
   pthread_mutex_unlock (&(sort_param->px_mtx));
 #else /* SERVER_MODE */
@@ -1685,9 +1744,117 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 #if defined(SERVER_MODE)
 // *INDENT-OFF*
 static void
-px_sort_myself_execute (cubthread::entry &thread_ref, PX_TREE_NODE * px_node)
+px_sort_myself_execute (cubthread::entry &thread_ref, PX_TREE_NODE * px_node, PX_SORT_TASKS * px_tasks)
+{
+  SORT_PARAM *sort_param;
+  bool is_claimed;
+  int rv;
+
+  rv = pthread_mutex_lock (&(px_tasks->mtx));
+  assert (rv == NO_ERROR);
+
+  if (px_tasks->is_closed)
+    {
+      /* started too late; px_node and sort_param may be freed */
+      pthread_mutex_unlock (&(px_tasks->mtx));
+      px_sort_release_tasks (px_tasks);
+      return;
+    }
+  px_tasks->n_running++;
+
+  pthread_mutex_unlock (&(px_tasks->mtx));
+
+  sort_param = (SORT_PARAM *) (px_node->px_arg);
+
+  /* the parent sorts the child by itself if no worker started it in time */
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  is_claimed = !px_node->px_claimed;
+  px_node->px_claimed = true;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  if (is_claimed)
+    {
+      /* is new child; work on behalf of the sorting transaction */
+      thread_ref.tran_index = px_node->px_tran_index;
+
+      (void) px_sort_myself (&thread_ref, px_node);
+
+      thread_ref.tran_index = NULL_TRAN_INDEX;
+    }
+
+  /* sort_param may be freed once all running tasks are ended */
+  rv = pthread_mutex_lock (&(px_tasks->mtx));
+  assert (rv == NO_ERROR);
+
+  assert (px_tasks->n_running > 0);
+  px_tasks->n_running--;
+  pthread_cond_broadcast (&(px_tasks->cond));
+
+  pthread_mutex_unlock (&(px_tasks->mtx));
+
+  px_sort_release_tasks (px_tasks);
+}
+
+/*
+ * px_sort_create_tasks() - create the state shared by the sort with the tasks of its px_nodes
+ *   return: shared state, referenced by the sort; NULL on error
+ *
+ * NOTE: support parallelism
+ */
+static PX_SORT_TASKS *
+px_sort_create_tasks (void)
+{
+  PX_SORT_TASKS *px_tasks;
+
+  px_tasks = (PX_SORT_TASKS *) malloc (sizeof (PX_SORT_TASKS));
+  if (px_tasks == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (PX_SORT_TASKS));
+      return NULL;
+    }
+
+  if (pthread_mutex_init (&(px_tasks->mtx), NULL) != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_INIT, 0);
+      free_and_init (px_tasks);
+      return NULL;
+    }
+  if (pthread_cond_init (&(px_tasks->cond), NULL) != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_INIT, 0);
+      pthread_mutex_destroy (&(px_tasks->mtx));
+      free_and_init (px_tasks);
+      return NULL;
+    }
+
+  px_tasks->n_running = 0;
+  px_tasks->is_closed = false;
+  px_tasks->ref_count = 1;
+
+  return px_tasks;
+}
+
+/*
+ * px_sort_release_tasks() - release a reference to the state shared with the tasks of px_nodes; the last one frees it
+ *   return:
+ *   px_tasks(in):
+ *
+ * NOTE: support parallelism
+ */
+static void
+px_sort_release_tasks (PX_SORT_TASKS * px_tasks)
 {
-  (void) px_sort_myself (&thread_ref, px_node);
+  if (ATOMIC_INC_32 (&(px_tasks->ref_count), -1) > 0)
+    {
+      return;
+    }
+
+  pthread_cond_destroy (&(px_tasks->cond));
+  pthread_mutex_destroy (&(px_tasks->mtx));
+  free (px_tasks);
 }
 
 /*
@@ -1702,6 +1869,7 @@ static int
 px_sort_communicate (PX_TREE_NODE * px_node)
 {
   SORT_PARAM *sort_param;
+  int rv;
 
   assert_release (px_node != NULL);
   assert_release (px_node->px_arg != NULL);
@@ -1710,10 +1878,24 @@ px_sort_communicate (PX_TREE_NODE * px_node)
   assert_release (px_node->px_height <= sort_param->px_height_max);
   assert_release (px_node->px_id < sort_param->px_array_size);
   assert_release (px_node->px_vector_size > 1);
+  assert_release (sort_param->px_worker_pool != NULL && sort_param->px_tasks != NULL);
+
+  /* from now on, the node is sorted by the first of the worker and the parent to claim it */
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  assert (px_node->px_claimed);
+  px_node->px_claimed = false;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  /* the task holds a reference until it ends */
+  (void) ATOMIC_INC_32 (&(sort_param->px_tasks->ref_count), 1);
 
   cubthread::entry_callable_task *task =
-    new cubthread::entry_callable_task (std::bind (px_sort_myself_execute, std::placeholders::_1, px_node));
-  css_push_external_task (css_get_current_conn_entry (), task);
+    new cubthread::entry_callable_task (std::bind (px_sort_myself_execute, std::placeholders::_1, px_node,
+						   sort_param->px_tasks));
+  thread_get_manager ()->push_task (sort_param->px_worker_pool, task);
 
   return NO_ERROR;
 }
@@ -1739,7 +1921,7 @@ px_sort_communicate (PX_TREE_NODE * px_node)
 static int
 px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
-#define SORT_PARTITION_RUN_SIZE_MIN (ONE_M)
+#define SORT_PARTITION_RUN_SIZE_MIN (64 * ONE_K)
 
   int ret = NO_ERROR;
   bool old_check_interrupt;
@@ -1775,13 +1957,6 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
   sort_param = (SORT_PARAM *) (px_node->px_arg);
 
 #if defined(SERVER_MODE)
-  if (px_node->px_id > 0)
-    {
-      /* is new childs */
-      thread_p->tran_index = px_node->px_tran_index;
-      pthread_mutex_unlock (&thread_p->tran_index_lock);
-    }
-
 #if !defined(NDEBUG)
   rv = pthread_mutex_lock (&(sort_param->px_mtx));
   assert (rv == NO_ERROR);
@@ -1908,25 +2083,30 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 	}
 
       /* wait for right-child finished */
-      do
-	{
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      assert (rv == NO_ERROR);
 
-	  if (right_px_node->px_status != 0)
-	    {
-	      assert (right_px_node->px_status == 1);
-	      pthread_mutex_unlock (&(sort_param->px_mtx));
-	      break;
-	    }
+      if (!right_px_node->px_claimed)
+	{
+	  /* all workers are busy; never wait for a queued task */
+	  right_px_node->px_claimed = true;
 
 	  pthread_mutex_unlock (&(sort_param->px_mtx));
 
-#if 1				/* TODO */
-	  thread_sleep (10);	/* 10 msec */
-#endif
+	  /* the child is marked as finished even if it fails; its result is checked below */
+	  (void) px_sort_myself (thread_p, right_px_node);
+
+	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+	  assert (rv == NO_ERROR);
+	}
+
+      while (right_px_node->px_status == 0)
+	{
+	  pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
 	}
-      while (1);
+      assert (right_px_node->px_status == 1);
+
+      pthread_mutex_unlock (&(sort_param->px_mtx));
 
       assert_release (px_node == left_px_node);
 #if !defined(NDEBUG)
@@ -2113,13 +2293,14 @@ exit_on_end:
 #if defined(SERVER_MODE)
   if (parent != px_node->px_id)
     {
-      /* mark as finished */
+      /* mark as finished and wake up the parent */
 
       rv = pthread_mutex_lock (&(sort_param->px_mtx));
       assert (rv == NO_ERROR);
 
       assert_release (px_node->px_status == 0);
       px_node->px_status = 1;	/* done */
+      pthread_cond_broadcast (&(sort_param->px_cond));
 
       pthread_mutex_unlock (&(sort_param->px_mtx));
     }
@@ -4387,6 +4568,27 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
       return;			/* nop */
     }
 
+#if defined(SERVER_MODE)
+  /* px_nodes of a failed sort may still be running; they use the internal memory and px_array. tasks that have not
+   * started yet are not waited for; they end without touching the sort */
+  if (sort_param->px_tasks != NULL)
+    {
+      rv = pthread_mutex_lock (&(sort_param->px_tasks->mtx));
+      assert (rv == NO_ERROR);
+
+      sort_param->px_tasks->is_closed = true;
+      while (sort_param->px_tasks->n_running > 0)
+	{
+	  pthread_cond_wait (&(sort_param->px_tasks->cond), &(sort_param->px_tasks->mtx));
+	}
+
+      pthread_mutex_unlock (&(sort_param->px_tasks->mtx));
+
+      px_sort_release_tasks (sort_param->px_tasks);
+      sort_param->px_tasks = NULL;
+    }
+#endif /* SERVER_MODE */
+
   if (sort_param->internal_memory)
     {
       free_and_init (sort_param->internal_memory);
@@ -4425,6 +4627,12 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_DESTROY, 0);
     }
+
+  rv = pthread_cond_destroy (&(sort_param->px_cond));
+  if (rv != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_DESTROY, 0);
+    }
 #endif
 
   free_and_init (sort_param);
@@ -189,6 +189,7 @@
 #define FILEIO_BACKUP_NO_ZIP_HEADER_VERSION        1
 #define FILEIO_BACKUP_CURRENT_HEADER_VERSION       2
 #define FILEIO_CHECK_FOR_INTERRUPT_INTERVAL       100
+#define FILEIO_WRITEV_MAX_PAGES                   64	/* pages written by one pwritev call */
 
 #define FILEIO_PAGE_SIZE_FULL_LEVEL (IO_PAGESIZE * FILEIO_FULL_LEVEL_EXP)
 #define FILEIO_BACKUP_PAGE_OVERHEAD \
@@ -508,6 +509,10 @@ static bool fileio_is_terminated_process (int pid);
 
 static ssize_t fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
 static ssize_t fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+static void *fileio_os_writev (THREAD_ENTRY * thread_p, int vol_fd, struct iovec *iov, int iovcnt, PAGEID page_id,
+			       size_t page_size);
+#endif /* SERVER_MODE && !WINDOWS */
 #if !defined (WINDOWS)
 static ssize_t pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count,
 					   off_t offset);
@@ -4410,14 +4415,79 @@ void *
 fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id, DKNPAGES npages,
 	       size_t page_size)
 {
-  int i;
   FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
 
 #if !defined (CS_MODE)
   write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
 #endif
 
-  for (i = 0; i < npages; i++)
+  return fileio_write_vectored (thread_p, vol_fd, io_page_array, start_page_id, npages, page_size, write_mode);
+}
+
+/*
+ * fileio_write_vectored () - write a set of contiguous pages, residing at different memory addresses, to disk
+ *   return: io_page_array[0] on success, NULL on failure
+ *   thread_p(in): Thread entry
+ *   vol_fd(in): Volume descriptor
+ *   io_page_array(in): Array of addresses where the content of pages reside
+ *   start_page_id(in): Page identifier of first page
+ *   num_pages(in): Number of consecutive pages
+ *   page_size(in): Page size
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ *
+ * Note: On server, the pages are written with one pwritev call for every FILEIO_WRITEV_MAX_PAGES pages, instead of
+ *       one system call for each page. Elsewhere, the pages are written one by one.
+ */
+void *
+fileio_write_vectored (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id,
+		       int num_pages, size_t page_size, FILEIO_WRITE_MODE write_mode)
+{
+  int i;
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+  struct iovec iov[FILEIO_WRITEV_MAX_PAGES];
+  int j, iovcnt;
+#endif /* SERVER_MODE && !WINDOWS */
+
+  assert (num_pages > 0);
+
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+#if !defined (NDEBUG)
+  if (FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS1) || FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS2))
+    {
+      /* partial writes are injected page by page */
+      goto write_one_by_one;
+    }
+#endif /* !NDEBUG */
+
+  for (i = 0; i < num_pages; i += iovcnt)
+    {
+      iovcnt = MIN (num_pages - i, FILEIO_WRITEV_MAX_PAGES);
+      for (j = 0; j < iovcnt; j++)
+	{
+	  iov[j].iov_base = io_page_array[i + j];
+	  iov[j].iov_len = page_size;
+	}
+
+      if (fileio_os_writev (thread_p, vol_fd, iov, iovcnt, start_page_id + i, page_size) == NULL)
+	{
+	  return NULL;
+	}
+    }
+
+  if (write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+    {
+      fileio_compensate_flush (thread_p, vol_fd, num_pages);
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOWRITES, num_pages);
+  return io_page_array[0];
+
+#if !defined (NDEBUG)
+write_one_by_one:
+#endif /* !NDEBUG */
+#endif /* SERVER_MODE && !WINDOWS */
+
+  for (i = 0; i < num_pages; i++)
     {
       if (fileio_write (thread_p, vol_fd, io_page_array[i], start_page_id + i, page_size, write_mode) == NULL)
 	{
@@ -4428,6 +4498,69 @@ fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID
   return io_page_array[0];
 }
 
+#if defined (SERVER_MODE) && !defined (WINDOWS)
+/*
+ * fileio_os_writev () - write the buffers of an I/O vector to contiguous pages of a volume
+ *   return: iov on success, NULL on failure
+ *   thread_p(in): Thread entry
+ *   vol_fd(in): Volume descriptor
+ *   iov(in/out): I/O vector; it is consumed by partial writes
+ *   iovcnt(in): Number of buffers in I/O vector
+ *   page_id(in): Page identifier of first page
+ *   page_size(in): Page size
+ */
+static void *
+fileio_os_writev (THREAD_ENTRY * thread_p, int vol_fd, struct iovec *iov, int iovcnt, PAGEID page_id,
+		  size_t page_size)
+{
+  struct iovec *iov_p = iov;
+  off_t offset = FILEIO_GET_FILE_SIZE (page_size, page_id);
+  ssize_t nbytes_written;
+
+  while (iovcnt > 0)
+    {
+      nbytes_written = pwritev (vol_fd, iov_p, iovcnt, offset);
+      if (nbytes_written <= 0)
+	{
+	  if (nbytes_written < 0 && (errno == EINTR || errno == EAGAIN))
+	    {
+	      continue;
+	    }
+	  else if (nbytes_written < 0 && errno == ENOSPC)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE_OUT_OF_SPACE, 2, page_id,
+		      fileio_get_volume_label_by_fd (vol_fd, PEEK));
+	      syslog (LOG_ALERT, "[CUBRID] %s () at %s:%d %m", __func__, __FILE__, __LINE__);
+	      return NULL;
+	    }
+	  else
+	    {
+	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, page_id,
+				   fileio_get_volume_label_by_fd (vol_fd, PEEK));
+	      return NULL;
+	    }
+	}
+
+      offset += nbytes_written;
+
+      /* skip the buffers written entirely and resume from the one written partially */
+      while (iovcnt > 0 && (size_t) nbytes_written >= iov_p->iov_len)
+	{
+	  nbytes_written -= iov_p->iov_len;
+	  iov_p++;
+	  iovcnt--;
+	}
+      if (iovcnt > 0)
+	{
+	  iov_p->iov_base = (char *) iov_p->iov_base + nbytes_written;
+	  iov_p->iov_len -= nbytes_written;
+	}
+    }
+
+  return iov;
+}
+#endif /* SERVER_MODE && !WINDOWS */
+
 /*
  * fileio_synchronize () - Synchronize a database volume's state with that on disk
  *   return: vdes or NULL_VOLDES
@@ -5872,6 +6005,24 @@ fileio_make_dwb_name (char *dwb_name_p, const char *dwb_path_p, const char *db_n
   sprintf (dwb_name_p, "%s%s%s%s", dwb_path_p, FILEIO_PATH_SEPARATOR (dwb_path_p), db_name_p, FILEIO_SUFFIX_DWB);
 }
 
+/*
+ * fileio_make_xcache_name () - Build the name of the file where XASL cache is saved
+ *   return: void
+ *   xcache_name_p(out): the name of XASL cache file
+ *   xcache_path_p(in): XASL cache file path
+ *   dbname(in): database name
+ *
+ * Note: The caller must have enough space to store the name of the file
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_xcache_name (char *xcache_name_p, const char *xcache_path_p, const char *db_name_p)
+{
+  sprintf (xcache_name_p, "%s%s%s%s", xcache_path_p, FILEIO_PATH_SEPARATOR (xcache_path_p), db_name_p,
+	   FILEIO_SUFFIX_XCACHE);
+}
+
 
 /*
  * fileio_cache () - Cache information related to a mounted volume
@@ -423,6 +423,18 @@ struct file_map_context
   void *args;
 };
 
+/* FILE_COLLECT_PAGES_CONTEXT - context variables for file_collect_user_pages function. */
+typedef struct file_collect_pages_context FILE_COLLECT_PAGES_CONTEXT;
+struct file_collect_pages_context
+{
+  bool is_partial;
+  FILE_FTAB_COLLECTOR ftab_collector;
+
+  VPID *vpids;
+  int n_vpids;
+  int max_vpids;
+};
+
 /************************************************************************/
 /* Numerable files section                                              */
 /************************************************************************/
@@ -711,6 +723,7 @@ static int file_rv_dealloc_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, boo
 STATIC_INLINE int file_create_temp_internal (THREAD_ENTRY * thread_p, int npages, FILE_TYPE ftype, bool is_numerable,
 					     VFID * vfid_out) __attribute__ ((ALWAYS_INLINE));
 static int file_sector_map_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
+static int file_sector_collect_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
 static DISK_ISVALID file_table_check (THREAD_ENTRY * thread_p, const VFID * vfid, DISK_VOLMAP_CLONE * disk_map_clone);
 
 STATIC_INLINE int file_table_dump (THREAD_ENTRY * thread_p, const FILE_HEADER * fhead, FILE * fp)
@@ -6922,6 +6935,176 @@ exit:
   return error_code;
 }
 
+/*
+ * file_sector_collect_pages () - FILE_EXTDATA_ITEM_FUNC used for collecting the identifiers of all user pages
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ * data (in)     : FILE_PARTIAL_SECTOR or VSID
+ * index (in)    : ignored
+ * stop (out)    : output true when output array is full
+ * args (in)     : collect context
+ */
+static int
+file_sector_collect_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args)
+{
+  FILE_COLLECT_PAGES_CONTEXT *context = (FILE_COLLECT_PAGES_CONTEXT *) args;
+  FILE_PARTIAL_SECTOR partsect = FILE_PARTIAL_SECTOR_INITIALIZER;
+  int iter;
+  VPID vpid;
+
+  assert (context != NULL);
+
+  /* hack to know this is partial table or full table */
+  if (context->is_partial)
+    {
+      partsect = *(FILE_PARTIAL_SECTOR *) data;
+    }
+  else
+    {
+      partsect.vsid = *(VSID *) data;
+    }
+
+  vpid.volid = partsect.vsid.volid;
+  for (iter = 0, vpid.pageid = SECTOR_FIRST_PAGEID (partsect.vsid.sectid); iter < FILE_ALLOC_BITMAP_NBITS;
+       iter++, vpid.pageid++)
+    {
+      if (context->is_partial && !file_partsect_is_bit_set (&partsect, iter))
+	{
+	  /* not allocated */
+	  continue;
+	}
+
+      if (file_table_collector_has_page (&context->ftab_collector, &vpid))
+	{
+	  /* skip table pages */
+	  continue;
+	}
+
+      if (context->n_vpids >= context->max_vpids)
+	{
+	  /* header says there are no more user pages */
+	  assert (false);
+	  *stop = true;
+	  return NO_ERROR;
+	}
+      context->vpids[context->n_vpids++] = vpid;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * file_collect_user_pages () - collect identifiers of all user pages of file
+ *
+ * return            : error code
+ * thread_p (in)     : thread entry
+ * vfid (in)         : file identifier
+ * vpids_out (out)   : allocated array of user page identifiers. caller must free it with db_private_free.
+ * n_vpids_out (out) : number of user pages
+ *
+ * note: unlike file_map_pages, user pages are not fixed. the output is only a snapshot of file table; pages can be
+ *       deallocated once the header latch is released. callers should fix pages with OLD_PAGE_MAYBE_DEALLOCATED.
+ */
+int
+file_collect_user_pages (THREAD_ENTRY * thread_p, const VFID * vfid, VPID ** vpids_out, int *n_vpids_out)
+{
+  VPID vpid_fhead;
+  PAGE_PTR page_fhead = NULL;
+  FILE_HEADER *fhead = NULL;
+  FILE_EXTENSIBLE_DATA *extdata_ftab;
+  FILE_COLLECT_PAGES_CONTEXT context;
+  int error_code = NO_ERROR;
+
+  assert (vfid != NULL && !VFID_ISNULL (vfid));
+  assert (vpids_out != NULL && n_vpids_out != NULL);
+
+  *vpids_out = NULL;
+  *n_vpids_out = 0;
+
+  FILE_GET_HEADER_VPID (vfid, &vpid_fhead);
+  page_fhead = pgbuf_fix (thread_p, &vpid_fhead, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (page_fhead == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  fhead = (FILE_HEADER *) page_fhead;
+  file_header_sanity_check (thread_p, fhead);
+
+  context.ftab_collector.partsect_ftab = NULL;
+  context.vpids = NULL;
+  context.n_vpids = 0;
+  context.max_vpids = fhead->n_page_user;
+  if (context.max_vpids <= 0)
+    {
+      /* empty file */
+      goto exit;
+    }
+
+  context.vpids = (VPID *) db_private_alloc (thread_p, context.max_vpids * sizeof (VPID));
+  if (context.vpids == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, context.max_vpids * sizeof (VPID));
+      goto exit;
+    }
+
+  /* collect table pages */
+  error_code = file_table_collect_ftab_pages (thread_p, page_fhead, true, &context.ftab_collector);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  /* collect from partial sectors table */
+  FILE_HEADER_GET_PART_FTAB (fhead, extdata_ftab);
+  context.is_partial = true;
+  error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_collect_pages, &context,
+					 false, NULL, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (!FILE_IS_TEMPORARY (fhead))
+    {
+      /* collect from full table */
+      context.is_partial = false;
+      FILE_HEADER_GET_FULL_FTAB (fhead, extdata_ftab);
+      error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_collect_pages, &context,
+					     false, NULL, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+    }
+
+  assert (error_code == NO_ERROR);
+  *vpids_out = context.vpids;
+  *n_vpids_out = context.n_vpids;
+  context.vpids = NULL;
+
+exit:
+  if (page_fhead != NULL)
+    {
+      pgbuf_unfix (thread_p, page_fhead);
+    }
+  if (context.ftab_collector.partsect_ftab != NULL)
+    {
+      db_private_free (thread_p, context.ftab_collector.partsect_ftab);
+    }
+  if (context.vpids != NULL)
+    {
+      db_private_free (thread_p, context.vpids);
+    }
+
+  return error_code;
+}
+
 /*
  * file_table_check () - check file table is valid
  *
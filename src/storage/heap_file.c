@@ -640,6 +640,8 @@ static int heap_vpid_init_new (THREAD_ENTRY * thread_p, PAGE_PTR page, void *arg
 static int heap_vpid_alloc (THREAD_ENTRY * thread_p, const HFID * hfid, PAGE_PTR hdr_pgptr, HEAP_HDR_STATS * heap_hdr,
 			    HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * new_pg_watcher);
 static VPID *heap_vpid_remove (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, VPID * rm_vpid);
+static bool heap_read_ahead_next_vpid (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, const OID * class_oid,
+				       VPID * next_vpid);
 
 static int heap_create_internal (THREAD_ENTRY * thread_p, HFID * hfid, const OID * class_oid, const bool reuse_oid);
 static const HFID *heap_reuse (THREAD_ENTRY * thread_p, const HFID * hfid, const OID * class_oid, const bool reuse_oid);
@@ -765,7 +767,7 @@ static SCAN_CODE heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, R
 				       DB_VALUE ** record_info);
 static SCAN_CODE heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 				     RECDES * recdes, HEAP_SCANCACHE * scan_cache, bool ispeeking,
-				     bool reversed_direction, DB_VALUE ** cache_recordinfo);
+				     bool reversed_direction, bool stay_in_page, DB_VALUE ** cache_recordinfo);
 
 static SCAN_CODE heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
 				     const PAGE_PTR pgptr, DB_VALUE ** page_info);
@@ -4971,6 +4973,42 @@ error:
   return false;
 }
 
+/*
+ * heap_read_ahead_next_vpid () - Get next page of heap chain for page buffer read-ahead
+ *   return: true if page is a heap page of given class, false otherwise
+ *   pgptr(in): Page fixed by read-ahead worker
+ *   class_oid(in): Class of scanned heap or NULL
+ *   next_vpid(out): Next volume-page identifier
+ *
+ * Note: Page is fixed without any lock on heap, it may have been deallocated and reused meanwhile.
+ */
+static bool
+heap_read_ahead_next_vpid (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, const OID * class_oid, VPID * next_vpid)
+{
+  HEAP_CHAIN *chain;
+  RECDES recdes;
+
+  if (pgbuf_get_page_ptype (thread_p, pgptr) != PAGE_HEAP)
+    {
+      return false;
+    }
+  if (spage_get_record (thread_p, pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK) != S_SUCCESS
+      || recdes.length < (int) sizeof (HEAP_CHAIN))
+    {
+      return false;
+    }
+
+  /* the header page is the first page of heap and it is never read ahead; this must be a chain record */
+  chain = (HEAP_CHAIN *) recdes.data;
+  if (class_oid != NULL && !OID_ISNULL (class_oid) && !OID_EQ (&chain->class_oid, class_oid))
+    {
+      return false;
+    }
+
+  *next_vpid = chain->next_vpid;
+  return true;
+}
+
 /*
  * heap_vpid_next () - Find next page of heap
  *   return: NO_ERROR
@@ -6761,9 +6799,11 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
+  scan_cache->m_insert_batch = NULL;
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
 
   return ret;
 
@@ -6778,10 +6818,12 @@ exit_on_error:
   PGBUF_INIT_WATCHER (&(scan_cache->page_watcher), PGBUF_ORDERED_RANK_UNDEFINED, PGBUF_ORDERED_NULL_HFID);
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
+  scan_cache->m_insert_batch = NULL;
   scan_cache->file_type = FILE_UNKNOWN_TYPE;
   scan_cache->debug_initpattern = 0;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead);
 
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
@@ -7060,6 +7102,7 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->start_area ();
   scan_cache->num_btids = 0;
   scan_cache->m_index_stats = NULL;
+  scan_cache->m_insert_batch = NULL;
   scan_cache->file_type = FILE_UNKNOWN_TYPE;
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
@@ -7092,6 +7135,8 @@ heap_scancache_quick_end (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache)
     {
       delete scan_cache->m_index_stats;
       scan_cache->m_index_stats = NULL;
+      delete scan_cache->m_insert_batch;
+      scan_cache->m_insert_batch = NULL;
       scan_cache->num_btids = 0;
 
       if (scan_cache->cache_last_fix_page == true)
@@ -7739,12 +7784,18 @@ heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT *
  * scan_cache (in)	     : Scan cache or NULL
  * ispeeking (in)	     : PEEK when the object is peeked scan_cache can't
  *			       be NULL COPY when the object is copied.
+ * reversed_direction (in)   : true to scan backwards.
+ * stay_in_page (in)	     : true to stop at the end of the page of next_oid
+ *			       instead of following the heap chain. The page
+ *			       may have been deallocated or reused by another
+ *			       file; such page is treated as empty.
  * cache_recordinfo (in/out) : DB_VALUE pointer array that caches record
  *			       information values.
  */
 static SCAN_CODE
 heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
-		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, DB_VALUE ** cache_recordinfo)
+		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, bool stay_in_page,
+		    DB_VALUE ** cache_recordinfo)
 {
   VPID vpid;
   VPID *vpidptr_incache;
@@ -7756,8 +7807,10 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
   bool is_null_recdata;
   PGBUF_WATCHER curr_page_watcher;
   PGBUF_WATCHER old_page_watcher;
+  OID page_class_oid;
 
   assert (scan_cache != NULL);
+  assert (!stay_in_page || !OID_ISNULL (next_oid));
 
 #if defined(CUBRID_DEBUG)
   if (scan_cache != NULL && scan_cache->debug_initpattern != HEAP_DEBUG_SCANCACHE_INITPATTERN)
@@ -7845,12 +7898,34 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 	  if (curr_page_watcher.pgptr == NULL)
 	    {
 	      curr_page_watcher.pgptr =
-		heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, scan_cache,
-					     &curr_page_watcher);
+		heap_scan_pb_lock_and_fetch (thread_p, &vpid,
+					     stay_in_page ? OLD_PAGE_MAYBE_DEALLOCATED : OLD_PAGE_PREVENT_DEALLOC,
+					     S_LOCK, scan_cache, &curr_page_watcher);
 	      if (old_page_watcher.pgptr != NULL)
 		{
 		  pgbuf_ordered_unfix (thread_p, &old_page_watcher);
 		}
+	      if (curr_page_watcher.pgptr == NULL && stay_in_page && er_errid () == ER_PB_BAD_PAGEID)
+		{
+		  /* page was deallocated after the caller picked it; nothing to scan */
+		  er_clear ();
+		  OID_SET_NULL (next_oid);
+		  return S_END;
+		}
+	      if (curr_page_watcher.pgptr != NULL && stay_in_page)
+		{
+		  /* page may have been reused by another file */
+		  if (pgbuf_get_page_ptype (thread_p, curr_page_watcher.pgptr) != PAGE_HEAP
+		      || (class_oid != NULL && !OID_ISNULL (class_oid)
+			  && (heap_get_class_oid_from_page (thread_p, curr_page_watcher.pgptr, &page_class_oid) != NO_ERROR
+			      || !OID_EQ (&page_class_oid, class_oid))))
+		    {
+		      er_clear ();
+		      pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		      OID_SET_NULL (next_oid);
+		      return S_END;
+		    }
+		}
 	      if (curr_page_watcher.pgptr == NULL)
 		{
 		  if (er_errid () == ER_PB_BAD_PAGEID)
@@ -7923,7 +7998,18 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 
 	  if (scan != S_SUCCESS)
 	    {
-	      if (scan == S_END)
+	      if (scan == S_END && stay_in_page)
+		{
+		  /* end of the page, the caller picks the next one */
+		  pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		  if (old_page_watcher.pgptr != NULL)
+		    {
+		      pgbuf_ordered_unfix (thread_p, &old_page_watcher);
+		    }
+		  OID_SET_NULL (next_oid);
+		  return scan;
+		}
+	      else if (scan == S_END)
 		{
 		  /* Find next page of heap and continue scanning */
 		  if (reversed_direction)
@@ -7933,6 +8019,8 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 		  else
 		    {
 		      (void) heap_vpid_next (thread_p, hfid, curr_page_watcher.pgptr, &vpid);
+		      pgbuf_read_ahead_next (thread_p, &scan_cache->read_ahead, &vpid, heap_read_ahead_next_vpid,
+					     class_oid);
 		    }
 		  pgbuf_replace_watcher (thread_p, &curr_page_watcher, &old_page_watcher);
 		  oid.volid = vpid.volid;
@@ -18526,7 +18614,32 @@ SCAN_CODE
 heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, false, NULL);
+}
+
+/*
+ * heap_next_in_page () - Retrieve or peek next object of one heap page
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
+ *   hfid(in):
+ *   class_oid(in):
+ *   next_oid(in/out): Object identifier of current record. Page identifier
+ *                     must be set, slotid should be NULL_SLOTID to start
+ *                     with first record of the page. Will be set to next
+ *                     available record or NULL_OID when there is not one.
+ *   recdes(in/out): Pointer to a record descriptor. Will be modified to
+ *                   describe the new record.
+ *   scan_cache(in/out): Scan cache
+ *   ispeeking(in): PEEK when the object is peeked, scan_cache cannot be NULL
+ *                  COPY when the object is copied
+ *
+ * Note: Like heap_next, but does not follow the heap chain. Used to scan
+ *       pages distributed to several threads.
+ */
+SCAN_CODE
+heap_next_in_page (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
+		   HEAP_SCANCACHE * scan_cache, int ispeeking)
+{
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, true, NULL);
 }
 
 /*
@@ -18552,7 +18665,7 @@ SCAN_CODE
 heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false,
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, false,
 			     cache_recordinfo);
 }
 
@@ -18575,7 +18688,7 @@ SCAN_CODE
 heap_prev (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, false, NULL);
 }
 
 /*
@@ -18601,7 +18714,7 @@ SCAN_CODE
 heap_prev_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true,
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, false,
 			     cache_recordinfo);
 }
 
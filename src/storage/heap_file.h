@@ -43,6 +43,7 @@
 
 // forward declarations
 class multi_index_unique_stats;
+class btree_insert_batch;
 class record_descriptor;
 
 #define HFID_EQ(hfid_ptr1, hfid_ptr2) \
@@ -149,11 +150,13 @@ struct heap_scancache
     PGBUF_WATCHER page_watcher;
     int num_btids;		/* Total number of indexes defined on the scanning class */
     multi_index_unique_stats *m_index_stats;	// does this really belong to scan cache??
+    btree_insert_batch *m_insert_batch;	/* index keys deferred to the end of a multi-row insert */
     FILE_TYPE file_type;		/* The file type of the heap file being scanned. Can be FILE_HEAP or
 				         * FILE_HEAP_REUSE_SLOTS */
     MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
     HEAP_SCANCACHE_NODE_LIST *partition_list;	/* list holding the heap file information for partition nodes involved
 						 * in the scan */
+    PGBUF_READ_AHEAD read_ahead;	/* read-ahead of the heap pages following the scanned page */
 
 
     void start_area ();
@@ -417,6 +420,8 @@ extern void heap_scancache_end_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE *
 extern SCAN_CODE heap_get_class_oid (THREAD_ENTRY * thread_p, const OID * oid, OID * class_oid);
 extern SCAN_CODE heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 			    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
+extern SCAN_CODE heap_next_in_page (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
+				    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
 extern SCAN_CODE heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 					RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking,
 					DB_VALUE ** cache_recordinfo);
@@ -635,7 +635,6 @@ struct pgbuf_page_quota
   float private_pages_ratio;	/* Ratio of all private BCBs among total BCBs */
 
   /* TODO: remove me --> */
-  unsigned int add_shared_lru_idx;	/* circular index of shared LRU for relocating to shared */
   int avoid_shared_lru_idx;	/* index of shared LRU to avoid when relocating to shared;
 				 * this is usually the index of shared LRU with maximum number of BCBs;
 				 * transaction will avoid this list when relocating to shared LRU (like when moving from
@@ -646,6 +645,29 @@ struct pgbuf_page_quota
   int is_adjusting;
 };
 
+/* PGBUF_NUMA_NODE - shared LRU lists are partitioned by NUMA nodes. a thread adds pages to and looks for victims in the
+ * lists of the node it runs on first, to keep the list mutexes and the memory of their pages local to the node.
+ * there is one node if NUMA awareness is disabled.
+ */
+typedef struct pgbuf_numa_node PGBUF_NUMA_NODE;
+struct pgbuf_numa_node
+{
+  /* *INDENT-OFF* */
+  lockfree::circular_queue<int> *shared_lrus_with_victims;	/* node's shared lists having victims */
+  /* *INDENT-ON* */
+  unsigned int add_shared_lru_idx;	/* circular index of node's shared LRU for relocating to shared */
+  char padding[64 - sizeof (void *) - sizeof (unsigned int)];	/* avoid false sharing between nodes */
+};
+
+typedef struct pgbuf_numa PGBUF_NUMA;
+struct pgbuf_numa
+{
+  int node_count;		/* number of nodes partitioning shared LRU lists */
+  int cpu_count;		/* size of cpu_to_node */
+  int *cpu_to_node;		/* node of each cpu; NULL if there is only one node */
+  PGBUF_NUMA_NODE *nodes;
+};
+
 #if defined (SERVER_MODE)
 /* PGBUF_DIRECT_VICTIM - system used to optimize the victim assignment without searching and burning CPU uselessly.
  * threads are waiting to be assigned a victim directly and woken up.
@@ -662,6 +684,31 @@ struct pgbuf_direct_victim
 #define PGBUF_FLUSHED_BCBS_BUFFER_SIZE (8 * 1024)	/* 8k */
 #endif /* SERVER_MODE */
 
+/* PGBUF_SCAN_RING - small per-thread set of bcb's recycled by large sequential scans.
+ * while a thread is in sequential access mode, the pages it loads from disk are added to the bottom of lru (victim
+ * zone) instead of the middle and are remembered in the thread's ring. once the ring is full, the oldest ring bcb is
+ * reused for the next page (if nobody else needed it in the meantime), instead of searching lru lists for a victim.
+ * this way, a scan of a table much larger than the buffer does not flush hot pages of other transactions.
+ */
+typedef struct pgbuf_scan_ring_entry PGBUF_SCAN_RING_ENTRY;
+struct pgbuf_scan_ring_entry
+{
+  PGBUF_BCB *bcb;
+  VPID vpid;			/* page loaded by the thread; bcb is reused only if it still has the same page */
+};
+
+typedef struct pgbuf_scan_ring PGBUF_SCAN_RING;
+struct pgbuf_scan_ring
+{
+  int nesting;			/* greater than zero while thread is in sequential access mode */
+  int count;			/* number of entries in ring */
+  int next;			/* next entry to be replaced (the oldest when ring is full) */
+  PGBUF_SCAN_RING_ENTRY *entries;
+};
+
+/* scans of files smaller than this fraction of buffer do not use rings */
+#define PGBUF_SCAN_RING_MIN_FILE_RATIO 0.25f
+
 /* The buffer Pool */
 struct pgbuf_buffer_pool
 {
@@ -731,8 +778,12 @@ struct pgbuf_buffer_pool
 #endif				/* SERVER_MODE */
   lockfree::circular_queue<int> *private_lrus_with_victims;
   lockfree::circular_queue<int> *big_private_lrus_with_victims;
-  lockfree::circular_queue<int> *shared_lrus_with_victims;
   /* *INDENT-ON* */
+  PGBUF_NUMA numa;		/* partitioning of shared LRU lists by NUMA nodes */
+
+  int scan_ring_size;		/* number of pages in each scan ring; 0 if rings are disabled */
+  PGBUF_SCAN_RING *scan_rings;	/* scan ring for each thread */
+  PGBUF_SCAN_RING_ENTRY *scan_ring_entries;	/* memory for entries of all scan rings */
 };
 
 /* victim candidate list */
@@ -871,7 +922,20 @@ PGBUF_THREAD_HAS_PRIVATE_LRU (THREAD_ENTRY * thread_p)
 #define PGBUF_PRIVATE_LIST_FROM_LRU_INDEX(i) ((i) - PGBUF_SHARED_LRU_COUNT)
 #define PGBUF_LRU_INDEX_FROM_PRIVATE(private_id) (PGBUF_SHARED_LRU_COUNT + (private_id))
 
+#define PGBUF_THREAD_IN_SCAN_RING(thread_p) \
+  (pgbuf_Pool.scan_rings != NULL && pgbuf_Pool.scan_rings[thread_get_entry_index (thread_p)].nesting > 0)
+
 #define PGBUF_IS_SHARED_LRU_INDEX(lru_idx) ((lru_idx) < PGBUF_SHARED_LRU_COUNT)
+
+/* shared LRU lists are assigned to NUMA nodes in round-robin; i-th list of a node is node + i * node_count */
+#define PGBUF_NUMA_NODE_COUNT (pgbuf_Pool.numa.node_count)
+#define PGBUF_NUMA_NODE_OF_SHARED_LRU(lru_idx) ((lru_idx) % PGBUF_NUMA_NODE_COUNT)
+#define PGBUF_NUMA_NODE_SHARED_LRU_COUNT(node) \
+  ((PGBUF_SHARED_LRU_COUNT - (node) + PGBUF_NUMA_NODE_COUNT - 1) / PGBUF_NUMA_NODE_COUNT)
+#define PGBUF_NUMA_NODE_SHARED_LRU(node, i) \
+  ((node) + PGBUF_NUMA_NODE_COUNT * (int) ((i) % PGBUF_NUMA_NODE_SHARED_LRU_COUNT (node)))
+#define PGBUF_SHARED_LRU_VICTIMS_QUEUE(lru_idx) \
+  (pgbuf_Pool.numa.nodes[PGBUF_NUMA_NODE_OF_SHARED_LRU (lru_idx)].shared_lrus_with_victims)
 #define PGBUF_IS_PRIVATE_LRU_INDEX(lru_idx) ((lru_idx) >= PGBUF_SHARED_LRU_COUNT)
 
 #define PGBUF_LRU_LIST_IS_OVER_QUOTA(list) (PGBUF_LRU_LIST_COUNT (list) > (list)->quota)
@@ -917,6 +981,11 @@ static int pgbuf_initialize_page_quota_parameters (void);
 static int pgbuf_initialize_page_quota (void);
 static int pgbuf_initialize_page_monitor (void);
 static int pgbuf_initialize_thrd_holder (void);
+static int pgbuf_initialize_scan_rings (void);
+static int pgbuf_initialize_numa (void);
+STATIC_INLINE int pgbuf_numa_get_current_node (void) __attribute__ ((ALWAYS_INLINE));
+static UINT64 pgbuf_lfcq_shared_consumer_cursor (void);
+static bool pgbuf_lfcq_shared_is_empty (void);
 STATIC_INLINE PGBUF_HOLDER *pgbuf_allocate_thrd_holder_entry (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE PGBUF_HOLDER *pgbuf_find_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
   __attribute__ ((ALWAYS_INLINE));
@@ -960,6 +1029,9 @@ STATIC_INLINE int pgbuf_get_shared_lru_index_for_add (void) __attribute__ ((ALWA
 static int pgbuf_get_victim_candidates_from_lru (THREAD_ENTRY * thread_p, int check_count,
 						 float lru_sum_flush_priority, bool * assigned_directly);
 static PGBUF_BCB *pgbuf_get_victim (THREAD_ENTRY * thread_p);
+static PGBUF_BCB *pgbuf_get_victim_from_scan_ring (THREAD_ENTRY * thread_p);
+static void pgbuf_scan_ring_add_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb);
+STATIC_INLINE bool pgbuf_is_scan_ring_page (PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 static PGBUF_BCB *pgbuf_get_victim_from_lru_list (THREAD_ENTRY * thread_p, const int lru_idx);
 #if defined (SERVER_MODE)
 static int pgbuf_panic_assign_direct_victims_from_lru (THREAD_ENTRY * thread_p, PGBUF_LRU_LIST * lru_list,
@@ -1155,7 +1227,10 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::entry_workpool *pgbuf_Read_ahead_workers = NULL;
 // *INDENT-ON*
+
+static bool pgbuf_is_page_in_buffer_hint (const VPID * vpid);
 #endif /* SERVER_MODE */
 
 static bool pgbuf_is_page_flush_daemon_available ();
@@ -1245,6 +1320,8 @@ pgbuf_compare_vpid (const void *key_vpid1, const void *key_vpid2)
 int
 pgbuf_initialize (void)
 {
+  int i;
+
   pgbuf_flags_mask_sanity_check ();
 
   memset (&pgbuf_Pool, 0, sizeof (pgbuf_Pool));
@@ -1318,6 +1395,16 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  if (pgbuf_initialize_scan_rings () != NO_ERROR)
+    {
+      goto error;
+    }
+
+  if (pgbuf_initialize_numa () != NO_ERROR)
+    {
+      goto error;
+    }
+
   /* keep page quota initializer first */
   if (pgbuf_initialize_page_quota () != NO_ERROR)
     {
@@ -1420,13 +1507,17 @@ pgbuf_initialize (void)
 	}
     }
 
-  /* *INDENT-OFF* */
-  pgbuf_Pool.shared_lrus_with_victims = new lockfree::circular_queue<int> (PGBUF_SHARED_LRU_COUNT * 2);
-  /* *INDENT-ON* */
-  if (pgbuf_Pool.shared_lrus_with_victims == NULL)
+  for (i = 0; i < PGBUF_NUMA_NODE_COUNT; i++)
     {
-      ASSERT_ERROR ();
-      goto error;
+      /* *INDENT-OFF* */
+      pgbuf_Pool.numa.nodes[i].shared_lrus_with_victims =
+	new lockfree::circular_queue<int> (PGBUF_NUMA_NODE_SHARED_LRU_COUNT (i) * 2);
+      /* *INDENT-ON* */
+      if (pgbuf_Pool.numa.nodes[i].shared_lrus_with_victims == NULL)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
     }
 
   return NO_ERROR;
@@ -1557,6 +1648,17 @@ pgbuf_finalize (void)
       free_and_init (pgbuf_Pool.seq_chkpt_flusher.flush_list);
     }
 
+  /* final task for scan rings */
+  if (pgbuf_Pool.scan_rings != NULL)
+    {
+      free_and_init (pgbuf_Pool.scan_rings);
+    }
+  if (pgbuf_Pool.scan_ring_entries != NULL)
+    {
+      free_and_init (pgbuf_Pool.scan_ring_entries);
+    }
+  pgbuf_Pool.scan_ring_size = 0;
+
   /* Free quota structure data */
   if (pgbuf_Pool.quota.lru_victim_flush_priority_per_lru != NULL)
     {
@@ -1614,11 +1716,22 @@ pgbuf_finalize (void)
       delete pgbuf_Pool.big_private_lrus_with_victims;
       pgbuf_Pool.big_private_lrus_with_victims = NULL;
     }
-  if (pgbuf_Pool.shared_lrus_with_victims != NULL)
+  if (pgbuf_Pool.numa.nodes != NULL)
+    {
+      for (i = 0; i < pgbuf_Pool.numa.node_count; i++)
+	{
+	  if (pgbuf_Pool.numa.nodes[i].shared_lrus_with_victims != NULL)
+	    {
+	      delete pgbuf_Pool.numa.nodes[i].shared_lrus_with_victims;
+	    }
+	}
+      free_and_init (pgbuf_Pool.numa.nodes);
+    }
+  if (pgbuf_Pool.numa.cpu_to_node != NULL)
     {
-      delete pgbuf_Pool.shared_lrus_with_victims;
-      pgbuf_Pool.shared_lrus_with_victims = NULL;
+      free_and_init (pgbuf_Pool.numa.cpu_to_node);
     }
+  pgbuf_Pool.numa.node_count = 0;
 }
 
 /*
@@ -5156,6 +5269,232 @@ pgbuf_initialize_thrd_holder (void)
   return NO_ERROR;
 }
 
+/*
+ * pgbuf_initialize_scan_rings () - initialize scan rings used by threads doing sequential access
+ *
+ * return : NO_ERROR, or ER_code
+ */
+static int
+pgbuf_initialize_scan_rings (void)
+{
+  size_t thrd_num_total;
+  size_t alloc_size;
+  size_t i;
+
+  pgbuf_Pool.scan_rings = NULL;
+  pgbuf_Pool.scan_ring_entries = NULL;
+
+  /* rings must remain a small part of the buffer */
+  pgbuf_Pool.scan_ring_size = prm_get_integer_value (PRM_ID_PB_SCAN_RING_PAGES);
+  pgbuf_Pool.scan_ring_size = MIN (pgbuf_Pool.scan_ring_size, pgbuf_Pool.num_buffers / 8);
+  if (pgbuf_Pool.scan_ring_size <= 1)
+    {
+      /* disabled */
+      pgbuf_Pool.scan_ring_size = 0;
+      return NO_ERROR;
+    }
+
+  thrd_num_total = thread_num_total_threads ();
+
+  alloc_size = thrd_num_total * sizeof (PGBUF_SCAN_RING);
+  pgbuf_Pool.scan_rings = (PGBUF_SCAN_RING *) malloc (alloc_size);
+  if (pgbuf_Pool.scan_rings == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  alloc_size = thrd_num_total * pgbuf_Pool.scan_ring_size * sizeof (PGBUF_SCAN_RING_ENTRY);
+  pgbuf_Pool.scan_ring_entries = (PGBUF_SCAN_RING_ENTRY *) malloc (alloc_size);
+  if (pgbuf_Pool.scan_ring_entries == NULL)
+    {
+      free_and_init (pgbuf_Pool.scan_rings);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < thrd_num_total; i++)
+    {
+      pgbuf_Pool.scan_rings[i].nesting = 0;
+      pgbuf_Pool.scan_rings[i].count = 0;
+      pgbuf_Pool.scan_rings[i].next = 0;
+      pgbuf_Pool.scan_rings[i].entries = &pgbuf_Pool.scan_ring_entries[i * pgbuf_Pool.scan_ring_size];
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_initialize_numa () - partition shared LRU lists by NUMA nodes
+ *   return: NO_ERROR, or ER_code
+ *
+ * Note: if NUMA awareness is disabled or the system has only one node, all lists belong to one node.
+ */
+static int
+pgbuf_initialize_numa (void)
+{
+  int node_count = 1;
+  size_t alloc_size;
+  int i;
+#if defined (LINUX)
+  char path[PATH_MAX];
+  FILE *fp;
+  int cpu, first_cpu, last_cpu;
+  char sep;
+#endif /* LINUX */
+
+  pgbuf_Pool.numa.node_count = 0;
+  pgbuf_Pool.numa.cpu_count = 0;
+  pgbuf_Pool.numa.cpu_to_node = NULL;
+  pgbuf_Pool.numa.nodes = NULL;
+
+#if defined (LINUX)
+  if (prm_get_bool_value (PRM_ID_PB_NUMA_AWARE))
+    {
+      /* count nodes; every node must have at least one shared list */
+      for (node_count = 0; node_count < PGBUF_SHARED_LRU_COUNT; node_count++)
+	{
+	  snprintf (path, sizeof (path), "/sys/devices/system/node/node%d/cpulist", node_count);
+	  if (access (path, R_OK) != 0)
+	    {
+	      break;
+	    }
+	}
+      node_count = MAX (node_count, 1);
+    }
+
+  if (node_count > 1)
+    {
+      pgbuf_Pool.numa.cpu_count = (int) sysconf (_SC_NPROCESSORS_CONF);
+      alloc_size = pgbuf_Pool.numa.cpu_count * sizeof (int);
+      pgbuf_Pool.numa.cpu_to_node = (int *) malloc (alloc_size);
+      if (pgbuf_Pool.numa.cpu_to_node == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      memset (pgbuf_Pool.numa.cpu_to_node, 0, alloc_size);
+
+      for (i = 0; i < node_count; i++)
+	{
+	  /* cpu list format is like "0-15,32-47" */
+	  snprintf (path, sizeof (path), "/sys/devices/system/node/node%d/cpulist", i);
+	  fp = fopen (path, "r");
+	  if (fp == NULL)
+	    {
+	      continue;
+	    }
+	  while (fscanf (fp, "%d", &first_cpu) == 1)
+	    {
+	      last_cpu = first_cpu;
+	      sep = (char) fgetc (fp);
+	      if (sep == '-')
+		{
+		  if (fscanf (fp, "%d", &last_cpu) != 1)
+		    {
+		      break;
+		    }
+		  sep = (char) fgetc (fp);
+		}
+	      for (cpu = first_cpu; cpu <= last_cpu && cpu < pgbuf_Pool.numa.cpu_count; cpu++)
+		{
+		  pgbuf_Pool.numa.cpu_to_node[cpu] = i;
+		}
+	      if (sep != ',')
+		{
+		  break;
+		}
+	    }
+	  fclose (fp);
+	}
+    }
+#endif /* LINUX */
+
+  alloc_size = node_count * sizeof (PGBUF_NUMA_NODE);
+  pgbuf_Pool.numa.nodes = (PGBUF_NUMA_NODE *) malloc (alloc_size);
+  if (pgbuf_Pool.numa.nodes == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  for (i = 0; i < node_count; i++)
+    {
+      pgbuf_Pool.numa.nodes[i].shared_lrus_with_victims = NULL;
+      pgbuf_Pool.numa.nodes[i].add_shared_lru_idx = 0;
+    }
+  pgbuf_Pool.numa.node_count = node_count;
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_numa_get_current_node () - get NUMA node of the cpu current thread runs on
+ *
+ * return : node index
+ *
+ * note: threads are not bound to cpus, the node may change right after the call.
+ */
+STATIC_INLINE int
+pgbuf_numa_get_current_node (void)
+{
+#if defined (LINUX)
+  int cpu;
+
+  if (pgbuf_Pool.numa.cpu_to_node == NULL)
+    {
+      return 0;
+    }
+
+  cpu = sched_getcpu ();
+  if (cpu < 0 || cpu >= pgbuf_Pool.numa.cpu_count)
+    {
+      return 0;
+    }
+  return pgbuf_Pool.numa.cpu_to_node[cpu];
+#else /* !LINUX */
+  return 0;
+#endif /* !LINUX */
+}
+
+/*
+ * pgbuf_lfcq_shared_consumer_cursor () - get the sum of consumer cursors of the queues with shared lists having
+ *                                        victims, of all NUMA nodes.
+ *
+ * return : consumer cursors sum
+ */
+static UINT64
+pgbuf_lfcq_shared_consumer_cursor (void)
+{
+  UINT64 cursor = 0;
+  int node;
+
+  for (node = 0; node < PGBUF_NUMA_NODE_COUNT; node++)
+    {
+      cursor += pgbuf_Pool.numa.nodes[node].shared_lrus_with_victims->get_consumer_cursor ();
+    }
+  return cursor;
+}
+
+/*
+ * pgbuf_lfcq_shared_is_empty () - are the queues with shared lists having victims empty on all NUMA nodes?
+ *
+ * return : true if all queues are empty
+ */
+static bool
+pgbuf_lfcq_shared_is_empty (void)
+{
+  int node;
+
+  for (node = 0; node < PGBUF_NUMA_NODE_COUNT; node++)
+    {
+      if (!pgbuf_Pool.numa.nodes[node].shared_lrus_with_victims->is_empty ())
+	{
+	  return false;
+	}
+    }
+  return true;
+}
+
 /*
  * pgbuf_allocate_thrd_holder_entry () - Allocates one buffer holder entry
  *   			from the free holder list of given thread
@@ -5998,6 +6337,11 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 		  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_LRU_THREE_PRV_TO_SHR_MID);
 		  break;
 		}
+	      if (PGBUF_THREAD_IN_SCAN_RING (thread_p) && pgbuf_is_scan_ring_page (bufptr))
+		{
+		  /* sequential scans do not boost pages (they usually fix the same page for each record) */
+		  break;
+		}
 	      /* boost */
 	      pgbuf_lru_boost_bcb (thread_p, bufptr);
 	      pgbuf_bcb_register_hit_for_lru (bufptr);
@@ -6103,6 +6447,17 @@ pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int threa
       if (aout_list_id == PGBUF_AOUT_NOT_FOUND)
 	{
 	  perfmon_inc_stat (thread_p, PSTAT_PB_UNFIX_VOID_AOUT_NOT_FOUND);
+
+	  if (PGBUF_THREAD_IN_SCAN_RING (thread_p) && pgbuf_is_scan_ring_page (bcb))
+	    {
+	      /* page loaded by a big sequential scan. keep it in victim zone and recycle it through the scan ring. pages
+	       * found in aout were recently hot and are added normally. */
+	      pgbuf_scan_ring_add_bcb (thread_p, bcb);
+	      pgbuf_lru_add_new_bcb_to_bottom (thread_p, bcb,
+					       thread_private_lru_index != -1 ? thread_private_lru_index :
+					       pgbuf_get_shared_lru_index_for_add ());
+	      return;
+	    }
 	}
       else
 	{
@@ -7212,7 +7567,8 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
    * 1. first source should be invalid list. initially, all bcb's will be in this list. sometimes, bcb's can be added to
    *    this list during runtime. in any case, these bcb's are not used by anyone, do not need any flush or other
    *    actions and are the best option for allocating a bcb.
-   * 2. search the bcb in lru lists by calling pgbuf_get_victim.
+   * 2. search the bcb in lru lists by calling pgbuf_get_victim. threads in sequential access mode first try to reuse
+   *    the oldest bcb of their scan ring (see PGBUF_SCAN_RING).
    * 3. if search failed then:
    *    SERVER_MODE: thread is added to one of two queues: high priority waiting threads queue or low priority waiting
    *                 threads queue. high priority is usually populated by vacuum threads or by threads holding latch
@@ -7243,6 +7599,13 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
       PERF_UTIME_TRACKER_START (thread_p, &time_tracker_alloc_search_and_wait);
     }
 
+  /* threads doing sequential access recycle their own scan ring */
+  bufptr = pgbuf_get_victim_from_scan_ring (thread_p);
+  if (bufptr != NULL)
+    {
+      goto end;
+    }
+
   /* search lru lists */
   bufptr = pgbuf_get_victim (thread_p);
   PERF_UTIME_TRACKER_TIME_AND_RESTART (thread_p, &time_tracker_alloc_search_and_wait, PSTAT_PB_ALLOC_BCB_SEARCH_VICTIM);
@@ -7925,7 +8288,8 @@ pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 
 /*
  * pgbuf_get_shared_lru_index_for_add () - get a shared index to add a new bcb. we'll use a round-robin way to choose
- *                                         next list, but we'll avoid biggest list (just to keep things balanced).
+ *                                         next list of current NUMA node, but we'll avoid biggest list (just to keep
+ *                                         things balanced).
  *
  * return : shared lru index
  */
@@ -7937,8 +8301,9 @@ pgbuf_get_shared_lru_index_for_add (void)
 
   int i;
   unsigned int lru_idx, refresh_stat_cnt;
+  int node = pgbuf_numa_get_current_node ();
 
-  lru_idx = ATOMIC_INC_32 (&pgbuf_Pool.quota.add_shared_lru_idx, 1);
+  lru_idx = ATOMIC_INC_32 (&pgbuf_Pool.numa.nodes[node].add_shared_lru_idx, 1);
   refresh_stat_cnt = lru_idx % PAGE_ADD_REFRESH_STAT;
 
   /* check if there is an in-balance BCBs distribution across shared LRUs */
@@ -7989,19 +8354,189 @@ pgbuf_get_shared_lru_index_for_add (void)
 	}
     }
 
-  lru_idx = lru_idx % PGBUF_SHARED_LRU_COUNT;
+  lru_idx = PGBUF_NUMA_NODE_SHARED_LRU (node, lru_idx);
 
   /* avoid to add in shared LRU idx having too many BCBs */
   if (pgbuf_Pool.quota.avoid_shared_lru_idx == (int) lru_idx)
     {
-      lru_idx = ATOMIC_INC_32 (&pgbuf_Pool.quota.add_shared_lru_idx, 1);
-      lru_idx = lru_idx % PGBUF_SHARED_LRU_COUNT;
+      lru_idx = ATOMIC_INC_32 (&pgbuf_Pool.numa.nodes[node].add_shared_lru_idx, 1);
+      lru_idx = PGBUF_NUMA_NODE_SHARED_LRU (node, lru_idx);
     }
 
   return lru_idx;
 #undef PAGE_ADD_REFRESH_STAT
 }
 
+/*
+ * pgbuf_is_sequential_access_enabled () - can sequential accesses use scan rings?
+ *
+ * return : true if scan rings are enabled
+ */
+bool
+pgbuf_is_sequential_access_enabled (void)
+{
+  return pgbuf_Pool.scan_rings != NULL;
+}
+
+/*
+ * pgbuf_start_sequential_access () - start sequential access of a file. if the file is big compared to page buffer,
+ *                                    the pages loaded by thread are recycled through its scan ring until
+ *                                    pgbuf_end_sequential_access is called.
+ *
+ * return        : true if thread uses its scan ring (pgbuf_end_sequential_access must be called), false otherwise
+ * thread_p (in) : thread entry
+ * npages (in)   : number of pages the thread is going to read
+ */
+bool
+pgbuf_start_sequential_access (THREAD_ENTRY * thread_p, int npages)
+{
+  PGBUF_SCAN_RING *ring;
+
+  if (pgbuf_Pool.scan_rings == NULL || npages < (int) (pgbuf_Pool.num_buffers * PGBUF_SCAN_RING_MIN_FILE_RATIO))
+    {
+      /* small files are not a threat for hot pages */
+      return false;
+    }
+
+  if (PGBUF_THREAD_SHOULD_IGNORE_UNFIX (thread_p))
+    {
+      /* vacuum workers have their own policy */
+      return false;
+    }
+
+  ring = &pgbuf_Pool.scan_rings[thread_get_entry_index (thread_p)];
+  if (ring->nesting++ == 0)
+    {
+      ring->count = 0;
+      ring->next = 0;
+    }
+  return true;
+}
+
+/*
+ * pgbuf_end_sequential_access () - end sequential access started by pgbuf_start_sequential_access.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ */
+void
+pgbuf_end_sequential_access (THREAD_ENTRY * thread_p)
+{
+  PGBUF_SCAN_RING *ring;
+
+  assert (pgbuf_Pool.scan_rings != NULL);
+
+  ring = &pgbuf_Pool.scan_rings[thread_get_entry_index (thread_p)];
+  assert (ring->nesting > 0);
+  if (--ring->nesting == 0)
+    {
+      /* ring bcb's are left in victim zone of lru lists */
+      ring->count = 0;
+      ring->next = 0;
+    }
+}
+
+/*
+ * pgbuf_is_scan_ring_page () - can page be recycled through scan ring?
+ *
+ * return   : true for data pages read in bulk by scans and sorts, false for index and file structure pages
+ * bcb (in) : bcb
+ *
+ * note: a thread scanning a big table may also load index pages or file headers (e.g. for a nested index join).
+ *       these are shared by many readers and must be kept.
+ */
+STATIC_INLINE bool
+pgbuf_is_scan_ring_page (PGBUF_BCB * bcb)
+{
+  switch ((PAGE_TYPE) bcb->iopage_buffer->iopage.prv.ptype)
+    {
+    case PAGE_HEAP:
+    case PAGE_OVERFLOW:
+    case PAGE_QRESULT:
+    case PAGE_AREA:
+    case PAGE_UNKNOWN:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * pgbuf_scan_ring_add_bcb () - remember a bcb loaded by thread in sequential access mode in its scan ring.
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * bcb (in)      : bcb loaded by thread
+ *
+ * note: when ring is full, the oldest entry is replaced.
+ */
+static void
+pgbuf_scan_ring_add_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb)
+{
+  PGBUF_SCAN_RING *ring = &pgbuf_Pool.scan_rings[thread_get_entry_index (thread_p)];
+
+  assert (ring->nesting > 0);
+
+  ring->entries[ring->next].bcb = bcb;
+  VPID_COPY (&ring->entries[ring->next].vpid, &bcb->vpid);
+  if (++ring->next == pgbuf_Pool.scan_ring_size)
+    {
+      ring->next = 0;
+    }
+  if (ring->count < pgbuf_Pool.scan_ring_size)
+    {
+      ring->count++;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_SCAN_RING_ADD);
+}
+
+/*
+ * pgbuf_get_victim_from_scan_ring () - reuse the oldest bcb from thread's scan ring.
+ *
+ * return        : locked bcb removed from its lru list or NULL if ring is not full or oldest bcb cannot be reused
+ * thread_p (in) : thread entry
+ *
+ * note: the bcb is reused only if it still holds the page loaded by thread, if it is still in the victim zone (was not
+ *       boosted by other transactions) and if it can be victimized without flush.
+ */
+static PGBUF_BCB *
+pgbuf_get_victim_from_scan_ring (THREAD_ENTRY * thread_p)
+{
+  PGBUF_SCAN_RING *ring;
+  PGBUF_SCAN_RING_ENTRY *entry;
+  PGBUF_BCB *bcb;
+
+  if (!PGBUF_THREAD_IN_SCAN_RING (thread_p))
+    {
+      return NULL;
+    }
+
+  ring = &pgbuf_Pool.scan_rings[thread_get_entry_index (thread_p)];
+  if (ring->count < pgbuf_Pool.scan_ring_size)
+    {
+      /* ring is still filling */
+      return NULL;
+    }
+
+  /* the oldest entry will be replaced by the page we allocate for, whatever happens here */
+  entry = &ring->entries[ring->next];
+  bcb = entry->bcb;
+
+  PGBUF_BCB_LOCK (bcb);
+  if (VPID_EQ (&bcb->vpid, &entry->vpid) && PGBUF_IS_BCB_IN_LRU_VICTIM_ZONE (bcb)
+      && !pgbuf_is_bcb_fixed_by_any (bcb, true) && pgbuf_is_bcb_victimizable (bcb, true))
+    {
+      pgbuf_lru_remove_bcb (thread_p, bcb);
+      perfmon_inc_stat (thread_p, PSTAT_PB_SCAN_RING_REUSE);
+      return bcb;
+    }
+  PGBUF_BCB_UNLOCK (bcb);
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_SCAN_RING_REUSE_FAIL);
+  return NULL;
+}
+
 /*
  * pgbuf_get_victim () - get a victim bcb from page buffer.
  *
@@ -8137,7 +8672,7 @@ pgbuf_get_victim (THREAD_ENTRY * thread_p)
       PERF_UTIME_TRACKER_START (thread_p, &perf_tracker);
     }
 
-  initial_consume_cursor = pgbuf_Pool.shared_lrus_with_victims->get_consumer_cursor ();
+  initial_consume_cursor = pgbuf_lfcq_shared_consumer_cursor ();
   do
     {
       /* 3. search a shared list. */
@@ -8150,9 +8685,9 @@ pgbuf_get_victim (THREAD_ENTRY * thread_p)
 	    }
 	  return victim;
 	}
-      current_consume_cursor = pgbuf_Pool.shared_lrus_with_victims->get_consumer_cursor ();
+      current_consume_cursor = pgbuf_lfcq_shared_consumer_cursor ();
     }
-  while (!has_flush_thread && !pgbuf_Pool.shared_lrus_with_victims->is_empty ()
+  while (!has_flush_thread && !pgbuf_lfcq_shared_is_empty ()
 	 && ((int) (current_consume_cursor - initial_consume_cursor) <= pgbuf_Pool.num_LRU_list)
 	 && (++nloops <= pgbuf_Pool.num_LRU_list));
   /* todo: maybe we can find a less complicated condition of looping. Probably no need to use nloops <= pgbuf_Pool.num_LRU_list. */
@@ -12581,7 +13116,6 @@ pgbuf_initialize_page_quota (void)
       quota->private_pages_ratio = 0;
     }
 
-  quota->add_shared_lru_idx = 0;
   quota->avoid_shared_lru_idx = -1;
 
 exit:
@@ -13382,7 +13916,11 @@ pgbuf_peek_stats (UINT64 * fixed_cnt, UINT64 * dirty_cnt, UINT64 * lru1_cnt, UIN
       *lfcq_prv_num = pgbuf_Pool.private_lrus_with_victims->size ();
     }
 
-  *lfcq_shr_num = pgbuf_Pool.shared_lrus_with_victims->size ();
+  *lfcq_shr_num = 0;
+  for (int node = 0; node < PGBUF_NUMA_NODE_COUNT; node++)
+    {
+      *lfcq_shr_num += pgbuf_Pool.numa.nodes[node].shared_lrus_with_victims->size ();
+    }
 }
 
 /*
@@ -14865,7 +15403,7 @@ pgbuf_lfcq_add_lru_with_victims (PGBUF_LRU_LIST * lru_list)
       else
 	{
 	  /* shared list */
-	  if (pgbuf_Pool.shared_lrus_with_victims->produce (lru_list->index))
+	  if (PGBUF_SHARED_LRU_VICTIMS_QUEUE (lru_list->index)->produce (lru_list->index))
 	    {
 	      return true;
 	    }
@@ -14986,15 +15524,29 @@ pgbuf_lfcq_get_victim_from_shared_lru (THREAD_ENTRY * thread_p, bool multi_threa
   PGBUF_LRU_LIST *lru_list;
   PGBUF_BCB *victim = NULL;
   bool detailed_perf = perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_PB_VICTIMIZATION);
+  int node, i;
 
   PERF (PSTAT_PB_LFCQ_LRU_SHR_GET_CALLS);
 
-  if (!pgbuf_Pool.shared_lrus_with_victims->consume (lru_idx))
+  /* search the lists of current node first */
+  node = pgbuf_numa_get_current_node ();
+  for (i = 0; i < PGBUF_NUMA_NODE_COUNT; i++)
+    {
+      if (pgbuf_Pool.numa.nodes[(node + i) % PGBUF_NUMA_NODE_COUNT].shared_lrus_with_victims->consume (lru_idx))
+	{
+	  break;
+	}
+    }
+  if (i == PGBUF_NUMA_NODE_COUNT)
     {
       /* no list has candidates! */
       PERF (PSTAT_PB_LFCQ_LRU_SHR_GET_EMPTY);
       return NULL;
     }
+  if (i > 0)
+    {
+      PERF (PSTAT_PB_LFCQ_LRU_SHR_GET_OTHER_NODE);
+    }
   /* popped a list with victim candidates from queue */
   assert (PGBUF_IS_SHARED_LRU_INDEX (lru_idx));
 
@@ -15012,7 +15564,7 @@ pgbuf_lfcq_get_victim_from_shared_lru (THREAD_ENTRY * thread_p, bool multi_threa
   if ((multi_threaded || victim != NULL) && lru_list->count_vict_cand > 0)
     {
       /* add lru list back to queue */
-      if (pgbuf_Pool.shared_lrus_with_victims->produce (lru_idx))
+      if (PGBUF_SHARED_LRU_VICTIMS_QUEUE (lru_idx)->produce (lru_idx))
 	{
 	  return victim;
 	}
@@ -15690,6 +16242,216 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_read_ahead_task - read pages of a chain ahead of a scan, so the scan finds them in page buffer.
+ *
+ * note: the next page is known only after the current one is read, so a task reads its pages one by one. the gain
+ *       comes from overlapping the reads with the processing done by the scan.
+ */
+class pgbuf_read_ahead_task : public cubthread::entry_task
+{
+  public:
+    pgbuf_read_ahead_task (const VPID &first_vpid, int npages, PGBUF_CHAIN_NEXT_FUNC next_func, const OID *owner,
+			   bool is_sequential)
+      : m_vpid (first_vpid)
+      , m_npages (npages)
+      , m_next_func (next_func)
+      , m_is_sequential (is_sequential)
+    {
+      if (owner != NULL)
+	{
+	  m_owner = *owner;
+	}
+      else
+	{
+	  OID_SET_NULL (&m_owner);
+	}
+    }
+
+    void execute (cubthread::entry &thread_ref) override
+    {
+      THREAD_ENTRY *thread_p = &thread_ref;
+      PAGE_PTR page;
+      bool is_chained;
+      bool seq_access_started = false;
+
+      thread_ref.tran_index = LOG_SYSTEM_TRAN_INDEX;
+
+      if (m_is_sequential)
+	{
+	  /* scan recycles its pages; so do we */
+	  seq_access_started = pgbuf_start_sequential_access (thread_p, pgbuf_Pool.num_buffers);
+	}
+
+      for (int i = 0; i < m_npages && !VPID_ISNULL (&m_vpid); i++)
+	{
+	  if (!pgbuf_is_page_in_buffer_hint (&m_vpid))
+	    {
+	      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_PAGE_LOADS);
+	    }
+
+	  page = pgbuf_fix (thread_p, &m_vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ,
+			    PGBUF_UNCONDITIONAL_LATCH);
+	  if (page == NULL)
+	    {
+	      /* page was deallocated or could not be read; scan will find out itself */
+	      er_clear ();
+	      break;
+	    }
+
+	  is_chained = m_next_func (thread_p, page, OID_ISNULL (&m_owner) ? NULL : &m_owner, &m_vpid);
+	  pgbuf_unfix_and_init (thread_p, page);
+	  if (!is_chained)
+	    {
+	      break;
+	    }
+	}
+
+      if (seq_access_started)
+	{
+	  pgbuf_end_sequential_access (thread_p);
+	}
+
+      thread_ref.tran_index = NULL_TRAN_INDEX;
+    }
+
+  private:
+    VPID m_vpid;
+    int m_npages;
+    PGBUF_CHAIN_NEXT_FUNC m_next_func;
+    OID m_owner;
+    bool m_is_sequential;
+};
+#endif /* SERVER_MODE */
+
+/*
+ * pgbuf_read_ahead_init () - initialize read-ahead of a scan following a chain of pages
+ *
+ * return          : void
+ * read_ahead (in) : read-ahead state of scan
+ */
+void
+pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead)
+{
+#if defined (SERVER_MODE)
+  read_ahead->window = pgbuf_Read_ahead_workers != NULL ? prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES) : 0;
+#else /* !SERVER_MODE */
+  /* no workers to read ahead */
+  read_ahead->window = 0;
+#endif /* !SERVER_MODE */
+  read_ahead->countdown = 0;
+}
+
+/*
+ * pgbuf_read_ahead_next () - notify read-ahead that scan advances to next page of chain
+ *
+ * return          : void
+ * thread_p (in)   : thread entry
+ * read_ahead (in) : read-ahead state of scan
+ * next_vpid (in)  : page the scan is going to fix next
+ * next_func (in)  : function to get next page of chain
+ * owner (in)      : passed to next_func to check pages belong to the chain (can be NULL)
+ *
+ * note: read-ahead starts when the scan is about to miss a page. from then, every half window, a worker is asked to
+ *       read the next window pages. the pages already read are found in buffer, the others are loaded.
+ */
+void
+pgbuf_read_ahead_next (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * next_vpid,
+		       PGBUF_CHAIN_NEXT_FUNC next_func, const OID * owner)
+{
+#if defined (SERVER_MODE)
+  pgbuf_read_ahead_task *task;
+
+  if (read_ahead->window <= 1 || VPID_ISNULL (next_vpid))
+    {
+      return;
+    }
+
+  if (read_ahead->countdown > 0)
+    {
+      /* keep ahead of scan */
+      if (--read_ahead->countdown > 0)
+	{
+	  return;
+	}
+    }
+  else if (pgbuf_is_page_in_buffer_hint (next_vpid))
+    {
+      /* no miss yet */
+      return;
+    }
+
+  read_ahead->countdown = read_ahead->window / 2;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  task = new pgbuf_read_ahead_task (*next_vpid, read_ahead->window, next_func, owner,
+				    PGBUF_THREAD_IN_SCAN_RING (thread_p));
+  if (cubthread::get_manager ()->try_task (*thread_p, pgbuf_Read_ahead_workers, task))
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_REQUESTS);
+    }
+  else
+    {
+      /* all workers are busy; scan will read its pages */
+      delete task;
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_DROPPED);
+    }
+#endif /* SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_is_page_in_buffer_hint () - check if page is in buffer, without locking anything
+ *
+ * return    : true if page was found in buffer
+ * vpid (in) : page identifier
+ *
+ * note: the answer may be outdated by the time it is used. use only for decisions that are not critical.
+ */
+static bool
+pgbuf_is_page_in_buffer_hint (const VPID * vpid)
+{
+  PGBUF_BCB *bufptr;
+
+  for (bufptr = pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)].hash_next; bufptr != NULL;
+       bufptr = bufptr->hash_next)
+    {
+      if (VPID_EQ (&bufptr->vpid, vpid))
+	{
+	  return true;
+	}
+    }
+  return false;
+}
+
+/*
+ * pgbuf_read_ahead_workers_init () - initialize workers reading pages ahead of scans
+ */
+static void
+pgbuf_read_ahead_workers_init ()
+{
+  int worker_count = prm_get_integer_value (PRM_ID_PB_READ_AHEAD_WORKERS);
+
+  assert (pgbuf_Read_ahead_workers == NULL);
+
+  if (worker_count <= 0)
+    {
+      /* read-ahead is disabled */
+      return;
+    }
+
+  /* a request is dropped if all workers are busy and the queue is full */
+  pgbuf_Read_ahead_workers = cubthread::get_manager ()->create_worker_pool (worker_count, worker_count * 4,
+									      "pgbuf_read_ahead_workers", NULL, 1,
+									      false);
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -15701,6 +16463,7 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_read_ahead_workers_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -15715,6 +16478,10 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  if (pgbuf_Read_ahead_workers != NULL)
+    {
+      cubthread::get_manager ()->destroy_worker_pool (pgbuf_Read_ahead_workers);
+    }
 }
 #endif /* SERVER_MODE */
 
@@ -216,6 +216,17 @@ typedef enum
 
 typedef VPID PGBUF_ORDERED_GROUP;
 
+/* read-ahead along a chain of pages (heap pages, b-tree leaves). the function gets the next page of the chain from a
+ * fixed page; it returns false if page does not belong to the chain (e.g. it was deallocated and reused). */
+typedef bool (*PGBUF_CHAIN_NEXT_FUNC) (THREAD_ENTRY * thread_p, PAGE_PTR page, const OID * owner, VPID * next_vpid);
+
+typedef struct pgbuf_read_ahead PGBUF_READ_AHEAD;
+struct pgbuf_read_ahead
+{
+  int window;			/* number of pages read ahead of the scan; 0 if read-ahead is disabled */
+  int countdown;		/* pages left until next read-ahead; 0 until the scan misses a page */
+};
+
 typedef struct pgbuf_watcher PGBUF_WATCHER;
 struct pgbuf_watcher
 {
@@ -377,6 +388,12 @@ extern void pgbuf_dump_if_any_fixed (void);
 #endif
 
 extern bool pgbuf_has_perm_pages_fixed (THREAD_ENTRY * thread_p);
+extern bool pgbuf_is_sequential_access_enabled (void);
+extern bool pgbuf_start_sequential_access (THREAD_ENTRY * thread_p, int npages);
+extern void pgbuf_end_sequential_access (THREAD_ENTRY * thread_p);
+extern void pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead);
+extern void pgbuf_read_ahead_next (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * next_vpid,
+				   PGBUF_CHAIN_NEXT_FUNC next_func, const OID * owner);
 extern void pgbuf_ordered_set_dirty_and_free (THREAD_ENTRY * thread_p, PGBUF_WATCHER * pg_watcher);
 extern int pgbuf_get_condition_for_ordered_fix (const VPID * vpid_new_page, const VPID * vpid_fixed_page,
 						const HFID * hfid);
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * parallel_query_worker_pool.cpp
+ */
+
+#include "parallel_query_worker_pool.hpp"
+
+#include "system_parameter.h"
+#include "thread_worker_pool.hpp"
+
+namespace cubthread
+{
+  namespace parallel_query_worker_pool
+  {
+    constexpr std::size_t TASK_COUNT_PER_WORKER = 16;
+    constexpr std::size_t CORE_COUNT = 1;
+
+    entry_workpool *instance = NULL;
+
+    void initialize ()
+    {
+      std::size_t worker_count = (std::size_t) prm_get_integer_value (PRM_ID_PARALLEL_QUERY_WORKERS);
+
+      assert (instance == NULL);
+
+      if (worker_count == 0)
+	{
+	  // parallel query execution is disabled
+	  return;
+	}
+
+      instance = get_manager ()->create_worker_pool (worker_count, worker_count * TASK_COUNT_PER_WORKER,
+		 "parallel query workers", NULL, CORE_COUNT, false);
+    }
+
+    void finalize ()
+    {
+      if (instance != NULL)
+	{
+	  get_manager ()->destroy_worker_pool (instance);
+	}
+    }
+
+    entry_workpool *get_instance ()
+    {
+      return instance;
+    }
+
+    std::size_t get_worker_count ()
+    {
+      return instance != NULL ? instance->get_max_count () : 0;
+    }
+  }
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * parallel_query_worker_pool.hpp - workers shared by parallel sorts, heap scans and index loads of all transactions
+ */
+
+#ifndef _PARALLEL_QUERY_WORKER_POOL_HPP_
+#define _PARALLEL_QUERY_WORKER_POOL_HPP_
+
+#include "thread_manager.hpp"
+
+// the pool is created at server boot with parallel_query_workers threads, which are counted in the thread entries
+// of thread manager. it caps the total parallelism of all running queries; the degree of a single operation is further
+// limited by its own parameter.
+//
+// tasks of different operations are queued in the same pool. an operation must never wait for one of its tasks that
+// has not started; if it needs the result, it executes the task itself.
+
+namespace cubthread
+{
+  namespace parallel_query_worker_pool
+  {
+    void initialize ();
+    void finalize ();
+
+    // get_instance - NULL if parallel query execution is disabled
+    entry_workpool *get_instance ();
+    // get_worker_count - maximum number of workers of an operation; zero if parallel query execution is disabled
+    std::size_t get_worker_count ();
+  }
+}
+
+#endif // _PARALLEL_QUERY_WORKER_POOL_HPP_
@@ -76,6 +76,7 @@
 #include "scan_manager.h"
 #include "slotted_page.h"
 #include "thread_manager.hpp"
+#include "parallel_query_worker_pool.hpp"
 #include "double_write_buffer.h"
 #include "xasl_cache.h"
 #include "log_volids.hpp"
@@ -2473,6 +2474,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 #if defined(SERVER_MODE)
   pgbuf_daemons_init ();
   dwb_daemons_init ();
+  cubthread::parallel_query_worker_pool::initialize ();
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2508,6 +2510,9 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       goto error;
     }
 
+  /* warm up XASL cache with the entries saved at last shutdown */
+  xcache_load (thread_p);
+
   if (qmgr_initialize (thread_p) != NO_ERROR)
     {
       error_code = ER_FAILED;
@@ -2780,6 +2785,7 @@ error:
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  cubthread::parallel_query_worker_pool::finalize ();
   pgbuf_daemons_destroy ();
   dwb_daemons_destroy ();
 #endif
@@ -2920,6 +2926,7 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   /* before removing temp vols */
   (void) logtb_reflect_global_unique_stats_to_btree (thread_p);
   qfile_finalize_list_cache (thread_p);
+  xcache_save (thread_p);
   xcache_finalize (thread_p);
   fpcache_finalize (thread_p);
   session_states_finalize (thread_p);
@@ -2935,6 +2942,7 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  cubthread::parallel_query_worker_pool::finalize ();
   pgbuf_daemons_destroy ();
 #endif
 
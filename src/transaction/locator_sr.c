@@ -199,6 +199,7 @@ static DISK_ISVALID locator_check_unique_btree_entries (THREAD_ENTRY * thread_p,
 static int locator_eval_filter_predicate (THREAD_ENTRY * thread_p, BTID * btid, OR_PREDICATE * or_pred, OID * class_oid,
 					  OID ** inst_oids, int num_insts, RECDES ** recs, DB_LOGICAL * results);
 static bool locator_was_index_already_applied (HEAP_CACHE_ATTRINFO * index_attrinfo, BTID * btid, int pos);
+static void locator_end_insert_batch (HEAP_SCANCACHE * scan_cache);
 static LC_FIND_CLASSNAME xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID * class_oid);
 
 static int locator_filter_errid (THREAD_ENTRY * thread_p, int num_ignore_error_count, int *ignore_error_list);
@@ -5151,15 +5152,9 @@ locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
       locator_increase_catalog_count (thread_p, &real_class_oid);
 #endif
 
-      /* remove query result cache entries which are relevant with this class */
+      /* query result cache entries which are relevant with this class are removed when the transaction commits */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, &real_class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_insert_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    real_class_oid.pageid, real_class_oid.slotid, real_class_oid.volid);
-	    }
 	  qmgr_add_modified_class (thread_p, &real_class_oid);
 	}
 #if 0				/* TODO - dead code; do not delete me */
@@ -5935,15 +5930,9 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 	}
 #endif
 
-      /* remove query result cache entries which are relevant with this class */
+      /* query result cache entries which are relevant with this class are removed when the transaction commits */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_update_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid->pageid, class_oid->slotid, class_oid->volid);
-	    }
 	  qmgr_add_modified_class (thread_p, class_oid);
 	}
     }
@@ -6235,15 +6224,9 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
 	    }
 	}
 
-      /* remove query result cache entries which are relevant with this class */
+      /* query result cache entries which are relevant with this class are removed when the transaction commits */
       if (!QFILE_IS_LIST_CACHE_DISABLED)
 	{
-	  if (qexec_clear_list_cache_by_class (thread_p, &class_oid) != NO_ERROR)
-	    {
-	      er_log_debug (ARG_FILE_LINE,
-			    "locator_delete_force: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
-			    class_oid.pageid, class_oid.slotid, class_oid.volid);
-	    }
 	  qmgr_add_modified_class (thread_p, &class_oid);
 	}
     }
@@ -7784,6 +7767,14 @@ locator_add_or_remove_index_internal (THREAD_ENTRY * thread_p, RECDES * recdes,
 		    btree_online_index_dispatcher (thread_p, &btid, key_dbvalue, class_oid, inst_oid, unique_pk,
 						   BTREE_OP_ONLINE_INDEX_TRAN_INSERT, NULL);
 		}
+	      else if (scan_cache != NULL && scan_cache->m_insert_batch != NULL && op_type == MULTI_ROW_INSERT
+		       && (index->type == BTREE_INDEX || index->type == BTREE_REVERSE_INDEX))
+		{
+		  /* Plain non-unique index: the key is inserted with all keys of the statement, in key order. */
+		  error_code =
+		    scan_cache->m_insert_batch->add_key (thread_p, &btid, class_oid, key_dbvalue, inst_oid, op_type,
+							 p_mvcc_rec_header);
+		}
 	      else
 		{
 		  error_code =
@@ -13700,6 +13691,20 @@ xlocator_demote_class_lock (THREAD_ENTRY * thread_p, const OID * class_oid, LOCK
   return lock_demote_class_lock (thread_p, class_oid, lock, ex_lock);
 }
 
+/*
+ * locator_end_insert_batch () - detach the index insert batch of a multi-row insert from its scan cache. On error,
+ *				 its remaining keys are discarded; the caller aborts the insert of their records.
+ *
+ * return	   : void
+ * scan_cache (in) : scan cache of the insert
+ */
+static void
+locator_end_insert_batch (HEAP_SCANCACHE * scan_cache)
+{
+  delete scan_cache->m_insert_batch;
+  scan_cache->m_insert_batch = NULL;
+}
+
 // *INDENT-OFF*
 int
 locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
@@ -13726,9 +13731,77 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 
   *force_count = 0;
 
+  if (has_index && pcontext == NULL && scan_cache->m_insert_batch == NULL && btree_insert_batch::is_enabled ())
+    {
+      // keys of plain indexes are inserted sorted, once all records are in heap
+      scan_cache->m_insert_batch = new btree_insert_batch ();
+    }
+
   // Take into account the unfill factor of the heap file.
   heap_max_page_size = heap_nonheader_page_capacity () * (1.0f - prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
 
+  // Format a new heap page with the collected records and log it as a whole, instead of logging each record.
+  auto insert_on_new_page = [&] () -> int
+  {
+    VPID new_page_vpid;
+    PGBUF_WATCHER home_hint_p;
+    int error;
+
+    VPID_SET_NULL (&new_page_vpid);
+    scan_cache->cache_last_fix_page = true;
+
+    // First alloc a new empty heap page.
+    error = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
+    if (error != NO_ERROR)
+      {
+	ASSERT_ERROR ();
+	return error;
+      }
+
+    for (size_t j = 0; j < recdes_array.size (); j++)
+      {
+	error = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index, op_type,
+				      scan_cache, force_count, pruning_type, pcontext, func_preds, force_in_place,
+				      &home_hint_p, has_BU_lock, dont_check_fk, true);
+	if (error != NO_ERROR)
+	  {
+	    ASSERT_ERROR ();
+
+	    if (home_hint_p.pgptr)
+	      {
+		pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+	      }
+
+	    if (scan_cache->page_watcher.pgptr)
+	      {
+		pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr, &scan_cache->page_watcher);
+	      }
+
+	    assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+	    return error;
+	  }
+
+	pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
+      }
+
+    // Now log the whole page.
+    pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
+
+    // Add the new VPID to the VPID array.
+    assert (!VPID_ISNULL (&new_page_vpid));
+    heap_pages_array.push_back (new_page_vpid);
+
+    // Clear the recdes array.
+    recdes_array.clear ();
+    accumulated_records_size = 0;
+
+    // Unfix the page.
+    pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+
+    assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
+    return NO_ERROR;
+  };
+
   for (size_t i = 0; i < recdes.size (); i++)
     {
       local_record = recdes[i].get_recdes ();
@@ -13744,6 +13817,7 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
+	      locator_end_insert_batch (scan_cache);
 	      return error_code;
 	    }
 	}
@@ -13753,64 +13827,13 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	  if ((DB_ALIGN (local_record.length, HEAP_MAX_ALIGN) + record_overhead + accumulated_records_size)
 	      >= heap_max_page_size)
 	    {
-	      VPID new_page_vpid;
-	      PGBUF_WATCHER home_hint_p;
-
-	      VPID_SET_NULL (&new_page_vpid);
-	      scan_cache->cache_last_fix_page = true;
-
-	      // First alloc a new empty heap page.
-	      error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
+	      error_code = insert_on_new_page ();
 	      if (error_code != NO_ERROR)
 		{
 		  ASSERT_ERROR ();
+		  locator_end_insert_batch (scan_cache);
 		  return error_code;
 		}
-
-	      for (size_t j = 0; j < recdes_array.size (); j++)
-		{
-		  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
-						     op_type, scan_cache, force_count, pruning_type, pcontext,
-						     func_preds, force_in_place, &home_hint_p, has_BU_lock,
-						     dont_check_fk, true);
-		  if (error_code != NO_ERROR)
-		    {
-		      ASSERT_ERROR ();
-
-		      if (home_hint_p.pgptr)
-			{
-			  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-			}
-
-		      if (scan_cache->page_watcher.pgptr)
-			{
-			  pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr,
-							&scan_cache->page_watcher);
-			}
-
-		      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
-
-		      return error_code;
-		    }
-
-		  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
-		}
-
-	      // Now log the whole page.
-	      pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
-
-	      // Add the new VPID to the VPID array.
-	      assert (!VPID_ISNULL (&new_page_vpid));
-	      heap_pages_array.push_back (new_page_vpid);
-
-	      // Clear the recdes array.
-	      recdes_array.clear ();
-	      accumulated_records_size = 0;
-
-	      // Unfix the page.
-	      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-
-	      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
 	    }
 
 	  // Add this record to the recdes array and increase the accumulated size.
@@ -13820,13 +13843,37 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	}
     }
 
-  // We must check if we have records which did not fill an entire page.
+  // The records left did not fill an entire page. If they fill at least half of one, they still get a new page of
+  // their own; the few records of a smaller tail are inserted one by one into existing pages.
+  if (accumulated_records_size >= heap_max_page_size / 2)
+    {
+      error_code = insert_on_new_page ();
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  locator_end_insert_batch (scan_cache);
+	  return error_code;
+	}
+    }
+
   for (size_t i = 0; i < recdes_array.size (); i++)
     {
       scan_cache->cache_last_fix_page = false;
       error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[i], has_index, op_type,
 					 scan_cache, force_count, pruning_type, pcontext, func_preds, force_in_place,
 					 NULL, has_BU_lock, dont_check_fk, false);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  locator_end_insert_batch (scan_cache);
+	  return error_code;
+	}
+    }
+
+  if (scan_cache->m_insert_batch != NULL)
+    {
+      error_code = scan_cache->m_insert_batch->flush (thread_p);
+      locator_end_insert_batch (scan_cache);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
@@ -69,7 +69,9 @@
 #include "xserver_interface.h"
 #include "xasl.h"
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 extern LOCK_COMPATIBILITY lock_Comp[12][12];
 
@@ -369,6 +371,12 @@ struct lk_global_data
   int max_TWFG_edge;
   int TWFG_free_edge_idx;
   int global_edge_seq_num;
+  // *INDENT-OFF*
+  std::atomic<UINT64> TWFG_wait_seq_num;	/* incremented each time a thread is suspended on a lock */
+  std::vector<LK_RES_KEY> TWFG_wait_res_keys;	/* keys of the resources lock waiters are blocked on */
+  // *INDENT-ON*
+  UINT64 TWFG_checked_wait_seq_num;	/* wait sequence of the last detection that found no cycle */
+  int TWFG_skipped_runs;	/* detection runs skipped since the last full run */
 
   /* miscellaneous things */
   short no_victim_case_count;
@@ -394,6 +402,10 @@ struct lk_global_data
     , max_TWFG_edge (0)
     , TWFG_free_edge_idx (0)
     , global_edge_seq_num (0)
+    , TWFG_wait_seq_num { 0 }
+    , TWFG_wait_res_keys ()
+    , TWFG_checked_wait_seq_num (0)
+    , TWFG_skipped_runs (0)
     , no_victim_case_count (0)
     , verbose_mode (false)
     , deadlock_and_timeout_detector { 0 }
@@ -439,6 +451,8 @@ static const int LK_SLEEP_MAX_COUNT = 3;
 
 /* transaction WFG edge related constants */
 static const int LK_MIN_TWFG_EDGE_COUNT = 200;
+/* max # of detection runs skipped because no thread started waiting since the last run that found no cycle */
+static const int LK_MAX_SKIPPED_DEADLOCK_RUNS = 10;
 /* TODO : change const */
 #define LK_MID_TWFG_EDGE_COUNT 1000
 /* TODO : change const */
@@ -468,6 +482,7 @@ static int lk_Standalone_has_xlock = 0;
 const size_t DEFAULT_LOCK_WAITING_THREAD_ARRAY_SIZE = 10;
 // *INDENT-OFF*
 using tran_lock_waiters_array_type = std::array<THREAD_ENTRY *, DEFAULT_LOCK_WAITING_THREAD_ARRAY_SIZE>;
+using lk_wait_res_keys_type = std::vector<LK_RES_KEY>;
 // *INDENT-ON*
 
 #if defined(SERVER_MODE)
@@ -492,6 +507,7 @@ static LK_ENTRY *lock_find_tran_hold_entry (THREAD_ENTRY * thread_p, int tran_in
 static bool lock_force_timeout_expired_wait_transactions (void *thrd_entry);
 static bool lock_is_local_deadlock_detection_interval_up (void);
 static void lock_detect_local_deadlock (THREAD_ENTRY * thread_p);
+static void lock_add_WFG_edges_of_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr);
 static bool lock_is_class_lock_escalated (LOCK class_lock, LOCK lock_escalation);
 static LK_ENTRY *lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index, LOCK lock);
 static void lock_position_holder_entry (LK_RES * res_ptr, LK_ENTRY * entry_ptr);
@@ -554,6 +570,8 @@ static void lock_free_entry (int tran_index, LF_TRAN_ENTRY * tran_entry, LF_FREE
 static void lock_victimize_first_thread_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper);
 static void lock_check_timeout_expired_and_count_suspended_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper,
 								    size_t & suspend_count);
+static void lock_collect_wait_resource_keys_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper,
+						     lk_wait_res_keys_type & res_keys);
 static void lock_get_transaction_lock_waiting_threads_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper,
 							       int tran_index,
 							       tran_lock_waiters_array_type & tran_lock_waiters,
@@ -2168,6 +2186,7 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
 
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = entry_ptr->thrd_entry->lockwait_stime;
   lk_Gl.deadlock_and_timeout_detector++;
+  lk_Gl.TWFG_wait_seq_num++;
 
   tdes = LOG_FIND_CURRENT_TDES (thread_p);
 
@@ -2970,6 +2989,14 @@ lock_escalate_if_needed (THREAD_ENTRY * thread_p, LK_ENTRY * class_entry, int tr
 
   /* check lock escalation count */
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
+
+  /* Granule counters are changed only by lock requests of this transaction, and nearly all requests are below the
+   * escalation threshold. Check first without the hold mutex, so that instance locks do not pay for it. */
+  if (lock_check_escalate (thread_p, class_entry, tran_lock) == false)
+    {
+      return LK_NOTGRANTED;
+    }
+
   rv = pthread_mutex_lock (&tran_lock->hold_mutex);
 
   if (lock_check_escalate (thread_p, class_entry, tran_lock) == false)
@@ -3233,6 +3260,7 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
   bool is_instant_duration;
   LOCK_COMPATIBILITY compat1, compat2;
   bool is_res_mutex_locked = false;
+  bool is_known_non_holder = false;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
   UINT64 lock_wait_time;
@@ -3301,6 +3329,7 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
 
 start:
   assert (!is_res_mutex_locked);
+  is_known_non_holder = false;
 
   if (class_oid != NULL && !OID_IS_ROOTOID (class_oid))
     {
@@ -3335,6 +3364,11 @@ start:
 	  res_ptr = entry_ptr->res_head;
 	  goto lock_tran_lk_entry;
 	}
+
+      /* Every holder entry is also in the hold list of its transaction, and only the thread of this transaction adds
+       * its entries. The holder list of a class may be long, so it is not searched again. System transaction is shared
+       * by many threads and it is excluded. */
+      is_known_non_holder = (tran_index != LOG_SYSTEM_TRAN_INDEX);
     }
 
   /* find or add the lockable object in the lock table */
@@ -3405,15 +3439,28 @@ start:
   /* the lockable object existed in the hash chain So, check whether I am a holder of the object. */
 
   /* find the lock entry of current transaction */
-  entry_ptr = res_ptr->holder;
-  while (entry_ptr != NULL)
+  entry_ptr = NULL;
+  if (!is_known_non_holder)
     {
-      if (entry_ptr->tran_index == tran_index)
+      entry_ptr = res_ptr->holder;
+      while (entry_ptr != NULL)
 	{
-	  break;
+	  if (entry_ptr->tran_index == tran_index)
+	    {
+	      break;
+	    }
+	  entry_ptr = entry_ptr->next;
+	}
+    }
+#if !defined (NDEBUG)
+  else
+    {
+      for (i = res_ptr->holder; i != NULL; i = i->next)
+	{
+	  assert (i->tran_index != tran_index);
 	}
-      entry_ptr = entry_ptr->next;
     }
+#endif /* !NDEBUG */
 
   if (entry_ptr == NULL)
     {
@@ -4991,6 +5038,9 @@ lock_select_deadlock_victim (THREAD_ENTRY * thread_p, int s, int t)
       num_tran_in_cycle++;
     }
 
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_DEADLOCK_CYCLES);
+  perfmon_add_stat (thread_p, PSTAT_LK_NUM_DEADLOCK_CYCLE_TRANS, num_tran_in_cycle);
+
   cycle_info_string = (char *) malloc (unit_size * num_tran_in_cycle);
   tran_index_in_cycle = (int *) malloc (sizeof (int) * num_tran_in_cycle);
 
@@ -7631,6 +7681,36 @@ lock_is_local_deadlock_detection_interval_up (void)
 #endif /* SERVER_MODE */
 }
 
+//
+// lock_collect_wait_resource_keys_mapfunc - map function to collect the keys of the resources lock waiters are
+//                                           blocked on
+//
+// thread_ref (in)  : thread entry
+// stop_mapper (in) : ignored
+// res_keys (out)   : resource keys
+//
+static void
+lock_collect_wait_resource_keys_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper,
+					 lk_wait_res_keys_type & res_keys)
+{
+#if defined (SERVER_MODE)
+  (void) stop_mapper;		// suppress unused parameter warning
+
+  if (thread_ref.lockwait == NULL)
+    {
+      return;
+    }
+
+  /* lockwait is set and cleared while the thread entry is locked; while it is set, the entry stays in its resource */
+  thread_lock_entry (&thread_ref);
+  if (thread_ref.lockwait != NULL)
+    {
+      res_keys.push_back (((LK_ENTRY *) thread_ref.lockwait)->res_head->key);
+    }
+  thread_unlock_entry (&thread_ref);
+#endif // SERVER_MODE
+}
+
 //
 // lock_victimize_first_thread_mapfunc - map function on all entries until one lock waiter is victimized
 //
@@ -7655,6 +7735,125 @@ lock_victimize_first_thread_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapp
 #endif // SERVER_MODE
 }
 
+/*
+ * lock_add_WFG_edges_of_resource - add the wait-for edges of a lock resource to the WFG
+ *
+ * return: nothing
+ *
+ *   res_ptr(in): lock resource; the caller holds its mutex
+ */
+#if defined(SERVER_MODE)
+static void
+lock_add_WFG_edges_of_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
+{
+  LK_ENTRY *hi, *hj;
+  LOCK_COMPATIBILITY compat1, compat2;
+
+  if (res_ptr->holder == NULL)
+    {
+      if (res_ptr->waiter == NULL)
+	{
+	  return;
+	}
+      else
+	{
+#if defined(CUBRID_DEBUG)
+	  FILE *lk_fp;
+	  time_t cur_time;
+	  char time_val[CTIME_MAX];
+
+	  lk_fp = fopen ("lock_waiter_only_info.log", "a");
+	  if (lk_fp != NULL)
+	    {
+	      cur_time = time (NULL);
+	      (void) ctime_r (&cur_time, time_val);
+	      fprintf (lk_fp, "##########################################\n");
+	      fprintf (lk_fp, "# current time: %s\n", time_val);
+	      lock_dump_resource (lk_fp, res_ptr);
+	      fprintf (lk_fp, "##########################################\n");
+	      fclose (lk_fp);
+	    }
+#endif /* CUBRID_DEBUG */
+	  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_LOCK_WAITER_ONLY, 1, "lock_waiter_only_info.log");
+
+	  if (res_ptr->total_holders_mode != NULL_LOCK)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_TOTAL_HOLDERS_MODE, 1, res_ptr->total_holders_mode);
+	      res_ptr->total_holders_mode = NULL_LOCK;
+	    }
+	  (void) lock_grant_blocked_waiter (thread_p, res_ptr);
+	}
+    }
+
+  /* among holders */
+  for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
+    {
+      if (hi->blocked_mode == NULL_LOCK)
+	{
+	  break;
+	}
+      for (hj = hi->next; hj != NULL; hj = hj->next)
+	{
+	  assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+	  assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
+
+	  compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
+	  compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
+	  assert (compat1 != LOCK_COMPAT_UNKNOWN && compat2 != LOCK_COMPAT_UNKNOWN);
+
+	  if (compat1 == LOCK_COMPAT_NO || compat2 == LOCK_COMPAT_NO)
+	    {
+	      (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
+	    }
+
+	  compat1 = lock_Comp[hi->blocked_mode][hj->granted_mode];
+	  assert (compat1 != LOCK_COMPAT_UNKNOWN);
+
+	  if (compat1 == LOCK_COMPAT_NO)
+	    {
+	      (void) lock_add_WFG_edge (hi->tran_index, hj->tran_index, true, hi->thrd_entry->lockwait_stime);
+	    }
+	}
+    }
+
+  /* from waiters in the waiter to holders */
+  for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
+    {
+      for (hj = res_ptr->waiter; hj != NULL; hj = hj->next)
+	{
+	  assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+	  assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
+
+	  compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
+	  compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
+	  assert (compat1 != LOCK_COMPAT_UNKNOWN && compat2 != LOCK_COMPAT_UNKNOWN);
+
+	  if (compat1 == LOCK_COMPAT_NO || compat2 == LOCK_COMPAT_NO)
+	    {
+	      (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
+	    }
+	}
+    }
+
+  /* from waiters in the waiter to other waiters in the waiter */
+  for (hi = res_ptr->waiter; hi != NULL; hi = hi->next)
+    {
+      for (hj = hi->next; hj != NULL; hj = hj->next)
+	{
+	  assert (hj->blocked_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
+
+	  compat1 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
+	  assert (compat1 != LOCK_COMPAT_UNKNOWN);
+
+	  if (compat1 == LOCK_COMPAT_NO)
+	    {
+	      (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, false, hj->thrd_entry->lockwait_stime);
+	    }
+	}
+    }
+}
+#endif /* SERVER_MODE */
+
 /*
  * lock_detect_local_deadlock - Run the local deadlock detection
  *
@@ -7675,6 +7874,10 @@ lock_victimize_first_thread_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapp
  *     the first transaction which enables a cycle
  *     when scanning from the first of object lock table to the last of it.
  *
+ *     Only the resources lock waiters are blocked on are visited to build the WFG,
+ *     and the detection is skipped when no thread started waiting since the last
+ *     run that found no cycle.
+ *
  *     The deadlock of victims are waken up and aborted by themselves.
  *
  *     Last, free WFG framework.
@@ -7687,13 +7890,28 @@ lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
 #else /* !SERVER_MODE */
   int k, s, t;
   LK_RES *res_ptr;
-  LK_ENTRY *hi, *hj;
   LK_WFG_NODE *TWFG_node;
   LK_WFG_EDGE *TWFG_edge;
   int i, rv;
-  LOCK_COMPATIBILITY compat1, compat2;
   int tran_index;
   FILE *log_fp;
+  UINT64 wait_seq_num;
+  int num_cycles;
+  TSC_TICKS start_tick, end_tick;
+  UINT64 detect_usec;
+
+  /* a new cycle needs a new wait; if no thread was suspended since the last run that found no cycle, there is nothing
+   * to detect. Still do a full run once in a while, in case a wait was missed. */
+  wait_seq_num = lk_Gl.TWFG_wait_seq_num;
+  if (wait_seq_num == lk_Gl.TWFG_checked_wait_seq_num && lk_Gl.TWFG_skipped_runs < LK_MAX_SKIPPED_DEADLOCK_RUNS)
+    {
+      lk_Gl.TWFG_skipped_runs++;
+      victim_count = 0;
+      goto check_no_victim;
+    }
+  lk_Gl.TWFG_skipped_runs = 0;
+
+  tsc_getticks (&start_tick);
 
   /* initialize deadlock detection related structures */
 
@@ -7723,118 +7941,37 @@ lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
 
   /* initialize victim count */
   victim_count = 0;		/* used as index of victims array */
+  num_cycles = 0;
 
-  /* hold the deadlock detection mutex */
-  rv = pthread_mutex_lock (&lk_Gl.DL_detection_mutex);
-
+  /* collect the resources lock waiters are blocked on. Only these resources can contribute edges to the WFG, so the
+   * rest of the lock table is neither visited nor locked. */
+  lk_Gl.TWFG_wait_res_keys.clear ();
+  thread_get_manager ()->map_entries (lock_collect_wait_resource_keys_mapfunc, lk_Gl.TWFG_wait_res_keys);
   // *INDENT-OFF*
-  lk_hashmap_iterator iterator { thread_p, lk_Gl.m_obj_hash_table };
+  std::sort (lk_Gl.TWFG_wait_res_keys.begin (), lk_Gl.TWFG_wait_res_keys.end (),
+             [] (const LK_RES_KEY & a, const LK_RES_KEY & b) { return oid_compare (&a.oid, &b.oid) < 0; });
+  lk_Gl.TWFG_wait_res_keys.erase (std::unique (lk_Gl.TWFG_wait_res_keys.begin (), lk_Gl.TWFG_wait_res_keys.end (),
+                                               [] (const LK_RES_KEY & a, const LK_RES_KEY & b)
+                                               { return OID_EQ (&a.oid, &b.oid); }),
+                                  lk_Gl.TWFG_wait_res_keys.end ());
   // *INDENT-ON*
-  for (res_ptr = iterator.iterate (); res_ptr != NULL; res_ptr = iterator.iterate ())
-    {
-      /* holding resource mutex */
-      if (res_ptr->holder == NULL)
-	{
-	  if (res_ptr->waiter == NULL)
-	    {
-	      continue;
-	    }
-	  else
-	    {
-#if defined(CUBRID_DEBUG)
-	      FILE *lk_fp;
-	      time_t cur_time;
-	      char time_val[CTIME_MAX];
+  perfmon_add_stat (thread_p, PSTAT_LK_NUM_DEADLOCK_WFG_RESOURCES, (int) lk_Gl.TWFG_wait_res_keys.size ());
 
-	      lk_fp = fopen ("lock_waiter_only_info.log", "a");
-	      if (lk_fp != NULL)
-		{
-		  cur_time = time (NULL);
-		  (void) ctime_r (&cur_time, time_val);
-		  fprintf (lk_fp, "##########################################\n");
-		  fprintf (lk_fp, "# current time: %s\n", time_val);
-		  lock_dump_resource (lk_fp, res_ptr);
-		  fprintf (lk_fp, "##########################################\n");
-		  fclose (lk_fp);
-		}
-#endif /* CUBRID_DEBUG */
-	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_LK_LOCK_WAITER_ONLY, 1, "lock_waiter_only_info.log");
-
-	      if (res_ptr->total_holders_mode != NULL_LOCK)
-		{
-		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_TOTAL_HOLDERS_MODE, 1, res_ptr->total_holders_mode);
-		  res_ptr->total_holders_mode = NULL_LOCK;
-		}
-	      (void) lock_grant_blocked_waiter (thread_p, res_ptr);
-	    }
-	}
-
-      /* among holders */
-      for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
-	{
-	  if (hi->blocked_mode == NULL_LOCK)
-	    {
-	      break;
-	    }
-	  for (hj = hi->next; hj != NULL; hj = hj->next)
-	    {
-	      assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
-	      assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
-
-	      compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
-	      compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
-	      assert (compat1 != LOCK_COMPAT_UNKNOWN && compat2 != LOCK_COMPAT_UNKNOWN);
-
-	      if (compat1 == LOCK_COMPAT_NO || compat2 == LOCK_COMPAT_NO)
-		{
-		  (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
-		}
-
-	      compat1 = lock_Comp[hi->blocked_mode][hj->granted_mode];
-	      assert (compat1 != LOCK_COMPAT_UNKNOWN);
-
-	      if (compat1 == LOCK_COMPAT_NO)
-		{
-		  (void) lock_add_WFG_edge (hi->tran_index, hj->tran_index, true, hi->thrd_entry->lockwait_stime);
-		}
-	    }
-	}
+  /* hold the deadlock detection mutex */
+  rv = pthread_mutex_lock (&lk_Gl.DL_detection_mutex);
 
-      /* from waiters in the waiter to holders */
-      for (hi = res_ptr->holder; hi != NULL; hi = hi->next)
+  for (i = 0; i < (int) lk_Gl.TWFG_wait_res_keys.size (); i++)
+    {
+      res_ptr = lk_Gl.m_obj_hash_table.find (thread_p, lk_Gl.TWFG_wait_res_keys[i]);
+      if (res_ptr == NULL)
 	{
-	  for (hj = res_ptr->waiter; hj != NULL; hj = hj->next)
-	    {
-	      assert (hi->granted_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
-	      assert (hj->granted_mode >= NULL_LOCK && hj->blocked_mode >= NULL_LOCK);
-
-	      compat1 = lock_Comp[hj->blocked_mode][hi->granted_mode];
-	      compat2 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
-	      assert (compat1 != LOCK_COMPAT_UNKNOWN && compat2 != LOCK_COMPAT_UNKNOWN);
-
-	      if (compat1 == LOCK_COMPAT_NO || compat2 == LOCK_COMPAT_NO)
-		{
-		  (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, true, hj->thrd_entry->lockwait_stime);
-		}
-	    }
+	  /* all locks on resource were released meanwhile */
+	  continue;
 	}
 
-      /* from waiters in the waiter to other waiters in the waiter */
-      for (hi = res_ptr->waiter; hi != NULL; hi = hi->next)
-	{
-	  for (hj = hi->next; hj != NULL; hj = hj->next)
-	    {
-	      assert (hj->blocked_mode >= NULL_LOCK && hi->blocked_mode >= NULL_LOCK);
-
-	      compat1 = lock_Comp[hj->blocked_mode][hi->blocked_mode];
-	      assert (compat1 != LOCK_COMPAT_UNKNOWN);
-
-	      if (compat1 == LOCK_COMPAT_NO)
-		{
-		  (void) lock_add_WFG_edge (hj->tran_index, hi->tran_index, false, hj->thrd_entry->lockwait_stime);
-		}
-	    }
-	}
+      /* holding resource mutex */
+      lock_add_WFG_edges_of_resource (thread_p, res_ptr);
+      pthread_mutex_unlock (&res_ptr->res_mutex);
     }
 
   /* release DL detection mutex */
@@ -7922,6 +8059,7 @@ lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
 	  if (TWFG_node[t].ancestor != -1)
 	    {
 	      /* A deadlock cycle is found */
+	      num_cycles++;
 	      lock_select_deadlock_victim (thread_p, s, t);
 	      if (victim_count >= LK_MAX_VICTIM_COUNT)
 		{
@@ -7939,6 +8077,11 @@ lock_detect_local_deadlock (THREAD_ENTRY * thread_p)
 
 final_:
 
+  tsc_getticks (&end_tick);
+  detect_usec = tsc_elapsed_utime (end_tick, start_tick);
+  perfmon_time_stat (thread_p, PSTAT_LK_DEADLOCK_DETECT, detect_usec);
+  perfmon_add_stat (thread_p, PSTAT_LK_NUM_DEADLOCK_VICTIMS, victim_count);
+
 #if defined(ENABLE_SYSTEMTAP)
   if (victim_count > 0)
     {
@@ -7979,6 +8122,12 @@ final_:
       log_fp = event_log_start (thread_p, "DEADLOCK");
       if (log_fp != NULL)
 	{
+	  fprintf (log_fp, "victim:\n");
+	  event_log_print_client_info (victims[k].tran_index, 2);
+	  fprintf (log_fp, "  resolution: %s\n", victims[k].can_timeout ? "timeout" : "abort");
+	  fprintf (log_fp, "  cycle length: %d\n", victims[k].num_trans_in_cycle);
+	  fprintf (log_fp, "  detection time: %lld usec\n", (long long) detect_usec);
+	  fprintf (log_fp, "cycle:\n");
 	  for (i = 0; i < victims[k].num_trans_in_cycle; i++)
 	    {
 	      tran_index = victims[k].tran_index_in_cycle[i];
@@ -8011,6 +8160,13 @@ final_:
       free_and_init (lk_Gl.TWFG_edge);
     }
 
+  if (num_cycles == 0)
+    {
+      /* waits up to wait_seq_num are cleared of deadlocks */
+      lk_Gl.TWFG_checked_wait_seq_num = wait_seq_num;
+    }
+
+check_no_victim:
   if (victim_count == 0)
     {
       if (lk_Gl.no_victim_case_count < 60)
@@ -76,6 +76,7 @@
 #define LA_MAX_UNFLUSHED_REPL_ITEMS             200
 #define LA_DEFAULT_LOG_PAGE_SIZE                4096
 #define LA_GET_PAGE_RETRY_COUNT                 10
+#define LA_ARV_READ_AHEAD_NPAGES                64	/* archive pages read at once */
 #define LA_REPL_LIST_COUNT                      50
 
 #define LA_PAGE_DOESNOT_EXIST                   0
@@ -222,6 +223,11 @@ struct la_arv_log
   LOG_PAGE *hdr_page;
   LOG_ARV_HEADER *log_hdr;
   int arv_num;
+
+  /* archives are not changed; pages following the fetched page are read ahead for the next fetches */
+  char *read_ahead_area;
+  LOG_PAGEID read_ahead_fpageid;
+  int read_ahead_npages;
 };
 
 typedef struct la_item LA_ITEM;
@@ -423,6 +429,8 @@ static void la_init_ha_apply_info (LA_HA_APPLY_INFO * ha_apply_info);
 static LOG_PHY_PAGEID la_log_phypageid (LOG_PAGEID logical_pageid);
 static int la_log_io_open (const char *vlabel, int flags, int mode);
 static int la_log_io_read (char *vname, int vdes, void *io_pgptr, LOG_PHY_PAGEID pageid, int pagesize);
+static int la_log_io_read_pages (char *vname, int vdes, void *io_pgptr, LOG_PHY_PAGEID pageid, int npages,
+				 int pagesize, int retries);
 static int la_log_io_read_with_max_retries (char *vname, int vdes, void *io_pgptr, LOG_PHY_PAGEID pageid, int pagesize,
 					    int retries);
 static int la_find_archive_num (int *arv_log_num, LOG_PAGEID pageid);
@@ -671,9 +679,27 @@ la_log_io_read (char *vname, int vdes, void *io_pgptr, LOG_PHY_PAGEID pageid, in
 static int
 la_log_io_read_with_max_retries (char *vname, int vdes, void *io_pgptr, LOG_PHY_PAGEID pageid, int pagesize,
 				 int retries)
+{
+  return la_log_io_read_pages (vname, vdes, io_pgptr, pageid, 1, pagesize, retries);
+}
+
+/*
+ * la_log_io_read_pages() - read contiguous pages from the disk with max retries
+ *   return: error code
+ *     vname(in): the volume name of the target file
+ *     vdes(in): the volume descriptor of the target file
+ *     io_pgptr(out): start pointer to be read
+ *     pageid(in): first page id to read
+ *     npages(in): number of pages to read
+ *     pagesize(in): page size to read
+ *     retries(in): read retry count
+ */
+static int
+la_log_io_read_pages (char *vname, int vdes, void *io_pgptr, LOG_PHY_PAGEID pageid, int npages, int pagesize,
+		      int retries)
 {
   int nbytes;
-  int remain_bytes = pagesize;
+  int remain_bytes = pagesize * npages;
   off64_t offset = ((off64_t) pagesize) * ((off64_t) pageid);
   char *current_ptr = (char *) io_pgptr;
 
@@ -893,6 +919,7 @@ la_log_fetch_from_archive (LOG_PAGEID pageid, char *data)
   LOG_ARV_HEADER *log_hdr = NULL;
   LOG_PAGEID fpageid;
   int npages;
+  int i;
 
   if (la_Info.arv_log.log_vdes != NULL_VOLDES && la_Info.arv_log.log_hdr != NULL)
     {
@@ -926,9 +953,21 @@ la_log_fetch_from_archive (LOG_PAGEID pageid, char *data)
 	}
     }
 
+  if (!need_guess && pageid >= la_Info.arv_log.read_ahead_fpageid
+      && pageid < la_Info.arv_log.read_ahead_fpageid + la_Info.arv_log.read_ahead_npages)
+    {
+      /* page was read ahead */
+      memcpy (data, la_Info.arv_log.read_ahead_area
+	      + (size_t) (pageid - la_Info.arv_log.read_ahead_fpageid) * la_Info.act_log.db_logpagesize,
+	      la_Info.act_log.db_logpagesize);
+      return NO_ERROR;
+    }
+
 log_reopen:
   if (la_Info.arv_log.log_vdes == NULL_VOLDES)
     {
+      la_Info.arv_log.read_ahead_npages = 0;
+
       /* make archive_name */
       fileio_make_log_archive_name (la_Info.arv_log.path, la_Info.log_path, la_Info.act_log.log_hdr->prefix_name,
 				    la_Info.arv_log.arv_num);
@@ -995,13 +1034,51 @@ log_reopen:
 	}
 
       la_Info.arv_log.log_hdr = (LOG_ARV_HEADER *) la_Info.arv_log.hdr_page->area;
+      la_Info.arv_log.read_ahead_npages = 0;
+    }
+
+  if (la_Info.arv_log.read_ahead_area == NULL)
+    {
+      la_Info.arv_log.read_ahead_area = (char *) malloc ((size_t) LA_ARV_READ_AHEAD_NPAGES
+							 * la_Info.act_log.db_logpagesize);
     }
 
+  if (la_Info.arv_log.read_ahead_area != NULL)
+    {
+      /* read the page and the pages following it in archive */
+      npages = (int) MIN (LA_ARV_READ_AHEAD_NPAGES,
+			  la_Info.arv_log.log_hdr->fpageid + la_Info.arv_log.log_hdr->npages - pageid);
+      npages = MAX (npages, 1);
+      la_Info.arv_log.read_ahead_npages = 0;
+      error =
+	la_log_io_read_pages (la_Info.arv_log.path, la_Info.arv_log.log_vdes, la_Info.arv_log.read_ahead_area,
+			      (pageid - la_Info.arv_log.log_hdr->fpageid + 1), npages,
+			      la_Info.act_log.db_logpagesize, 10);
+      if (error == NO_ERROR)
+	{
+	  memcpy (data, la_Info.arv_log.read_ahead_area, la_Info.act_log.db_logpagesize);
 
-  error =
-    la_log_io_read_with_max_retries (la_Info.arv_log.path, la_Info.arv_log.log_vdes, data,
-				     (pageid - la_Info.arv_log.log_hdr->fpageid + 1), la_Info.act_log.db_logpagesize,
-				     10);
+	  /* keep following pages until first one that does not belong to the sequence */
+	  for (i = 1; i < npages; i++)
+	    {
+	      LOG_PAGE *pgptr = (LOG_PAGE *) (la_Info.arv_log.read_ahead_area
+					      + (size_t) i * la_Info.act_log.db_logpagesize);
+	      if (pgptr->hdr.logical_pageid != pageid + i)
+		{
+		  break;
+		}
+	    }
+	  la_Info.arv_log.read_ahead_fpageid = pageid;
+	  la_Info.arv_log.read_ahead_npages = i;
+	}
+    }
+  else
+    {
+      error =
+	la_log_io_read_with_max_retries (la_Info.arv_log.path, la_Info.arv_log.log_vdes, data,
+					 (pageid - la_Info.arv_log.log_hdr->fpageid + 1),
+					 la_Info.act_log.db_logpagesize, 10);
+    }
 
   if (error != NO_ERROR)
     {
@@ -6885,6 +6962,11 @@ la_shutdown (void)
     {
       free_and_init (la_Info.act_log.hdr_page);
     }
+  if (la_Info.arv_log.read_ahead_area)
+    {
+      free_and_init (la_Info.arv_log.read_ahead_area);
+    }
+  la_Info.arv_log.read_ahead_npages = 0;
 
   if (db_get_client_type () == DB_CLIENT_TYPE_LOG_APPLIER)
     {
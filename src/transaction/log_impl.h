@@ -312,16 +312,26 @@ struct log_flush_info
 #endif				/* SERVER_MODE */
 };
 
+/* a transaction waiting for its commit to be flushed. it is woken only when log is flushed up to its LSA. */
+typedef struct log_commit_waiter LOG_COMMIT_WAITER;
+struct log_commit_waiter
+{
+  LOG_LSA flush_lsa;		/* wait until log is flushed up to this address */
+  pthread_cond_t cond;
+  bool is_woken;
+  LOG_COMMIT_WAITER *next;
+};
+
 typedef struct log_group_commit_info LOG_GROUP_COMMIT_INFO;
 struct log_group_commit_info
 {
-  /* group commit waiters count */
+  /* protects the waiters list */
   pthread_mutex_t gc_mutex;
-  pthread_cond_t gc_cond;
+  LOG_COMMIT_WAITER *waiters;
 };
 
 #define LOG_GROUP_COMMIT_INFO_INITIALIZER \
-  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+  { PTHREAD_MUTEX_INITIALIZER, NULL }
 
 
 
@@ -820,6 +830,9 @@ extern int logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid
 				      LOG_PAGE * log_pgptr);
 extern int logpb_read_page_from_active_log (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, int num_pages,
 					    LOG_PAGE * log_pgptr);
+extern void logpb_read_ahead_reset (bool is_log_analysis);
+extern void logpb_wakeup_commit_waiters (void);
+extern bool logpb_has_commit_waiters (void);
 extern int logpb_write_page_to_disk (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgptr, LOG_PAGEID logical_pageid);
 extern PGLENGTH logpb_find_header_parameters (THREAD_ENTRY * thread_p, const bool force_read_log_header,
 					      const char *db_fullname, const char *logpath,
@@ -91,6 +91,7 @@
 #include "transaction_transient.hpp"
 #include "vacuum.h"
 #include "xasl_cache.h"
+#include "tsc_timer.h"
 
 #include "dbtype.h"
 
@@ -322,6 +323,8 @@ static cubthread::daemon *log_Check_ha_delay_info_daemon = NULL;
 
 static cubthread::daemon *log_Flush_daemon = NULL;
 static std::atomic_bool log_Flush_has_been_requested = {false};
+/* moving average of log flush duration, used as group commit wait window while commits are waiting */
+static std::atomic<UINT64> log_Flush_avg_usec = {0};
 // *INDENT-ON*
 
 static void log_daemons_init ();
@@ -4773,6 +4776,9 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
    * be rolled back. */
   logtb_complete_mvcc (thread_p, tdes, true);
 
+  /* the changes are visible now; clear the cached query results they made obsolete */
+  qmgr_clear_list_cache_of_modified_classes (thread_p, tdes->tran_index);
+
   tdes->state = TRAN_UNACTIVE_WILL_COMMIT;
   /* undo_nxlsa is no longer required here and must be reset, in case checkpoint takes a snapshot of this transaction
    * during TRAN_UNACTIVE_WILL_COMMIT phase.
@@ -9529,6 +9535,21 @@ log_get_log_group_commit_interval (bool & is_timed_wait, cubthread::delta_time &
     {
       period = std::chrono::milliseconds (log_group_commit_interval_msec);
     }
+
+#if defined (SERVER_MODE)
+  if (logpb_has_commit_waiters ())
+    {
+      /* commits are already waiting; gather followers no longer than a flush lasts, so that next flush starts when
+       * the previous one would have ended. this pipelines flushes instead of sleeping whole interval. */
+      // *INDENT-OFF*
+      cubthread::delta_time window = std::chrono::microseconds (log_Flush_avg_usec.load ());
+      // *INDENT-ON*
+      if (window < period)
+	{
+	  period = window;
+	}
+    }
+#endif /* SERVER_MODE */
 }
 
 /*
@@ -9843,7 +9864,16 @@ log_check_ha_delay_info_execute (cubthread::entry &thread_ref)
 static void
 log_flush_execute (cubthread::entry & thread_ref)
 {
-  if (!BO_IS_SERVER_RESTARTED () || !log_Flush_has_been_requested)
+  TSC_TICKS start_tick, end_tick;
+  UINT64 flush_usec, avg_usec;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      return;
+    }
+
+  /* group commits do not request flush; they are found in commit waiters list */
+  if (!log_Flush_has_been_requested.exchange (false) && !logpb_has_commit_waiters ())
     {
       return;
     }
@@ -9851,16 +9881,25 @@ log_flush_execute (cubthread::entry & thread_ref)
   // refresh log trace flush time
   thread_ref.event_stats.trace_log_flush_time = prm_get_integer_value (PRM_ID_LOG_TRACE_FLUSH_TIME_MSECS);
 
+  tsc_getticks (&start_tick);
+
   LOG_CS_ENTER (&thread_ref);
   logpb_flush_pages_direct (&thread_ref);
   LOG_CS_EXIT (&thread_ref);
 
   log_Stat.gc_flush_count++;
 
-  pthread_mutex_lock (&log_Gl.group_commit_info.gc_mutex);
-  pthread_cond_broadcast (&log_Gl.group_commit_info.gc_cond);
-  log_Flush_has_been_requested = false;
-  pthread_mutex_unlock (&log_Gl.group_commit_info.gc_mutex);
+  /* waiters are woken by the flush itself; wake here too those that were added after the flush started and are
+   * already covered */
+  logpb_wakeup_commit_waiters ();
+
+  tsc_getticks (&end_tick);
+  flush_usec = tsc_elapsed_utime (end_tick, start_tick);
+  perfmon_time_stat (&thread_ref, PSTAT_LOG_GROUP_COMMIT_FLUSH, flush_usec);
+
+  /* avg = 7/8 avg + 1/8 current; only flush daemon updates it */
+  avg_usec = log_Flush_avg_usec.load ();
+  log_Flush_avg_usec = avg_usec - (avg_usec >> 3) + (flush_usec >> 3);
 }
 #endif /* SERVER_MODE */
 
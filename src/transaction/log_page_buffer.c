@@ -245,6 +245,40 @@ struct log_pb_global_data
   LOGPB_PARTIAL_APPEND partial_append;
 };
 
+/*
+ * Log read-ahead
+ *
+ * Readers scanning the log forward (recovery analysis and redo, vacuum, log copy for replication) miss the log buffer
+ * for almost every page and read the pages one by one from active or archive log. When a page following the previously
+ * read page is read from file, the next pages are read with one I/O into a chunk, and the next fetches are served from
+ * the chunk.
+ *
+ * Only pages that are not changed anymore are kept: the pages before the next I/O page, or any page while the log is
+ * analyzed at recovery (the chunks are invalidated when analysis ends and when the log is reset).
+ */
+#define LOGPB_READ_AHEAD_NCHUNKS 4
+
+typedef struct logpb_read_ahead_chunk LOGPB_READ_AHEAD_CHUNK;
+struct logpb_read_ahead_chunk
+{
+  LOG_PAGEID first_pageid;	/* NULL_PAGEID if chunk is empty */
+  int npages;
+  bool is_loading;		/* pages are being read; chunk cannot be used or replaced */
+  INT64 last_used;		/* for LRU replacement */
+  char *area;
+};
+
+typedef struct logpb_read_ahead LOGPB_READ_AHEAD;
+struct logpb_read_ahead
+{
+  pthread_mutex_t mutex;
+  int chunk_npages;		/* less than 2 if read-ahead is disabled */
+  bool is_log_analysis;		/* any page may be kept */
+  LOG_PAGEID last_read_pageid;	/* to detect sequential reads */
+  INT64 use_count;
+  LOGPB_READ_AHEAD_CHUNK chunks[LOGPB_READ_AHEAD_NCHUNKS];
+};
+
 typedef struct arv_page_info
 {
   int arv_num;
@@ -273,6 +307,7 @@ LOG_PB_GLOBAL_DATA log_Pb;
 
 LOG_LOGGING_STAT log_Stat;
 static ARV_LOG_PAGE_INFO_TABLE logpb_Arv_page_info_table;
+static LOGPB_READ_AHEAD logpb_Read_ahead;
 
 static bool logpb_Initialized = false;
 static bool logpb_Logging = false;
@@ -290,6 +325,13 @@ static bool logpb_is_any_dirty (THREAD_ENTRY * thread_p);
 static bool logpb_is_any_fix (THREAD_ENTRY * thread_p);
 #endif /* CUBRID_DEBUG */
 static void logpb_dump_information (FILE * out_fp);
+static void logpb_initialize_read_ahead (void);
+static void logpb_finalize_read_ahead (void);
+static LOG_PAGEID logpb_read_ahead_end_pageid (void);
+static bool logpb_read_ahead_get_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE * log_pgptr,
+				       bool * is_sequential);
+static void logpb_read_ahead_load (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, bool is_archive_page,
+				   const LOG_PAGE * log_pgptr);
 static void logpb_dump_to_flush_page (FILE * out_fp);
 static void logpb_dump_pages (FILE * out_fp);
 static void logpb_initialize_backup_info (LOG_HEADER * loghdr);
@@ -627,11 +669,13 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
   memset (log_Pb.partial_append.log_page_record_header, LOG_PAGE_INIT_VALUE, IO_MAX_PAGE_SIZE);
 #endif // DEBUG
 
+  logpb_initialize_read_ahead ();
+
   logpb_Initialized = true;
   pthread_mutex_init (&log_Gl.chkpt_lsa_lock, NULL);
 
-  pthread_cond_init (&group_commit_info->gc_cond, NULL);
   pthread_mutex_init (&group_commit_info->gc_mutex, NULL);
+  group_commit_info->waiters = NULL;
 
   pthread_mutex_init (&writer_info->wr_list_mutex, NULL);
 
@@ -695,13 +739,14 @@ logpb_finalize_pool (THREAD_ENTRY * thread_p)
   free_and_init (log_Pb.pages_area);
   free_and_init (log_Pb.header_page);
   log_Pb.num_buffers = 0;
+  logpb_finalize_read_ahead ();
   logpb_Initialized = false;
   logpb_finalize_flush_info ();
 
   pthread_mutex_destroy (&log_Gl.chkpt_lsa_lock);
 
+  assert (log_Gl.group_commit_info.waiters == NULL);
   pthread_mutex_destroy (&log_Gl.group_commit_info.gc_mutex);
-  pthread_cond_destroy (&log_Gl.group_commit_info.gc_cond);
 
   logpb_finalize_writer_info ();
 
@@ -758,6 +803,8 @@ logpb_invalidate_pool (THREAD_ENTRY * thread_p)
 	  logpb_initialize_log_buffer (log_bufptr, log_bufptr->logpage);
 	}
     }
+  /* pages read ahead may be changed too */
+  logpb_read_ahead_reset (false);
 }
 
 
@@ -1974,6 +2021,8 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
 			   LOG_PAGE * log_pgptr)
 {
   bool log_csect_entered = false;
+  bool is_sequential = false;
+  bool is_archive_page = false;
 
   assert (log_pgptr != NULL);
   assert (pageid != NULL_PAGEID);
@@ -1996,6 +2045,16 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
       assert (LOG_CS_OWN (thread_p));
     }
 
+  if (logpb_read_ahead_get_page (thread_p, pageid, log_pgptr, &is_sequential))
+    {
+      /* page was read ahead */
+      if (log_csect_entered)
+	{
+	  LOG_CS_EXIT (thread_p);
+	}
+      return NO_ERROR;
+    }
+
   // some archived pages may be still in active log; check if they can be fetched from active.
   bool fetch_from_archive = logpb_is_page_in_archive (pageid);
   if (fetch_from_archive)
@@ -2012,6 +2071,7 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
   if (fetch_from_archive)
     {
       // fetch from archive
+      is_archive_page = true;
       if (logpb_fetch_from_archive (thread_p, pageid, log_pgptr, NULL, NULL, true) == NULL)
 	{
 #if defined (SERVER_MODE)
@@ -2051,6 +2111,7 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
 		{
 		  /* The active part where this archive page belonged was already, overwritten. Fetch the page from
 		   * archive. */
+		  is_archive_page = true;
 		  if (logpb_fetch_from_archive (thread_p, pageid, log_pgptr, NULL, NULL, true) == NULL)
 		    {
 #if defined (SERVER_MODE)
@@ -2073,6 +2134,11 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
 	}
     }
 
+  if (is_sequential)
+    {
+      logpb_read_ahead_load (thread_p, pageid, is_archive_page, log_pgptr);
+    }
+
   if (log_csect_entered)
     {
       LOG_CS_EXIT (thread_p);
@@ -2161,6 +2227,304 @@ logpb_read_page_from_active_log (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, int
   return num_pages;
 }
 
+/*
+ * logpb_initialize_read_ahead () - initialize log read-ahead chunks
+ *
+ * return : void
+ *
+ * note: read-ahead is disabled if chunks cannot be allocated.
+ */
+static void
+logpb_initialize_read_ahead (void)
+{
+  LOGPB_READ_AHEAD_CHUNK *chunk;
+  int i;
+
+  pthread_mutex_init (&logpb_Read_ahead.mutex, NULL);
+  logpb_Read_ahead.chunk_npages = prm_get_integer_value (PRM_ID_LOG_READ_AHEAD_PAGES);
+  logpb_Read_ahead.is_log_analysis = false;
+  logpb_Read_ahead.last_read_pageid = NULL_PAGEID;
+  logpb_Read_ahead.use_count = 0;
+
+  for (i = 0; i < LOGPB_READ_AHEAD_NCHUNKS; i++)
+    {
+      chunk = &logpb_Read_ahead.chunks[i];
+      chunk->first_pageid = NULL_PAGEID;
+      chunk->npages = 0;
+      chunk->is_loading = false;
+      chunk->last_used = 0;
+      chunk->area = NULL;
+    }
+
+  if (logpb_Read_ahead.chunk_npages < 2)
+    {
+      logpb_Read_ahead.chunk_npages = 0;
+      return;
+    }
+
+  for (i = 0; i < LOGPB_READ_AHEAD_NCHUNKS; i++)
+    {
+      chunk = &logpb_Read_ahead.chunks[i];
+      chunk->area = (char *) malloc ((size_t) logpb_Read_ahead.chunk_npages * LOG_PAGESIZE);
+      if (chunk->area == NULL)
+	{
+	  /* not critical; just read pages one by one */
+	  logpb_finalize_read_ahead ();
+	  pthread_mutex_init (&logpb_Read_ahead.mutex, NULL);
+	  return;
+	}
+    }
+}
+
+/*
+ * logpb_finalize_read_ahead () - free log read-ahead chunks
+ *
+ * return : void
+ */
+static void
+logpb_finalize_read_ahead (void)
+{
+  int i;
+
+  for (i = 0; i < LOGPB_READ_AHEAD_NCHUNKS; i++)
+    {
+      assert (!logpb_Read_ahead.chunks[i].is_loading);
+      logpb_Read_ahead.chunks[i].first_pageid = NULL_PAGEID;
+      logpb_Read_ahead.chunks[i].npages = 0;
+      if (logpb_Read_ahead.chunks[i].area != NULL)
+	{
+	  free_and_init (logpb_Read_ahead.chunks[i].area);
+	}
+    }
+  logpb_Read_ahead.chunk_npages = 0;
+  pthread_mutex_destroy (&logpb_Read_ahead.mutex);
+}
+
+/*
+ * logpb_read_ahead_reset () - invalidate all pages read ahead
+ *
+ * return : void
+ * is_log_analysis (in) : true if the log is about to be analyzed by recovery. no log page is changed until analysis
+ *                        ends, so any page may be kept. must be reset again with false when analysis ends.
+ *
+ * note: it must be called whenever log pages already flushed are changed (e.g. when the log is reset).
+ */
+void
+logpb_read_ahead_reset (bool is_log_analysis)
+{
+  int i;
+  int rv;
+
+  if (logpb_Read_ahead.chunk_npages == 0)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&logpb_Read_ahead.mutex);
+  for (i = 0; i < LOGPB_READ_AHEAD_NCHUNKS; i++)
+    {
+      /* log pages cannot be changed while they are read */
+      assert (!logpb_Read_ahead.chunks[i].is_loading);
+      logpb_Read_ahead.chunks[i].first_pageid = NULL_PAGEID;
+      logpb_Read_ahead.chunks[i].npages = 0;
+    }
+  logpb_Read_ahead.is_log_analysis = is_log_analysis;
+  logpb_Read_ahead.last_read_pageid = NULL_PAGEID;
+  pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+}
+
+/*
+ * logpb_read_ahead_end_pageid () - get the page where the log pages that may still change start
+ *
+ * return : page identifier; pages before it are not changed anymore
+ */
+static LOG_PAGEID
+logpb_read_ahead_end_pageid (void)
+{
+  if (logpb_Read_ahead.is_log_analysis)
+    {
+      return LOGPAGEID_MAX;
+    }
+  /* next I/O page is flushed again with the records appended to it */
+  return log_Gl.append.get_nxio_lsa ().pageid;
+}
+
+/*
+ * logpb_read_ahead_get_page () - get a log page from read-ahead chunks
+ *
+ * return             : true if page was read ahead and is copied to log_pgptr, false otherwise
+ * thread_p (in)      : thread entry
+ * pageid (in)        : log page identifier
+ * log_pgptr (out)    : log page buffer
+ * is_sequential (out): true if the page follows the previously read page, and next pages should be read ahead
+ */
+static bool
+logpb_read_ahead_get_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE * log_pgptr, bool * is_sequential)
+{
+  LOGPB_READ_AHEAD_CHUNK *chunk;
+  int i;
+  int rv;
+
+  *is_sequential = false;
+
+  if (logpb_Read_ahead.chunk_npages == 0 || pageid == LOGPB_HEADER_PAGE_ID)
+    {
+      return false;
+    }
+
+  rv = pthread_mutex_lock (&logpb_Read_ahead.mutex);
+
+  *is_sequential = (pageid == logpb_Read_ahead.last_read_pageid + 1);
+  logpb_Read_ahead.last_read_pageid = pageid;
+
+  for (i = 0; i < LOGPB_READ_AHEAD_NCHUNKS; i++)
+    {
+      chunk = &logpb_Read_ahead.chunks[i];
+      if (chunk->first_pageid != NULL_PAGEID && pageid >= chunk->first_pageid
+	  && pageid < chunk->first_pageid + chunk->npages)
+	{
+	  memcpy (log_pgptr, chunk->area + (size_t) (pageid - chunk->first_pageid) * LOG_PAGESIZE, LOG_PAGESIZE);
+	  chunk->last_used = ++logpb_Read_ahead.use_count;
+	  pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+
+	  perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_READ_AHEAD_HITS);
+	  return true;
+	}
+    }
+
+  pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+  return false;
+}
+
+/*
+ * logpb_read_ahead_load () - read the pages following a log page into a read-ahead chunk
+ *
+ * return               : void
+ * thread_p (in)        : thread entry
+ * pageid (in)          : log page just read from file
+ * is_archive_page (in) : true if the page was read from archive; the archive is still mounted
+ * log_pgptr (in)       : log page just read from file
+ *
+ * note: caller must hold log critical section; the active log cannot be archived and the archive cannot be dismounted
+ *       meanwhile. read-ahead is best effort; on any error, no pages are kept.
+ */
+static void
+logpb_read_ahead_load (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, bool is_archive_page, const LOG_PAGE * log_pgptr)
+{
+  LOGPB_READ_AHEAD_CHUNK *chunk = NULL;
+  LOG_PAGEID end_pageid;
+  LOG_PHY_PAGEID phy_pageid;
+  LOG_PAGE *chunk_pgptr;
+  int npages, read_npages = 0;
+  int i;
+  int rv;
+
+  if (logpb_Read_ahead.chunk_npages == 0 || pageid == LOGPB_HEADER_PAGE_ID)
+    {
+      return;
+    }
+
+  end_pageid = logpb_read_ahead_end_pageid ();
+  if (pageid + 1 >= end_pageid)
+    {
+      /* no stable page to read ahead */
+      return;
+    }
+  npages = (int) MIN (logpb_Read_ahead.chunk_npages, end_pageid - pageid);
+
+  /* choose least recently used chunk; chunk is not used or replaced by others while it is loaded */
+  rv = pthread_mutex_lock (&logpb_Read_ahead.mutex);
+  for (i = 0; i < LOGPB_READ_AHEAD_NCHUNKS; i++)
+    {
+      LOGPB_READ_AHEAD_CHUNK *cand = &logpb_Read_ahead.chunks[i];
+
+      if (cand->is_loading)
+	{
+	  continue;
+	}
+      if (cand->first_pageid != NULL_PAGEID && pageid >= cand->first_pageid
+	  && pageid < cand->first_pageid + cand->npages)
+	{
+	  /* loaded meanwhile by another reader */
+	  pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+	  return;
+	}
+      if (chunk == NULL || cand->last_used < chunk->last_used)
+	{
+	  chunk = cand;
+	}
+    }
+  if (chunk == NULL)
+    {
+      /* all chunks are being loaded */
+      pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+      return;
+    }
+  chunk->is_loading = true;
+  chunk->first_pageid = NULL_PAGEID;
+  chunk->npages = 0;
+  pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+
+  /* first page is already read */
+  memcpy (chunk->area, log_pgptr, LOG_PAGESIZE);
+
+  if (is_archive_page)
+    {
+      LOG_ARCHIVE_CS_ENTER (thread_p);
+      if (log_Gl.archive.vdes != NULL_VOLDES && pageid >= log_Gl.archive.hdr.fpageid
+	  && pageid + 1 < log_Gl.archive.hdr.fpageid + log_Gl.archive.hdr.npages)
+	{
+	  read_npages = (int) MIN (npages - 1, log_Gl.archive.hdr.fpageid + log_Gl.archive.hdr.npages - (pageid + 1));
+	  phy_pageid = (LOG_PHY_PAGEID) (pageid + 1 - log_Gl.archive.hdr.fpageid + 1);
+
+	  perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+	  if (fileio_read_pages (thread_p, log_Gl.archive.vdes, chunk->area + LOG_PAGESIZE, phy_pageid, read_npages,
+				 LOG_PAGESIZE) == NULL)
+	    {
+	      read_npages = 0;
+	    }
+	}
+      LOG_ARCHIVE_CS_EXIT (thread_p);
+    }
+  else
+    {
+      phy_pageid = logpb_to_physical_pageid (pageid + 1);
+      read_npages = (int) MIN (npages - 1, LOGPB_ACTIVE_NPAGES - phy_pageid + 1);
+
+      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+      if (fileio_read_pages (thread_p, log_Gl.append.vdes, chunk->area + LOG_PAGESIZE, phy_pageid, read_npages,
+			     LOG_PAGESIZE) == NULL)
+	{
+	  read_npages = 0;
+	}
+    }
+
+  if (read_npages == 0)
+    {
+      /* error is not relevant; pages are read again one by one when they are needed */
+      er_clear ();
+    }
+
+  /* keep pages until first one that does not belong to the sequence (e.g. active log page overwritten) */
+  for (i = 1; i <= read_npages; i++)
+    {
+      chunk_pgptr = (LOG_PAGE *) (chunk->area + (size_t) i * LOG_PAGESIZE);
+      if (chunk_pgptr->hdr.logical_pageid != pageid + i)
+	{
+	  break;
+	}
+    }
+
+  rv = pthread_mutex_lock (&logpb_Read_ahead.mutex);
+  chunk->first_pageid = pageid;
+  chunk->npages = i;
+  chunk->last_used = ++logpb_Read_ahead.use_count;
+  chunk->is_loading = false;
+  pthread_mutex_unlock (&logpb_Read_ahead.mutex);
+
+  perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_READ_AHEAD_LOADS);
+}
+
 /*
  * logpb_write_page_to_disk - writes and syncs a log page to disk
  *
@@ -3708,6 +4072,9 @@ logpb_flush_all_append_pages (THREAD_ENTRY * thread_p)
     }
 #endif /* SERVER_MODE */
 
+  /* commits flushed (and copied by log writers, if any) are complete */
+  logpb_wakeup_commit_waiters ();
+
   return 1;
 
 error:
@@ -3781,6 +4148,9 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   bool async_commit, group_commit;
   LOG_LSA nxio_lsa;
   LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_COMMIT_WAITER waiter;
+  LOG_COMMIT_WAITER **waiter_p;
+  TSC_TICKS wait_start_tick, wait_end_tick;
 
   assert (flush_lsa != NULL && !LSA_ISNULL (flush_lsa));
 
@@ -3846,12 +4216,24 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   else if (need_wait == true)
     {
       nxio_lsa = log_Gl.append.get_nxio_lsa ();
+      if (LSA_GE (&nxio_lsa, flush_lsa))
+	{
+	  /* already flushed */
+	  return;
+	}
 
       if (need_wakeup_LFT == false && pgbuf_has_perm_pages_fixed (thread_p))
 	{
 	  need_wakeup_LFT = true;
 	}
 
+      /* wait to be woken by the flush that covers flush_lsa, not by every flush */
+      tsc_getticks (&wait_start_tick);
+      LSA_COPY (&waiter.flush_lsa, flush_lsa);
+      waiter.is_woken = false;
+      waiter.next = NULL;
+      (void) pthread_cond_init (&waiter.cond, NULL);
+
       while (LSA_LT (&nxio_lsa, flush_lsa))
 	{
 	  gettimeofday (&start_time, NULL);
@@ -3866,20 +4248,102 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	      break;
 	    }
 
+	  waiter.is_woken = false;
+	  waiter.next = group_commit_info->waiters;
+	  group_commit_info->waiters = &waiter;
+
 	  if (need_wakeup_LFT == true)
 	    {
 	      log_wakeup_log_flush_daemon ();
 	    }
-	  (void) pthread_cond_timedwait (&group_commit_info->gc_cond, &group_commit_info->gc_mutex, &to);
+	  (void) pthread_cond_timedwait (&waiter.cond, &group_commit_info->gc_mutex, &to);
+
+	  if (!waiter.is_woken)
+	    {
+	      /* timed out; still in list */
+	      for (waiter_p = &group_commit_info->waiters; *waiter_p != NULL; waiter_p = &(*waiter_p)->next)
+		{
+		  if (*waiter_p == &waiter)
+		    {
+		      *waiter_p = waiter.next;
+		      break;
+		    }
+		}
+	    }
 	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
 
 	  need_wakeup_LFT = true;
 	  nxio_lsa = log_Gl.append.get_nxio_lsa ();
 	}
+
+      (void) pthread_cond_destroy (&waiter.cond);
+
+      tsc_getticks (&wait_end_tick);
+      perfmon_log_commit_wait (thread_p, tsc_elapsed_utime (wait_end_tick, wait_start_tick));
     }
 #endif /* SERVER_MODE */
 }
 
+/*
+ * logpb_wakeup_commit_waiters - wake transactions waiting for log flushed so far
+ *
+ * return: nothing
+ *
+ * NOTE: Only the waiters whose commit is covered by next I/O address are woken; the others keep waiting for a next
+ *       flush.
+ */
+void
+logpb_wakeup_commit_waiters (void)
+{
+#if defined (SERVER_MODE)
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_COMMIT_WAITER **waiter_p;
+  LOG_COMMIT_WAITER *waiter;
+  LOG_LSA nxio_lsa;
+  int rv;
+
+  /* waiters list is tested under mutex; a waiter enqueued concurrently is either seen here or finds its flush_lsa
+   * already covered by nxio_lsa before it waits */
+  rv = pthread_mutex_lock (&group_commit_info->gc_mutex);
+  if (group_commit_info->waiters == NULL)
+    {
+      pthread_mutex_unlock (&group_commit_info->gc_mutex);
+      return;
+    }
+
+  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+
+  waiter_p = &group_commit_info->waiters;
+  while (*waiter_p != NULL)
+    {
+      waiter = *waiter_p;
+      if (LSA_LE (&waiter->flush_lsa, &nxio_lsa))
+	{
+	  *waiter_p = waiter->next;
+	  waiter->next = NULL;
+	  waiter->is_woken = true;
+	  pthread_cond_signal (&waiter->cond);
+	}
+      else
+	{
+	  waiter_p = &waiter->next;
+	}
+    }
+  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+#endif /* SERVER_MODE */
+}
+
+/*
+ * logpb_has_commit_waiters - are there transactions waiting for their commit to be flushed?
+ *
+ * return: true if there are waiters. the answer is not protected and can be used as a hint only.
+ */
+bool
+logpb_has_commit_waiters (void)
+{
+  return log_Gl.group_commit_info.waiters != NULL;
+}
+
 void
 logpb_force_flush_pages (THREAD_ENTRY * thread_p)
 {
@@ -55,12 +55,24 @@
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				LOG_RCVINDEX rcvindex, const VPID * rcv_vpid, LOG_RCV * rcv,
 				const LOG_LSA * rcv_lsa_ptr, LOG_TDES * tdes, LOG_ZIP * undo_unzip_ptr);
 static void log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
 				LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static void log_rv_read_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+				   int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area_p);
+static bool log_rv_read_raw_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+				       LOG_RCV * rcv, char **area_p);
+static void log_rv_unzip_redo_data (THREAD_ENTRY * thread_p, LOG_RCV * rcv, int undo_length, const char *undo_data,
+				    LOG_ZIP * redo_unzip_ptr);
+static void log_rv_redo_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *),
+			       LOG_RCV * rcv, const LOG_LSA * rcv_lsa_ptr);
 static bool log_rv_find_checkpoint (THREAD_ENTRY * thread_p, VOLID volid, LOG_LSA * rcv_lsa);
 static bool log_rv_get_unzip_log_data (THREAD_ENTRY * thread_p, int length, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				       LOG_ZIP * undo_unzip_ptr);
@@ -434,17 +446,75 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
 		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
 {
   char *area = NULL;
-  bool is_zip = false;
-  int error_code;
 
   /* Note the the data page rcv->pgptr has been fetched by the caller */
 
+  log_rv_read_redo_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr, &area);
+
+  log_rv_redo_apply (thread_p, redofun, rcv, rcv_lsa_ptr);
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+}
+
+/*
+ * log_rv_read_redo_data - get the redo data of a log record
+ *
+ * return: nothing
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   rcv(in/out): Recovery structure; data and length are set
+ *   undo_length(in): length of undo data if redo data is a diff of undo data
+ *   undo_data(in): undo data if redo data is a diff of undo data
+ *   redo_unzip_ptr(in): buffer to unzip the redo data
+ *   area_p(out): area allocated when the data is not contained in one log page; caller must free it
+ *
+ * NOTE: rcv->data may point to the log page, to the unzip buffer or to *area_p. It is valid until any of them is
+ *       changed.
+ */
+static void
+log_rv_read_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+		       int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, char **area_p)
+{
+  bool is_zip;
+
+  is_zip = log_rv_read_raw_redo_data (thread_p, log_lsa, log_page_p, rcv, area_p);
+  if (is_zip)
+    {
+      log_rv_unzip_redo_data (thread_p, rcv, undo_length, undo_data, redo_unzip_ptr);
+    }
+}
+
+/*
+ * log_rv_read_raw_redo_data - get the redo data of a log record as it is logged
+ *
+ * return: true if the data is zipped
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *               effect to the page where data ends)
+ *   rcv(in/out): Recovery structure; data and length (of zipped data, if zipped) are set
+ *   area_p(out): area allocated when the data is not contained in one log page; caller must free it
+ */
+static bool
+log_rv_read_raw_redo_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+			   char **area_p)
+{
+  char *area = NULL;
+  bool is_zip = false;
+
   /*
    * If data is contained in only one buffer, pass pointer directly.
    * Otherwise, allocate a contiguous area, copy the data and pass this area.
    * At the end deallocate the area.
    */
 
+  *area_p = NULL;
+
   if (ZIP_CHECK (rcv->length))
     {
       rcv->length = (int) GET_ZIP_LEN (rcv->length);
@@ -462,34 +532,65 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
       if (area == NULL)
 	{
 	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
-	  return;
+	  return false;
 	}
       /* Copy the data */
       logpb_copy_from_log (thread_p, area, rcv->length, log_lsa, log_page_p);
       rcv->data = area;
+      *area_p = area;
     }
 
-  if (is_zip)
+  return is_zip;
+}
+
+/*
+ * log_rv_unzip_redo_data - unzip redo data and, if it is a diff of undo data, restore it
+ *
+ * return: nothing
+ *
+ *   rcv(in/out): Recovery structure with zipped data; data and length are set to unzipped data
+ *   undo_length(in): length of undo data if redo data is a diff of undo data
+ *   undo_data(in): undo data if redo data is a diff of undo data
+ *   redo_unzip_ptr(in): buffer to unzip the redo data
+ */
+static void
+log_rv_unzip_redo_data (THREAD_ENTRY * thread_p, LOG_RCV * rcv, int undo_length, const char *undo_data,
+			LOG_ZIP * redo_unzip_ptr)
+{
+  if (log_unzip (redo_unzip_ptr, rcv->length, (char *) rcv->data))
     {
-      if (log_unzip (redo_unzip_ptr, rcv->length, (char *) rcv->data))
+      if ((undo_length > 0) && (undo_data != NULL))
 	{
-	  if ((undo_length > 0) && (undo_data != NULL))
-	    {
-	      (void) log_diff (undo_length, undo_data, redo_unzip_ptr->data_length, redo_unzip_ptr->log_data);
-	      rcv->length = (int) redo_unzip_ptr->data_length;
-	      rcv->data = (char *) redo_unzip_ptr->log_data;
-	    }
-	  else
-	    {
-	      rcv->length = (int) redo_unzip_ptr->data_length;
-	      rcv->data = (char *) redo_unzip_ptr->log_data;
-	    }
+	  (void) log_diff (undo_length, undo_data, redo_unzip_ptr->data_length, redo_unzip_ptr->log_data);
+	  rcv->length = (int) redo_unzip_ptr->data_length;
+	  rcv->data = (char *) redo_unzip_ptr->log_data;
 	}
       else
 	{
-	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
+	  rcv->length = (int) redo_unzip_ptr->data_length;
+	  rcv->data = (char *) redo_unzip_ptr->log_data;
 	}
     }
+  else
+    {
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
+    }
+}
+
+/*
+ * log_rv_redo_apply - apply redo data to data page and set page LSA
+ *
+ * return: nothing
+ *
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in): Recovery structure with data page (can be NULL) and redo data
+ *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
+ */
+static void
+log_rv_redo_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
+		   const LOG_LSA * rcv_lsa_ptr)
+{
+  int error_code;
 
   if (redofun != NULL)
     {
@@ -525,11 +626,6 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     {
       (void) pgbuf_set_lsa (thread_p, rcv->pgptr, rcv_lsa_ptr);
     }
-
-  if (area != NULL)
-    {
-      free_and_init (area);
-    }
 }
 
 /*
@@ -728,8 +824,11 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
    */
 
   log_Gl.rcv_phase = LOG_RECOVERY_ANALYSIS_PHASE;
+  logpb_read_ahead_reset (true);
   log_recovery_analysis (thread_p, &rcv_lsa, &start_redolsa, &end_redo_lsa, ismedia_crash, stopat, &did_incom_recovery,
 			 &num_redo_log_records);
+  /* log is appended from now on */
+  logpb_read_ahead_reset (false);
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_STARTED, 3, num_redo_log_records,
 	  start_redolsa.pageid, end_redo_lsa.pageid);
@@ -3002,6 +3101,401 @@ log_recovery_needs_skip_logical_redo (THREAD_ENTRY * thread_p, TRANID tran_id, L
   return false;
 }
 
+/*
+ * Parallel redo
+ *
+ * The recovery thread reads the log and dispatches redo records of data pages to redo workers. Records are dispatched
+ * by page identifier, so all records of a page are applied by the same worker, in log order. Records not bound to one
+ * page or changing data shared by many pages (disk manager, vacuum) are applied by the recovery thread, after all the
+ * records dispatched before them were applied.
+ *
+ * Reading the log, unzipping redo data, fixing data pages (and reading them from disk) and applying redo are thus
+ * overlapped; the workers fix their pages concurrently, so several data page reads are in flight at any time. Zipped
+ * redo data is dispatched as it is logged and is unzipped by the worker.
+ *
+ * There are no workers in stand-alone mode.
+ */
+
+#define LOG_RV_REDO_QUEUE_MAX_JOBS 1024	/* recovery thread waits for worker when its queue is full */
+
+typedef struct log_rv_redo_job LOG_RV_REDO_JOB;
+struct log_rv_redo_job
+{
+  LOG_LSA rcv_lsa;		/* address of log record */
+  VPID vpid;			/* data page */
+  LOG_RCVINDEX rcvindex;
+  int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
+  MVCCID mvcc_id;
+  PGLENGTH offset;
+  int length;			/* length of redo data, which follows the job */
+  bool is_zip;			/* redo data is zipped */
+  int undo_length;		/* length of undo data, which follows redo data, if zipped redo data is a diff of undo */
+};
+
+static void log_rv_redo_job_execute (THREAD_ENTRY * thread_p, LOG_RV_REDO_JOB * job, LOG_ZIP * redo_unzip_ptr);
+
+// *INDENT-OFF*
+class log_rv_redo_parallel
+{
+  public:
+    log_rv_redo_parallel (std::size_t worker_count);
+    ~log_rv_redo_parallel ();
+
+    bool start ();
+    void dispatch (LOG_RV_REDO_JOB *job);
+    void wait_for_idle ();
+    void stop ();
+
+  private:
+    struct redo_queue
+    {
+      std::mutex m_mutex;
+      std::condition_variable m_job_cv;		// worker waits for jobs
+      std::condition_variable m_idle_cv;	// recovery thread waits for room or for worker to be idle
+      std::deque<LOG_RV_REDO_JOB *> m_jobs;
+      bool m_is_busy = false;			// worker is applying a job
+      bool m_is_waited = false;			// recovery thread waits on m_idle_cv
+      bool m_stop = false;
+    };
+
+    class redo_task : public cubthread::entry_task
+    {
+      public:
+	redo_task (redo_queue &queue)
+	  : m_queue (queue)
+	{
+	}
+
+	void execute (cubthread::entry &thread_ref) override;
+
+      private:
+	redo_queue &m_queue;
+    };
+
+    std::size_t m_worker_count;
+    redo_queue *m_queues;
+    cubthread::entry_workpool *m_worker_pool;
+};
+
+log_rv_redo_parallel::log_rv_redo_parallel (std::size_t worker_count)
+  : m_worker_count (worker_count)
+  , m_queues (new redo_queue[worker_count])
+  , m_worker_pool (NULL)
+{
+}
+
+log_rv_redo_parallel::~log_rv_redo_parallel ()
+{
+  assert (m_worker_pool == NULL);
+  delete [] m_queues;
+}
+
+//
+// start - create workers. returns false if they cannot be created; then all records are redone by recovery thread.
+//
+bool
+log_rv_redo_parallel::start ()
+{
+  m_worker_pool = cubthread::get_manager ()->create_worker_pool (m_worker_count, m_worker_count, "log_redo_workers",
+								   NULL, 1, false);
+  if (m_worker_pool == NULL)
+    {
+      return false;
+    }
+
+  for (std::size_t i = 0; i < m_worker_count; i++)
+    {
+      cubthread::get_manager ()->push_task (m_worker_pool, new redo_task (m_queues[i]));
+    }
+  return true;
+}
+
+//
+// dispatch - give job to the worker of its page. job is freed by worker.
+//
+void
+log_rv_redo_parallel::dispatch (LOG_RV_REDO_JOB *job)
+{
+  redo_queue &queue = m_queues[(job->vpid.volid * 31 + job->vpid.pageid) % m_worker_count];
+  std::unique_lock<std::mutex> ulock (queue.m_mutex);
+
+  if (queue.m_jobs.size () >= LOG_RV_REDO_QUEUE_MAX_JOBS)
+    {
+      queue.m_is_waited = true;
+      queue.m_idle_cv.wait (ulock, [&queue] { return queue.m_jobs.size () < LOG_RV_REDO_QUEUE_MAX_JOBS / 2; });
+      queue.m_is_waited = false;
+    }
+
+  queue.m_jobs.push_back (job);
+  if (queue.m_jobs.size () == 1)
+    {
+      queue.m_job_cv.notify_one ();
+    }
+}
+
+//
+// wait_for_idle - wait until all dispatched jobs are applied
+//
+void
+log_rv_redo_parallel::wait_for_idle ()
+{
+  for (std::size_t i = 0; i < m_worker_count; i++)
+    {
+      redo_queue &queue = m_queues[i];
+      std::unique_lock<std::mutex> ulock (queue.m_mutex);
+
+      queue.m_is_waited = true;
+      queue.m_idle_cv.wait (ulock, [&queue] { return queue.m_jobs.empty () && !queue.m_is_busy; });
+      queue.m_is_waited = false;
+    }
+}
+
+//
+// stop - apply all dispatched jobs and destroy workers
+//
+void
+log_rv_redo_parallel::stop ()
+{
+  for (std::size_t i = 0; i < m_worker_count; i++)
+    {
+      std::unique_lock<std::mutex> ulock (m_queues[i].m_mutex);
+      m_queues[i].m_stop = true;
+      m_queues[i].m_job_cv.notify_one ();
+    }
+  wait_for_idle ();
+
+  cubthread::get_manager ()->destroy_worker_pool (m_worker_pool);
+}
+
+void
+log_rv_redo_parallel::redo_task::execute (cubthread::entry &thread_ref)
+{
+  LOG_RV_REDO_JOB *job;
+  LOG_ZIP *redo_unzip_ptr;
+  std::unique_lock<std::mutex> ulock (m_queue.m_mutex);
+
+  thread_ref.tran_index = LOG_SYSTEM_TRAN_INDEX;
+
+  redo_unzip_ptr = log_zip_alloc (LOGAREA_SIZE, false);
+  if (redo_unzip_ptr == NULL)
+    {
+      logpb_fatal_error (&thread_ref, true, ARG_FILE_LINE, "log_rv_redo_parallel::redo_task::execute");
+      return;
+    }
+
+  while (true)
+    {
+      m_queue.m_job_cv.wait (ulock, [this] { return !m_queue.m_jobs.empty () || m_queue.m_stop; });
+      if (m_queue.m_jobs.empty ())
+	{
+	  // stopped
+	  break;
+	}
+
+      job = m_queue.m_jobs.front ();
+      m_queue.m_jobs.pop_front ();
+      m_queue.m_is_busy = true;
+      ulock.unlock ();
+
+      log_rv_redo_job_execute (&thread_ref, job, redo_unzip_ptr);
+      free (job);
+
+      ulock.lock ();
+      m_queue.m_is_busy = false;
+      if (m_queue.m_is_waited)
+	{
+	  m_queue.m_idle_cv.notify_one ();
+	}
+    }
+
+  log_zip_free (redo_unzip_ptr);
+  thread_ref.tran_index = NULL_TRAN_INDEX;
+}
+// *INDENT-ON*
+
+/*
+ * log_rv_redo_parallel_start () - start redo workers, if parallel redo is enabled
+ *
+ * return        : parallel redo or NULL if records are redone by recovery thread
+ */
+static log_rv_redo_parallel *
+log_rv_redo_parallel_start (void)
+{
+#if defined (SERVER_MODE)
+  int worker_count = prm_get_integer_value (PRM_ID_RECOVERY_REDO_WORKERS);
+  log_rv_redo_parallel *redo_parallel;
+
+  if (worker_count <= 0)
+    {
+      return NULL;
+    }
+
+  redo_parallel = new log_rv_redo_parallel (worker_count);
+  if (!redo_parallel->start ())
+    {
+      /* no entries for workers */
+      delete redo_parallel;
+      return NULL;
+    }
+  return redo_parallel;
+#else /* !SERVER_MODE */
+  return NULL;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * log_rv_redo_parallel_stop () - apply all dispatched records and stop redo workers
+ *
+ * return             : void
+ * redo_parallel (in) : parallel redo
+ */
+static void
+log_rv_redo_parallel_stop (log_rv_redo_parallel * redo_parallel)
+{
+  redo_parallel->stop ();
+  delete redo_parallel;
+}
+
+/*
+ * log_rv_redo_is_dispatched () - check whether a redo record of data page is dispatched to redo workers
+ *
+ * return             : true if record is to be dispatched; false if it is to be redone by recovery thread
+ * redo_parallel (in) : parallel redo or NULL
+ * vpid (in)          : data page of log record
+ * rcvindex (in)      : recovery index of log record
+ *
+ * note: when false is returned, all records dispatched so far are already applied.
+ */
+static bool
+log_rv_redo_is_dispatched (log_rv_redo_parallel * redo_parallel, const VPID * vpid, LOG_RCVINDEX rcvindex)
+{
+  if (redo_parallel == NULL)
+    {
+      return false;
+    }
+
+  if (vpid->pageid != NULL_PAGEID && vpid->volid != NULL_VOLID
+      /* disk manager records change volumes and sector tables, which are checked when other pages are fixed */
+      && !(rcvindex >= RVDK_NEWVOL && rcvindex <= RVDK_VOLHEAD_EXPAND)
+      /* vacuum records may change vacuum data kept in memory; vacuum of heap pages is like any page change */
+      && !(rcvindex >= RVVAC_COMPLETE && rcvindex <= RVVAC_DROPPED_FILE_REPLACE) && rcvindex != RVES_NOTIFY_VACUUM)
+    {
+      return true;
+    }
+
+  /* redo in order with all dispatched records */
+  redo_parallel->wait_for_idle ();
+  return false;
+}
+
+/*
+ * log_rv_redo_dispatch () - read redo data and dispatch the record to its redo worker
+ *
+ * return             : void
+ * thread_p (in)      : thread entry
+ * redo_parallel (in) : parallel redo
+ * log_lsa (in/out)   : address of redo data; set to the end of data
+ * log_page_p (in/out): log page of redo data; set to the page where data ends
+ * redofun (in)       : function to redo data
+ * rcv (in)           : recovery structure with data offset, length and MVCCID
+ * rcv_lsa (in)       : address of log record
+ * vpid (in)          : data page
+ * rcvindex (in)      : recovery index
+ * undo_length (in)   : length of undo data if redo data is a diff of undo data
+ * undo_data (in)     : undo data if redo data is a diff of undo data
+ */
+static void
+log_rv_redo_dispatch (THREAD_ENTRY * thread_p, log_rv_redo_parallel * redo_parallel, LOG_LSA * log_lsa,
+		      LOG_PAGE * log_page_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
+		      const LOG_LSA * rcv_lsa, const VPID * vpid, LOG_RCVINDEX rcvindex, int undo_length,
+		      char *undo_data)
+{
+  LOG_RV_REDO_JOB *job;
+  char *area = NULL;
+  bool is_zip;
+
+  /* the data may be in log page or area; they are both reused, so data is copied with the job. zipped data is unzipped
+   * by the worker. */
+  is_zip = log_rv_read_raw_redo_data (thread_p, log_lsa, log_page_p, rcv, &area);
+  if (!is_zip || undo_data == NULL)
+    {
+      undo_length = 0;
+    }
+
+  job = (LOG_RV_REDO_JOB *) malloc (sizeof (LOG_RV_REDO_JOB) + MAX (rcv->length, 0) + MAX (undo_length, 0));
+  if (job == NULL)
+    {
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_redo_dispatch");
+      return;
+    }
+  job->rcv_lsa = *rcv_lsa;
+  job->vpid = *vpid;
+  job->rcvindex = rcvindex;
+  job->redofun = redofun;
+  job->mvcc_id = rcv->mvcc_id;
+  job->offset = rcv->offset;
+  job->length = rcv->length;
+  job->is_zip = is_zip;
+  job->undo_length = MAX (undo_length, 0);
+  if (rcv->length > 0)
+    {
+      memcpy ((char *) (job + 1), rcv->data, rcv->length);
+    }
+  if (job->undo_length > 0)
+    {
+      memcpy ((char *) (job + 1) + MAX (rcv->length, 0), undo_data, job->undo_length);
+    }
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+
+  redo_parallel->dispatch (job);
+}
+
+/*
+ * log_rv_redo_job_execute () - redo a record dispatched to a redo worker
+ *
+ * return        : void
+ * thread_p (in)       : redo worker thread entry
+ * job (in)             : dispatched record
+ * redo_unzip_ptr (in)  : worker's buffer to unzip redo data
+ */
+static void
+log_rv_redo_job_execute (THREAD_ENTRY * thread_p, LOG_RV_REDO_JOB * job, LOG_ZIP * redo_unzip_ptr)
+{
+  LOG_RCV rcv;
+
+  rcv.pgptr = log_rv_redo_fix_page (thread_p, &job->vpid, job->rcvindex);
+  if (rcv.pgptr == NULL)
+    {
+      /* deallocated */
+      return;
+    }
+
+  if (LSA_LE (&job->rcv_lsa, pgbuf_get_lsa (rcv.pgptr)))
+    {
+      /* It is already done */
+      pgbuf_unfix (thread_p, rcv.pgptr);
+      return;
+    }
+
+  rcv.mvcc_id = job->mvcc_id;
+  rcv.offset = job->offset;
+  rcv.length = job->length;
+  rcv.data = (char *) (job + 1);
+  if (job->is_zip)
+    {
+      log_rv_unzip_redo_data (thread_p, &rcv, job->undo_length, (char *) (job + 1) + MAX (job->length, 0),
+			      redo_unzip_ptr);
+    }
+
+  log_rv_redo_apply (thread_p, job->redofun, &rcv, &job->rcv_lsa);
+
+  pgbuf_unfix (thread_p, rcv.pgptr);
+}
+
 /*
  * log_recovery_redo - SCAN FORWARD REDOING DATA
  *
@@ -3072,6 +3566,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_ZIP *redo_unzip_ptr = NULL;
   bool is_diff_rec;
   bool is_mvcc_op = false;
+  bool is_dispatched = false;
+  log_rv_redo_parallel *redo_parallel = NULL;
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -3113,6 +3609,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+  redo_parallel = log_rv_redo_parallel_start ();
+
   while (!LSA_ISNULL (&lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -3285,8 +3783,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = undoredo->data.rcvindex;
+	      is_dispatched = log_rv_redo_is_dispatched (redo_parallel, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3395,7 +3894,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      if (is_diff_rec)
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, redo_parallel, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv,
+					&rcv_lsa, &rcv_vpid, rcvindex,
+					is_diff_rec ? (int) undo_unzip_ptr->data_length : 0,
+					is_diff_rec ? (char *) undo_unzip_ptr->log_data : NULL);
+		}
+	      else if (is_diff_rec)
 		{
 		  /* XOR Process */
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa,
@@ -3471,8 +3977,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = redo->data.rcvindex;
+	      is_dispatched = log_rv_redo_is_dispatched (redo_parallel, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3528,6 +4035,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, redo_parallel, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv,
+					&rcv_lsa, &rcv_vpid, rcvindex, 0, NULL);
+		  break;
+		}
+
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				  redo_unzip_ptr);
 
@@ -3565,6 +4079,10 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      /* not bound to a page; redone by this thread */
+	      is_dispatched = log_rv_redo_is_dispatched (redo_parallel, &rcv_vpid, rcvindex);
+	      assert (!is_dispatched);
+
 	      if (!log_recovery_needs_skip_logical_redo (thread_p, tran_id, log_rtype, rcvindex, &rcv_lsa))
 		{
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
@@ -3593,8 +4111,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = run_posp->data.rcvindex;
+	      is_dispatched = log_rv_redo_is_dispatched (redo_parallel, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3651,6 +4170,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, redo_parallel, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv,
+					&rcv_lsa, &rcv_vpid, rcvindex, 0, NULL);
+		  break;
+		}
+
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				  NULL);
 
@@ -3680,8 +4206,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = compensate->data.rcvindex;
+	      is_dispatched = log_rv_redo_is_dispatched (redo_parallel, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3737,11 +4264,19 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
-	      if (rcv.pgptr != NULL)
+	      if (is_dispatched)
 		{
-		  pgbuf_unfix (thread_p, rcv.pgptr);
+		  log_rv_redo_dispatch (thread_p, redo_parallel, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv,
+					&rcv_lsa, &rcv_vpid, rcvindex, 0, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0,
+				      NULL, NULL);
+		  if (rcv.pgptr != NULL)
+		    {
+		      pgbuf_unfix (thread_p, rcv.pgptr);
+		    }
 		}
 	      if (prm_get_bool_value (PRM_ID_LOG_BTREE_OPS) && rcvindex == RVBT_RECORD_MODIFY_COMPENSATE)
 		{
@@ -4031,6 +4566,13 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	}
     }
 
+  if (redo_parallel != NULL)
+    {
+      /* wait for all records to be redone */
+      log_rv_redo_parallel_stop (redo_parallel);
+      redo_parallel = NULL;
+    }
+
   log_zip_free (undo_unzip_ptr);
   log_zip_free (redo_unzip_ptr);
 
@@ -4049,6 +4591,10 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   (void) pgbuf_flush_all (thread_p, NULL_VOLID);
 
 exit:
+  if (redo_parallel != NULL)
+    {
+      log_rv_redo_parallel_stop (redo_parallel);
+    }
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
   return;
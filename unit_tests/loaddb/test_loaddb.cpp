@@ -21,12 +21,22 @@
  * test_loaddb.cpp - implementation for loaddb parse tests
  */
 
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
 #include <sstream>
+#include <string>
 #include <thread>
+#include <vector>
 
+#include "dbtype.h"
 #include "language_support.h"
+#include "load_db_value_converter.hpp"
 #include "load_driver.hpp"
+#include "object_primitive.h"
+#include "porting.h"
 #include "test_loaddb.hpp"
+#include "test_perf_compare.hpp"
 
 namespace test_loaddb
 {
@@ -89,4 +99,271 @@ namespace test_loaddb
 	threads[i].join ();
       }
   }
+
+  struct int_case
+  {
+    DB_TYPE type;
+    const char *token;
+    int expected_error;
+    std::int64_t expected_value;
+  };
+
+  static std::int64_t
+  get_int_value (DB_TYPE type, db_value &val)
+  {
+    switch (type)
+      {
+      case DB_TYPE_SHORT:
+	return db_get_short (&val);
+      case DB_TYPE_INTEGER:
+	return db_get_int (&val);
+      default:
+	return db_get_bigint (&val);
+      }
+  }
+
+  static int
+  test_int_converters ()
+  {
+    // overflow, the 18/19/20 character boundaries between the fast path and the generic conversion, signs and
+    // malformed tokens
+    const int_case cases[] =
+    {
+      { DB_TYPE_SHORT, "32767", NO_ERROR, 32767 },
+      { DB_TYPE_SHORT, "-32768", NO_ERROR, -32768 },
+      { DB_TYPE_SHORT, "+123", NO_ERROR, 123 },
+      { DB_TYPE_SHORT, "32768", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_SHORT, "-32769", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_SHORT, "999999999999999999", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_SHORT, "", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_SHORT, "abc", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_SHORT, "abcdefg", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_SHORT, "12a", ER_IT_DATA_OVERFLOW, 0 },
+
+      { DB_TYPE_INTEGER, "2147483647", NO_ERROR, 2147483647LL },
+      { DB_TYPE_INTEGER, "-2147483648", NO_ERROR, -2147483648LL },
+      { DB_TYPE_INTEGER, "+2147483647", NO_ERROR, 2147483647LL },
+      { DB_TYPE_INTEGER, "0000000042", NO_ERROR, 42 },
+      { DB_TYPE_INTEGER, "2147483648", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "-2147483649", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "9999999999", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "-999999999999999999", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "-", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "+", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "1-2", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_INTEGER, "12345678x", ER_IT_DATA_OVERFLOW, 0 },
+
+      { DB_TYPE_BIGINT, "0", NO_ERROR, 0 },
+      { DB_TYPE_BIGINT, "-0", NO_ERROR, 0 },
+      { DB_TYPE_BIGINT, "+7", NO_ERROR, 7 },
+      { DB_TYPE_BIGINT, "12345678", NO_ERROR, 12345678LL },
+      { DB_TYPE_BIGINT, "123456789", NO_ERROR, 123456789LL },
+      { DB_TYPE_BIGINT, "999999999999999999", NO_ERROR, 999999999999999999LL },
+      { DB_TYPE_BIGINT, "-999999999999999999", NO_ERROR, -999999999999999999LL },
+      { DB_TYPE_BIGINT, "+999999999999999999", NO_ERROR, 999999999999999999LL },
+      { DB_TYPE_BIGINT, "1000000000000000000", NO_ERROR, 1000000000000000000LL },
+      { DB_TYPE_BIGINT, "-1000000000000000000", NO_ERROR, -1000000000000000000LL },
+      { DB_TYPE_BIGINT, "9223372036854775807", NO_ERROR, INT64_MAX },
+      { DB_TYPE_BIGINT, "-9223372036854775807", NO_ERROR, -INT64_MAX },
+      { DB_TYPE_BIGINT, "-9223372036854775808", NO_ERROR, INT64_MIN },
+      { DB_TYPE_BIGINT, "9223372036854775808", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "9999999999999999999", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "-9223372036854775809", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "18446744073709551616", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "-", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "1234567a", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "12345678901234567a", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "12345:78", ER_IT_DATA_OVERFLOW, 0 },
+      { DB_TYPE_BIGINT, "12345/78", ER_IT_DATA_OVERFLOW, 0 },
+    };
+    int failures = 0;
+
+    for (const int_case &c : cases)
+      {
+	std::string token (c.token);
+	db_value val;
+	int error = cubload::get_conv_func (cubload::LDR_INT, c.type) (token.c_str (), token.size (), NULL, &val);
+
+	if (error != c.expected_error || (error == NO_ERROR && get_int_value (c.type, val) != c.expected_value))
+	  {
+	    std::cout << "  converting '" << c.token << "' to " << pr_type_name (c.type) << " returned error " << error;
+	    if (error == NO_ERROR)
+	      {
+		std::cout << " and value " << get_int_value (c.type, val);
+	      }
+	    std::cout << ", expected error " << c.expected_error << " and value " << c.expected_value << std::endl;
+	    failures++;
+	  }
+      }
+
+    return failures;
+  }
+
+  static int
+  test_ascii_check ()
+  {
+    // a non-ASCII byte must be found at any position, both in the eight byte chunks and in the tail
+    const unsigned char high_bytes[] = { 0x80, 0xc3, 0xff };
+    const size_t max_length = 24;
+    int failures = 0;
+
+    for (size_t length = 0; length <= max_length; length++)
+      {
+	std::string str (length, 'a');
+
+	if (!cubload::is_ascii_string (str.c_str (), str.size ()))
+	  {
+	    std::cout << "  ASCII string of length " << length << " is reported as non-ASCII" << std::endl;
+	    failures++;
+	  }
+	for (size_t pos = 0; pos < length; pos++)
+	  {
+	    for (unsigned char high_byte : high_bytes)
+	      {
+		str[pos] = (char) high_byte;
+		if (cubload::is_ascii_string (str.c_str (), str.size ()))
+		  {
+		    std::cout << "  byte " << (int) high_byte << " at " << pos << " in a string of length " << length
+			      << " is not found" << std::endl;
+		    failures++;
+		  }
+		// the byte only counts inside the given size
+		if (!cubload::is_ascii_string (str.c_str (), pos))
+		  {
+		    std::cout << "  byte " << (int) high_byte << " past the size " << pos << " is found" << std::endl;
+		    failures++;
+		  }
+		str[pos] = 'a';
+	      }
+	  }
+      }
+
+    // a multi-byte UTF-8 token, like the ones the string converters must not take the single byte path for
+    const std::string utf8 = "\xec\xbd\x94\xeb\x93\x9c-name";
+    if (cubload::is_ascii_string (utf8.c_str (), utf8.size ()))
+      {
+	std::cout << "  UTF-8 string is reported as ASCII" << std::endl;
+	failures++;
+      }
+
+    return failures;
+  }
+
+  int
+  test_converter ()
+  {
+    int failures = 0;
+
+    lang_init ();
+    lang_set_charset_lang ("en_US.utf8");
+
+    failures += test_int_converters ();
+    failures += test_ascii_check ();
+
+    if (failures != 0)
+      {
+	std::cout << "  " << failures << " converter checks failed" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
+  /*
+   * representative tokens of an unloaded table: integer keys and counters, dates and short ASCII strings with an
+   * occasional multi-byte one
+   */
+  static void
+  make_tokens (std::vector<std::string> &int_tokens, std::vector<std::string> &str_tokens, size_t token_count)
+  {
+    std::srand (0);
+    for (size_t i = 0; i < token_count; i++)
+      {
+	long long number = ((long long) std::rand () << 20) ^ std::rand ();
+
+	int_tokens.push_back (std::to_string ((i % 4 == 0) ? -number : number));
+	if (i % 16 == 0)
+	  {
+	    str_tokens.push_back ("\xec\xbd\x94\xeb\x93\x9c-" + std::to_string (i));
+	  }
+	else
+	  {
+	    str_tokens.push_back ("name_" + std::to_string (number) + "@example.com");
+	  }
+      }
+  }
+
+  int
+  test_converter_performance ()
+  {
+    const size_t token_count = 1000000;
+    const size_t FAST_PATH = 0, GENERIC = 1;
+    const size_t STEP_INT = 0, STEP_STRING = 1;
+    test_common::string_collection scenarios ("fast path", "generic");
+    test_common::string_collection steps ("integers", "char count");
+    test_common::perf_compare results (scenarios, steps);
+    test_common::us_timer timer;
+    std::vector<std::string> int_tokens;
+    std::vector<std::string> str_tokens;
+    long long fast_sum = 0, generic_sum = 0;
+    long long fast_chars = 0, generic_chars = 0;
+
+    lang_init ();
+    lang_set_charset_lang ("en_US.utf8");
+
+    make_tokens (int_tokens, str_tokens, token_count);
+
+    timer.reset ();
+    for (const std::string &token : int_tokens)
+      {
+	std::int64_t value = 0;
+
+	if (!cubload::parse_int64_digits (token.c_str (), token.size (), value))
+	  {
+	    (void) parse_bigint (&value, token.c_str (), 10);
+	  }
+	fast_sum += value;
+      }
+    results.register_time (timer, FAST_PATH, STEP_INT);
+
+    for (const std::string &token : int_tokens)
+      {
+	INT64 value = 0;
+
+	(void) parse_bigint (&value, token.c_str (), 10);
+	generic_sum += value;
+      }
+    results.register_time (timer, GENERIC, STEP_INT);
+
+    for (const std::string &token : str_tokens)
+      {
+	int char_count = (int) token.size ();
+
+	if (!cubload::is_ascii_string (token.c_str (), token.size ()))
+	  {
+	    intl_char_count ((unsigned char *) token.c_str (), (int) token.size (), INTL_CODESET_UTF8, &char_count);
+	  }
+	fast_chars += char_count;
+      }
+    results.register_time (timer, FAST_PATH, STEP_STRING);
+
+    for (const std::string &token : str_tokens)
+      {
+	int char_count = 0;
+
+	intl_char_count ((unsigned char *) token.c_str (), (int) token.size (), INTL_CODESET_UTF8, &char_count);
+	generic_chars += char_count;
+      }
+    results.register_time (timer, GENERIC, STEP_STRING);
+
+    results.print_results_and_warnings (std::cout);
+
+    if (fast_sum != generic_sum || fast_chars != generic_chars)
+      {
+	std::cout << "  converter fast path results differ from the generic conversion" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
 } // namespace test_loaddb
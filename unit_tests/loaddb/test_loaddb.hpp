@@ -28,6 +28,8 @@ namespace test_loaddb
 {
   void test_parse_with_multiple_threads ();
   void test_parse_reusing_driver ();
+  int test_converter ();
+  int test_converter_performance ();
 }; // namespace test_loaddb
 
 #endif //_TEST_LOADDB_PASRE_HPP_
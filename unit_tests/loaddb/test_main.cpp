@@ -19,11 +19,21 @@
 
 #include "test_loaddb.hpp"
 
+#include <string>
+
 int
-main (int, char **)
+main (int argc, char **argv)
 {
   //test_loaddb::test_parse_with_multiple_threads ();
   //test_loaddb::test_parse_reusing_driver ();
 
-  return 0;
+  int err = test_loaddb::test_converter ();
+
+  // the benchmark only reports timings; run it on request
+  if (argc >= 2 && std::string ("performance") == argv[1])
+    {
+      err = err | test_loaddb::test_converter_performance ();
+    }
+
+  return err;
 }
@@ -20,6 +20,7 @@
 #include "test_cqueue_functional.hpp"
 #include "test_freelist_functional.hpp"
 #include "test_hashmap.hpp"
+#include "test_stack.hpp"
 
 #include <string>
 #include <vector>
@@ -33,7 +34,8 @@ main (int argc, char **argv)
     "all",
     "cqueue",
     "freelist",
-    "hashmap"
+    "hashmap",
+    "stack"
   };
   if (argc >= 2)
     {
@@ -90,6 +92,19 @@ main (int argc, char **argv)
 	  err = err | test_lockfree::test_hashmap_performance ();
 	}
     }
+  if (opt == 0 || opt == 4)
+    {
+      bool do_performance = (opt == 0) || (argc == 2) || (argc >= 3 && std::string ("performance") == argv[2]);
+      bool do_functional = (opt == 0) || (argc == 2) || (argc >= 3 && std::string ("functional") == argv[2]);
+      if (do_functional)
+	{
+	  err = err | test_lockfree::test_stack_functional ();
+	}
+      if (do_performance)
+	{
+	  err = err | test_lockfree::test_stack_performance ();
+	}
+    }
 
   return err;
 }
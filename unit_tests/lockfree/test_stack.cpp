@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "test_stack.hpp"
+
+#include "test_output.hpp"
+#include "test_debug.hpp"
+
+#include "lockfree_stack.hpp"
+#include "lockfree_transaction_system.hpp"
+#include "string_buffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace lockfree;
+
+namespace test_lockfree
+{
+  using my_stack = stack<size_t>;
+  using my_stack_freelist = my_stack::freelist_type;
+
+  static int run_functional_test (size_t thread_count, size_t stack_count, size_t values_per_thread, size_t ops);
+  static int run_performance_test (size_t thread_count, size_t ops_per_thread, size_t use_loops);
+
+  int
+  test_stack_functional ()
+  {
+    test_common::sync_cout ("start test_stack_functional\n");
+
+    int err = run_functional_test (4, 1, 100, 10000);
+    err = err | run_functional_test (64, 1, 100, 10000);
+    err = err | run_functional_test (64, 16, 100, 10000);
+
+    if (err == 0)
+      {
+	test_common::sync_cout ("success test_stack_functional\n");
+      }
+    else
+      {
+	test_common::sync_cout ("failed test_stack_functional\n");
+      }
+    return err;
+  }
+
+  int
+  test_stack_performance ()
+  {
+    test_common::sync_cout ("start test_stack_performance\n");
+
+    int err = run_performance_test (4, 1000000, 10);
+    err = err | run_performance_test (16, 1000000, 10);
+    err = err | run_performance_test (64, 200000, 10);
+
+    test_common::sync_cout ("end test_stack_performance\n");
+    return err;
+  }
+
+  //
+  // functional: each thread pushes its own values and then randomly moves values between stacks; at the end, every
+  //             value must be found exactly once
+  //
+  static void
+  run_functional_job (my_stack_freelist &lffl, std::vector<my_stack> &stacks, size_t first_value,
+		      size_t value_count, size_t ops)
+  {
+    tran::index my_index = lffl.get_transaction_system ().assign_index ();
+    size_t value;
+
+    for (size_t i = 0; i < value_count; i++)
+      {
+	stacks[std::rand () % stacks.size ()].push (lffl, my_index, first_value + i);
+      }
+    while (ops-- > 0)
+      {
+	if (stacks[std::rand () % stacks.size ()].pop (lffl, my_index, value))
+	  {
+	    stacks[std::rand () % stacks.size ()].push (lffl, my_index, value);
+	  }
+      }
+
+    lffl.get_transaction_system ().free_index (my_index);
+  }
+
+  int
+  run_functional_test (size_t thread_count, size_t stack_count, size_t values_per_thread, size_t ops)
+  {
+    string_buffer desc_str;
+    desc_str ("run_functional_test: threads = %zu, stacks = %zu, values = %zu, ops = %zu\n", thread_count,
+	      stack_count, values_per_thread, ops);
+    test_common::sync_cout (desc_str.get_buffer ());
+
+    lockfree::tran::system l_lfsys { thread_count + 1 };
+    my_stack_freelist l_freelist { l_lfsys, 256, 1 };
+    std::vector<my_stack> l_stacks (stack_count);
+    std::vector<std::thread> l_threads;
+
+    for (size_t i = 0; i < thread_count; i++)
+      {
+	l_threads.emplace_back (run_functional_job, std::ref (l_freelist), std::ref (l_stacks), i * values_per_thread,
+				values_per_thread, ops);
+      }
+    for (auto &thr : l_threads)
+      {
+	thr.join ();
+      }
+
+    // check all values are found once
+    std::vector<bool> l_found (thread_count * values_per_thread, false);
+    tran::index my_index = l_lfsys.assign_index ();
+    size_t value;
+    for (auto &stk : l_stacks)
+      {
+	while (stk.pop (l_freelist, my_index, value))
+	  {
+	    test_common::custom_assert (value < l_found.size ());
+	    test_common::custom_assert (!l_found[value]);
+	    l_found[value] = true;
+	  }
+      }
+    l_lfsys.free_index (my_index);
+    for (bool found : l_found)
+      {
+	test_common::custom_assert (found);
+      }
+
+    return 0;
+  }
+
+  //
+  // performance: simulate concurrent executions of same cached plan; each execution takes a clone from the pool, or
+  //              creates a new clone if pool is empty, uses it and gives it back to pool
+  //
+  //              compares a lock-free stack pool with a mutex protected pool
+  //
+  static size_t
+  use_clone (size_t clone, size_t use_loops)
+  {
+    volatile size_t result = clone;
+    for (size_t i = 0; i < use_loops; i++)
+      {
+	result = result * 31 + i;
+      }
+    return result;
+  }
+
+  static void
+  run_mutex_pool_job (std::mutex &pool_mutex, std::vector<size_t> &pool, std::atomic<size_t> &clone_count,
+		      size_t ops, size_t use_loops)
+  {
+    size_t clone;
+    while (ops-- > 0)
+      {
+	pool_mutex.lock ();
+	if (pool.empty ())
+	  {
+	    pool_mutex.unlock ();
+	    clone = ++clone_count;
+	  }
+	else
+	  {
+	    clone = pool.back ();
+	    pool.pop_back ();
+	    pool_mutex.unlock ();
+	  }
+
+	(void) use_clone (clone, use_loops);
+
+	pool_mutex.lock ();
+	pool.push_back (clone);
+	pool_mutex.unlock ();
+      }
+  }
+
+  static void
+  run_stack_pool_job (my_stack_freelist &lffl, my_stack &pool, std::atomic<size_t> &clone_count, size_t ops,
+		      size_t use_loops)
+  {
+    tran::index my_index = lffl.get_transaction_system ().assign_index ();
+    size_t clone;
+    while (ops-- > 0)
+      {
+	if (!pool.pop (lffl, my_index, clone))
+	  {
+	    clone = ++clone_count;
+	  }
+
+	(void) use_clone (clone, use_loops);
+
+	pool.push (lffl, my_index, clone);
+      }
+    lffl.get_transaction_system ().free_index (my_index);
+  }
+
+  template <typename F>
+  static long long
+  run_timed_threads (size_t thread_count, F &&f)
+  {
+    std::vector<std::thread> l_threads;
+
+    auto start_time = std::chrono::high_resolution_clock::now ();
+    for (size_t i = 0; i < thread_count; i++)
+      {
+	l_threads.emplace_back (f);
+      }
+    for (auto &thr : l_threads)
+      {
+	thr.join ();
+      }
+    auto end_time = std::chrono::high_resolution_clock::now ();
+
+    return (long long) std::chrono::duration_cast<std::chrono::milliseconds> (end_time - start_time).count ();
+  }
+
+  int
+  run_performance_test (size_t thread_count, size_t ops_per_thread, size_t use_loops)
+  {
+    string_buffer desc_str;
+    long long mutex_msec;
+    long long stack_msec;
+
+    // mutex protected pool
+    std::mutex l_mutex;
+    std::vector<size_t> l_pool;
+    std::atomic<size_t> l_mutex_clone_count { 0 };
+    mutex_msec = run_timed_threads (thread_count, [&] ()
+    {
+      run_mutex_pool_job (l_mutex, l_pool, l_mutex_clone_count, ops_per_thread, use_loops);
+    });
+
+    // lock-free stack pool
+    lockfree::tran::system l_lfsys { thread_count + 1 };
+    my_stack_freelist l_freelist { l_lfsys, 256, 1 };
+    my_stack l_stack;
+    std::atomic<size_t> l_stack_clone_count { 0 };
+    stack_msec = run_timed_threads (thread_count, [&] ()
+    {
+      run_stack_pool_job (l_freelist, l_stack, l_stack_clone_count, ops_per_thread, use_loops);
+    });
+
+    // no clone should be lost
+    tran::index my_index = l_lfsys.assign_index ();
+    size_t clone;
+    size_t popped_count = 0;
+    while (l_stack.pop (l_freelist, my_index, clone))
+      {
+	popped_count++;
+      }
+    l_lfsys.free_index (my_index);
+    test_common::custom_assert (popped_count == l_stack_clone_count);
+    test_common::custom_assert (l_pool.size () == l_mutex_clone_count);
+
+    desc_str ("run_performance_test: threads = %zu, ops = %zu: mutex pool = %lld msec (%zu clones), "
+	      "lock-free stack pool = %lld msec (%zu clones)\n", thread_count, ops_per_thread, mutex_msec,
+	      l_mutex_clone_count.load (), stack_msec, l_stack_clone_count.load ());
+    test_common::sync_cout (desc_str.get_buffer ());
+
+    return 0;
+  }
+}